@@ -5,6 +5,7 @@
 
 #include "Macro.h"
 #include "Patch.h"
+#include "PatchTable.h"
 
 #ifdef PARTICLE
 #  include "Particle.h"
@@ -31,7 +32,9 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Description :  Data structure of the AMR implementation
 //
 // Data Member :  patch         : Pointers of all patches
+//                                --> Growable tables indexed as patch[Sg][lv][PID] (see PatchTable.h)
 //                num           : Number of patches (real patch + buffer patch) at each level
+//                NPatchMax     : Maximum num[lv] during the entire simulation (i.e., high-water mark)
 //                scale         : Grid scale at each level (grid size normalized to that at the finest level)
 //                FluSg         : Sandglass of the current fluid          data [0/1]
 //                MagSg         : Sandglass of the current magnetic field data [0/1]
@@ -66,18 +69,20 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                                    when to redistribute all patches (when LOAD_BALANCE is on)
 //                use_wave_flag : Flag that determines whether hybrid ELBDM scheme uses fluid or wave scheme at a given AMR level
 //
-// Method      :  AMR_t    : Constructor
-//               ~AMR_t    : Destructor
-//                pnew     : Allocate one patch
-//                pdelete  : Deallocate one patch
-//                Lvdelete : Deallocate all patches in the given level
+// Method      :  AMR_t         : Constructor
+//               ~AMR_t         : Destructor
+//                pnew          : Allocate one patch
+//                pdelete       : Deallocate one patch
+//                GroupFluid    : Return fluid[] of a patch group if it is contiguous
+//                GroupMagnetic : Return magnetic[] of a patch group if it is contiguous
+//                Lvdelete      : Deallocate all patches in the given level
 //-------------------------------------------------------------------------------------------------------
 struct AMR_t
 {
 
 // data members
 // ===================================================================================
-   patch_t    *patch[2][NLEVEL][MAX_PATCH];
+   PatchTable_t patch[2][NLEVEL];
 
 #  ifdef PARTICLE
    Particle_t *Par;
@@ -91,6 +96,7 @@ struct AMR_t
 #  endif
 
    int    num         [NLEVEL];
+   int    NPatchMax   [NLEVEL];
    int    scale       [NLEVEL];
    int    FluSg       [NLEVEL];
    double FluSgTime   [NLEVEL][2];
@@ -142,6 +148,7 @@ struct AMR_t
 #        ifdef GRAVITY
          PotSg[lv] = FluSg[lv];
 #        endif
+         NPatchMax[lv] = 0;
 
 //       initialized as arbitrary "negative" number to indicate that they have not been set yet
 //       --> these will be reset by Init_ResetParameter(), Init_ByRestart_*(), LB_Init_LoadBalance(), and EvolveLevel()
@@ -167,11 +174,6 @@ struct AMR_t
 #        endif // #if ( MODEL == ELBDM )
       }
 
-      for (int Sg=0; Sg<2; Sg++)
-      for (int lv=0; lv<NLEVEL; lv++)
-      for (int PID=0; PID<MAX_PATCH; PID++)
-         patch[Sg][lv][PID] = NULL;
-
       for (int lv=0; lv<NLEVEL; lv++)
       for (int m=0; m<28; m++)
          NPatchComma[lv][m] = 0;
@@ -209,6 +211,18 @@ struct AMR_t
       const bool ReusePatchMemory_No = false;
       for (int lv=0; lv<NLEVEL; lv++)  Lvdelete( lv, ReusePatchMemory_No );
 
+//    deallocate the inactive patches kept by OPT__REUSE_MEMORY
+      for (int Sg=0; Sg<2; Sg++)
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int PID=0; PID<patch[Sg][lv].Capacity(); PID++)
+      {
+         if ( patch[Sg][lv][PID] != NULL )
+         {
+            delete patch[Sg][lv][PID];
+            patch[Sg][lv][PID] = NULL;
+         }
+      }
+
 #     ifdef PARTICLE
       if ( Par != NULL )
       {
@@ -244,6 +258,10 @@ struct AMR_t
    // Note        :  1. Each patch contains two patch pointers --> SANDGLASS (Sg) = 0 / 1
    //                2. Sg = 0 : Store both data and relation (father,son.sibling,corner,flag,flux)
    //                   Sg = 1 : Store only data
+   //                3. fluid[], magnetic[], and pot[] of all patches in a patch group are allocated in a single
+   //                   block (patch_t::group_data[]) if the patch with LocalID == 0 is allocated with FluData
+   //                   --> Otherwise (e.g., the LOAD_BALANCE buffer patches allocating data on demand), they
+   //                       are allocated individually
    //
    // Parameter   :  lv          : Target refinement level
    //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
@@ -256,10 +274,13 @@ struct AMR_t
               const bool FluData, const bool MagData, const bool PotData )
    {
 
-      const int NewPID = num[lv];
+      const int NewPID  = num[lv];
+      const int LocalID = NewPID % 8;
+      const int PID0    = NewPID - LocalID;
 
-      if ( NewPID > MAX_PATCH-1 )
-         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
+//    grow the patch tables if necessary
+      patch[0][lv].Reserve( NewPID+1 );
+      patch[1][lv].Reserve( NewPID+1 );
 
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
@@ -270,9 +291,10 @@ struct AMR_t
             Aux_Error( ERROR_INFO, "conflicting patch allocation (Lv %d, PID %d, FaPID %d) !!\n", lv, NewPID, FaPID );
 #        endif
 
-         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+//       field arrays are allocated below after setting the group slots
+         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, false, false, false, FluData, lv,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
-         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, false, false, false,   false, lv,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
       }
 
@@ -293,14 +315,34 @@ struct AMR_t
 //       do NOT initialize field pointers as NULL since they may be allocated already
          const bool InitPtrAsNull_No = false;
 
-         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, false, false, false, FluData, lv,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
-         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, false, false, false,   false, lv,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
+//    allocate the field arrays of the entire patch group in a single block
+//    --> group_data[] is kept by the patch with LocalID == 0 and Sg == 0, which always exists here since
+//        patches are allocated group by group
+      if ( LocalID == 0  &&  FluData )    patch[0][lv][NewPID]->GroupNew();
+
+      for (int Sg=0; Sg<2; Sg++)
+      {
+         patch[Sg][lv][NewPID]->SetGroupSlot( patch[0][lv][PID0]->group_data, Sg, LocalID );
+
+         if ( FluData )    patch[Sg][lv][NewPID]->hnew();
+#        ifdef MHD
+         if ( MagData )    patch[Sg][lv][NewPID]->mnew();
+#        endif
+#        ifdef GRAVITY
+         if ( PotData )    patch[Sg][lv][NewPID]->gnew();
+#        endif
+      }
+
       num[lv] ++;
 
+      NPatchMax[lv] = MAX( NPatchMax[lv], num[lv] );
+
    } // METHOD : pnew
 
 
@@ -382,6 +424,64 @@ struct AMR_t
 
 
 
+   //===================================================================================
+   // Method      :  GroupFluid
+   // Description :  Return fluid[] of the entire patch group if it is stored contiguously in group_data[]
+   //
+   // Note        :  1. Return NULL if any patch in the patch group stores fluid[] outside group_data[]
+   //                   --> Caller must then access fluid[] patch by patch
+   //                2. fluid[] of the patch PID0+LocalID starts at the returned pointer + LocalID*NCOMP_TOTAL*CUBE(PS1)
+   //
+   // Parameter   :  Sg  : Target sandglass
+   //                lv  : Target refinement level
+   //                PID0: Patch index of the patch with LocalID == 0 in the target patch group
+   //===================================================================================
+   real *GroupFluid( const int Sg, const int lv, const int PID0 )
+   {
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const patch_t *Patch = patch[Sg][lv][ PID0 + LocalID ];
+
+         if ( Patch->fluid == NULL  ||  Patch->fluid != Patch->fluid_slot )   return NULL;
+      }
+
+      return patch[Sg][lv][PID0]->fluid[0][0][0];
+
+   } // METHOD : GroupFluid
+
+
+
+#  ifdef MHD
+   //===================================================================================
+   // Method      :  GroupMagnetic
+   // Description :  Return magnetic[] of the entire patch group if it is stored contiguously in group_data[]
+   //
+   // Note        :  1. Return NULL if any patch in the patch group stores magnetic[] outside group_data[]
+   //                   --> Caller must then access magnetic[] patch by patch
+   //                2. magnetic[] of the patch PID0+LocalID starts at the returned pointer + LocalID*NCOMP_MAG*PS1P1*SQR(PS1)
+   //
+   // Parameter   :  Sg  : Target sandglass
+   //                lv  : Target refinement level
+   //                PID0: Patch index of the patch with LocalID == 0 in the target patch group
+   //===================================================================================
+   real *GroupMagnetic( const int Sg, const int lv, const int PID0 )
+   {
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const patch_t *Patch = patch[Sg][lv][ PID0 + LocalID ];
+
+         if ( Patch->magnetic == NULL  ||  Patch->magnetic != Patch->magnetic_slot )   return NULL;
+      }
+
+      return patch[Sg][lv][PID0]->magnetic[0];
+
+   } // METHOD : GroupMagnetic
+#  endif // #ifdef MHD
+
+
+
    //===================================================================================
    // Method      :  Lvdelete
    // Description :  Deallocate all patches in the target level and initialize all
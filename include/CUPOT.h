@@ -148,6 +148,27 @@
 #     define SOR_CPOT_SHARED
 #  endif
 
+// number of patches interleaved in CPU_PoissonSolver_SOR.cpp (i.e., number of SIMD lanes)
+// --> set automatically according to the target instruction set, which can be overridden by -DSOR_CPU_NLANE=...
+// --> 1 : disable the patch-interleaved CPU solver
+#  ifndef SOR_CPU_NLANE
+#  if   ( defined __AVX512F__ )
+#     ifdef FLOAT8
+#     define SOR_CPU_NLANE  8
+#     else
+#     define SOR_CPU_NLANE 16
+#     endif
+#  elif ( defined __AVX2__ )
+#     ifdef FLOAT8
+#     define SOR_CPU_NLANE  4
+#     else
+#     define SOR_CPU_NLANE  8
+#     endif
+#  else
+#     define SOR_CPU_NLANE  1
+#  endif
+#  endif // #ifndef SOR_CPU_NLANE
+
 
 
 // ###################
@@ -0,0 +1,129 @@
+#ifndef __CLUMP_H__
+#define __CLUMP_H__
+
+
+
+#include "Macro.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  Clump_t
+// Description :  Data structure storing the properties of a clump or a particle group
+//
+// Note        :  1. Returned by Aux_FindClump() and Aux_FindParticleGroup()
+//                2. Cell clumps are weighted by "field value * cell volume", which is the mass for density fields
+//                   --> Peak is the maximum field value
+//                3. Particle groups are weighted by the particle mass
+//                   --> Peak is the maximum particle mass
+//                4. During the search, CoM[] and Vel[] temporarily store the weighted sums of the position
+//                   relative to PeakCoord[] and the velocity, respectively
+//
+// Data Member :  NMember   : Number of member cells or particles
+//                Mass      : Sum of weights
+//                Peak      : Peak value
+//                PeakCoord : Coordinates of the peak
+//                CoM       : Weighted center (i.e., center of mass for density fields and particles)
+//                Vel       : Weighted bulk velocity
+//
+// Method      :  Clump_t       : Constructor
+//               ~Clump_t       : Destructor
+//                CreateMPIType : Create a MPI derived datatype for struct Clump_t
+//-------------------------------------------------------------------------------------------------------
+struct Clump_t
+{
+
+// data members
+// --> must be consistent with CreateMPIType()
+// ===================================================================================
+   long   NMember;
+   double Mass;
+   double Peak;
+   double PeakCoord[3];
+   double CoM[3];
+   double Vel[3];
+
+
+   //===================================================================================
+   // Constructor :  Clump_t
+   // Description :  Constructor of the structure "Clump_t"
+   //
+   // Note        :  Initialize the data members
+   //
+   // Parameter   :  None
+   //===================================================================================
+   Clump_t()
+   {
+
+      NMember = 0;
+      Mass    = 0.0;
+      Peak    = -HUGE_NUMBER;
+
+      for (int d=0; d<3; d++)
+      {
+         PeakCoord[d] = NULL_REAL;
+         CoM      [d] = 0.0;
+         Vel      [d] = 0.0;
+      }
+
+   } // METHOD : Clump_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~Clump_t
+   // Description :  Destructor of the structure "Clump_t"
+   //
+   // Note        :  Free memory
+   //===================================================================================
+   ~Clump_t()
+   {
+   } // METHOD : ~Clump_t
+
+
+
+#  ifndef SERIAL
+   //===================================================================================
+   // Method      :  CreateMPIType
+   // Description :  Create a MPI derived datatype for struct Clump_t
+   //
+   // Note        :  1. Invoked by Aux_FindClump() and Aux_FindParticleGroup()
+   //                2. The returned MPI datatype must be freed manually by calling MPI_Type_free()
+   //                3. The extent is resized to sizeof(Clump_t) so that arrays of Clump_t can be transferred
+   //
+   // Parameter   :  MPI_Clump_t : MPI derived datatype to be returned
+   //
+   // Return      :  MPI_Clump_t
+   //===================================================================================
+   void CreateMPIType( MPI_Datatype *MPI_Clump_t ) const
+   {
+
+      const int          NBlk         = 6;
+      const int          Length[NBlk] = { 1, 1, 1, 3, 3, 3 };
+      const MPI_Datatype Type  [NBlk] = { MPI_LONG, MPI_DOUBLE, MPI_DOUBLE, MPI_DOUBLE, MPI_DOUBLE, MPI_DOUBLE };
+
+      MPI_Aint     Disp[NBlk];
+      MPI_Datatype MPI_Clump_Tmp;
+
+      Disp[0] = offsetof( Clump_t, NMember   );
+      Disp[1] = offsetof( Clump_t, Mass      );
+      Disp[2] = offsetof( Clump_t, Peak      );
+      Disp[3] = offsetof( Clump_t, PeakCoord );
+      Disp[4] = offsetof( Clump_t, CoM       );
+      Disp[5] = offsetof( Clump_t, Vel       );
+
+      MPI_Type_create_struct( NBlk, Length, Disp, Type, &MPI_Clump_Tmp );
+      MPI_Type_create_resized( MPI_Clump_Tmp, 0, sizeof(Clump_t), MPI_Clump_t );
+      MPI_Type_commit( MPI_Clump_t );
+      MPI_Type_free( &MPI_Clump_Tmp );
+
+   } // METHOD : CreateMPIType
+#  endif // #ifndef SERIAL
+
+
+}; // struct Clump_t
+
+
+
+#endif // #ifndef __CLUMP_H__
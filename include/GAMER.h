@@ -65,9 +65,11 @@ extern "C" {
 #include "Typedef.h"
 #include "AMR.h"
 #include "Timer.h"
+#include "PerfCounter.h"
 #include "RandomNumber.h"
 #include "Profile.h"
 #include "Extrema.h"
+#include "Clump.h"
 #include "SrcTerms.h"
 #include "EoS.h"
 #include "Microphysics.h"
@@ -3,6 +3,9 @@
 
 #include "Macro.h"
 
+// number of 64-bit words of the per-patch bitmask of cells with refined wave counterparts
+#define WAVE_MASK_NWORD    ( ( CUBE(PS1) + 63 ) / 64 )
+
 class NonCopyable
 {
   protected:
@@ -105,6 +108,8 @@ struct LB_GlobalPatchExchangeList : private NonCopyable
 // class to manage LB_PatchCount and global tree consisting of LB_GlobalPatch
 // constructor calls LB_GatherTree
 // global tree information can be accessed after construction via helper functions
+// for ELBDM_HYBRID, the constructor also caches a bitmask of cells with refined wave counterparts
+// for all patches on the fluid levels (see ConstructWaveMask)
 struct LB_GlobalTree : private NonCopyable
 {
    LB_GlobalTree(const int root = -1);
@@ -116,6 +121,9 @@ struct LB_GlobalTree : private NonCopyable
    const LB_GlobalPatch& GetPatch(const long GID) const;
    const LB_PatchCount&  GetLBPatchCount() const;
    long PID2GID(const int PID, const int lv) const;
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   bool HasWaveCounterpart(const int i, const int j, const int k, const long GID) const;
+#  endif
 
    const LB_GlobalPatch& operator[](long) const;
 
@@ -123,6 +131,12 @@ private:
    LB_PatchCount   PatchCount;
    LB_GlobalPatch* Patches;
    long            NPatch;
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   ulong         (*WaveMask)[WAVE_MASK_NWORD]; // bitmask of cells with refined wave counterparts of patches with GID < NPatchWaveMask
+   long            NPatchWaveMask;             // number of patches on the fluid levels
+
+   void ConstructWaveMask();
+#  endif
 }; // struct LB_GlobalTree
 
 
@@ -71,6 +71,7 @@ extern double     OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_
 extern bool       OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION, OPT__FLAG_ANGULAR, OPT__FLAG_RADIAL;
 extern int        OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
 extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__DT_FUSED;
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
@@ -80,10 +81,32 @@ extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID, OPT
 extern bool       OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
 extern bool       OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+extern bool       OPT__RECORD_TRACE;
+extern long       TRACE_STEP_START, TRACE_STEP_END;
+extern int        TRACE_MAX_EVENT;
 extern char       OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
+extern bool       OPT__OUTPUT_NODE_LOCAL, OPT__NODE_LOCAL_DRAIN;
+extern char       NODE_LOCAL_DIR[MAX_STRING];
+extern int        NODE_LOCAL_STEP;
+extern int        OPT__OUTPUT_DEFLATE;
+extern double     OUTPUT_LOSSY_REL_ERR;
+extern int        OPT__OUTPUT_IMAGE, OUTPUT_IMAGE_STEP, OUTPUT_IMAGE_NPIX, OUTPUT_IMAGE_AXIS;
+extern char       OUTPUT_IMAGE_FIELD[MAX_STRING];
+extern double     OUTPUT_IMAGE_SLICE_X, OUTPUT_IMAGE_SLICE_Y, OUTPUT_IMAGE_SLICE_Z;
+extern char       OUTPUT_BASEPS_FIELD[MAX_STRING];
+extern bool       OUTPUT_BASEPS_CROSS;
+extern int        OUTPUT_BASEPS_LEVEL, OUTPUT_BASEPS_STEP;
 extern int        OPT__UM_IC_FLOAT8;
 extern double     COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
 extern int        COM_MAX_ITER;
+extern bool       OPT__RECORD_CLUMP;
+extern char       CLUMP_FIELD[MAX_STRING];
+extern double     CLUMP_THRESHOLD;
+extern int        CLUMP_MIN_NCELL;
+#ifdef MASSIVE_PARTICLES
+extern double     CLUMP_FOF_LINKLEN;
+extern int        CLUMP_FOF_MIN_NPAR;
+#endif
 extern double     ANGMOM_ORIGIN_X, ANGMOM_ORIGIN_Y, ANGMOM_ORIGIN_Z;
 extern double     FLAG_ANGULAR_CEN_X, FLAG_ANGULAR_CEN_Y, FLAG_ANGULAR_CEN_Z;
 extern double     FLAG_RADIAL_CEN_X, FLAG_RADIAL_CEN_Y, FLAG_RADIAL_CEN_Z;
@@ -111,6 +134,8 @@ extern double           GAMMA, MINMOD_COEFF, AUTO_REDUCE_MINMOD_FACTOR, AUTO_RED
 extern LR_Limiter_t     OPT__LR_LIMITER;
 extern Opt1stFluxCorr_t OPT__1ST_FLUX_CORR;
 extern OptRSolver1st_t  OPT__1ST_FLUX_CORR_SCHEME;
+extern char             NUC_TABLE[MAX_STRING];
+extern long             NUC_BENCHMARK;
 extern bool             OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP, OPT__FLAG_LOHNER_ENTR;
 extern bool             OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES, OPT__LAST_RESORT_FLOOR;
 extern bool             OPT__OUTPUT_DIVVEL, OPT__OUTPUT_MACH, OPT__OUTPUT_PRES, OPT__OUTPUT_CS;
@@ -185,6 +210,9 @@ extern bool          OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, O
 extern double        SOR_OMEGA;
 extern int           SOR_MAX_ITER, SOR_MIN_ITER;
 extern double        MG_TOLERATED_ERROR;
+extern bool          OPT__LEVEL_MG;
+extern int           LEVEL_MG_MAX_ITER;
+extern double        LEVEL_MG_TOLERATED_ERROR;
 extern int           MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
 extern char          EXT_POT_TABLE_NAME[MAX_STRING];
 extern double        EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
@@ -222,6 +250,8 @@ extern double     LB_INPUT__PAR_WEIGHT;               // LB->Par_Weight loaded f
 #endif
 extern bool       OPT__RECORD_LOAD_BALANCE;
 extern bool       OPT__LB_EXCHANGE_FATHER;
+extern bool       OPT__NODE_AWARE_MPI;
+extern bool       OPT__PERSISTENT_MPI;
 #endif
 extern bool       OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
@@ -241,6 +271,7 @@ extern double          FlagTable_ParMassCell[NLEVEL-1];
 extern ParOutputDens_t OPT__OUTPUT_PAR_DENS;
 extern int             PAR_IC_FLOAT8;
 extern int             PAR_IC_INT8;
+extern int             PAR_IC_LOAD_NRANK;
 #endif
 
 
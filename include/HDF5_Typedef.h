@@ -131,6 +131,7 @@ struct Makefile_t
    int BitwiseReproducibility;
    int Timing;
    int TimingSolver;
+   int PerfCounter;
    int Float8;
    int Serial;
    int LoadBalance;
@@ -427,6 +428,7 @@ struct InputPara_t
    int    Par_ICType;
    int    Par_ICFloat8;
    int    Par_ICInt8;
+   int    Par_ICLoadNRank;
    int    Par_Interp;
    int    Par_InterpTracer;
    int    Par_Integ;
@@ -484,6 +486,7 @@ struct InputPara_t
    int    Opt__DtUser;
    int    Opt__DtLevel;
    int    Opt__RecordDt;
+   int    Opt__DtFused;
    int    AutoReduceDt;
    double AutoReduceDtFactor;
    double AutoReduceDtFactorMin;
@@ -568,6 +571,8 @@ struct InputPara_t
 #  endif
    int    Opt__RecordLoadBalance;
    int    Opt__LB_ExchangeFather;
+   int    Opt__NodeAwareMPI;
+   int    Opt__PersistentMPI;
 #  endif
    int    Opt__MinimizeMPIBarrier;
 
@@ -577,6 +582,8 @@ struct InputPara_t
    double MolecularWeight;
    double MuNorm;
    double IsoTemp;
+   char  *NucTable;
+   long   NucBenchmark;
    double MinMod_Coeff;
    int    MinMod_MaxIter;
    int    Opt__LR_Limiter;
@@ -659,6 +666,9 @@ struct InputPara_t
    int    MG_NPostSmooth;
    double MG_ToleratedError;
 #  endif
+   int    Opt__LevelMG;
+   int    LevelMG_MaxIter;
+   double LevelMG_ToleratedError;
    int    Pot_GPU_NPGroup;
    int    Opt__GraP5Gradient;
    int    Opt__SelfGravity;
@@ -799,6 +809,10 @@ struct InputPara_t
    int    Opt__Output_Par_Mesh;
 #  endif
    int    Opt__Output_BasePS;
+   char  *Output_BasePS_Field;
+   int    Output_BasePS_Cross;
+   int    Output_BasePS_Level;
+   int    Output_BasePS_Step;
    int    Opt__Output_Base;
 #  ifdef MHD
    int    Opt__Output_CC_Mag;
@@ -828,6 +842,20 @@ struct InputPara_t
    int    Opt__Output_UserField;
    int    Opt__Output_Mode;
    int    Opt__Output_Restart;
+   int    Opt__Output_NodeLocal;
+   char  *NodeLocal_Dir;
+   int    Opt__NodeLocal_Drain;
+   int    NodeLocal_Step;
+   int    Opt__Output_Deflate;
+   double Output_Lossy_RelErr;
+   int    Opt__Output_Image;
+   int    Output_Image_Step;
+   int    Output_Image_NPix;
+   int    Output_Image_Axis;
+   char  *Output_Image_Field;
+   double Output_Image_SliceX;
+   double Output_Image_SliceY;
+   double Output_Image_SliceZ;
    int    Opt__Output_Step;
    double Opt__Output_Dt;
    char  *Opt__Output_Text_Format_Flt;
@@ -850,6 +878,10 @@ struct InputPara_t
    int    Opt__RecordUnphy;
    int    Opt__RecordMemory;
    int    Opt__RecordPerformance;
+   int    Opt__RecordTrace;
+   long   Trace_StepStart;
+   long   Trace_StepEnd;
+   int    Trace_MaxEvent;
    int    Opt__ManualControl;
    int    Opt__RecordCenter;
    double COM_CenX;
@@ -859,6 +891,14 @@ struct InputPara_t
    double COM_MinRho;
    double COM_TolErrR;
    int    COM_MaxIter;
+   int    Opt__RecordClump;
+   char  *Clump_Field;
+   double Clump_Threshold;
+   int    Clump_MinNCell;
+#  ifdef MASSIVE_PARTICLES
+   double Clump_FoF_LinkLen;
+   int    Clump_FoF_MinNPar;
+#  endif
    int    Opt__RecordUser;
    int    Opt__OptimizeAggressive;
    int    Opt__SortPatchByLBIdx;
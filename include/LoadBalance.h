@@ -22,13 +22,14 @@
 //                OverlapMPI_FluAsyncPID0 : Patch indices with LocalID==0 which will be overlapped with
 //                                          the MPI communication (fluid solver)
 //                OverlapMPI_PotSyncN     : Number of patches with LocalID==0 which will NOT be overlapped with
-//                                          the MPI communication (gravity solver)
+//                                          the MPI communication (Poisson/gravity solver)
+//                                          --> patch groups adjacent to any sibling buffer patch
 //                OverlapMPI_PotSyncPID0  : Patch indices with LocalID==0 which will NOT be overlapped with
-//                                          the MPI communication (gravity solver)
+//                                          the MPI communication (Poisson/gravity solver)
 //                OverlapMPI_PotAsyncN    : Number of patches with LocalID==0 which will be overlapped with
-//                                          the MPI communication (gravity solver)
+//                                          the MPI communication (Poisson/gravity solver)
 //                OverlapMPI_PotAsyncPID0 : Patch indices with LocalID==0 which will be overlapped with
-//                                          the MPI communication (gravity solver)
+//                                          the MPI communication (Poisson/gravity solver)
 //                WLI                     : Weighted load-imbalance factor of patches at all levels
 //                WLI_Max                 : WLI threshold for redistributing patches at all levels
 //                Par_Weight              : Load-balance weighting of one particle over one cell
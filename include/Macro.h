@@ -841,6 +841,21 @@
 #define PS1P1           ( PS1 + 1 )
 
 
+// number of elements of fluid[], magnetic[], and pot[] of a single patch group (including both Sg)
+// stored in patch_t::group_data[]
+#define GROUP_SIZE_FLU  ( 16*NCOMP_TOTAL*CUBE(PS1) )
+#ifdef MHD
+#define GROUP_SIZE_MAG  ( 16*NCOMP_MAG*PS1P1*SQR(PS1) )
+#else
+#define GROUP_SIZE_MAG  ( 0 )
+#endif
+#ifdef GRAVITY
+#define GROUP_SIZE_POT  ( 16*CUBE(PS1) )
+#else
+#define GROUP_SIZE_POT  ( 0 )
+#endif
+
+
 // size of GPU arrays (in one dimension)
 //###REVISE: support interpolation schemes requiring 2 ghost cells on each side for POT_NXT
 #  define FLU_NXT       ( PS2 + 2*FLU_GHOST_SIZE )                // use patch group as the unit
@@ -885,6 +900,17 @@
 #  define EOS_NTABLE_MAX         0
 #endif
 
+// variables stored on each node of the nuclear EoS table
+// --> all NUC_NVAR variables of a node are stored contiguously (see EoS/Nuclear/CPU_EoS_Nuclear.cpp)
+#if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
+#  define NUC_NVAR                4
+#  define NUC_VAR_PRES            0    // log10(pressure)
+#  define NUC_VAR_EINT            1    // log10(specific internal energy + energy shift)
+#  define NUC_VAR_ENTR            2    // entropy per baryon in kB
+#  define NUC_VAR_CSQR            3    // sound speed squared
+#  define NUC_TABLE_DATA          0    // index of the table data in *_EoS_Table[]
+#endif
+
 #ifdef GRAVITY
 #  define EXT_POT_NAUX_MAX       20    // ExtPot_AuxArray[]
 #  define EXT_ACC_NAUX_MAX       20    // ExtAcc_AuxArray[]
@@ -1077,6 +1103,20 @@
 #define TIMER_OFF          0
 
 
+// hardware performance counter events for the option PERF_COUNTER
+#ifdef PERF_COUNTER
+#  define PERF_CYCLE       0     // CPU cycles
+#  define PERF_INSTR       1     // retired instructions
+#  define PERF_LLC_MISS    2     // last-level cache misses
+#  define PERF_NEVENT      3
+#endif
+
+
+// image types for the option OPT__OUTPUT_IMAGE (bitwise)
+#define OUTPUT_IMAGE_PROJ  1     // density-weighted projection
+#define OUTPUT_IMAGE_SLICE 2     // slice
+
+
 // symbolic constant for Aux_Error()
 #define ERROR_INFO         __FILE__, __LINE__, __FUNCTION__
 
@@ -1121,6 +1161,7 @@
 #  define   SIN( a )         sin( a )
 #  define   COS( a )         cos( a )
 #  define   LOG( a )         log( a )
+#  define LOG10( a )       log10( a )
 #  define   EXP( a )         exp( a )
 #  define  ATAN( a )        atan( a )
 #  define FLOOR( a )       floor( a )
@@ -1136,6 +1177,7 @@
 #  define   SIN( a )         sinf( a )
 #  define   COS( a )         cosf( a )
 #  define   LOG( a )         logf( a )
+#  define LOG10( a )       log10f( a )
 #  define   EXP( a )         expf( a )
 #  define  ATAN( a )        atanf( a )
 #  define FLOOR( a )       floorf( a )
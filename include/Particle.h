@@ -35,6 +35,12 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                                           (2) being sent to other MPI ranks   (mass == PAR_INACTIVE_MPI)
 //                NPar_Inactive           : Total number of inactive particles in this MPI rank
 //                NPar_Lv                 : Total number of active particles at each level in this MPI rank
+//                NPar_BatchAdd           : Number of particle slots claimed in the current batch of new particles
+//                NPar_BatchAddMax        : Maximum number of particle slots in the current batch of new particles
+//                                          --> Set by BeginAddBatch()
+//                NPar_BatchRemove        : Number of particles removed in the current batch of removed particles
+//                NPar_BatchRemoveMax     : Maximum number of particles in the current batch of removed particles
+//                                          --> Set by BeginRemoveBatch()
 //                Init                    : Initialization methods (1/2/3 --> call function/restart/load from file)
 //                ParICFormat             : Data format of the particle initialization file (1=[att][id], 2=[id][att])
 //                ParICMass               : Assign this mass to all particles for Init=3
@@ -103,11 +109,18 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                Type                    : Particle type (e.g., tracer, generic, dark matter, star)
 //                Acc                     : Particle acceleration (only when STORE_PAR_ACC is on)
 //
-// Method      :  Particle_t        : Constructor
-//               ~Particle_t        : Destructor
-//                InitRepo          : Initialize particle repository
-//                AddOneParticle    : Add one new particle into the particle list
-//                RemoveOneParticle : Remove one particle from the particle list
+// Method      :  Particle_t          : Constructor
+//               ~Particle_t          : Destructor
+//                InitRepo            : Initialize particle repository
+//                AddOneParticle      : Add one new particle into the particle list
+//                RemoveOneParticle   : Remove one particle from the particle list
+//                ResizeParList       : Resize the particle data arrays
+//                BeginAddBatch       : Prepare a batch of new particles added by AddParticleBatch()
+//                AddParticleBatch    : Add new particles into the particle list (thread-safe)
+//                EndAddBatch         : Finish a batch of new particles
+//                BeginRemoveBatch    : Prepare a batch of particles removed by RemoveParticleBatch()
+//                RemoveParticleBatch : Remove particles from the particle list (thread-safe)
+//                EndRemoveBatch      : Finish a batch of removed particles
 //-------------------------------------------------------------------------------------------------------
 struct Particle_t
 {
@@ -121,6 +134,10 @@ struct Particle_t
    long          NPar_Active;
    long          NPar_Inactive;
    long          NPar_Lv[NLEVEL];
+   long          NPar_BatchAdd;
+   long          NPar_BatchAddMax;
+   long          NPar_BatchRemove;
+   long          NPar_BatchRemoveMax;
    ParInit_t     Init;
    ParICFormat_t ParICFormat;
    double        ParICMass;
@@ -195,6 +212,10 @@ struct Particle_t
 
       NPar_Active_AllRank = -1;
       NPar_AcPlusInac     = -1;
+      NPar_BatchAdd       = 0;
+      NPar_BatchAddMax    = 0;
+      NPar_BatchRemove    = 0;
+      NPar_BatchRemoveMax = 0;
       Init                = PAR_INIT_NONE;
       ParICFormat         = PAR_IC_FORMAT_NONE;
       ParICMass           = -1.0;
@@ -345,6 +366,10 @@ struct Particle_t
       NPar_AcPlusInac     = NPar_Input;
       NPar_Active         = NPar_Input;                  // assuming all particles are active initially
       NPar_Inactive       = 0;
+      NPar_BatchAdd       = 0;
+      NPar_BatchAddMax    = 0;
+      NPar_BatchRemove    = 0;
+      NPar_BatchRemoveMax = 0;
       ParListSize         = NPar_Input;                  // set ParListSize = NPar_AcPlusInac at the beginning
       InactiveParListSize = MAX( 1, ParListSize/100 );   // set arbitrarily (but must > 0)
 
@@ -432,6 +457,8 @@ struct Particle_t
    //                   to the newly added particles
    //                4. Note that the global variable "AveDensity_Init" will NOT be recalculated
    //                   automatically here
+   //                5. Use BeginAddBatch(), AddParticleBatch(), and EndAddBatch() instead to add
+   //                   particles within OpenMP parallel regions without the critical construct
    //
    // Parameter   :  NewAttFlt : Array storing the floating-point attributes of new particles
    //                NewAttInt : Array storing the integer        attributes of new particles
@@ -483,27 +510,7 @@ struct Particle_t
       {
 //       allocate enough memory for the particle variable array
          if ( NPar_AcPlusInac >= ParListSize )
-         {
-            ParListSize = (int)ceil( PARLIST_GROWTH_FACTOR*(ParListSize+1) );
-
-            for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)   AttributeFlt[v] = (real_par*)realloc( AttributeFlt[v], ParListSize*sizeof(real_par) );
-            for (int v=0; v<PAR_NATT_INT_TOTAL; v++)   AttributeInt[v] = (long_par*)realloc( AttributeInt[v], ParListSize*sizeof(long_par) );
-
-            Mass = AttributeFlt[PAR_MASS];
-            PosX = AttributeFlt[PAR_POSX];
-            PosY = AttributeFlt[PAR_POSY];
-            PosZ = AttributeFlt[PAR_POSZ];
-            VelX = AttributeFlt[PAR_VELX];
-            VelY = AttributeFlt[PAR_VELY];
-            VelZ = AttributeFlt[PAR_VELZ];
-            Time = AttributeFlt[PAR_TIME];
-#           ifdef STORE_PAR_ACC
-            AccX = AttributeFlt[PAR_ACCX];
-            AccY = AttributeFlt[PAR_ACCY];
-            AccZ = AttributeFlt[PAR_ACCZ];
-#           endif
-            Type = AttributeInt[PAR_TYPE];
-         }
+            ResizeParList( (int)ceil( PARLIST_GROWTH_FACTOR*(ParListSize+1) ) );
 
          ParID = NPar_AcPlusInac;
          NPar_AcPlusInac ++;
@@ -542,6 +549,8 @@ struct Particle_t
    //                       calling AddOneParticle()
    //                3. Note that the global variable "AveDensity_Init" will NOT be recalculated
    //                   automatically here
+   //                4. Use BeginRemoveBatch(), RemoveParticleBatch(), and EndRemoveBatch() instead to
+   //                   remove particles within OpenMP parallel regions without the critical construct
    //
    // Parameter   :  ParID  : Particle ID to be removed
    //                Marker : Value assigned to the mass of the particle being removed
@@ -590,6 +599,301 @@ struct Particle_t
    } // METHOD : RemoveOneParticle
 
 
+
+   //===================================================================================
+   // Method      :  ResizeParList
+   // Description :  Resize the particle data arrays
+   //
+   // Note        :  1. Pointers to the particle attributes (e.g., Mass, PosX) will be reset
+   //                   --> Do not call it within OpenMP parallel regions
+   //                2. NewSize must be >= NPar_AcPlusInac
+   //
+   // Parameter   :  NewSize : New size of the particle data arrays
+   //
+   // Return      :  ParListSize, AttributeFlt[], AttributeInt[], Mass, PosX, ...
+   //===================================================================================
+   void ResizeParList( const long NewSize )
+   {
+
+#     ifdef DEBUG_PARTICLE
+      if ( NewSize < NPar_AcPlusInac )
+         Aux_Error( ERROR_INFO, "NewSize (%ld) < NPar_AcPlusInac (%ld) !!\n", NewSize, NPar_AcPlusInac );
+#     endif
+
+      ParListSize = NewSize;
+
+      for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)   AttributeFlt[v] = (real_par*)realloc( AttributeFlt[v], ParListSize*sizeof(real_par) );
+      for (int v=0; v<PAR_NATT_INT_TOTAL; v++)   AttributeInt[v] = (long_par*)realloc( AttributeInt[v], ParListSize*sizeof(long_par) );
+
+      Mass = AttributeFlt[PAR_MASS];
+      PosX = AttributeFlt[PAR_POSX];
+      PosY = AttributeFlt[PAR_POSY];
+      PosZ = AttributeFlt[PAR_POSZ];
+      VelX = AttributeFlt[PAR_VELX];
+      VelY = AttributeFlt[PAR_VELY];
+      VelZ = AttributeFlt[PAR_VELZ];
+      Time = AttributeFlt[PAR_TIME];
+#     ifdef STORE_PAR_ACC
+      AccX = AttributeFlt[PAR_ACCX];
+      AccY = AttributeFlt[PAR_ACCY];
+      AccZ = AttributeFlt[PAR_ACCZ];
+#     endif
+      Type = AttributeInt[PAR_TYPE];
+
+   } // METHOD : ResizeParList
+
+
+
+   //===================================================================================
+   // Method      :  BeginAddBatch
+   // Description :  Prepare a batch of new particles to be added by AddParticleBatch()
+   //
+   // Note        :  1. Must be called outside OpenMP parallel regions or by a single thread
+   //                   (e.g., within the single construct)
+   //                2. Allocate enough memory for NNewMax new particles in advance so that
+   //                   AddParticleBatch() never resizes the particle data arrays
+   //                   --> Pointers to the particle attributes (e.g., Mass, PosX) remain unchanged
+   //                       until EndAddBatch()
+   //                   --> The arrays grow by at least PARLIST_GROWTH_FACTOR to amortize the cost
+   //                3. Inactive particle IDs will be reassigned to the new particles first
+   //
+   // Parameter   :  NNewMax : Maximum number of new particles in this batch
+   //===================================================================================
+   void BeginAddBatch( const long NNewMax )
+   {
+
+#     ifdef DEBUG_PARTICLE
+      if ( NNewMax < 0 )   Aux_Error( ERROR_INFO, "NNewMax (%ld) < 0 !!\n", NNewMax );
+
+      if ( NPar_BatchAddMax > 0  ||  NPar_BatchRemoveMax > 0 )
+         Aux_Error( ERROR_INFO, "another batch is in progress (NPar_BatchAddMax %ld, NPar_BatchRemoveMax %ld) !!\n",
+                    NPar_BatchAddMax, NPar_BatchRemoveMax );
+#     endif
+
+//    allocate enough memory for the particle data arrays
+      const long NPar_Need = NPar_AcPlusInac + MAX( NNewMax-NPar_Inactive, 0L );
+
+      if ( NPar_Need > ParListSize )
+         ResizeParList(  MAX( NPar_Need, (long)ceil( PARLIST_GROWTH_FACTOR*(ParListSize+1) ) )  );
+
+      NPar_BatchAdd    = 0;
+      NPar_BatchAddMax = NNewMax;
+
+   } // METHOD : BeginAddBatch
+
+
+
+   //===================================================================================
+   // Method      :  AddParticleBatch
+   // Description :  Add new particles into the particle list
+   //
+   // Note        :  1. Thread-safe without the critical construct
+   //                   --> Each call claims NNew consecutive slots of the current batch by an atomic
+   //                       fetch-and-add of NPar_BatchAdd, and then records the particle data without locks
+   //                   --> Slots [0 ... NPar_Inactive-1] reuse the inactive particle IDs stored in
+   //                       InactiveParList[] from the end, and the others are appended after NPar_AcPlusInac
+   //                2. Must be called between BeginAddBatch() and EndAddBatch()
+   //                   --> NPar_Active, NPar_Inactive, and NPar_AcPlusInac are not updated until EndAddBatch()
+   //                3. The order of particle IDs may change from run to run when called by multiple threads
+   //
+   // Parameter   :  NNew      : Number of new particles
+   //                NewAttFlt : Array storing the floating-point attributes of new particles
+   //                NewAttInt : Array storing the integer        attributes of new particles
+   //                NewParID  : Array to store the indices of new particles
+   //
+   // Return      :  NewParID[]
+   //===================================================================================
+   void AddParticleBatch( const int NNew, const real_par (*NewAttFlt)[PAR_NATT_FLT_TOTAL],
+                          const long_par (*NewAttInt)[PAR_NATT_INT_TOTAL], long *NewParID )
+   {
+
+      if ( NNew <= 0 )  return;
+
+//    1. claim NNew slots
+      long Slot0;
+
+#     pragma omp atomic capture
+      { Slot0 = NPar_BatchAdd;  NPar_BatchAdd += NNew; }
+
+      if ( Slot0 + NNew > NPar_BatchAddMax )
+         Aux_Error( ERROR_INFO, "number of new particles exceeds the batch size (%ld) !!\n", NPar_BatchAddMax );
+
+
+      for (int p=0; p<NNew; p++)
+      {
+//       check
+#        ifdef DEBUG_PARTICLE
+         if ( NewAttFlt[p][PAR_MASS] < (real_par)0.0 )
+            Aux_Error( ERROR_INFO, "Adding an inactive particle (mass = %21.14e) !!\n", NewAttFlt[p][PAR_MASS] );
+
+         if ( NewAttFlt[p][PAR_POSX] != NewAttFlt[p][PAR_POSX] ||
+              NewAttFlt[p][PAR_POSY] != NewAttFlt[p][PAR_POSY] ||
+              NewAttFlt[p][PAR_POSZ] != NewAttFlt[p][PAR_POSZ]   )
+            Aux_Error( ERROR_INFO, "Adding a particle with strange position (%21.14e, %21.14e, %21.14e) !!\n",
+                       NewAttFlt[p][PAR_POSX], NewAttFlt[p][PAR_POSY], NewAttFlt[p][PAR_POSZ] );
+
+         if ( NewAttInt[p][PAR_TYPE] < (long_par)0  ||  NewAttInt[p][PAR_TYPE] >= (long_par)PAR_NTYPE )
+            Aux_Error( ERROR_INFO, "Incorrect particle type (%ld) !!\n", (long)NewAttInt[p][PAR_TYPE] );
+#        endif
+
+//       2. determine the target particle ID
+         const long Slot  = Slot0 + p;
+         const long ParID = ( Slot < NPar_Inactive ) ? InactiveParList[ NPar_Inactive-1-Slot ]
+                                                     : NPar_AcPlusInac + Slot - NPar_Inactive;
+
+//       3. record the data of new particles
+         for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)   AttributeFlt[v][ParID] = NewAttFlt[p][v];
+         for (int v=0; v<PAR_NATT_INT_TOTAL; v++)   AttributeInt[v][ParID] = NewAttInt[p][v];
+
+         NewParID[p] = ParID;
+      } // for (int p=0; p<NNew; p++)
+
+   } // METHOD : AddParticleBatch
+
+
+
+   //===================================================================================
+   // Method      :  EndAddBatch
+   // Description :  Finish a batch of new particles
+   //
+   // Note        :  1. Must be called outside OpenMP parallel regions or by a single thread
+   //                2. Update NPar_Active, NPar_Inactive, and NPar_AcPlusInac (assuming all new
+   //                   particles are active)
+   //===================================================================================
+   void EndAddBatch()
+   {
+
+      const long NReuse = MIN( NPar_BatchAdd, NPar_Inactive );
+
+      NPar_Inactive   -= NReuse;
+      NPar_AcPlusInac += NPar_BatchAdd - NReuse;
+      NPar_Active     += NPar_BatchAdd;
+
+      NPar_BatchAdd    = 0;
+      NPar_BatchAddMax = 0;
+
+#     ifdef DEBUG_PARTICLE
+      if ( NPar_AcPlusInac > ParListSize )
+         Aux_Error( ERROR_INFO, "NPar_AcPlusInac (%ld) > ParListSize (%ld) !!\n", NPar_AcPlusInac, ParListSize );
+
+      if ( NPar_Active + NPar_Inactive != NPar_AcPlusInac )
+         Aux_Error( ERROR_INFO, "NPar_Active (%ld) + NPar_Inactive (%ld) != NPar_AcPlusInac (%ld) !!\n",
+                    NPar_Active, NPar_Inactive, NPar_AcPlusInac );
+#     endif
+
+   } // METHOD : EndAddBatch
+
+
+
+   //===================================================================================
+   // Method      :  BeginRemoveBatch
+   // Description :  Prepare a batch of particles to be removed by RemoveParticleBatch()
+   //
+   // Note        :  1. Must be called outside OpenMP parallel regions or by a single thread
+   //                2. Allocate enough memory of InactiveParList[] for NRemoveMax particles in advance
+   //
+   // Parameter   :  NRemoveMax : Maximum number of particles to be removed in this batch
+   //===================================================================================
+   void BeginRemoveBatch( const long NRemoveMax )
+   {
+
+#     ifdef DEBUG_PARTICLE
+      if ( NRemoveMax < 0 )   Aux_Error( ERROR_INFO, "NRemoveMax (%ld) < 0 !!\n", NRemoveMax );
+
+      if ( NPar_BatchAddMax > 0  ||  NPar_BatchRemoveMax > 0 )
+         Aux_Error( ERROR_INFO, "another batch is in progress (NPar_BatchAddMax %ld, NPar_BatchRemoveMax %ld) !!\n",
+                    NPar_BatchAddMax, NPar_BatchRemoveMax );
+#     endif
+
+      if ( NPar_Inactive + NRemoveMax > InactiveParListSize )
+      {
+         InactiveParListSize = MAX( NPar_Inactive+NRemoveMax, (long)ceil( PARLIST_GROWTH_FACTOR*(InactiveParListSize+1) ) );
+
+         InactiveParList = (long*)realloc( InactiveParList, InactiveParListSize*sizeof(long) );
+      }
+
+      NPar_BatchRemove    = 0;
+      NPar_BatchRemoveMax = NRemoveMax;
+
+   } // METHOD : BeginRemoveBatch
+
+
+
+   //===================================================================================
+   // Method      :  RemoveParticleBatch
+   // Description :  Remove particles from the particle list
+   //
+   // Note        :  1. Thread-safe without the critical construct
+   //                   --> Each call claims NRemove consecutive entries of InactiveParList[] after
+   //                       NPar_Inactive by an atomic fetch-and-add of NPar_BatchRemove
+   //                2. Must be called between BeginRemoveBatch() and EndRemoveBatch()
+   //                   --> NPar_Active and NPar_Inactive are not updated until EndRemoveBatch()
+   //                3. See RemoveOneParticle() for the meaning of Marker
+   //
+   // Parameter   :  NRemove : Number of particles to be removed
+   //                ParID   : Particle IDs to be removed
+   //                Marker  : Value assigned to the mass of the particles being removed
+   //                          (PAR_INACTIVE_OUTSIDE or PAR_INACTIVE_MPI)
+   //===================================================================================
+   void RemoveParticleBatch( const int NRemove, const long *ParID, const real_par Marker )
+   {
+
+      if ( NRemove <= 0 )  return;
+
+#     ifdef DEBUG_PARTICLE
+      if ( Marker != PAR_INACTIVE_OUTSIDE  &&  Marker != PAR_INACTIVE_MPI )
+         Aux_Error( ERROR_INFO, "Unsupported Marker (%14.7e) !!\n", Marker );
+
+      for (int p=0; p<NRemove; p++)
+         if ( ParID[p] < 0  ||  ParID[p] >= NPar_AcPlusInac )
+            Aux_Error( ERROR_INFO, "Wrong ParID (%ld) !!\n", ParID[p] );
+#     endif
+
+//    1. claim NRemove entries of InactiveParList[]
+      long Slot0;
+
+#     pragma omp atomic capture
+      { Slot0 = NPar_BatchRemove;  NPar_BatchRemove += NRemove; }
+
+      if ( Slot0 + NRemove > NPar_BatchRemoveMax )
+         Aux_Error( ERROR_INFO, "number of removed particles exceeds the batch size (%ld) !!\n", NPar_BatchRemoveMax );
+
+//    2. record the particle IDs to be removed and remove the target particles
+      for (int p=0; p<NRemove; p++)
+      {
+         InactiveParList[ NPar_Inactive + Slot0 + p ] = ParID[p];
+         Mass[ ParID[p] ] = Marker;
+      }
+
+   } // METHOD : RemoveParticleBatch
+
+
+
+   //===================================================================================
+   // Method      :  EndRemoveBatch
+   // Description :  Finish a batch of removed particles
+   //
+   // Note        :  1. Must be called outside OpenMP parallel regions or by a single thread
+   //                2. Update NPar_Active and NPar_Inactive
+   //===================================================================================
+   void EndRemoveBatch()
+   {
+
+      NPar_Active   -= NPar_BatchRemove;
+      NPar_Inactive += NPar_BatchRemove;
+
+      NPar_BatchRemove    = 0;
+      NPar_BatchRemoveMax = 0;
+
+#     ifdef DEBUG_PARTICLE
+      if ( NPar_Active + NPar_Inactive != NPar_AcPlusInac )
+         Aux_Error( ERROR_INFO, "NPar_Active (%ld) + NPar_Inactive (%ld) != NPar_AcPlusInac (%ld) !!\n",
+                    NPar_Active, NPar_Inactive, NPar_AcPlusInac );
+#     endif
+
+   } // METHOD : EndRemoveBatch
+
+
 }; // struct Particle_t
 
 
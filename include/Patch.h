@@ -4,6 +4,7 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "Macro.h"
 
 #ifdef PARTICLE
@@ -49,6 +50,19 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                              NOT be used outside Prepare_PatchData)
 //                                      --> Note that even with NGP mass assignment which requires no ghost zone we
 //                                          still allocate rho_ext as (PS1+RHOEXT_GHOST_SIZE)^3
+//                group_data          : Single block storing fluid[], magnetic[], and pot[] of all patches in a patch group
+//                                      (including both Sg)
+//                                      --> Allocated by GroupNew() for the patch with LocalID == 0 and Sg == 0 only
+//                                      --> Layout = fluid[Sg][LocalID], magnetic[Sg][LocalID], pot[Sg][LocalID]
+//                                          --> fluid[] of the eight patches in a patch group are contiguous
+//                                      --> Deallocated with this patch, which is always deleted together with the
+//                                          other patches in the same patch group
+//                fluid_slot          : Location reserved for fluid[] in the group_data[] of the patch group
+//                                      --> Set by SetGroupSlot() and used by hnew()
+//                                      --> NULL if the patch group has no group_data[], in which case fluid[] is
+//                                          allocated individually
+//                magnetic_slot       : Location reserved for magnetic[] in group_data[] (see fluid_slot)
+//                pot_slot            : Location reserved for pot[] in group_data[] (see fluid_slot)
 //                flux[6]             : Fluid flux (for the flux-correction operation)
 //                                      --> Including passively advected flux (for the flux-correction operation)
 //                flux_tmp[6]         : Temporary fluid flux for the option "AUTO_REDUCE_DT"
@@ -176,6 +190,9 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                mdelete        : Deallocate magnetic[]
 //                gnew           : Allocate pot[]
 //                gdelete        : Deallocate pot[]
+//                GroupNew       : Allocate group_data[]
+//                GroupDelete    : Deallocate group_data[]
+//                SetGroupSlot   : Set fluid_slot, magnetic_slot, and pot_slot
 //                snew           : Allocate de_status[]
 //                sdelete        : Deallocate de_status[]
 //                dnew           : Allocate rho_ext[]
@@ -209,6 +226,15 @@ struct patch_t
    real (*rho_ext)[RHOEXT_NXT][RHOEXT_NXT];
 #  endif
 
+   real  *group_data;
+   real (*fluid_slot)[PS1][PS1][PS1];
+#  ifdef MHD
+   real (*magnetic_slot)[ PS1P1*SQR(PS1) ];
+#  endif
+#  ifdef GRAVITY
+   real (*pot_slot)[PS1][PS1];
+#  endif
+
    real (*flux       [6])[PS1][PS1];
    real (*flux_tmp   [6])[PS1][PS1];
 #  ifdef BIT_REP_FLUX
@@ -409,6 +435,15 @@ struct patch_t
 #        ifdef MASSIVE_PARTICLES
          rho_ext   = NULL;
 #        endif
+
+         group_data    = NULL;
+         fluid_slot    = NULL;
+#        ifdef MHD
+         magnetic_slot = NULL;
+#        endif
+#        ifdef GRAVITY
+         pot_slot      = NULL;
+#        endif
       }
 
       for (int s=0; s<6; s++)
@@ -489,6 +524,7 @@ struct patch_t
 #     ifdef DUAL_ENERGY
       sdelete();
 #     endif
+      GroupDelete();
 
 #     ifdef PARTICLE
 #     ifdef GRAVITY
@@ -686,14 +722,16 @@ struct patch_t
    // Method      :  hnew
    // Description :  Allocate fluid[]
    //
-   // Note        :  Do nothing if fluid[] has been allocated
+   // Note        :  1. Do nothing if fluid[] has been allocated
+   //                2. Use the location reserved in group_data[] if available (see SetGroupSlot())
    //===================================================================================
    void hnew()
    {
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+         if ( fluid_slot != NULL )  fluid = fluid_slot;
+         else                       fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
          fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -704,11 +742,13 @@ struct patch_t
    //===================================================================================
    // Method      :  hdelete
    // Description :  Deallocate fluid[]
+   //
+   // Note        :  fluid[] stored in group_data[] is released by GroupDelete() instead
    //===================================================================================
    void hdelete()
    {
 
-      delete [] fluid;
+      if ( fluid != fluid_slot )    delete [] fluid;
       fluid = NULL;
 
 #     ifdef MASSIVE_PARTICLES
@@ -725,14 +765,16 @@ struct patch_t
    // Method      :  mnew
    // Description :  Allocate magnetic[]
    //
-   // Note        :  Do nothing if magnetic[] has been allocated
+   // Note        :  1. Do nothing if magnetic[] has been allocated
+   //                2. Use the location reserved in group_data[] if available (see SetGroupSlot())
    //===================================================================================
    void mnew()
    {
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         if ( magnetic_slot != NULL )  magnetic = magnetic_slot;
+         else                          magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -743,11 +785,13 @@ struct patch_t
    //===================================================================================
    // Method      :  mdelete
    // Description :  Deallocate magnetic[]
+   //
+   // Note        :  magnetic[] stored in group_data[] is released by GroupDelete() instead
    //===================================================================================
    void mdelete()
    {
 
-      delete [] magnetic;
+      if ( magnetic != magnetic_slot )    delete [] magnetic;
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -760,12 +804,13 @@ struct patch_t
    // Method      :  gnew
    // Description :  Allocate pot[] (and pot_ext[] for STORE_POT_GHOST)
    //
-   // Note        :  Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   // Note        :  1. Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   //                2. Use the location reserved in group_data[] for pot[] if available (see SetGroupSlot())
    //===================================================================================
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )      pot     = ( pot_slot != NULL ) ? pot_slot : new real [PS1][PS1][PS1];
 
 #     ifdef STORE_POT_GHOST
       if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
@@ -782,11 +827,13 @@ struct patch_t
    //===================================================================================
    // Method      :  gdelete
    // Description :  Deallocate pot[] (and pot_ext[] for STORE_POT_GHOST)
+   //
+   // Note        :  pot[] stored in group_data[] is released by GroupDelete() instead
    //===================================================================================
    void gdelete()
    {
 
-      delete [] pot;
+      if ( pot != pot_slot )  delete [] pot;
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
@@ -799,6 +846,108 @@ struct patch_t
 
 
 
+   //===================================================================================
+   // Method      :  GroupNew
+   // Description :  Allocate group_data[] for fluid[], magnetic[], and pot[] of all patches in a patch group
+   //
+   // Note        :  1. Invoked by AMR_t::pnew() for the patch with LocalID == 0 and Sg == 0
+   //                2. Do nothing if group_data[] has been allocated
+   //                3. group_data[] is 64-byte aligned
+   //                4. Sizes of different fields are set by GROUP_SIZE_FLU/MAG/POT in Macro.h
+   //===================================================================================
+   void GroupNew()
+   {
+
+      if ( group_data == NULL )
+      {
+         if (  posix_memalign( (void**)&group_data, 64, (GROUP_SIZE_FLU+GROUP_SIZE_MAG+GROUP_SIZE_POT)*sizeof(real) ) != 0  )
+            Aux_Error( ERROR_INFO, "posix_memalign() failed for group_data[] !!\n" );
+      }
+
+   } // METHOD : GroupNew
+
+
+
+   //===================================================================================
+   // Method      :  GroupDelete
+   // Description :  Deallocate group_data[]
+   //
+   // Note        :  1. Invalidate fluid[], magnetic[], and pot[] of all patches in the same patch group stored in
+   //                   group_data[]
+   //                   --> Must only be invoked when deleting the entire patch group
+   //===================================================================================
+   void GroupDelete()
+   {
+
+      free( group_data );
+      group_data = NULL;
+
+   } // METHOD : GroupDelete
+
+
+
+   //===================================================================================
+   // Method      :  SetGroupSlot
+   // Description :  Set the locations reserved for fluid[], magnetic[], and pot[] in the group_data[]
+   //                of the patch group
+   //
+   // Note        :  1. Invoked by AMR_t::pnew() before allocating any field array
+   //                2. Arrays allocated individually before the patch group gets group_data[] (which is possible
+   //                   for OPT__REUSE_MEMORY) are deallocated here
+   //                   --> The next hnew()/mnew()/gnew() will use group_data[] instead
+   //
+   // Parameter   :  GroupData : group_data[] of the patch with LocalID == 0 and Sg == 0 in the same patch group
+   //                            --> NULL if it has not been allocated
+   //                Sg        : Sandglass of this patch
+   //                LocalID   : Local index of this patch in the patch group
+   //===================================================================================
+   void SetGroupSlot( real *GroupData, const int Sg, const int LocalID )
+   {
+
+      const int Slot = Sg*8 + LocalID;
+
+      if ( GroupData == NULL )
+      {
+         fluid_slot    = NULL;
+#        ifdef MHD
+         magnetic_slot = NULL;
+#        endif
+#        ifdef GRAVITY
+         pot_slot      = NULL;
+#        endif
+
+         return;
+      }
+
+      fluid_slot = ( real (*)[PS1][PS1][PS1] )( GroupData + Slot*NCOMP_TOTAL*CUBE(PS1) );
+      if ( fluid != NULL  &&  fluid != fluid_slot )
+      {
+         delete [] fluid;
+         fluid = NULL;
+      }
+
+#     ifdef MHD
+      magnetic_slot = ( real (*)[ PS1P1*SQR(PS1) ] )( GroupData + GROUP_SIZE_FLU + Slot*NCOMP_MAG*PS1P1*SQR(PS1) );
+      if ( magnetic != NULL  &&  magnetic != magnetic_slot )
+      {
+         delete [] magnetic;
+         magnetic = NULL;
+      }
+#     endif
+
+#     ifdef GRAVITY
+      pot_slot = ( real (*)[PS1][PS1] )( GroupData + GROUP_SIZE_FLU + GROUP_SIZE_MAG + Slot*CUBE(PS1) );
+      if ( pot != NULL  &&  pot != pot_slot )
+      {
+         delete [] pot;
+         pot = NULL;
+      }
+#     endif
+
+   } // METHOD : SetGroupSlot
+
+
+
 #  ifdef DUAL_ENERGY
    //===================================================================================
    // Method      :  snew
@@ -0,0 +1,191 @@
+#ifndef __PATCH_TABLE_H__
+#define __PATCH_TABLE_H__
+
+
+
+#include "Macro.h"
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+
+struct patch_t;
+
+
+// number of patch pointers per chunk (must be a power of two)
+#define PATCH_TABLE_CHUNK_BITS   12
+#define PATCH_TABLE_CHUNK        ( 1 << PATCH_TABLE_CHUNK_BITS )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PatchTable_t
+// Description :  Growable table of the patch pointers at one level and one sandglass
+//
+// Note        :  1. Used by AMR_t::patch[Sg][lv] so that amr->patch[Sg][lv][PID] works as a fixed array
+//                2. Pointers are stored in chunks of PATCH_TABLE_CHUNK pointers
+//                   --> Chunks are allocated on demand and never moved, so references to the table entries
+//                       (e.g., &amr->patch[Sg][lv][PID] passed to Aux_SwapPointer()) remain valid after the
+//                       table grows
+//                   --> Only the small chunk directory is reallocated when it is full
+//                3. All entries are initialized as NULL
+//                4. operator[] never grows the table and is therefore safe to call inside OpenMP parallel regions
+//                   --> The table only grows through Reserve(), which is called by AMR_t::pnew() before
+//                       allocating a new patch
+//                   --> Accessing PID >= Capacity() is an error, which is only checked in the debug mode
+//
+// Data Member :  Chunk     : Chunk directory: Chunk[c][i] stores the patch pointer of PID = c*PATCH_TABLE_CHUNK + i
+//                NChunk    : Number of allocated chunks
+//                NDir      : Size of the chunk directory
+//
+// Method      :  PatchTable_t  : Constructor
+//               ~PatchTable_t  : Destructor
+//                operator[]    : Return the reference of the patch pointer of a given PID
+//                Reserve       : Allocate chunks for PID < NPatch
+//                Capacity      : Return the number of allocated entries
+//                MemSize       : Return the memory consumption in bytes
+//-------------------------------------------------------------------------------------------------------
+struct PatchTable_t
+{
+
+// data members
+// ===================================================================================
+   patch_t ***Chunk;
+   int        NChunk;
+   int        NDir;
+
+
+
+   //===================================================================================
+   // Constructor :  PatchTable_t
+   // Description :  Constructor of the structure "PatchTable_t"
+   //
+   // Note        :  No chunk is allocated
+   //===================================================================================
+   PatchTable_t()
+   {
+
+      Chunk  = NULL;
+      NChunk = 0;
+      NDir   = 0;
+
+   } // METHOD : PatchTable_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~PatchTable_t
+   // Description :  Destructor of the structure "PatchTable_t"
+   //
+   // Note        :  Only deallocate the table --> patches must be deallocated by the owner
+   //===================================================================================
+   ~PatchTable_t()
+   {
+
+      for (int c=0; c<NChunk; c++)  delete [] Chunk[c];
+
+      delete [] Chunk;
+
+      Chunk  = NULL;
+      NChunk = 0;
+      NDir   = 0;
+
+   } // METHOD : ~PatchTable_t
+
+
+
+   //===================================================================================
+   // Method      :  operator[]
+   // Description :  Return the reference of the patch pointer of a given PID
+   //
+   // Note        :  1. Do NOT grow the table --> call Reserve() in advance
+   //                2. Entries with PID < Capacity() that have never been allocated are NULL
+   //
+   // Parameter   :  PID : Target patch ID
+   //===================================================================================
+   patch_t*& operator[]( const int PID )
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( PID < 0  ||  PID >= Capacity() )
+         Aux_Error( ERROR_INFO, "incorrect PID = %d (capacity = %d) !!\n", PID, Capacity() );
+#     endif
+
+      return Chunk[ PID >> PATCH_TABLE_CHUNK_BITS ][ PID & (PATCH_TABLE_CHUNK-1) ];
+
+   } // METHOD : operator[]
+
+
+
+   //===================================================================================
+   // Method      :  Reserve
+   // Description :  Allocate chunks to store the pointers of PID < NPatch
+   //
+   // Note        :  1. New entries are initialized as NULL
+   //                2. Existing chunks are not moved
+   //
+   // Parameter   :  NPatch : Number of entries to be stored
+   //===================================================================================
+   void Reserve( const int NPatch )
+   {
+
+      const int NChunkNew = ( NPatch + PATCH_TABLE_CHUNK - 1 ) >> PATCH_TABLE_CHUNK_BITS;
+
+      if ( NChunkNew <= NChunk )    return;
+
+//    grow the chunk directory by at least a factor of two
+      if ( NChunkNew > NDir )
+      {
+         const int NDirNew = MAX( NChunkNew, 2*NDir );
+         patch_t ***ChunkNew = new patch_t** [NDirNew];
+
+         for (int c=0; c<NChunk; c++)  ChunkNew[c] = Chunk[c];
+
+         delete [] Chunk;
+         Chunk = ChunkNew;
+         NDir  = NDirNew;
+      }
+
+//    allocate new chunks
+      for (int c=NChunk; c<NChunkNew; c++)
+      {
+         Chunk[c] = new patch_t* [PATCH_TABLE_CHUNK];
+
+         for (int i=0; i<PATCH_TABLE_CHUNK; i++)   Chunk[c][i] = NULL;
+      }
+
+      NChunk = NChunkNew;
+
+   } // METHOD : Reserve
+
+
+
+   //===================================================================================
+   // Method      :  Capacity
+   // Description :  Return the number of allocated entries
+   //===================================================================================
+   int Capacity() const
+   {
+
+      return NChunk*PATCH_TABLE_CHUNK;
+
+   } // METHOD : Capacity
+
+
+
+   //===================================================================================
+   // Method      :  MemSize
+   // Description :  Return the memory consumption of this table in bytes
+   //===================================================================================
+   long MemSize() const
+   {
+
+      return (long)NChunk*PATCH_TABLE_CHUNK*sizeof(patch_t*) + (long)NDir*sizeof(patch_t**);
+
+   } // METHOD : MemSize
+
+
+}; // struct PatchTable_t
+
+
+
+#endif // #ifndef __PATCH_TABLE_H__
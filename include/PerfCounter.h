@@ -0,0 +1,152 @@
+#ifndef __PERFCOUNTER_H__
+#define __PERFCOUNTER_H__
+
+
+
+#ifdef PERF_COUNTER
+
+void Aux_Message( FILE *Type, const char *Format, ... );
+int  Aux_PerfCounter_GetNThread();
+void Aux_PerfCounter_Read( long (*Count)[PERF_NEVENT] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PerfCounter_t
+// Description :  Data structure for accumulating the hardware performance counters of a code section
+//
+// Note        :  1. Used by the option "PERF_COUNTER"
+//                2. Counters of all OpenMP threads are opened once by Aux_PerfCounter_Init() and keep
+//                   counting throughout the run
+//                   --> Start() and Stop() only take snapshots from the master thread, so they must be
+//                       invoked outside OpenMP parallel regions
+//                   --> Different PerfCounter_t objects can be nested or overlapped
+//                3. Events are defined by PERF_* in Macro.h
+//
+// Data Member :  Status  : (false / true) <--> (stop / counting)
+//                NThread : Number of OpenMP threads
+//                Count   : Accumulated counts of each thread and event
+//
+// Method      :  PerfCounter_t  : Constructor
+//               ~PerfCounter_t  : Destructor
+//                Start          : Start counting
+//                Stop           : Stop counting
+//                Reset          : Reset counter
+//-------------------------------------------------------------------------------------------------------
+struct PerfCounter_t
+{
+
+// data members
+// ===================================================================================
+   bool   Status;
+   int    NThread;
+   long (*Count)[PERF_NEVENT];
+   long (*Snapshot)[PERF_NEVENT];
+
+
+
+   //===================================================================================
+   // Constructor :  PerfCounter_t
+   // Description :  Constructor of the structure "PerfCounter_t"
+   //
+   // Note        :  1. Initialize all data members
+   //                2. Must be invoked after Aux_PerfCounter_Init()
+   //===================================================================================
+   PerfCounter_t()
+   {
+      Status   = false;
+      NThread  = Aux_PerfCounter_GetNThread();
+      Count    = new long [NThread][PERF_NEVENT];
+      Snapshot = new long [NThread][PERF_NEVENT];
+
+      Reset();
+   }
+
+
+
+   //===================================================================================
+   // Destructor  :  ~PerfCounter_t
+   // Description :  Destructor of the structure "PerfCounter_t"
+   //
+   // Note        :  Release memory
+   //===================================================================================
+   ~PerfCounter_t()
+   {
+      delete [] Count;
+      delete [] Snapshot;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Start
+   // Description :  Start counting and set status as "true"
+   //
+   // Note        :  1. Counter must not already be running
+   //                2. Results of multiple Start()/Stop() pairs are accumulated
+   //===================================================================================
+   void Start()
+   {
+#     ifdef GAMER_DEBUG
+      if ( Status )  Aux_Message( stderr, "WARNING : performance counter has already been started !!\n" );
+#     endif
+
+      Aux_PerfCounter_Read( Snapshot );
+
+      for (int t=0; t<NThread; t++)
+      for (int e=0; e<PERF_NEVENT; e++)   Count[t][e] -= Snapshot[t][e];
+
+      Status = true;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Stop
+   // Description :  Stop counting and set status as "false"
+   //
+   // Note        :  Counter must already be running
+   //===================================================================================
+   void Stop()
+   {
+#     ifdef GAMER_DEBUG
+      if ( !Status )    Aux_Message( stderr, "WARNING : performance counter has NOT been started !!\n" );
+#     endif
+
+      Aux_PerfCounter_Read( Snapshot );
+
+      for (int t=0; t<NThread; t++)
+      for (int e=0; e<PERF_NEVENT; e++)   Count[t][e] += Snapshot[t][e];
+
+      Status = false;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Reset
+   // Description :  Reset the counter
+   //
+   // Note        :  Counter must not be running
+   //===================================================================================
+   void Reset()
+   {
+#     ifdef GAMER_DEBUG
+      if ( Status )  Aux_Message( stderr, "WARNING : resetting a running performance counter !!\n" );
+#     endif
+
+      for (int t=0; t<NThread; t++)
+      for (int e=0; e<PERF_NEVENT; e++)   Count[t][e] = 0;
+   }
+
+
+}; // struct PerfCounter_t
+
+
+
+#endif // #ifdef PERF_COUNTER
+
+
+
+#endif // #ifndef __PERFCOUNTER_H__
@@ -31,19 +31,40 @@ void Aux_DeleteTimer();
 void Aux_ResetTimer();
 void Aux_AccumulatedTiming( const double TotalT, double InitT, double OtherT );
 void Aux_Record_Timing();
+#ifdef PERF_COUNTER
+void Aux_PerfCounter_Init();
+void Aux_PerfCounter_End();
+#endif
+#ifdef TIMING
+void Aux_CreateTrace();
+void Aux_DeleteTrace();
+void Aux_Trace_SetStep( const long NextStep );
+void Aux_Trace_Begin( const char *Name, const int Level );
+void Aux_Trace_End();
+void Aux_Record_Trace();
+#endif
 void Aux_Record_PatchCount();
 void Aux_Record_Performance( const double ElapsedTime );
 void Aux_Record_CorrUnphy();
 void Aux_Record_Center();
+void Aux_Record_Clump();
 int  Aux_CountRow( const char *FileName );
 void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double r_max_input, const double dr_min,
                          const bool LogBin, const double LogBinRatio, const bool RemoveEmpty, const long TVarBitIdx[],
                          const int NProf, const int MinLv, const int MaxLv, const PatchType_t PatchType,
                          const double PrepTimeIn );
+void Aux_ComputeProfile_Batch( Profile_t *Prof[], const double Center[][3], const double r_max_input[], const int NCenter,
+                               const double dr_min, const bool LogBin, const double LogBinRatio, const bool RemoveEmpty,
+                               const long TVarBitIdx[], const int NProf, const int MinLv, const int MaxLv,
+                               const PatchType_t PatchType, const double PrepTimeIn );
 void Aux_FindExtrema( Extrema_t *Extrema, const ExtremaMode_t Mode, const int MinLv, const int MaxLv,
                       const PatchType_t PatchType );
 void Aux_FindWeightedAverageCenter( double WeightedAverageCenter[], const double Center_ref[], const double MaxR, const double MinWD,
                                     const long WeightingDensityField, const double TolErrR, const int MaxIter, double *FinaldR, int *FinalNIter );
+void Aux_FindClump( Clump_t **Clump, int *NClump, const long Field, const double Threshold, const long MinNCell );
+#ifdef MASSIVE_PARTICLES
+void Aux_FindParticleGroup( Clump_t **Group, int *NGroup, const double LinkLen, const long MinNPar );
+#endif
 #ifndef SERIAL
 void Aux_Record_BoundaryPatch( const int lv, int *NList, int **IDList, int **PosList );
 #endif
@@ -59,6 +80,25 @@ int Aux_IsFinite( const double x );
 void Aux_PauseManually();
 
 
+// Benchmark (gamer_bench)
+bool Bench_Selected( const char *Kernel );
+void Bench_Measure( const char *Kernel, const char *Variant, const char *Unit, const double Work,
+                    void (*Func)( const int NRep ), const bool ThreadScaling );
+void Bench_FluidSolver();
+void Bench_PreparePatchData();
+void Bench_Interpolate();
+#ifdef GRAVITY
+void Bench_PoissonSolver();
+void Bench_LevelMG();
+#endif
+#ifdef MASSIVE_PARTICLES
+void Bench_MassAssignment();
+#endif
+#ifndef SERIAL
+void Bench_Alltoallv();
+#endif
+
+
 // Buffer
 #ifndef SERIAL
 void Buf_AllocateBufferPatch_Base( AMR_t *Tamr );
@@ -160,7 +200,7 @@ real Hydro_Con2HTilde( const real Con[], const EoS_GUESS_t EoS_GuessHTilde, cons
                        const real *const EoS_Table[EOS_NTABLE_MAX] );
 #endif
 int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
-                   const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI, const bool Overlap_Sync );
+                   const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI );
 void Flu_AllocateFluxArray( const int lv );
 void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
@@ -209,6 +249,10 @@ void EvolveLevel( const int lv, const double dTime_FaLv );
 void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt_in,
                    const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
                    const bool OverlapMPI, const bool Overlap_Sync );
+void InvokeSolver_Prepare( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                           const int NPG, const int *PID0_List );
+void InvokeSolver_Solve( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                         const int NPG, const double dt, const double Poi_Coeff );
 void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, real *OutputFC,
                         const int GhostSize, const int NPG, const int *PID0_List, long TVarCC, long TVarFC,
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
@@ -249,11 +293,14 @@ void Init_Field();
 FieldIdx_t AddField( const char *InputLabel, const FixUpFlux_t FixUp_Flux, const FixUpRestrict_t FixUp_Restrict,
                      const NormPassive_t Norm, const IntFracPassive_t IntFrac );
 FieldIdx_t GetFieldIndex( const char *InputLabel, const Check_t Check );
+long GetFieldBIdx( const char *InputLabel, const Check_t Check );
+const char *GetFieldBIdxLabel( const long BIdx );
 #ifdef OPENMP
 void Init_OpenMP();
 #endif
 #ifdef SUPPORT_HDF5
-void Init_ByRestart_HDF5( const char *FileName );
+void Init_ByRestart_HDF5( const char *FileName, const bool NodeLocal );
+void Init_ByRestart_NodeLocal( const char *DirName );
 #endif
 #ifdef SUPPORT_FFTW
 void End_FFTW();
@@ -262,6 +309,7 @@ void Patch2Slab( real *VarS, real *SendBuf_Var, real *RecvBuf_Var, long *SendBuf
                  int **List_PID, int **List_k, long *List_NSend_Var, long *List_NRecv_Var,
                  const int *List_z_start, const int local_nz, const int FFT_Size[], const int NRecvSlice,
                  const double PrepTime, const long TVar, const bool InPlacePad, const bool ForPoisson, const bool AddExtraMass );
+int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
 void Slab2Patch( const real *VarS, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_SIdx,
                  int **List_PID, int **List_k, long *List_NSend, long *List_NRecv, const int local_nz, const int FFT_Size[],
                  const int NSendSlice, const long TVar, const bool InPlacePad );
@@ -307,6 +355,18 @@ void   dt_Prepare_Pot( const int lv, real h_Pot_Array_T[][ CUBE(GRA_NXT) ], cons
                        const double PrepTime );
 #endif
 void   dt_Close( const real h_dt_Array_T[], const int NPG );
+#if ( MODEL == HYDRO )
+void   dt_Fused_Start( const int lv );
+real   dt_Fused_Flu( const int lv, const int FluSg, const int MagSg, const int PID0 );
+#ifdef GRAVITY
+real   dt_Fused_Gra( const int lv, const real Pot_Array[][ CUBE(GRA_NXT) ], const double Corner_Array[][3],
+                     const double TimeNew );
+#endif
+void   dt_Fused_Record( const Solver_t TSolver, const int lv, const double dt_min );
+bool   dt_Fused_Get( const Solver_t TSolver, const int lv, double *dt_min );
+void   dt_Fused_Invalidate( const int lv );
+void   dt_Fused_MemFree();
+#endif
 void   CPU_dtSolver( const Solver_t TSolver, real dt_Array[], const real Flu_Array[][FLU_NIN_T][ CUBE(PS1) ],
                      const real Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const real Pot_Array[][ CUBE(GRA_NXT) ],
                      const double Corner_Array[][3], const int NPatchGroup, const real dh, const real Safety,
@@ -323,6 +383,9 @@ void MPI_ExchangeData( const int TargetRank[2], const int SendSize[2], const int
                        real *SendBuffer[2], real *RecvBuffer[2] );
 void MPI_Exit();
 template <typename T> void MPI_Alltoallv_GAMER( T * SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_DataType, MPI_Comm comm );
+void MPI_Init_NodeAware( MPI_Comm NodeComm );
+void MPI_End_NodeAware();
+template <typename T> bool MPI_Alltoallv_NodeAware( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
 #endif // #ifndef SERIAL
 
 
@@ -333,8 +396,11 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
 void Output_DumpData_Total( const char *FileName );
 #ifdef SUPPORT_HDF5
 void Output_DumpData_Total_HDF5( const char *FileName );
+void Output_DumpData_NodeLocal( const int Stage );
+void Output_NodeLocal_WaitDrain();
 #endif
 void Output_DumpManually( int &Dump_global );
+void Output_Image( const int Stage );
 void Output_FlagMap( const int lv, const int xyz, const char *comment );
 void Output_Flux( const int lv, const int PID, const int Sib, const char *comment );
 void Output_PatchCorner( const int lv, const char *comment );
@@ -345,7 +411,9 @@ void Output_PreparedPatch_Fluid( const int TLv, const int TPID,
                                  const real h_Mag_Array[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                  const int NPG, const int *PID0_List, const int CLv, const char *comment );
 #ifdef SUPPORT_FFTW
-void Output_BasePowerSpectrum( const char *FileName, const long TVar );
+void Output_BasePowerSpectrum( const char *FileName, const int NVar, const long *TVar, const bool Cross, const int Level );
+void Output_BasePowerSpectrum( const char *FileName );
+void Output_BasePowerSpectrum_Step( const int Stage );
 #endif
 void Output_L1Error( void (*AnalFunc_Flu)( real fluid[], const double x, const double y, const double z, const double Time,
                                            const int lv, double AuxArray[] ),
@@ -409,13 +477,16 @@ void CPU_ExtPotSolver_BaseLevel( const ExtPot_t Func, const double AuxArray_Flt[
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime );
 void Init_GreenFuncK();
 #endif
+int  CPU_PoissonSolver_LevelMG( const int lv, const real Poi_Coeff, const int SaveSg, const double PrepTime,
+                                const int MaxIter, const bool GuessFromPot, double *ErrHist );
 void End_MemFree_PoissonGravity();
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                     const int SaveSg_Flu, const int SaveSg_Pot, const bool Poisson, const bool Gravity,
-                    const bool OverlapMPI, const bool Overlap_Sync, const bool Timing );
+                    const bool OverlapMPI, const bool Timing );
 void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_NIN][PS1][PS1][PS1],
                 const char h_DE_Array_G[][PS1][PS1][PS1], const real h_Emag_Array_G[][PS1][PS1][PS1],
-                const int NPG, const int *PID0_List );
+                const real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT], const double h_Corner_Array_PGT[][3],
+                const int NPG, const int *PID0_List, const double TimeNew );
 void Gra_Prepare_Flu( const int lv, real h_Flu_Array_G[][GRA_NIN][PS1][PS1][PS1], char h_DE_Array_G[][PS1][PS1][PS1],
                       real h_Emag_Array_G[][PS1][PS1][PS1], const int NPG, const int *PID0_List );
 void Gra_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
@@ -485,9 +556,11 @@ void LB_ExchangeFlaggedBuffer( const int lv );
 void LB_FindFather( const int SonLv, const bool SearchAllSon, const int NInput, int* TargetSonPID0, const bool ResetSonID );
 void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput, int* TargetFaPID );
 void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
-                       const long TVarCC, const long TVarFC, const int ParaBuf );
+                       const long TVarCC, const long TVarFC, const int ParaBuf, void (*OverlapFunc)( void *Arg ) = NULL,
+                       void *OverlapArg = NULL );
 void*LB_GetBufferData_MemAllocate_Send( const long SendSize );
 void*LB_GetBufferData_MemAllocate_Recv( const long RecvSize );
+void LB_GetBufferData_FreePersistReq( const int lv );
 void LB_GrandsonCheck( const int lv );
 void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, const double ParWeight, const bool Reset,
                           const bool SortRealPatch, const int TLv );
@@ -3,6 +3,7 @@
 
 
 #include <typeinfo>
+#include <ctype.h>
 #include "Macro.h"
 #include "Global.h"
 
@@ -226,6 +227,8 @@ struct ReadPara_t
    //
    // Note        :  1. Format:   KEY   VALUE
    //                2. Use # to comment out lines
+   //                3. VALUE cannot contain spaces
+   //                   --> Issue a warning if VALUE is followed by anything other than a comment
    //===================================================================================
    void Read( const char *FileName )
    {
@@ -235,7 +238,7 @@ struct ReadPara_t
 
 
       char LoadKey[MAX_STRING], LoadValue[MAX_STRING];
-      int  MatchIdx, LineNum=0, NLoad;
+      int  MatchIdx, LineNum=0, NLoad, NChar;
 
       char *Line = new char [MAX_STRING];
       FILE *File = fopen( FileName, "r" );
@@ -247,7 +250,8 @@ struct ReadPara_t
          LineNum ++;
 
 //       load the key and value at the target line
-         NLoad = sscanf( Line, "%s%s", LoadKey, LoadValue );
+         NChar = 0;
+         NLoad = sscanf( Line, "%s%s%n", LoadKey, LoadValue, &NChar );
 
 //       skip lines with incorrect format (e.g., empty lines)
          if ( NLoad < 2 )
@@ -278,6 +282,16 @@ struct ReadPara_t
 
          if ( MatchIdx >= 0 )
          {
+//          check whether the value is followed by extra tokens that are not comments
+//          --> skip values already ending with a comment (e.g., "1.0#comment")
+            const char *Remain = Line + NChar;
+            while ( isspace(*Remain) )    Remain ++;
+
+            if ( *Remain != '\0'  &&  *Remain != COMMENT_SYM  &&  strchr( LoadValue, COMMENT_SYM ) == NULL  &&
+                 MPI_Rank == 0 )
+               Aux_Message( stderr, "WARNING : extra tokens after parameter [%-30s] at line %4d are ignored (value = \"%s\") !!\n",
+                            LoadKey, LineNum, LoadValue );
+
             switch ( Type[MatchIdx] )
             {
                case TYPE_INT    :   GET_VOID( int,    Ptr[MatchIdx] ) = (int   )atol( LoadValue );    break;
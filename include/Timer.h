@@ -8,6 +8,16 @@
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 void Aux_Message( FILE *Type, const char *Format, ... );
 
+#ifdef PERF_COUNTER
+struct PerfCounter_t;
+#endif
+
+#ifdef TIMING
+extern bool Trace_Active;
+void Aux_Trace_Begin( const char *Name, const int Level );
+void Aux_Trace_End();
+#endif
+
 
 
 
@@ -17,6 +27,8 @@ void Aux_Message( FILE *Type, const char *Format, ... );
 //
 // Data Member :  Status : (false / true) <--> (stop / ticking)
 //                Time   : Variable recording the elapsed time (in microseconds)
+//                Perf   : Hardware performance counters attached to this timer by Aux_CreateTimer()
+//                         --> Only for the option "PERF_COUNTER" and is started/stopped by TIMING_SYNC()
 //
 // Method      :  Timer_t  : Constructor
 //               ~Timer_t  : Destructor
@@ -32,6 +44,9 @@ struct Timer_t
 // ===================================================================================
    bool  Status;
    ulong Time;
+#  ifdef PERF_COUNTER
+   PerfCounter_t *Perf;
+#  endif
 
 
 
@@ -45,6 +60,9 @@ struct Timer_t
    {
       Time   = 0;
       Status = false;
+#     ifdef PERF_COUNTER
+      Perf   = NULL;
+#     endif
    }
 
 
@@ -145,6 +163,30 @@ struct Timer_t
 
 
 
+// macros for the event tracer of OPT__RECORD_TRACE (see Aux_Trace.cpp)
+// --> name must be a string literal
+// --> lv < 0 if not applicable
+#ifdef TIMING
+
+#  define TRACE_BEGIN( name, lv )   { if ( Trace_Active )  Aux_Trace_Begin( name, lv ); }
+#  define TRACE_END()               { if ( Trace_Active )  Aux_Trace_End(); }
+
+#else
+
+#  define TRACE_BEGIN( name, lv )
+#  define TRACE_END()
+
+#endif
+
+// MPI barrier shown as an event in the trace
+#define TRACE_MPI_BARRIER()                                     \
+   {                                                              \
+      TRACE_BEGIN( "MPI_Barrier", -1 );                           \
+      MPI_Barrier( MPI_COMM_WORLD );                              \
+      TRACE_END();                                                \
+   }
+
+
 // macro for timing functions
 #ifdef TIMING
 
@@ -152,15 +194,17 @@ struct Timer_t
    {                                                                 \
       if ( timer_on )                                                \
       {                                                              \
-         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
+         if ( OPT__TIMING_BARRIER ) TRACE_MPI_BARRIER();             \
          timer->Start();                                             \
+         TRACE_BEGIN( #call, -1 );                                   \
       }                                                              \
                                                                      \
       call;                                                          \
                                                                      \
       if ( timer_on )                                                \
       {                                                              \
-         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
+         TRACE_END();                                                \
+         if ( OPT__TIMING_BARRIER ) TRACE_MPI_BARRIER();             \
          timer->Stop();                                              \
       }                                                              \
    }
@@ -173,6 +217,7 @@ struct Timer_t
 
 
 // macro for timing solvers
+// --> solvers are still traced for OPT__RECORD_TRACE when TIMING_SOLVER is off
 #if ( defined TIMING_SOLVER  &&  defined TIMING )
 
 #  ifdef GPU
@@ -181,16 +226,37 @@ struct Timer_t
 #     define GPU_SYNC()
 #  endif
 
+#  ifdef PERF_COUNTER
+#     define PERF_START( timer )   { if ( timer->Perf != NULL )  timer->Perf->Start(); }
+#     define PERF_STOP( timer )    { if ( timer->Perf != NULL )  timer->Perf->Stop();  }
+#  else
+#     define PERF_START( timer )
+#     define PERF_STOP( timer )
+#  endif
+
 #  define TIMING_SYNC( call, timer )                              \
    {                                                              \
-      if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
+      if ( OPT__TIMING_BARRIER ) TRACE_MPI_BARRIER();             \
       timer->Start();                                             \
+      PERF_START( timer );                                        \
+      TRACE_BEGIN( #call, -1 );                                   \
       call;                                                       \
       GPU_SYNC();                                                 \
-      if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
+      TRACE_END();                                                \
+      PERF_STOP( timer );                                         \
+      if ( OPT__TIMING_BARRIER ) TRACE_MPI_BARRIER();             \
       timer->Stop();                                              \
    }
 
+#elif ( defined TIMING )
+
+#  define TIMING_SYNC( call, timer )                              \
+   {                                                              \
+      TRACE_BEGIN( #call, -1 );                                   \
+      call;                                                       \
+      TRACE_END();                                                \
+   }
+
 #else
 
 #  define TIMING_SYNC( call, timer )   call
@@ -27,6 +27,14 @@ void Aux_Check_Parameter()
 #     error : ERROR : TIMING_SOLVER must work with TIMING !!
 #  endif
 
+#  if ( defined PERF_COUNTER  &&  !defined TIMING_SOLVER )
+#     error : ERROR : PERF_COUNTER must work with TIMING_SOLVER !!
+#  endif
+
+#  if ( defined PERF_COUNTER  &&  !defined __linux__ )
+#     error : ERROR : PERF_COUNTER only works on Linux !!
+#  endif
+
 #  if ( defined OPENMP  &&  !defined _OPENMP )
 #     error : ERROR : something is wrong in OpenMP; the macro "_OPENMP" is NOT defined !!
 #  endif
@@ -64,16 +72,11 @@ void Aux_Check_Parameter()
 #  ifdef SERIAL
    int NRank = 1;
 #  else
-   int NRank, MPI_Thread_Status, MPI_Init_Status;
+   int NRank, MPI_Init_Status;
 
    MPI_Initialized( &MPI_Init_Status );
    if ( MPI_Init_Status == false )  Aux_Error( ERROR_INFO, "MPI_Init() has not been called !!\n" );
 
-   MPI_Query_thread( &MPI_Thread_Status );
-   if ( OPT__OVERLAP_MPI  &&  MPI_Thread_Status == MPI_THREAD_SINGLE )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported since the level of MPI thread support == %s\n",
-                 "OPT__OVERLAP_MPI", "MPI_THREAD_SINGLE" );
-
    MPI_Comm_size( MPI_COMM_WORLD, &NRank );
 #  endif
 
@@ -112,6 +115,36 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "please turn on SUPPORT_HDF5 in the Makefile for OPT__OUTPUT_TOTAL == 1 !!\n" );
 #  endif
 
+   if ( OPT__OUTPUT_NODE_LOCAL )
+   {
+#     ifndef LOAD_BALANCE
+      Aux_Error( ERROR_INFO, "OPT__OUTPUT_NODE_LOCAL only supports LOAD_BALANCE !!\n" );
+#     endif
+
+#     ifndef SUPPORT_HDF5
+      Aux_Error( ERROR_INFO, "please turn on SUPPORT_HDF5 in the Makefile for OPT__OUTPUT_NODE_LOCAL !!\n" );
+#     endif
+
+      if ( NODE_LOCAL_DIR[0] == '\0' )
+         Aux_Error( ERROR_INFO, "NODE_LOCAL_DIR is empty for OPT__OUTPUT_NODE_LOCAL !!\n" );
+   }
+
+   if ( OUTPUT_LOSSY_REL_ERR > 0.0  &&  OPT__OUTPUT_DEFLATE == 0 )
+      Aux_Error( ERROR_INFO, "OUTPUT_LOSSY_REL_ERR > 0.0 requires OPT__OUTPUT_DEFLATE > 0 !!\n" );
+
+   if ( OPT__OUTPUT_IMAGE  &&  OUTPUT_IMAGE_FIELD[0] == '\0' )
+      Aux_Error( ERROR_INFO, "OUTPUT_IMAGE_FIELD is empty for OPT__OUTPUT_IMAGE !!\n" );
+
+   if ( OPT__OUTPUT_IMAGE & OUTPUT_IMAGE_SLICE )
+   {
+      const double SliceCoord[3] = { OUTPUT_IMAGE_SLICE_X, OUTPUT_IMAGE_SLICE_Y, OUTPUT_IMAGE_SLICE_Z };
+
+      for (int d=0; d<3; d++)
+         if ( SliceCoord[d] < 0.0  ||  SliceCoord[d] >= amr->BoxSize[d] )
+            Aux_Error( ERROR_INFO, "incorrect OUTPUT_IMAGE_SLICE_%c (%14.7e) (out of range [0<=%c<%lf]) !!\n",
+                       'X'+d, SliceCoord[d], 'X'+d, amr->BoxSize[d] );
+   }
+
    if (  ( OPT__OUTPUT_PART == OUTPUT_YZ  ||  OPT__OUTPUT_PART == OUTPUT_Y  ||  OPT__OUTPUT_PART == OUTPUT_Z )  &&
          ( OUTPUT_PART_X < 0.0  ||  OUTPUT_PART_X >= amr->BoxSize[0] )  )
       Aux_Error( ERROR_INFO, "incorrect OUTPUT_PART_X (out of range [0<=X<%lf]) !!\n", amr->BoxSize[0] );
@@ -128,8 +161,27 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n",
                  "OPT__OUTPUT_PART == 7 (OUTPUT_DIAG)" );
 
-   if (  OPT__OUTPUT_BASEPS  &&  ( NX0_TOT[0] != NX0_TOT[1] || NX0_TOT[0] != NX0_TOT[2] )  )
-      Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n", "OPT__OUTPUT_BASEPS" );
+   if (  ( OPT__OUTPUT_BASEPS || OUTPUT_BASEPS_STEP > 0 )  &&  ( NX0_TOT[0] != NX0_TOT[1] || NX0_TOT[0] != NX0_TOT[2] )  )
+      Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n", "OPT__OUTPUT_BASEPS/OUTPUT_BASEPS_STEP" );
+
+   if ( OPT__OUTPUT_BASEPS || OUTPUT_BASEPS_STEP > 0 )
+   {
+      if ( OUTPUT_BASEPS_FIELD[0] == '\0' )
+         Aux_Error( ERROR_INFO, "OUTPUT_BASEPS_FIELD is empty for OPT__OUTPUT_BASEPS/OUTPUT_BASEPS_STEP !!\n" );
+
+      if ( OUTPUT_BASEPS_LEVEL > MAX_LEVEL )
+         Aux_Error( ERROR_INFO, "OUTPUT_BASEPS_LEVEL (%d) > MAX_LEVEL (%d) !!\n", OUTPUT_BASEPS_LEVEL, MAX_LEVEL );
+
+//    the FFTW-MPI paths of the refined-grid deposit and the cross spectra have not been validated against the serial build yet
+#     ifndef SERIAL
+      if ( OUTPUT_BASEPS_LEVEL > 0 )
+         Aux_Error( ERROR_INFO, "OUTPUT_BASEPS_LEVEL (%d) > 0 is not supported in the MPI build yet --> only SERIAL !!\n",
+                    OUTPUT_BASEPS_LEVEL );
+
+      if ( OUTPUT_BASEPS_CROSS )
+         Aux_Error( ERROR_INFO, "OUTPUT_BASEPS_CROSS is not supported in the MPI build yet --> only SERIAL !!\n" );
+#     endif
+   }
 
    if ( OPT__CK_REFINE  &&  !OPT__FLAG_RHO )
       Aux_Error( ERROR_INFO, "currently the check \"%s\" must work with \"%s\" !!\n",
@@ -153,6 +205,12 @@ void Aux_Check_Parameter()
    if ( OPT__RECORD_CENTER  &&  COM_CEN_Z > amr->BoxSize[2] )
       Aux_Error( ERROR_INFO, "incorrect COM_CEN_Z = %lf (out of range [Z<=%lf]) !!\n", COM_CEN_Z, amr->BoxSize[2] );
 
+   if ( OPT__RECORD_CLUMP  &&  CLUMP_THRESHOLD == NoDef_double )
+      Aux_Error( ERROR_INFO, "CLUMP_THRESHOLD must be set for OPT__RECORD_CLUMP !!\n" );
+
+   if ( OPT__RECORD_CLUMP  &&  CLUMP_FIELD[0] == '\0' )
+      Aux_Error( ERROR_INFO, "CLUMP_FIELD is empty for OPT__RECORD_CLUMP !!\n" );
+
 #  if   ( MODEL == HYDRO )
 #  ifndef COSMIC_RAY
    const bool OPT__FLAG_LOHNER_CRAY = false;
@@ -191,15 +249,8 @@ void Aux_Check_Parameter()
                  "OVERLAP_MPI", "OPT__OVERLAP_MPI" );
 #  endif
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
-
    if ( AUTO_REDUCE_DT )
    {
-      if ( OPT__OVERLAP_MPI )
-         Aux_Error( ERROR_INFO, "currently \"%s\" does not work with \"%s\" !!\n",
-                    "AUTO_REDUCE_DT", "OPT__OVERLAP_MPI" );
-
       if ( OPT__DT_LEVEL != DT_LEVEL_FLEXIBLE )
          Aux_Error( ERROR_INFO, "\"%s\" must work with \"%s\" !!\n",
                     "AUTO_REDUCE_DT", "OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE" );
@@ -229,6 +280,9 @@ void Aux_Check_Parameter()
    if ( OPT__TIMING_MPI )  Aux_Error( ERROR_INFO, "OPT__TIMING_MPI must work with TIMING !!\n" );
 #  endif
 
+   if ( OPT__RECORD_TRACE  &&  TRACE_STEP_END < TRACE_STEP_START )
+      Aux_Error( ERROR_INFO, "TRACE_STEP_END (%ld) < TRACE_STEP_START (%ld) !!\n", TRACE_STEP_END, TRACE_STEP_START );
+
    if ( OPT__DT_LEVEL == DT_LEVEL_SHARED  &&  OPT__INT_TIME )
       Aux_Error( ERROR_INFO, "OPT__INT_TIME should be disabled when \"OPT__DT_LEVEL == DT_LEVEL_SHARED\" !!\n" );
 
@@ -335,10 +389,6 @@ void Aux_Check_Parameter()
 
 // general warnings
 // =======================================================================================
-#  ifdef OVERLAP_MPI
-#     warning : WARNING : make sure to link with multi-thread supported MPI and FFTW for "OVERLAP_MPI"
-#  endif
-
 #  ifdef OPENMP
 #  pragma omp parallel
 #  pragma omp master
@@ -438,23 +488,9 @@ void Aux_Check_Parameter()
                            "simulation boundaries are NOT allowed for refinement !!\n" );
 
    if ( OPT__OVERLAP_MPI )
-   {
       Aux_Message( stderr, "WARNING : \"%s\" is still experimental and is not fully optimized !!\n",
                    "OPT__OVERLAP_MPI" );
 
-#     ifdef OPENMP
-      omp_set_nested( true );
-
-      if ( !omp_get_nested() )
-         Aux_Message( stderr, "WARNING : OpenMP nested parallelism is NOT supported for \"%s\" !!\n",
-                      "OPT__OVERLAP_MPI" );
-
-      omp_set_nested( false );
-#     else
-      Aux_Message( stderr, "WARNING : OpenMP is NOT turned on for \"%s\" !!\n", "OPT__OVERLAP_MPI" );
-#     endif
-   } // if ( OPT__OVERLAP_MPI )
-
    if ( OPT__TIMING_BARRIER )
       Aux_Message( stderr, "WARNING : \"%s\" may deteriorate performance (especially if %s is on) ...\n",
                    "OPT__TIMING_BARRIER", "OPT__OVERLAP_MPI" );
@@ -574,6 +610,10 @@ void Aux_Check_Parameter()
       }
    }
 
+   if ( OPT__PERSISTENT_MPI  &&  OPT__NODE_AWARE_MPI )
+      Aux_Message( stderr, "WARNING : \"%s\" does not apply to the buffer-patch data exchanged with \"%s\" !!\n",
+                   "OPT__NODE_AWARE_MPI", "OPT__PERSISTENT_MPI" );
+
    } // if ( MPI_Rank == 0 )
 
 #else // #ifdef LOAD_BALANCE ... else ...
@@ -670,6 +710,34 @@ void Aux_Check_Parameter()
    if ( OPT__FREEZE_FLUID )
       Aux_Message( stderr, "REMINDER : \"%s\" will prevent fluid variables from being updated\n", "OPT__FREEZE_FLUID" );
 
+#  if ( MODEL == HYDRO )
+   if ( OPT__DT_FUSED  &&  OPT__RESET_FLUID )
+      Aux_Message( stderr, "WARNING : \"%s\" has no effect when \"%s\" is on since the dt solvers are always invoked !!\n",
+                   "OPT__DT_FUSED", "OPT__RESET_FLUID" );
+
+   if ( OPT__DT_FUSED  &&  SrcTerms.Any )
+      Aux_Message( stderr, "WARNING : \"%s\" has no effect when source terms are on since the dt solvers are always invoked !!\n",
+                   "OPT__DT_FUSED" );
+
+#  ifdef SUPPORT_GRACKLE
+   if ( OPT__DT_FUSED  &&  GRACKLE_ACTIVATE )
+      Aux_Message( stderr, "WARNING : \"%s\" has no effect when \"%s\" is on since the dt solvers are always invoked !!\n",
+                   "OPT__DT_FUSED", "GRACKLE_ACTIVATE" );
+#  endif
+
+#  ifdef STAR_FORMATION
+   if ( OPT__DT_FUSED  &&  SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
+      Aux_Message( stderr, "WARNING : \"%s\" has no effect when \"%s\" is on since the dt solvers are always invoked !!\n",
+                   "OPT__DT_FUSED", "SF_CREATE_STAR_SCHEME" );
+#  endif
+
+#  ifdef FEEDBACK
+   if ( OPT__DT_FUSED  &&  FB_Any )
+      Aux_Message( stderr, "WARNING : \"%s\" has no effect when feedback is on since the dt solvers are always invoked !!\n",
+                   "OPT__DT_FUSED" );
+#  endif
+#  endif
+
    } // if ( MPI_Rank == 0 )
 
 
@@ -868,7 +936,22 @@ void Aux_Check_Parameter()
 #  endif
 
 #  if ( EOS == EOS_NUCLEAR )
-      Aux_Error( ERROR_INFO, "EOS_NUCLEAR is not supported yet !!\n" );
+#  ifndef SUPPORT_HDF5
+#     error : ERROR : EOS_NUCLEAR must work with SUPPORT_HDF5 !!
+#  endif
+
+#  if ( NCOMP_PASSIVE_USER < 1 )
+#     error : ERROR : EOS_NUCLEAR requires the passive scalar "Ye" (NCOMP_PASSIVE_USER >= 1) !!
+#  endif
+
+      if ( !OPT__UNIT )
+         Aux_Error( ERROR_INFO, "EOS_NUCLEAR must work with OPT__UNIT !!\n" );
+
+      if ( !Aux_CheckFileExist(NUC_TABLE) )
+         Aux_Error( ERROR_INFO, "nuclear EoS table \"%s\" (NUC_TABLE) does not exist !!\n", NUC_TABLE );
+
+      if ( NUC_BENCHMARK < 0 )
+         Aux_Error( ERROR_INFO, "incorrect NUC_BENCHMARK (%ld) !!\n", NUC_BENCHMARK );
 #  endif
 
 #  if ( EOS == EOS_TABULAR )
@@ -1558,6 +1641,13 @@ void Aux_Check_Parameter()
    if ( MG_TOLERATED_ERROR < 0.0 )     Aux_Error( ERROR_INFO, "MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", MG_TOLERATED_ERROR );
 #  endif
 
+   if ( OPT__LEVEL_MG )
+   {
+      if ( LEVEL_MG_MAX_ITER < 1 )           Aux_Error( ERROR_INFO, "LEVEL_MG_MAX_ITER (%d) < 1 !!\n", LEVEL_MG_MAX_ITER );
+      if ( LEVEL_MG_TOLERATED_ERROR < 0.0 )  Aux_Error( ERROR_INFO, "LEVEL_MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", LEVEL_MG_TOLERATED_ERROR );
+      if ( PS1 & (PS1-1) )                   Aux_Error( ERROR_INFO, "PATCH_SIZE (%d) must be a power of two for OPT__LEVEL_MG !!\n", PS1 );
+   }
+
 #  if ( NLEVEL > 1 )
    int Trash_RefPot, NGhost_RefPot;
    Int_Table( OPT__REF_POT_INT_SCHEME, Trash_RefPot, NGhost_RefPot );
@@ -1590,6 +1680,9 @@ void Aux_Check_Parameter()
    if ( !OPT__SELF_GRAVITY  &&  !OPT__EXT_ACC  &&  !OPT__EXT_POT )
       Aux_Message( stderr, "WARNING : all gravity options are disabled (OPT__SELF_GRAVITY, OPT__EXT_ACC, OPT__EXT_POT) !!\n" );
 
+   if ( OPT__LEVEL_MG  &&  !OPT__SELF_GRAVITY )
+      Aux_Message( stderr, "WARNING : OPT__LEVEL_MG is useless when OPT__SELF_GRAVITY is disabled !!\n" );
+
    } // if ( MPI_Rank == 0 )
 
 
@@ -1722,9 +1815,6 @@ void Aux_Check_Parameter()
    if ( DT__PARACC > 1.0 )
       Aux_Message( stderr, "WARNING : DT__PARACC (%13.7e) is not within the normal range [0.0~1.0] !!\n", DT__PARACC );
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Message( stderr, "WARNING : PARTICLE does not support OPT__OVERLAP_MPI !!\n" );
-
 #  ifdef STORE_POT_GHOST
    if ( !amr->Par->ImproveAcc )
       Aux_Message( stderr, "WARNING : STORE_POT_GHOST is useless when PAR_IMPROVE_ACC is disabled !!\n" );
@@ -1782,7 +1872,8 @@ void Aux_Check_Parameter()
    if ( MPI_Rank == 0 ) {
 
    if ( OPT__OVERLAP_MPI )
-      Aux_Message( stderr, "WARNING : currently SUPPORT_GRACKLE does not support \"%s\" !!\n", "OPT__OVERLAP_MPI" );
+      Aux_Message( stderr, "WARNING : \"%s\" will not overlap the fluid solver with MPI communication when %s is on !!\n",
+                   "OPT__OVERLAP_MPI", "GRACKLE_ACTIVATE" );
 
    if ( GRACKLE_PRIMORDIAL > 0 )
       Aux_Message( stderr, "WARNING : adiabatic index gamma is currently fixed to %13.7e for Grackle !!\n", GAMMA );
@@ -3,6 +3,12 @@
 extern void SetTempIntPara( const int lv, const int Sg0, const double PrepTime, const double Time0, const double Time1,
                             bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
 
+static bool SkipPatch_ByType( const int lv, const int PID, const int MaxLv, const PatchType_t PatchType );
+static bool BoxOverlapSphere( const double EdgeL[], const double EdgeR[], const double Center[], const double r2,
+                              const bool Periodic[] );
+static void RemoveEmptyBin( Profile_t *Prof[], const int NProf, const bool LogBin, const double LogBinRatio,
+                            const double dr_min );
+
 
 
 
@@ -31,6 +37,8 @@ extern void SetTempIntPara( const int lv, const int Sg0, const double PrepTime,
 //                6. This routine is thread-unsafe when the temporal interpolation set by PrepTime and OPT__INT_TIME
 //                   are inconsistent with each other
 //                   --> But it shouldn't be a big issue since this routine itself has been parallelized with OpenMP
+//                7. Simply a wrapper of Aux_ComputeProfile_Batch() with a single center
+//                   --> Use Aux_ComputeProfile_Batch() directly to compute the profiles of many centers in one pass
 //
 // Parameter   :  Prof        : Profile_t object array to store the results
 //                Center      : Target center coordinates
@@ -106,10 +114,73 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                          const double PrepTimeIn )
 {
 
+   const int    NCenter          = 1;
+   const double CenterList[1][3] = { { Center[0], Center[1], Center[2] } };
+   const double r_max_List[1]    = { r_max_input };
+
+   Aux_ComputeProfile_Batch( Prof, CenterList, r_max_List, NCenter, dr_min, LogBin, LogBinRatio, RemoveEmpty,
+                             TVarBitIdx, NProf, MinLv, MaxLv, PatchType, PrepTimeIn );
+
+} // FUNCTION : Aux_ComputeProfile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_ComputeProfile_Batch
+// Description :  Compute the average radial profiles of target field(s) around multiple centers in one pass
+//
+// Note        :  1. Same as Aux_ComputeProfile() except that it supports multiple centers, each with its own
+//                   maximum radius
+//                   --> Prof[c*NProf+p] stores the profile of the field TVarBitIdx[p] around the center Center[c]
+//                   --> Profiles of different centers can have different numbers of bins
+//                2. Each AMR level is traversed only once for all centers and fields
+//                   (a) Patch groups are indexed by the root-level patch groups containing them, so only the patch
+//                       groups close to each center are tested against the sphere of the maximum radius
+//                   (b) Field data of a patch group are prepared once and reused by all overlapping centers
+//                   (c) Each OpenMP thread accumulates into its own histogram, which stores all fields of the same
+//                       bin contiguously; threads are then summed up in a fixed order for reproducibility
+//                3. Centers are processed in chunks to bound the memory of the per-thread histograms
+//                   --> All chunks share the same spatial index of each level
+//                4. A single MPI_Allreduce() is used to collect the profiles of all centers from all ranks
+//                5. See Aux_ComputeProfile() for other notes
+//
+// Parameter   :  Prof        : Profile_t object array with NCenter*NProf elements to store the results
+//                Center      : Target center coordinates of each center
+//                r_max_input : Maximum radius of each center
+//                NCenter     : Number of centers
+//                Others      : See Aux_ComputeProfile()
+//
+// Example     :  const int NHalo = 3;
+//                const double HaloCen[NHalo][3] = { { 0.2, 0.3, 0.4 }, { 0.5, 0.5, 0.5 }, { 0.8, 0.7, 0.6 } };
+//                const double HaloRad[NHalo]    = { 0.05, 0.1, 0.02 };
+//                const long   TVar[]            = { _DENS, _PRES };
+//                const int    NProf             = 2;
+//
+//                Profile_t *Prof[NHalo*NProf];
+//                for (int t=0; t<NHalo*NProf; t++)   Prof[t] = new Profile_t();
+//
+//                Aux_ComputeProfile_Batch( Prof, HaloCen, HaloRad, NHalo, amr->dh[MAX_LEVEL], true, 1.25, true,
+//                                          TVar, NProf, 0, MAX_LEVEL, PATCH_LEAF, -1.0 );
+//
+//                --> Prof[h*NProf+p] is the profile of TVar[p] around the halo h
+//
+// Return      :  Prof
+//-------------------------------------------------------------------------------------------------------
+void Aux_ComputeProfile_Batch( Profile_t *Prof[], const double Center[][3], const double r_max_input[], const int NCenter,
+                               const double dr_min, const bool LogBin, const double LogBinRatio, const bool RemoveEmpty,
+                               const long TVarBitIdx[], const int NProf, const int MinLv, const int MaxLv,
+                               const PatchType_t PatchType, const double PrepTimeIn )
+{
+
 // check
 #  ifdef GAMER_DEBUG
-   if ( r_max_input <= 0.0 )
-      Aux_Error( ERROR_INFO, "r_max_input (%14.7e) <= 0.0 !!\n", r_max_input );
+   if ( NCenter < 1 )
+      Aux_Error( ERROR_INFO, "NCenter (%d) < 1 !!\n", NCenter );
+
+   for (int c=0; c<NCenter; c++) {
+      if ( r_max_input[c] <= 0.0 )
+         Aux_Error( ERROR_INFO, "r_max_input[%d] (%14.7e) <= 0.0 !!\n", c, r_max_input[c] );
+   }
 
    if ( dr_min <= 0.0 )
       Aux_Error( ERROR_INFO, "dr_min (%14.7e) <= 0.0 !!\n", dr_min );
@@ -168,81 +239,158 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
 #  endif
 
 
-// initialize the profile objects
+// set the weight field of each profile
+//###REVISE: allow users to choose the weight field
+   const int WeightByVolume = 1;
+   const int WeightByMass   = 2;
+
+   int *WeightField = new int  [NProf];
+   bool NeedMass    = false;
+   bool NeedVelR    = false;
+
    for (int p=0; p<NProf; p++)
+   {
+      switch ( TVarBitIdx[p] )
+      {
+#        ifdef _VELX
+         case _VELX : WeightField[p] = WeightByMass;     break;
+#        endif
+#        ifdef _VELY
+         case _VELY : WeightField[p] = WeightByMass;     break;
+#        endif
+#        ifdef _VELZ
+         case _VELZ : WeightField[p] = WeightByMass;     break;
+#        endif
+#        ifdef _VELR
+         case _VELR : WeightField[p] = WeightByMass;     break;
+#        endif
+#        ifdef _POTE
+         case _POTE : WeightField[p] = WeightByMass;     break;
+#        endif
+         default    : WeightField[p] = WeightByVolume;   break;
+      }
+
+      if ( WeightField[p] == WeightByMass )  NeedMass = true;
+
+#     ifdef _VELR
+      if ( TVarBitIdx[p] == _VELR )          NeedVelR = true;
+#     endif
+   }
+
+
+// initialize the profile objects
+// --> the histograms of all centers are concatenated, where BinOffset[c] is the first bin of the center c
+   long *BinOffset = new long [NCenter+1];
+   BinOffset[0] = 0;
+
+   for (int c=0; c<NCenter; c++)
    {
 //    get the total number of radial bins and the corresponding maximum radius
+      int    NBin;
+      double MaxRadius;
+
       if ( LogBin )
       {
-         Prof[p]->NBin      = int( log(r_max_input/dr_min)/log(LogBinRatio) ) + 2;
-         Prof[p]->MaxRadius = dr_min*pow( LogBinRatio, Prof[p]->NBin-1 );
+         NBin      = int( log(r_max_input[c]/dr_min)/log(LogBinRatio) ) + 2;
+         MaxRadius = dr_min*pow( LogBinRatio, NBin-1 );
       }
 
       else // linear bin
       {
-         Prof[p]->NBin      = (int)ceil( r_max_input / dr_min );
-         Prof[p]->MaxRadius = dr_min*Prof[p]->NBin;
+         NBin      = (int)ceil( r_max_input[c] / dr_min );
+         MaxRadius = dr_min*NBin;
       }
 
+      for (int p=0; p<NProf; p++)
+      {
+         Profile_t *ThisProf = Prof[ c*NProf + p ];
 
-//    record profile parameters
-      for (int d=0; d<3; d++)    Prof[p]->Center[d] = Center[d];
+//       record profile parameters
+         ThisProf->NBin      = NBin;
+         ThisProf->MaxRadius = MaxRadius;
 
-      Prof[p]->LogBin = LogBin;
+         for (int d=0; d<3; d++)    ThisProf->Center[d] = Center[c][d];
 
-      if ( LogBin )  Prof[p]->LogBinRatio = LogBinRatio;
+         ThisProf->LogBin = LogBin;
 
+         if ( LogBin )  ThisProf->LogBinRatio = LogBinRatio;
 
-//    allocate all member arrays of Prof
-      Prof[p]->AllocateMemory();
 
+//       allocate all member arrays of Prof
+         ThisProf->AllocateMemory();
 
-//    record radial coordinates
-      if ( LogBin )
-         for (int b=0; b<Prof[0]->NBin; b++)    Prof[p]->Radius[b] = dr_min*pow( LogBinRatio, b-0.5 );
-      else
-         for (int b=0; b<Prof[0]->NBin; b++)    Prof[p]->Radius[b] = (b+0.5)*dr_min;
 
-   } // for (int p=0; p<NProf; p++)
+//       record radial coordinates
+         if ( LogBin )
+            for (int b=0; b<NBin; b++)    ThisProf->Radius[b] = dr_min*pow( LogBinRatio, b-0.5 );
+         else
+            for (int b=0; b<NBin; b++)    ThisProf->Radius[b] = (b+0.5)*dr_min;
+      }
 
+      BinOffset[c+1] = BinOffset[c] + NBin;
+   } // for (int c=0; c<NCenter; c++)
 
-// allocate memory for the per-thread arrays
+
+// allocate the histogram of all centers
+// --> NVar entries per bin: [0] = number of cells, [1+2*p] = weighted data of field p, [2+2*p] = weight of field p
+// --> number of cells is stored as double so that all entries can be collected by a single MPI_Allreduce()
+   const int  NVar     = 1 + 2*NProf;
+   const long NBinAll  = BinOffset[NCenter];
+   double    *Hist     = new double [ NBinAll*NVar ];
+
+   for (long t=0; t<NBinAll*NVar; t++)    Hist[t] = 0.0;
+
+
+// divide centers into chunks to bound the memory of the per-thread histograms
+// --> ChunkCen[n] ~ ChunkCen[n+1]-1 are the centers in the chunk n
+// --> at least one center per chunk
 #  ifdef OPENMP
    const int NT = OMP_NTHREAD;   // number of OpenMP threads
 #  else
    const int NT = 1;
 #  endif
 
-   double ***OMP_Data=NULL, ***OMP_Weight=NULL;
-   long   ***OMP_NCell=NULL;
+   const long MaxNHistPerThread = ( 1L << 24 ) / NT;    // ~128 MB for all threads
+   int  *ChunkCen    = new int [NCenter+1];
+   int   NChunk      = 0;
+   long  MaxChunkBin = 0;
 
-   Aux_AllocateArray3D( OMP_Data,   NProf, NT, Prof[0]->NBin );
-   Aux_AllocateArray3D( OMP_Weight, NProf, NT, Prof[0]->NBin );
-   Aux_AllocateArray3D( OMP_NCell,  NProf, NT, Prof[0]->NBin );
-
-// initialize profile arrays
-   for (int p=0; p<NProf; p++)
-   for (int t=0; t<NT; t++)
-   for (int b=0; b<Prof[0]->NBin; b++)
+   ChunkCen[0] = 0;
+   for (int c=0; c<NCenter; c++)
    {
-      OMP_Data  [p][t][b] = 0.0;
-      OMP_Weight[p][t][b] = 0.0;
-      OMP_NCell [p][t][b] = 0;
+      if ( c > ChunkCen[NChunk]  &&  ( BinOffset[c+1] - BinOffset[ ChunkCen[NChunk] ] )*NVar > MaxNHistPerThread )
+         ChunkCen[ ++NChunk ] = c;
    }
+   ChunkCen[ ++NChunk ] = NCenter;
+
+   for (int n=0; n<NChunk; n++)
+      MaxChunkBin = MAX( MaxChunkBin, BinOffset[ ChunkCen[n+1] ] - BinOffset[ ChunkCen[n] ] );
+
 
-   real (*Patch_Data)[8][PS1][PS1][PS1] = new real [NT][8][PS1][PS1][PS1];  // field data of each cell
-   int  (*Patch_Bin )[8][PS1][PS1][PS1] = new int  [NT][8][PS1][PS1][PS1];  // radial bin of each cell
+// allocate memory for the per-thread arrays
+   double **OMP_Hist = NULL;
+   Aux_AllocateArray2D( OMP_Hist, NT, MaxChunkBin*NVar );
+
+   for (int t=0; t<NT; t++)
+   for (long b=0; b<MaxChunkBin*NVar; b++)   OMP_Hist[t][b] = 0.0;
+
+   real (*Patch_Data)[8][PS1][PS1][PS1] = new real [NT*NProf][8][PS1][PS1][PS1];                       // field data of each cell
+   real (*Patch_Mass)[8][PS1][PS1][PS1] = ( NeedMass ) ? new real [NT  ][8][PS1][PS1][PS1] : NULL;    // cell mass
+   real (*Patch_Vel )[8][PS1][PS1][PS1] = ( NeedVelR ) ? new real [NT*3][8][PS1][PS1][PS1] : NULL;    // cell velocity for _VELR
 
 
 // set global constants
-   const double r_max2         = SQR( Prof[0]->MaxRadius );
    const double HalfBox[3]     = { 0.5*amr->BoxSize[0], 0.5*amr->BoxSize[1], 0.5*amr->BoxSize[2] };
    const bool   Periodic[3]    = { OPT__BC_FLU[0] == BC_FLU_PERIODIC,
                                    OPT__BC_FLU[2] == BC_FLU_PERIODIC,
                                    OPT__BC_FLU[4] == BC_FLU_PERIODIC };
-   const int    CellSkip       = -1;
-   const int    WeightByVolume = 1;
-   const int    WeightByMass   = 2;
+
+// spatial index: each bucket is a root-level patch group
+   const int    NBucket[3]     = { NX0_TOT[0]/PS2, NX0_TOT[1]/PS2, NX0_TOT[2]/PS2 };
+   const long   NBucketAll     = (long)NBucket[0]*NBucket[1]*NBucket[2];
+   const double BucketWidth    = PS2*amr->dh[0];
+   const int    BucketScale    = PS2*amr->scale[0];
+   long        *BucketPG_Start = new long [NBucketAll+1];   // BucketPG[ BucketPG_Start[b] ~ BucketPG_Start[b+1]-1 ] are in the bucket b
 
 
 // temporarily overwrite OPT__INT_TIME
@@ -257,8 +405,9 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
 // loop over all target levels
    for (int lv=MinLv; lv<=MaxLv; lv++)
    {
-      const double dh = amr->dh[lv];
-      const double dv = CUBE( dh );
+      const double dh  = amr->dh[lv];
+      const double dv  = CUBE( dh );
+      const int    NPG = amr->NPatchComma[lv][1] / 8;
 
 
 //    determine the temporal interpolation parameters
@@ -299,250 +448,327 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
 #     endif // #ifdef MASSIVE_PARTICLES
 
 
-//    different OpenMP threads and MPI processes first compute profiles independently
-//    --> their data will be combined later
-#     pragma omp parallel
+//    build the spatial index of the targeted patch groups on this level
+//    --> untargeted patch groups are excluded from the index
+      int  *BucketPG     = new int  [ MAX(NPG,1) ];
+      long *PG_Bucket    = new long [ MAX(NPG,1) ];
+      long *PG_CenStart  = new long [ NPG+1 ];   // PG_Cen[ PG_CenStart[PG] ~ PG_CenStart[PG+1]-1 ] overlap with the patch group PG
+      long *PG_Cursor    = new long [ MAX(NPG,1) ];
+      int  *ActivePG     = new int  [ MAX(NPG,1) ];
+
+      for (long b=0; b<=NBucketAll; b++)  BucketPG_Start[b] = 0;
+
+      for (int PG=0; PG<NPG; PG++)
       {
-#        ifdef OPENMP
-         const int TID = omp_get_thread_num();
-#        else
-         const int TID = 0;
-#        endif
+         const int PID0 = PG*8;
+         bool Targeted = false;
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+            if ( ! SkipPatch_ByType(lv, PID0+LocalID, MaxLv, PatchType) )   Targeted = true;
 
-//       use the "static" schedule for reproducibility
-#        pragma omp for schedule( static )
-         for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+         if ( ! Targeted )
          {
-//          skip untargeted patches
-            bool SkipPatch[8], SkipPatchGroup=true;
+            PG_Bucket[PG] = -1;
+            continue;
+         }
+
+         int BIdx[3];
+         for (int d=0; d<3; d++)    BIdx[d] = amr->patch[0][lv][PID0]->corner[d] / BucketScale;
+
+         PG_Bucket[PG] = ( (long)BIdx[2]*NBucket[1] + BIdx[1] )*NBucket[0] + BIdx[0];
+         BucketPG_Start[ PG_Bucket[PG] + 1 ] ++;
+      }
+
+      for (long b=0; b<NBucketAll; b++)   BucketPG_Start[b+1] += BucketPG_Start[b];
+
+      for (int PG=0; PG<NPG; PG++)
+      {
+         if ( PG_Bucket[PG] < 0 )   continue;
+
+         BucketPG[ BucketPG_Start[ PG_Bucket[PG] ] ++ ] = PG;
+      }
 
-            for (int LocalID=0; LocalID<8; LocalID++)
+//    restore the starting indices shifted by the above loop
+      for (long b=NBucketAll; b>0; b--)   BucketPG_Start[b] = BucketPG_Start[b-1];
+      BucketPG_Start[0] = 0;
+
+
+//    process one chunk of centers at a time
+      for (int n=0; n<NChunk; n++)
+      {
+         const int  CenS      = ChunkCen[n];
+         const int  CenE      = ChunkCen[n+1];
+         const long ChunkBin0 = BinOffset[CenS];
+         const long NChunkBin = BinOffset[CenE] - ChunkBin0;
+
+
+//       find the patch groups overlapping with the sphere of each center
+//       --> Pass 0 counts the number of centers of each patch group and Pass 1 records them
+//       --> centers of each patch group are recorded in ascending order
+         long *PG_Cen = NULL;
+
+         for (int PG=0; PG<=NPG; PG++)    PG_CenStart[PG] = 0;
+
+         for (int Pass=0; Pass<2; Pass++)
+         {
+            for (int c=CenS; c<CenE; c++)
             {
-               const int PID = PID0 + LocalID;
-               SkipPatch[LocalID] = false;
+               const double r_max = Prof[ c*NProf ]->MaxRadius;
+               const double r_max2 = SQR( r_max );
 
-               if ( amr->patch[0][lv][PID]->son != -1 )
-               {
-                  if ( PatchType == PATCH_LEAF )                                    SkipPatch[LocalID] = true;
-                  if ( PatchType == PATCH_LEAF_PLUS_MAXNONLEAF  &&  lv != MaxLv )   SkipPatch[LocalID] = true;
-               }
+               int  BIdxL[3], NB[3];
+               bool Empty = false;
 
-               else
+               for (int d=0; d<3; d++)
                {
-                  if ( PatchType == PATCH_NONLEAF )                                 SkipPatch[LocalID] = true;
+                  BIdxL[d] = (int)floor( (Center[c][d]-r_max)/BucketWidth );
+
+                  const int BIdxR = (int)floor( (Center[c][d]+r_max)/BucketWidth );
+
+                  if ( Periodic[d] )   NB[d] = MIN( BIdxR-BIdxL[d]+1, NBucket[d] );
+                  else
+                  {
+                     BIdxL[d] = MAX( BIdxL[d], 0 );
+                     NB   [d] = MIN( BIdxR, NBucket[d]-1 ) - BIdxL[d] + 1;
+                  }
+
+                  if ( NB[d] <= 0 )    Empty = true;
                }
 
-               if ( ! SkipPatch[LocalID] )   SkipPatchGroup = false;
-            } // for (int LocalID=0; LocalID<8; LocalID++)
+               if ( Empty )   continue;
 
-            if ( SkipPatchGroup )   continue;
+               for (int k=0; k<NB[2]; k++)  {  const int bk = ( ( (BIdxL[2]+k) % NBucket[2] ) + NBucket[2] ) % NBucket[2];
+               for (int j=0; j<NB[1]; j++)  {  const int bj = ( ( (BIdxL[1]+j) % NBucket[1] ) + NBucket[1] ) % NBucket[1];
+               for (int i=0; i<NB[0]; i++)  {  const int bi = ( ( (BIdxL[0]+i) % NBucket[0] ) + NBucket[0] ) % NBucket[0];
 
+                  const long b = ( (long)bk*NBucket[1] + bj )*NBucket[0] + bi;
 
-//          store the radial bin associated with each cell
-//          --> do it before looping over all target fields to avoid redundant calculations
-            for (int LocalID=0; LocalID<8; LocalID++)
-            {
-               if ( SkipPatch[LocalID] )  continue;
-
-               const int    PID = PID0 + LocalID;
-               const double x0  = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh - Center[0];
-               const double y0  = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh - Center[1];
-               const double z0  = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh - Center[2];
-
-               for (int k=0; k<PS1; k++)  {  double dz = z0 + k*dh;
-                                             if ( Periodic[2] ) {
-                                                if      ( dz > +HalfBox[2] )  {  dz -= amr->BoxSize[2];  }
-                                                else if ( dz < -HalfBox[2] )  {  dz += amr->BoxSize[2];  }
-                                             }
-               for (int j=0; j<PS1; j++)  {  double dy = y0 + j*dh;
-                                             if ( Periodic[1] ) {
-                                                if      ( dy > +HalfBox[1] )  {  dy -= amr->BoxSize[1];  }
-                                                else if ( dy < -HalfBox[1] )  {  dy += amr->BoxSize[1];  }
-                                             }
-               for (int i=0; i<PS1; i++)  {  double dx = x0 + i*dh;
-                                             if ( Periodic[0] ) {
-                                                if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
-                                                else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
-                                             }
-
-                  const double r2 = SQR(dx) + SQR(dy) + SQR(dz);
-
-                  if ( r2 < r_max2 )
+                  for (long t=BucketPG_Start[b]; t<BucketPG_Start[b+1]; t++)
                   {
-                     const double r   = sqrt( r2 );
-                     const int    bin = ( LogBin ) ? (  (r<dr_min) ? 0 : int( log(r/dr_min)/log(LogBinRatio) ) + 1  )
-                                                   : int( r/dr_min );
-//                   prevent from round-off errors
-                     if ( bin >= Prof[0]->NBin )   Patch_Bin[TID][LocalID][k][j][i] = CellSkip;
-                     else                          Patch_Bin[TID][LocalID][k][j][i] = bin;
-
-//                   check
-#                    ifdef GAMER_DEBUG
-                     if ( bin < 0 )    Aux_Error( ERROR_INFO, "bin (%d) < 0 !!\n", bin );
-#                    endif
-                  }
+                     const int PG   = BucketPG[t];
+                     const int PID0 = PG*8;
 
-                  else
-                     Patch_Bin[TID][LocalID][k][j][i] = CellSkip;
+                     if ( ! BoxOverlapSphere(amr->patch[0][lv][PID0]->EdgeL, amr->patch[0][lv][PID0+7]->EdgeR,
+                                             Center[c], r_max2, Periodic) )
+                        continue;
+
+                     if ( Pass == 0 )  PG_CenStart[ PG+1 ] ++;
+                     else              PG_Cen[ PG_Cursor[PG] ++ ] = c;
+                  }
                }}} // i,j,k
-            } // for (int LocalID=0; LocalID<8; LocalID++)
+            } // for (int c=CenS; c<CenE; c++)
 
+            if ( Pass == 0 )
+            {
+               for (int PG=0; PG<NPG; PG++)  PG_CenStart[PG+1] += PG_CenStart[PG];
+               for (int PG=0; PG<NPG; PG++)  PG_Cursor  [PG  ]  = PG_CenStart[PG];
 
-//          compute one field at a time
-            for (int p=0; p<NProf; p++)
+               PG_Cen = new long [ MAX(PG_CenStart[NPG],1L) ];
+            }
+         } // for (int Pass=0; Pass<2; Pass++)
+
+         int NActivePG = 0;
+         for (int PG=0; PG<NPG; PG++)
+            if ( PG_CenStart[PG+1] > PG_CenStart[PG] )   ActivePG[ NActivePG ++ ] = PG;
+
+
+//       different OpenMP threads and MPI processes first compute profiles independently
+//       --> their data will be combined later
+#        pragma omp parallel
+         {
+#           ifdef OPENMP
+            const int TID = omp_get_thread_num();
+#           else
+            const int TID = 0;
+#           endif
+
+//          use the "static" schedule for reproducibility
+#           pragma omp for schedule( static )
+            for (int t=0; t<NActivePG; t++)
             {
-//             collect the data of the target field
-               switch ( TVarBitIdx[p] )
-               {
-//                _VELR is currently not supported by Prepare_PatchData()
-#                 ifdef _VELR
-                  case _VELR:
-                     for (int LocalID=0; LocalID<8; LocalID++)
-                     {
-                        if ( SkipPatch[LocalID] )  continue;
-
-                        const int PID = PID0 + LocalID;
-                        const real (*FluidPtr     )[PS1][PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid;
-                        const real (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
-
-                        const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh - Center[0];
-                        const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh - Center[1];
-                        const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh - Center[2];
-
-                        for (int k=0; k<PS1; k++)  {  double dz = z0 + k*dh;
-                                                      if ( Periodic[2] ) {
-                                                         if      ( dz > +HalfBox[2] )  {  dz -= amr->BoxSize[2];  }
-                                                         else if ( dz < -HalfBox[2] )  {  dz += amr->BoxSize[2];  }
-                                                      }
-                        for (int j=0; j<PS1; j++)  {  double dy = y0 + j*dh;
-                                                      if ( Periodic[1] ) {
-                                                         if      ( dy > +HalfBox[1] )  {  dy -= amr->BoxSize[1];  }
-                                                         else if ( dy < -HalfBox[1] )  {  dy += amr->BoxSize[1];  }
-                                                      }
-                        for (int i=0; i<PS1; i++)  {  double dx = x0 + i*dh;
-                                                      if ( Periodic[0] ) {
-                                                         if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
-                                                         else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
-                                                      }
-
-                           if ( Patch_Bin[TID][LocalID][k][j][i] == CellSkip )   continue;
-
-                           const double r        = sqrt( SQR(dx) + SQR(dy) + SQR(dz) );
-                           const real _Dens      =                  (real)1.0 / FluidPtr     [DENS][k][j][i];
-                           const real _Dens_IntT = ( FluIntTime ) ? (real)1.0 / FluidPtr_IntT[DENS][k][j][i] : NULL_REAL;
-
-                           real VelR;
-                           if ( r == 0.0 ) {
-                              VelR = (real)0.0;    // take care of the corner case where the profile center coincides with a cell center
-                           }
+               const int PID0 = ActivePG[t]*8;
 
-                           else {
-                              VelR = ( FluIntTime )
-                                   ? ( FluWeighting     *( FluidPtr     [MOMX][k][j][i]*dx +
-                                                           FluidPtr     [MOMY][k][j][i]*dy +
-                                                           FluidPtr     [MOMZ][k][j][i]*dz )*_Dens
-                                     + FluWeighting_IntT*( FluidPtr_IntT[MOMX][k][j][i]*dx +
-                                                           FluidPtr_IntT[MOMY][k][j][i]*dy +
-                                                           FluidPtr_IntT[MOMZ][k][j][i]*dz )*_Dens_IntT ) / r
-                                   :                     ( FluidPtr     [MOMX][k][j][i]*dx +
-                                                           FluidPtr     [MOMY][k][j][i]*dy +
-                                                           FluidPtr     [MOMZ][k][j][i]*dz )*_Dens / r;
-                           }
+               bool SkipPatch[8];
+               for (int LocalID=0; LocalID<8; LocalID++)
+                  SkipPatch[LocalID] = SkipPatch_ByType( lv, PID0+LocalID, MaxLv, PatchType );
 
-                           Patch_Data[TID][LocalID][k][j][i] = VelR;
-                        }}} // i,j,k
-                     } // for (int LocalID=0; LocalID<8; LocalID++)
-                  break; // _VELR
-#                 endif // #ifdef _VELR
-
-                  default:
-                     const int  NGhost             = 0;
-                     const int  NPG                = 1;
-                     const bool IntPhase_No        = false;
-                     const real MinDens_No         = -1.0;
-                     const real MinPres_No         = -1.0;
-                     const real MinTemp_No         = -1.0;
-                     const real MinEntr_No         = -1.0;
-                     const bool DE_Consistency_Yes = true;
-
-                     Prepare_PatchData( lv, PrepTime, &Patch_Data[TID][0][0][0][0], NULL, NGhost, NPG, &PID0,
-                                        TVarBitIdx[p], _NONE, INT_NONE, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No,
-                                        OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
-                                        DE_Consistency_Yes );
-                  break; // default
-               } // switch ( TVarBitIdx[p] )
-
-
-//             set the weight field
-//###REVISE: allow users to choose the weight field
-               int WeightField=-1;
 
-               switch ( TVarBitIdx[p] )
+//             collect the data of all target fields
+//             --> done only once for all centers overlapping with this patch group
+               for (int p=0; p<NProf; p++)
                {
-#                 ifdef _VELX
-                  case _VELX : WeightField = WeightByMass;     break;
-#                 endif
-#                 ifdef _VELY
-                  case _VELY : WeightField = WeightByMass;     break;
-#                 endif
-#                 ifdef _VELZ
-                  case _VELZ : WeightField = WeightByMass;     break;
-#                 endif
+//                _VELR is currently not supported by Prepare_PatchData()
+//                --> it depends on the center and is computed from Patch_Vel[] later
 #                 ifdef _VELR
-                  case _VELR : WeightField = WeightByMass;     break;
-#                 endif
-#                 ifdef _POTE
-                  case _POTE : WeightField = WeightByMass;     break;
+                  if ( TVarBitIdx[p] == _VELR )    continue;
 #                 endif
-                  default    : WeightField = WeightByVolume;   break;
-               } // switch ( TVarBitIdx[p] )
 
+                  const int  NGhost             = 0;
+                  const int  NPG_One            = 1;
+                  const bool IntPhase_No        = false;
+                  const real MinDens_No         = -1.0;
+                  const real MinPres_No         = -1.0;
+                  const real MinTemp_No         = -1.0;
+                  const real MinEntr_No         = -1.0;
+                  const bool DE_Consistency_Yes = true;
 
-//             compute the radial profile
+                  Prepare_PatchData( lv, PrepTime, &Patch_Data[ TID*NProf + p ][0][0][0][0], NULL, NGhost, NPG_One, &PID0,
+                                     TVarBitIdx[p], _NONE, INT_NONE, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No,
+                                     OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
+                                     DE_Consistency_Yes );
+               } // for (int p=0; p<NProf; p++)
+
+
+//             collect the cell mass and velocity
                for (int LocalID=0; LocalID<8; LocalID++)
                {
-                  if ( SkipPatch[LocalID] )  continue;
+                  if ( SkipPatch[LocalID]  ||  ( !NeedMass && !NeedVelR ) )   continue;
 
                   const int PID = PID0 + LocalID;
-                  const real (*DensPtr     )[PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid[DENS];
-                  const real (*DensPtr_IntT)[PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid[DENS] : NULL;
+                  const real (*FluidPtr     )[PS1][PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid;
+                  const real (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
 
                   for (int k=0; k<PS1; k++)
                   for (int j=0; j<PS1; j++)
                   for (int i=0; i<PS1; i++)
                   {
-                     if ( Patch_Bin[TID][LocalID][k][j][i] == CellSkip )   continue;
-
-//                   compute the weight
-                     real Weight;
-                     switch ( WeightField )
+                     if ( NeedMass )
+                        Patch_Mass[TID][LocalID][k][j][i] = ( FluIntTime )
+                                                          ? ( FluWeighting     *FluidPtr     [DENS][k][j][i]
+                                                            + FluWeighting_IntT*FluidPtr_IntT[DENS][k][j][i] )*dv
+                                                          :                     FluidPtr     [DENS][k][j][i]  *dv;
+
+#                    if ( MODEL == HYDRO )
+                     if ( NeedVelR )
                      {
-                        case WeightByMass   :   Weight = ( FluIntTime )
-                                                       ? ( FluWeighting     *DensPtr     [k][j][i]
-                                                         + FluWeighting_IntT*DensPtr_IntT[k][j][i] )*dv
-                                                       :                     DensPtr     [k][j][i]  *dv;
-                        break;
-
-                        case WeightByVolume :   Weight = dv;
-                        break;
-
-                        default:
-                           Aux_Error( ERROR_INFO, "unsupported weight field (%d) !!\n", WeightField );
-                           exit( 1 );
+                        const real _Dens      =                  (real)1.0 / FluidPtr     [DENS][k][j][i];
+                        const real _Dens_IntT = ( FluIntTime ) ? (real)1.0 / FluidPtr_IntT[DENS][k][j][i] : NULL_REAL;
+
+                        for (int d=0; d<3; d++)
+                           Patch_Vel[ TID*3 + d ][LocalID][k][j][i] = ( FluIntTime )
+                                                                    ? FluWeighting     *FluidPtr     [MOMX+d][k][j][i]*_Dens
+                                                                    + FluWeighting_IntT*FluidPtr_IntT[MOMX+d][k][j][i]*_Dens_IntT
+                                                                    :                   FluidPtr     [MOMX+d][k][j][i]*_Dens;
                      }
+#                    endif
+                  } // i,j,k
+               } // for (int LocalID=0; LocalID<8; LocalID++)
 
 
-//                   update the profile
-                     const int bin = Patch_Bin[TID][LocalID][k][j][i];
+//             update the profiles of all centers overlapping with this patch group
+               for (long s=PG_CenStart[ ActivePG[t] ]; s<PG_CenStart[ ActivePG[t]+1 ]; s++)
+               {
+                  const int     c        = PG_Cen[s];
+                  const int     NBin     = Prof[ c*NProf ]->NBin;
+                  const double  r_max2   = SQR( Prof[ c*NProf ]->MaxRadius );
+                  double       *HistCen  = OMP_Hist[TID] + ( BinOffset[c] - ChunkBin0 )*NVar;
 
-                     OMP_Data  [p][TID][bin] += Patch_Data[TID][LocalID][k][j][i]*Weight;
-                     OMP_Weight[p][TID][bin] += Weight;
-                     OMP_NCell [p][TID][bin] ++;
-                  } // i,j,k
-               } // for (int LocalID=0; LocalID<8; LocalID++)
-            } // for (int p=0; p<NProf; p++)
-         } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-      } // OpenMP parallel region
+                  for (int LocalID=0; LocalID<8; LocalID++)
+                  {
+                     if ( SkipPatch[LocalID] )  continue;
+
+                     const int PID = PID0 + LocalID;
+
+                     if ( ! BoxOverlapSphere(amr->patch[0][lv][PID]->EdgeL, amr->patch[0][lv][PID]->EdgeR,
+                                             Center[c], r_max2, Periodic) )
+                        continue;
+
+                     const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh - Center[c][0];
+                     const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh - Center[c][1];
+                     const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh - Center[c][2];
+
+                     for (int k=0; k<PS1; k++)  {  double dz = z0 + k*dh;
+                                                   if ( Periodic[2] ) {
+                                                      if      ( dz > +HalfBox[2] )  {  dz -= amr->BoxSize[2];  }
+                                                      else if ( dz < -HalfBox[2] )  {  dz += amr->BoxSize[2];  }
+                                                   }
+                     for (int j=0; j<PS1; j++)  {  double dy = y0 + j*dh;
+                                                   if ( Periodic[1] ) {
+                                                      if      ( dy > +HalfBox[1] )  {  dy -= amr->BoxSize[1];  }
+                                                      else if ( dy < -HalfBox[1] )  {  dy += amr->BoxSize[1];  }
+                                                   }
+                     for (int i=0; i<PS1; i++)  {  double dx = x0 + i*dh;
+                                                   if ( Periodic[0] ) {
+                                                      if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
+                                                      else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
+                                                   }
+
+                        const double r2 = SQR(dx) + SQR(dy) + SQR(dz);
+
+                        if ( r2 >= r_max2 )  continue;
+
+                        const double r   = sqrt( r2 );
+                        const int    bin = ( LogBin ) ? (  (r<dr_min) ? 0 : int( log(r/dr_min)/log(LogBinRatio) ) + 1  )
+                                                      : int( r/dr_min );
+//                      prevent from round-off errors
+                        if ( bin >= NBin )   continue;
+
+//                      check
+#                       ifdef GAMER_DEBUG
+                        if ( bin < 0 )    Aux_Error( ERROR_INFO, "bin (%d) < 0 !!\n", bin );
+#                       endif
+
+//                      update all fields of this bin, which are stored contiguously
+                        double *HistBin = HistCen + (long)bin*NVar;
+
+                        HistBin[0] += 1.0;
+
+                        for (int p=0; p<NProf; p++)
+                        {
+                           real Value;
+
+#                          ifdef _VELR
+                           if ( TVarBitIdx[p] == _VELR )
+                           {
+//                            take care of the corner case where the profile center coincides with a cell center
+                              Value = ( r == 0.0 ) ? (real)0.0
+                                                   : ( Patch_Vel[ TID*3 + 0 ][LocalID][k][j][i]*dx +
+                                                       Patch_Vel[ TID*3 + 1 ][LocalID][k][j][i]*dy +
+                                                       Patch_Vel[ TID*3 + 2 ][LocalID][k][j][i]*dz ) / r;
+                           }
+                           else
+#                          endif
+                              Value = Patch_Data[ TID*NProf + p ][LocalID][k][j][i];
+
+                           const real Weight = ( WeightField[p] == WeightByMass ) ? Patch_Mass[TID][LocalID][k][j][i]
+                                                                                  : (real)dv;
+
+                           HistBin[ 1 + 2*p ] += Value*Weight;
+                           HistBin[ 2 + 2*p ] += Weight;
+                        }
+                     }}} // i,j,k
+                  } // for (int LocalID=0; LocalID<8; LocalID++)
+               } // for (long s=PG_CenStart[ ActivePG[t] ]; s<PG_CenStart[ ActivePG[t]+1 ]; s++)
+            } // for (int t=0; t<NActivePG; t++)
+         } // OpenMP parallel region
+
+
+//       sum over all OpenMP threads in a fixed order for reproducibility and reset the per-thread histograms
+         if ( NActivePG > 0 )
+         {
+#           pragma omp parallel for schedule( static )
+            for (long b=0; b<NChunkBin*NVar; b++)
+            {
+               double Sum = 0.0;
+
+               for (int TID=0; TID<NT; TID++)
+               {
+                  Sum               += OMP_Hist[TID][b];
+                  OMP_Hist[TID][b]   = 0.0;
+               }
+
+               Hist[ ChunkBin0*NVar + b ] += Sum;
+            }
+         }
+
+         delete [] PG_Cen;
+      } // for (int n=0; n<NChunk; n++)
+
+      delete [] BucketPG;
+      delete [] PG_Bucket;
+      delete [] PG_CenStart;
+      delete [] PG_Cursor;
+      delete [] ActivePG;
 
 
 //    free particle resources
@@ -558,122 +784,193 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
    } // for (int lv=MinLv; lv<=MaxLv; lv++)
 
 
-// sum over all OpenMP threads
-   for (int p=0; p<NProf; p++)
-   {
-      for (int b=0; b<Prof[0]->NBin; b++)
-      {
-         Prof[p]->Data  [b]  = OMP_Data  [p][0][b];
-         Prof[p]->Weight[b]  = OMP_Weight[p][0][b];
-         Prof[p]->NCell [b]  = OMP_NCell [p][0][b];
-      }
-
-      for (int t=1; t<NT; t++)
-      for (int b=0; b<Prof[0]->NBin; b++)
-      {
-         Prof[p]->Data  [b] += OMP_Data  [p][t][b];
-         Prof[p]->Weight[b] += OMP_Weight[p][t][b];
-         Prof[p]->NCell [b] += OMP_NCell [p][t][b];
-      }
-   }
-
-
 // free per-thread arrays
-   Aux_DeallocateArray3D( OMP_Data );
-   Aux_DeallocateArray3D( OMP_Weight );
-   Aux_DeallocateArray3D( OMP_NCell );
+   Aux_DeallocateArray2D( OMP_Hist );
 
    delete [] Patch_Data;
-   delete [] Patch_Bin;
+   delete [] Patch_Mass;
+   delete [] Patch_Vel;
+   delete [] BucketPG_Start;
+   delete [] ChunkCen;
+   delete [] WeightField;
 
 
-// collect data from all ranks (in-place reduction)
+// collect data of all centers from all ranks by a single in-place reduction
 #  ifndef SERIAL
+   MPI_Allreduce( MPI_IN_PLACE, Hist, NBinAll*NVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+#  endif
+
+
+// compute profiles
+// --> all ranks do the same work so that no data broadcast is required
+   for (int c=0; c<NCenter; c++)
    for (int p=0; p<NProf; p++)
    {
-      if ( MPI_Rank == 0 )
-      {
-         MPI_Reduce( MPI_IN_PLACE,    Prof[p]->Data,   Prof[p]->NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-         MPI_Reduce( MPI_IN_PLACE,    Prof[p]->Weight, Prof[p]->NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-         MPI_Reduce( MPI_IN_PLACE,    Prof[p]->NCell , Prof[p]->NBin, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
-      }
+      Profile_t *ThisProf = Prof[ c*NProf + p ];
 
-      else
+      for (int b=0; b<ThisProf->NBin; b++)
       {
-         MPI_Reduce( Prof[p]->Data,   NULL,            Prof[p]->NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-         MPI_Reduce( Prof[p]->Weight, NULL,            Prof[p]->NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-         MPI_Reduce( Prof[p]->NCell,  NULL,            Prof[p]->NBin, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
-      }
-   }
-#  endif
+         const double *HistBin = Hist + ( BinOffset[c] + b )*NVar;
 
+         ThisProf->NCell [b] = (long)HistBin[0];
+         ThisProf->Data  [b] = HistBin[ 1 + 2*p ];
+         ThisProf->Weight[b] = HistBin[ 2 + 2*p ];
 
-// compute profile by the root rank
-   if ( MPI_Rank == 0 )
-   {
-      for (int p=0; p<NProf; p++)
-      for (int b=0; b<Prof[0]->NBin; b++)
-      {
 //       skip empty bins since both their data and weight are zero
-         if ( Prof[p]->NCell[b] > 0L )    Prof[p]->Data[b] /= Prof[p]->Weight[b];
+         if ( ThisProf->NCell[b] > 0L )   ThisProf->Data[b] /= ThisProf->Weight[b];
       }
    }
 
+   delete [] Hist;
+   delete [] BinOffset;
 
-// broadcast data to all ranks
-   for (int p=0; p<NProf; p++)
+
+// remove the empty bins
+   if ( RemoveEmpty )
+      for (int c=0; c<NCenter; c++)    RemoveEmptyBin( Prof+c*NProf, NProf, LogBin, LogBinRatio, dr_min );
+
+
+// restore the original temporal interpolation setup
+   OPT__INT_TIME = IntTimeBackup;
+
+} // FUNCTION : Aux_ComputeProfile_Batch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SkipPatch_ByType
+// Description :  Check whether a patch should be skipped according to the target patch type
+//
+// Note        :  1. Invoked by Aux_ComputeProfile_Batch()
+//
+// Parameter   :  lv        : Target refinement level
+//                PID       : Target patch index
+//                MaxLv     : Maximum target level
+//                PatchType : Target patch type (see Aux_ComputeProfile())
+//
+// Return      :  true/false --> skip/keep the patch
+//-------------------------------------------------------------------------------------------------------
+bool SkipPatch_ByType( const int lv, const int PID, const int MaxLv, const PatchType_t PatchType )
+{
+
+   if ( amr->patch[0][lv][PID]->son != -1 )
    {
-      MPI_Bcast( Prof[p]->Data,   Prof[p]->NBin, MPI_DOUBLE, 0, MPI_COMM_WORLD );
-      MPI_Bcast( Prof[p]->Weight, Prof[p]->NBin, MPI_DOUBLE, 0, MPI_COMM_WORLD );
-      MPI_Bcast( Prof[p]->NCell,  Prof[p]->NBin, MPI_LONG,   0, MPI_COMM_WORLD );
+      if ( PatchType == PATCH_LEAF )                                    return true;
+      if ( PatchType == PATCH_LEAF_PLUS_MAXNONLEAF  &&  lv != MaxLv )   return true;
    }
 
+   else
+   {
+      if ( PatchType == PATCH_NONLEAF )                                 return true;
+   }
 
-// remove the empty bins
-// --> all ranks do the same work so that no data broadcast is required
-   if ( RemoveEmpty )
+   return false;
+
+} // FUNCTION : SkipPatch_ByType
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BoxOverlapSphere
+// Description :  Check whether an axis-aligned box overlaps with a sphere
+//
+// Note        :  1. Invoked by Aux_ComputeProfile_Batch()
+//                2. Periodic directions consider the nearest periodic image of the box
+//                   --> Conservative for culling since cells are checked again with their own minimum images
+//
+// Parameter   :  EdgeL/R  : Left/right edges of the box
+//                Center   : Center of the sphere
+//                r2       : Squared radius of the sphere
+//                Periodic : Whether each direction is periodic
+//
+// Return      :  true/false --> overlap/no overlap
+//-------------------------------------------------------------------------------------------------------
+bool BoxOverlapSphere( const double EdgeL[], const double EdgeR[], const double Center[], const double r2,
+                       const bool Periodic[] )
+{
+
+   double dist2 = 0.0;
+
+   for (int d=0; d<3; d++)
    {
-      for (int b=0; b<Prof[0]->NBin; b++)
+      double dmin = __DBL_MAX__;
+
+      for (int s=-1; s<=1; s++)
       {
-         if ( Prof[0]->NCell[b] != 0L )   continue;
+         if ( s != 0  &&  !Periodic[d] )  continue;
 
-//       remove consecutive empty bins at the same time for better performance
-         int b_up;
-         for (b_up=b+1; b_up<Prof[0]->NBin; b_up++)
-            if ( Prof[0]->NCell[b_up] != 0L )   break;
+         const double L = EdgeL[d] + s*amr->BoxSize[d] - Center[d];
+         const double R = EdgeR[d] + s*amr->BoxSize[d] - Center[d];
+         const double dd = ( L > 0.0 ) ? L : ( R < 0.0 ) ? -R : 0.0;
 
-         const int stride = b_up - b;
+         dmin = MIN( dmin, dd );
+      }
 
-         for (b_up=b+stride; b_up<Prof[0]->NBin; b_up++)
-         {
-            const int b_up_ms = b_up - stride;
+      dist2 += SQR( dmin );
+   }
 
-            for (int p=0; p<NProf; p++)
-            {
-               Prof[p]->Radius[b_up_ms] = Prof[p]->Radius[b_up];
-               Prof[p]->Data  [b_up_ms] = Prof[p]->Data  [b_up];
-               Prof[p]->Weight[b_up_ms] = Prof[p]->Weight[b_up];
-               Prof[p]->NCell [b_up_ms] = Prof[p]->NCell [b_up];
-            }
-         }
+   return ( dist2 < r2 );
 
-//       reset the total number of bins
-         for (int p=0; p<NProf; p++)
-            Prof[p]->NBin -= stride;
-      } // for (int b=0; b<Prof->NBin; b++)
+} // FUNCTION : BoxOverlapSphere
 
-//    update the maximum radius since the last bin may have been removed
-      for (int p=0; p<NProf; p++)
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RemoveEmptyBin
+// Description :  Remove the empty bins from the profiles of the same center
+//
+// Note        :  1. Invoked by Aux_ComputeProfile_Batch()
+//                2. All profiles must share the same bins
+//                3. MaxRadius is updated since the last bin may have been removed
+//
+// Parameter   :  Prof        : Profile_t object array of the same center
+//                NProf       : Number of Profile_t objects in Prof
+//                LogBin      : true/false --> log/linear bins
+//                LogBinRatio : Ratio of adjacent log bins
+//                dr_min      : Minimum bin size
+//
+// Return      :  Prof
+//-------------------------------------------------------------------------------------------------------
+void RemoveEmptyBin( Profile_t *Prof[], const int NProf, const bool LogBin, const double LogBinRatio,
+                     const double dr_min )
+{
+
+   for (int b=0; b<Prof[0]->NBin; b++)
+   {
+      if ( Prof[0]->NCell[b] != 0L )   continue;
+
+//    remove consecutive empty bins at the same time for better performance
+      int b_up;
+      for (b_up=b+1; b_up<Prof[0]->NBin; b_up++)
+         if ( Prof[0]->NCell[b_up] != 0L )   break;
+
+      const int stride = b_up - b;
+
+      for (b_up=b+stride; b_up<Prof[0]->NBin; b_up++)
       {
-         const int LastBin = Prof[p]->NBin-1;
+         const int b_up_ms = b_up - stride;
 
-         Prof[p]->MaxRadius = ( LogBin ) ? Prof[p]->Radius[LastBin]*sqrt( LogBinRatio )
-                                         : Prof[p]->Radius[LastBin] + 0.5*dr_min;
+         for (int p=0; p<NProf; p++)
+         {
+            Prof[p]->Radius[b_up_ms] = Prof[p]->Radius[b_up];
+            Prof[p]->Data  [b_up_ms] = Prof[p]->Data  [b_up];
+            Prof[p]->Weight[b_up_ms] = Prof[p]->Weight[b_up];
+            Prof[p]->NCell [b_up_ms] = Prof[p]->NCell [b_up];
+         }
       }
-   } // if ( RemoveEmpty )
 
+//    reset the total number of bins
+      for (int p=0; p<NProf; p++)
+         Prof[p]->NBin -= stride;
+   } // for (int b=0; b<Prof->NBin; b++)
+
+// update the maximum radius since the last bin may have been removed
+   for (int p=0; p<NProf; p++)
+   {
+      const int LastBin = Prof[p]->NBin-1;
 
-// restore the original temporal interpolation setup
-   OPT__INT_TIME = IntTimeBackup;
+      Prof[p]->MaxRadius = ( LogBin ) ? Prof[p]->Radius[LastBin]*sqrt( LogBinRatio )
+                                      : Prof[p]->Radius[LastBin] + 0.5*dr_min;
+   }
 
-} // FUNCTION : Aux_ComputeProfile
+} // FUNCTION : RemoveEmptyBin
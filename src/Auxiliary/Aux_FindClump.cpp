@@ -0,0 +1,1903 @@
+#include "GAMER.h"
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  ClumpHash_t
+// Description :  Open-addressing hash table mapping four integer keys to a non-negative value
+//
+// Note        :  1. Used by Aux_FindClump() and Aux_FindParticleGroup() to look up cells, face records,
+//                   particles, and labels
+//                2. Table size is a power of two and at least twice the maximum number of entries
+//-------------------------------------------------------------------------------------------------------
+struct ClumpHash_t
+{
+
+   long   Size;
+   long (*Key)[4];
+   long  *Value;
+
+
+   ClumpHash_t( const long NMax )
+   {
+
+      Size = 64;
+      while ( Size < 2*NMax )   Size <<= 1;
+
+      Key   = new long [Size][4];
+      Value = new long [Size];
+
+      for (long t=0; t<Size; t++)   Value[t] = -1;
+
+   } // METHOD : ClumpHash_t
+
+
+   ~ClumpHash_t()
+   {
+
+      delete [] Key;
+      delete [] Value;
+
+   } // METHOD : ~ClumpHash_t
+
+
+   long Slot( const long K[4] ) const
+   {
+
+      ulong h = (ulong)K[0];
+      for (int t=1; t<4; t++)    h = h*0x9E3779B97F4A7C15UL + (ulong)K[t];
+
+      h ^= h >> 33;
+      h *= 0xFF51AFD7ED558CCDUL;
+      h ^= h >> 33;
+
+      long s = (long)( h & (ulong)(Size-1) );
+
+      while (  Value[s] != -1  &&
+               ( Key[s][0] != K[0] || Key[s][1] != K[1] || Key[s][2] != K[2] || Key[s][3] != K[3] )  )
+         s = ( s + 1 ) & ( Size - 1 );
+
+      return s;
+
+   } // METHOD : Slot
+
+
+// return the value of an existing key or insert a new key with the input value
+   long Insert( const long K[4], const long V )
+   {
+
+      const long s = Slot( K );
+
+      if ( Value[s] == -1 )
+      {
+         for (int t=0; t<4; t++)    Key[s][t] = K[t];
+         Value[s] = V;
+      }
+
+      return Value[s];
+
+   } // METHOD : Insert
+
+
+// return -1 if the key does not exist
+   long Find( const long K[4] ) const
+   {
+
+      return Value[ Slot(K) ];
+
+   } // METHOD : Find
+
+}; // struct ClumpHash_t
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  LabelForest_t
+// Description :  Union-find forest over sparse global clump labels
+//
+// Note        :  1. The root of each set is its minimum label so that the result does not depend on
+//                   the order of the unions
+//                2. NMax is the maximum number of distinct labels
+//-------------------------------------------------------------------------------------------------------
+struct LabelForest_t
+{
+
+   ClumpHash_t *Hash;
+   long         N;
+   long        *Label;
+   long        *Parent;
+
+
+   LabelForest_t( const long NMax )
+   {
+
+      Hash   = new ClumpHash_t( NMax );
+      N      = 0;
+      Label  = new long [ MAX(NMax,1) ];
+      Parent = new long [ MAX(NMax,1) ];
+
+   } // METHOD : LabelForest_t
+
+
+   ~LabelForest_t()
+   {
+
+      delete Hash;
+      delete [] Label;
+      delete [] Parent;
+
+   } // METHOD : ~LabelForest_t
+
+
+   long Idx( const long L )
+   {
+
+      const long K[4] = { L, 0, 0, 0 };
+      const long t    = Hash->Insert( K, N );
+
+      if ( t == N )
+      {
+         Label [N] = L;
+         Parent[N] = N;
+         N ++;
+      }
+
+      return t;
+
+   } // METHOD : Idx
+
+
+   long Root( long t )
+   {
+
+      while ( Parent[t] != t )
+      {
+         Parent[t] = Parent[ Parent[t] ];
+         t         = Parent[t];
+      }
+
+      return t;
+
+   } // METHOD : Root
+
+
+// return true if two different sets are joined
+   bool Union( const long L1, const long L2 )
+   {
+
+      const long r1 = Root( Idx(L1) );
+      const long r2 = Root( Idx(L2) );
+
+      if ( r1 == r2 )   return false;
+
+      if ( Label[r1] < Label[r2] )  Parent[r2] = r1;
+      else                          Parent[r1] = r2;
+
+      return true;
+
+   } // METHOD : Union
+
+
+}; // struct LabelForest_t
+
+
+
+static long UF_Find( long *Parent, long t );
+static void UF_Union( long *Parent, const long t1, const long t2 );
+static bool HigherPeak( const double PeakA, const double CoordA[], const double PeakB, const double CoordB[] );
+static void MinImage( double dr[] );
+static long GetLabelOffset( const long NComp );
+static void ResolveClump( const long NEdge, const long *Edge, const long NComp, const long LabelOffset,
+                          const Clump_t *Partial, const long MinNMember, Clump_t **Clump, int *NClump );
+static void GetLabelRoot( const long NQuery, const long *Query, long *Root, const long *RootTable,
+                          const long *LabelOffset_AllRank );
+static int  GetLabelRank( const long Label, const long *LabelOffset_AllRank );
+static int  FindFaceNeighbour( const ClumpHash_t *Hash, const int lv, const long Corner[], const int f, long NbrIdx[] );
+static int  GetFaceRank( const int lv, const int PID, const int f );
+static int  GetPatchRank( const int lv, const int Corner[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_FindClump
+// Description :  Find all connected regions of leaf cells with a field value above a given threshold
+//
+// Note        :  1. Distributed union-find over the whole AMR hierarchy
+//                   --> Leaf cells sharing a face are connected, including faces between adjacent levels
+//                   --> (a) Each rank labels the connected regions of its own leaf cells using a hash table
+//                           of the cell positions
+//                       (b) A face is resolved locally if the cells on its other side lie in the local real
+//                           patches, whether or not these cells are selected. Otherwise, if they lie in a buffer
+//                           patch or in a coarser patch not allocated on this rank, the face is sent to the rank
+//                           owning that patch (see GetFaceRank()), which matches it to its own selected cells
+//                       (c) The connections are merged into a union-find forest distributed over the ranks owning
+//                           the labels, and the partial properties of each region are reduced on the rank owning
+//                           its final label (see ResolveClump())
+//                   --> Only the faces of the selected cells on the rank boundaries are communicated
+//                2. Support fields that are supported by Prepare_PatchData() (e.g., _DENS or _TOTAL_DENS)
+//                   --> Does not support computing multiple fields at once
+//                3. Clump properties are weighted by "field value * cell volume" (see "include/Clump.h")
+//                   --> Velocity is the bulk fluid velocity in HYDRO and zero otherwise
+//                4. Support periodic BC
+//                   --> Clumps must be smaller than half of the simulation box to get correct centers
+//                5. Support hybrid OpenMP/MPI parallelization
+//                   --> All ranks will share the same results after invoking this function
+//                6. Clumps are sorted by their mass in descending order
+//                7. *Clump is allocated by this function and must be freed by the caller with delete []
+//                8. In case different AMR levels are not synchronized, this function currently only checks
+//                   the most recent data on each level (i.e., data associated with FluSg[lv]/PotSg[lv]) without temporal interpolation
+//
+// Parameter   :  Clump     : Array of clumps to be returned
+//                NClump    : Number of clumps to be returned
+//                Field     : Target field (e.g., _DENS or BIDX(DENS))
+//                Threshold : Only include cells with field values above this threshold
+//                MinNCell  : Only return clumps with at least this number of cells
+//
+// Example     :  Clump_t *Clump  = NULL;
+//                int      NClump = 0;
+//
+//                Aux_FindClump( &Clump, &NClump, _DENS, 1.0e2*AveDens, 8 );
+//
+//                if ( MPI_Rank == 0 )
+//                for (int c=0; c<NClump; c++)
+//                   Aux_Message( stdout, "%4d %14.7e %14.7e %14.7e %14.7e\n",
+//                                c, Clump[c].Mass, Clump[c].CoM[0], Clump[c].CoM[1], Clump[c].CoM[2] );
+//
+//                delete [] Clump;
+//
+// Return      :  Clump, NClump
+//-------------------------------------------------------------------------------------------------------
+void Aux_FindClump( Clump_t **Clump, int *NClump, const long Field, const double Threshold, const long MinNCell )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( Clump == NULL  ||  NClump == NULL )
+      Aux_Error( ERROR_INFO, "Clump == NULL or NClump == NULL !!\n" );
+
+   if ( Field == _NONE )
+      Aux_Error( ERROR_INFO, "Field == _NONE !!\n" );
+
+   if ( Field & (Field-1) )
+      Aux_Error( ERROR_INFO, "not support computing multiple fields at once (Field = %ld) !!\n", Field );
+
+   if ( MinNCell < 1 )
+      Aux_Error( ERROR_INFO, "MinNCell (%ld) < 1 !!\n", MinNCell );
+#  endif
+
+
+// get the integer index of the target intrinsic fluid field
+   const int FluIdxUndef = -1;
+   int TFluIntIdx = FluIdxUndef;
+   bool UsePrepare = true;
+
+   for (int v=0; v<NCOMP_TOTAL; v++) {
+      if ( Field & BIDX(v) ) {
+         TFluIntIdx = v;
+         UsePrepare = false;
+         break;
+      }
+   }
+
+#  ifdef GRAVITY
+   if ( Field & _POTE ) UsePrepare = false;
+#  endif
+
+
+   const int    NPG_Max           = FLU_GPU_NPGROUP;
+   const bool   IntPhase_No       = false;
+   const real   MinDens_No        = -1.0;
+   const real   MinPres_No        = -1.0;
+   const real   MinTemp_No        = -1.0;
+   const real   MinEntr_No        = -1.0;
+   const bool   DE_Consistency_No = false;
+#  ifdef MASSIVE_PARTICLES
+   const bool   TimingSendPar_No  = false;
+   const bool   JustCountNPar_No  = false;
+#  ifdef LOAD_BALANCE
+   const bool   PredictPos        = amr->Par->PredictPos;
+   const bool   SibBufPatch       = true;
+   const bool   FaSibBufPatch     = true;
+#  else
+   const bool   PredictPos        = false;
+   const bool   SibBufPatch       = NULL_BOOL;
+   const bool   FaSibBufPatch     = NULL_BOOL;
+#  endif
+#  endif // #ifdef MASSIVE_PARTICLES
+
+
+// 1. collect all leaf cells above the threshold
+// --> CellKey[] stores the level and the corner indices of each cell in the unit of the finest grid scale
+// --> CellPID[] stores the ID of the patch containing each cell
+   long   NCell     = 0;
+   long   NCell_Max = 0;
+   long (*CellKey)[4] = NULL;
+   real  *CellVal    = NULL;
+   int   *CellPID    = NULL;
+#  if ( MODEL == HYDRO )
+   real (*CellVel)[3] = NULL;
+#  endif
+
+   real (*FieldPtr)[PS1][PS1][PS1] = NULL;
+   if ( UsePrepare )    FieldPtr = new real [8*NPG_Max][PS1][PS1][PS1];   // 8: number of local patches
+
+   int  *NSelect = new int  [8*NPG_Max];
+   long *Offset  = new long [8*NPG_Max];
+
+// get the field value of a given cell
+#  ifdef GRAVITY
+#  define GET_VALUE( t, PID, i, j, k )                                                              \
+   (  ( TFluIntIdx != FluIdxUndef ) ? amr->patch[FluSg][lv][PID]->fluid[TFluIntIdx][k][j][i] :     \
+      ( UsePrepare                ) ? FieldPtr[t][k][j][i]                                  :     \
+                                      amr->patch[PotSg][lv][PID]->pot[k][j][i]                  )
+#  else
+#  define GET_VALUE( t, PID, i, j, k )                                                              \
+   (  ( TFluIntIdx != FluIdxUndef ) ? amr->patch[FluSg][lv][PID]->fluid[TFluIntIdx][k][j][i] :     \
+                                      FieldPtr[t][k][j][i]                                          )
+#  endif
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NTotal = amr->NPatchComma[lv][1] / 8;
+      const int FluSg  = amr->FluSg[lv];
+#     ifdef GRAVITY
+      const int PotSg  = amr->PotSg[lv];
+#     endif
+      int   *PID0_List = new int [NTotal];
+      for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
+
+//    initialize the particle density array (rho_ext) and collect particles to the target level
+#     ifdef MASSIVE_PARTICLES
+      if ( Field & _PAR_DENS  ||  Field & _TOTAL_DENS )
+      {
+         Par_CollectParticle2OneLevel( lv, _PAR_MASS|_PAR_POSX|_PAR_POSY|_PAR_POSZ, _PAR_TYPE, PredictPos, Time[lv],
+                                       SibBufPatch, FaSibBufPatch, JustCountNPar_No, TimingSendPar_No );
+
+         Prepare_PatchData_InitParticleDensityArray( lv, Time[lv] );
+      }
+#     endif
+
+      for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+      {
+         const int NPG = ( NPG_Max < NTotal-Disp ) ? NPG_Max : NTotal-Disp;
+
+         if ( UsePrepare )
+         {
+            Prepare_PatchData( lv, Time[lv], FieldPtr[0][0][0], NULL, 0, NPG, PID0_List+Disp, Field, _NONE,
+                               INT_NONE, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
+                               MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+         }
+
+//       count the number of selected cells in each leaf patch
+#        pragma omp parallel for schedule( runtime )
+         for (int t=0; t<8*NPG; t++)
+         {
+            const int PID = 8*Disp + t;
+
+            NSelect[t] = 0;
+
+            if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+               if ( GET_VALUE(t,PID,i,j,k) > Threshold )    NSelect[t] ++;
+         }
+
+         long NNew = 0;
+         for (int t=0; t<8*NPG; t++)
+         {
+            Offset[t] = NCell + NNew;
+            NNew     += NSelect[t];
+         }
+
+         if ( NNew == 0 )  continue;
+
+//       grow the cell arrays
+         if ( NCell + NNew > NCell_Max )
+         {
+            NCell_Max = MAX( 2*NCell_Max, NCell+NNew );
+
+            long (*CellKey_New)[4] = new long [NCell_Max][4];
+            real  *CellVal_New     = new real [NCell_Max];
+            int   *CellPID_New     = new int  [NCell_Max];
+            memcpy( CellKey_New, CellKey, NCell*sizeof(long)*4 );
+            memcpy( CellVal_New, CellVal, NCell*sizeof(real)   );
+            memcpy( CellPID_New, CellPID, NCell*sizeof(int)    );
+            delete [] CellKey;   CellKey = CellKey_New;
+            delete [] CellVal;   CellVal = CellVal_New;
+            delete [] CellPID;   CellPID = CellPID_New;
+
+#           if ( MODEL == HYDRO )
+            real (*CellVel_New)[3] = new real [NCell_Max][3];
+            memcpy( CellVel_New, CellVel, NCell*sizeof(real)*3 );
+            delete [] CellVel;   CellVel = CellVel_New;
+#           endif
+         }
+
+//       store the selected cells
+#        pragma omp parallel for schedule( runtime )
+         for (int t=0; t<8*NPG; t++)
+         {
+            if ( NSelect[t] == 0 )  continue;
+
+            const int  PID    = 8*Disp + t;
+            const int *Corner = amr->patch[0][lv][PID]->corner;
+            long       n      = Offset[t];
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               const real Value = GET_VALUE( t, PID, i, j, k );
+
+               if ( Value <= Threshold )  continue;
+
+               CellKey[n][0] = lv;
+               CellKey[n][1] = Corner[0] + i*amr->scale[lv];
+               CellKey[n][2] = Corner[1] + j*amr->scale[lv];
+               CellKey[n][3] = Corner[2] + k*amr->scale[lv];
+               CellVal[n]    = Value;
+               CellPID[n]    = PID;
+
+#              if ( MODEL == HYDRO )
+               const real (*Fluid)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+               const real _Dens = (real)1.0 / Fluid[DENS][k][j][i];
+               CellVel[n][0] = Fluid[MOMX][k][j][i]*_Dens;
+               CellVel[n][1] = Fluid[MOMY][k][j][i]*_Dens;
+               CellVel[n][2] = Fluid[MOMZ][k][j][i]*_Dens;
+#              endif
+
+               n ++;
+            }
+         } // for (int t=0; t<8*NPG; t++)
+
+         NCell += NNew;
+
+      } // for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+
+//    free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
+#     ifdef MASSIVE_PARTICLES
+      if ( Field & _PAR_DENS  ||  Field & _TOTAL_DENS )
+      {
+         Par_CollectParticle2OneLevel_FreeMemory( lv, SibBufPatch, FaSibBufPatch );
+
+         Prepare_PatchData_FreeParticleDensityArray( lv );
+      }
+#     endif
+
+      delete [] PID0_List;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+#  undef GET_VALUE
+
+   delete [] FieldPtr;
+   delete [] NSelect;
+   delete [] Offset;
+
+
+// 2. connect the local cells sharing a face and record the faces to be matched on other ranks
+   ClumpHash_t *CellHash = new ClumpHash_t( NCell );
+   long        *Parent   = new long [NCell];
+
+   for (long n=0; n<NCell; n++)
+   {
+      CellHash->Insert( CellKey[n], n );
+      Parent[n] = n;
+   }
+
+   long   NFace     = 0;
+   long   NFace_Max = 0;
+   long (*FaceRec)[3] = NULL;    // [0/1/2] = cell index / face index / target rank
+
+   for (long n=0; n<NCell; n++)
+   {
+      const int  lv     = CellKey[n][0];
+      const int *Corner = amr->patch[0][lv][ CellPID[n] ]->corner;
+
+      for (int f=0; f<6; f++)
+      {
+         long NbrIdx[4];
+         const int NNbr = FindFaceNeighbour( CellHash, lv, CellKey[n]+1, f, NbrIdx );
+
+         for (int t=0; t<NNbr; t++)    UF_Union( Parent, n, NbrIdx[t] );
+
+//       faces inside a patch are always resolved locally
+         const int d    = f/2;
+         const int Cell = ( CellKey[n][d+1] - Corner[d] ) / amr->scale[lv];
+
+         if ( Cell != ( (f%2) ? PS1-1 : 0 ) )   continue;
+
+         const int FaceRank = GetFaceRank( lv, CellPID[n], f );
+
+         if ( FaceRank == -1 )   continue;
+
+         if ( NFace == NFace_Max )
+         {
+            NFace_Max = MAX( 2*NFace_Max, 1024L );
+            long (*FaceRec_New)[3] = new long [NFace_Max][3];
+            memcpy( FaceRec_New, FaceRec, NFace*sizeof(long)*3 );
+            delete [] FaceRec;
+            FaceRec = FaceRec_New;
+         }
+
+         FaceRec[NFace][0] = n;
+         FaceRec[NFace][1] = f;
+         FaceRec[NFace][2] = FaceRank;
+         NFace ++;
+      }
+   }
+
+   delete [] CellPID;
+
+
+// 3. label the local regions
+// --> roots are the minimum cell indices, so CompIdx[] of a root is always set before its members
+   long *CompIdx = new long [NCell];
+   long  NComp   = 0;
+
+   for (long n=0; n<NCell; n++)
+   {
+      const long r = UF_Find( Parent, n );
+      CompIdx[n] = ( r == n ) ? NComp++ : CompIdx[r];
+   }
+
+   delete [] Parent;
+
+   const long LabelOffset = GetLabelOffset( NComp );
+
+
+// 4. send the recorded faces to the ranks owning the patches on their other sides
+// --> each record stores [level*6+face, corner x/y/z, label]
+   const int NRec = 5;
+   long *Send_NCount = new long [MPI_NRank];
+   long *Recv_NCount = new long [MPI_NRank];
+   long *Send_NDisp  = new long [MPI_NRank];
+   long *Recv_NDisp  = new long [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (long t=0; t<NFace; t++)  Send_NCount[ FaceRec[t][2] ] += NRec;
+
+   MPI_Alltoall( Send_NCount, 1, MPI_LONG, Recv_NCount, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+
+   const long NSendRec = ( Send_NDisp[MPI_NRank-1] + Send_NCount[MPI_NRank-1] ) / NRec;
+   const long NRecvRec = ( Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1] ) / NRec;
+   long *SendBuf = new long [ MAX(NSendRec,1L)*NRec ];
+   long *RecvBuf = new long [ MAX(NRecvRec,1L)*NRec ];
+   long *Counter = new long [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = Send_NDisp[r];
+
+   for (long t=0; t<NFace; t++)
+   {
+      const long n = FaceRec[t][0];
+      const int  r = FaceRec[t][2];
+      long *Rec    = SendBuf + Counter[r];
+
+      Rec[0] = CellKey[n][0]*6 + FaceRec[t][1];
+      Rec[1] = CellKey[n][1];
+      Rec[2] = CellKey[n][2];
+      Rec[3] = CellKey[n][3];
+      Rec[4] = LabelOffset + CompIdx[n];
+
+      Counter[r] += NRec;
+   }
+
+   MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, MPI_LONG,
+                        RecvBuf, Recv_NCount, Recv_NDisp, MPI_LONG, MPI_COMM_WORLD );
+
+   delete [] FaceRec;
+   delete [] SendBuf;
+   delete [] Counter;
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+
+
+// 5. match the received faces to the local selected cells
+// --> keep only the edges joining different sets to minimize the communication in ResolveClump()
+   const long     NLabel_Max = NRecvRec + MIN( 4*NRecvRec, NComp );
+   LabelForest_t *Forest     = new LabelForest_t( NLabel_Max );
+   long           NEdge      = 0;
+   long          *Edge       = new long [ 2*MAX(NLabel_Max,1L) ];
+
+   for (long t=0; t<NRecvRec; t++)
+   {
+      const long *Rec = RecvBuf + t*NRec;
+      long NbrIdx[4];
+      const int NNbr = FindFaceNeighbour( CellHash, Rec[0]/6, Rec+1, Rec[0]%6, NbrIdx );
+
+      for (int s=0; s<NNbr; s++)
+      {
+         const long Label1 = Rec[4];
+         const long Label2 = LabelOffset + CompIdx[ NbrIdx[s] ];
+
+         if ( Forest->Union(Label1, Label2) )
+         {
+            Edge[ 2*NEdge + 0 ] = Label1;
+            Edge[ 2*NEdge + 1 ] = Label2;
+            NEdge ++;
+         }
+      }
+   }
+
+   delete CellHash;
+   delete Forest;
+   delete [] RecvBuf;
+
+
+// 6. compute the partial properties of the local regions
+   const double dh_min  = amr->dh[TOP_LEVEL];
+   Clump_t     *Partial = new Clump_t [ MAX(NComp,1L) ];
+
+   for (long n=0; n<NCell; n++)
+   {
+      const int lv = CellKey[n][0];
+      Clump_t  *P  = Partial + CompIdx[n];
+      double    Coord[3];
+
+      for (int d=0; d<3; d++)    Coord[d] = amr->BoxEdgeL[d] + ( CellKey[n][d+1] + 0.5*amr->scale[lv] )*dh_min;
+
+      if (  HigherPeak( CellVal[n], Coord, P->Peak, P->PeakCoord )  )
+      {
+         P->Peak = CellVal[n];
+         for (int d=0; d<3; d++)    P->PeakCoord[d] = Coord[d];
+      }
+   }
+
+   for (long n=0; n<NCell; n++)
+   {
+      const int    lv = CellKey[n][0];
+      const double w  = CellVal[n]*CUBE( amr->dh[lv] );
+      Clump_t     *P  = Partial + CompIdx[n];
+      double       dr[3];
+
+      for (int d=0; d<3; d++)
+         dr[d] = amr->BoxEdgeL[d] + ( CellKey[n][d+1] + 0.5*amr->scale[lv] )*dh_min - P->PeakCoord[d];
+
+      MinImage( dr );
+
+      P->NMember ++;
+      P->Mass += w;
+      for (int d=0; d<3; d++)    P->CoM[d] += w*dr[d];
+#     if ( MODEL == HYDRO )
+      for (int d=0; d<3; d++)    P->Vel[d] += w*CellVel[n][d];
+#     endif
+   }
+
+   delete [] CellKey;
+   delete [] CellVal;
+#  if ( MODEL == HYDRO )
+   delete [] CellVel;
+#  endif
+   delete [] CompIdx;
+
+
+// 7. merge the regions connected across ranks
+   ResolveClump( NEdge, Edge, NComp, LabelOffset, Partial, MinNCell, Clump, NClump );
+
+   delete [] Edge;
+   delete [] Partial;
+
+
+} // FUNCTION : Aux_FindClump
+
+
+
+#ifdef MASSIVE_PARTICLES
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_FindParticleGroup
+// Description :  Find all friends-of-friends groups of massive particles
+//
+// Note        :  1. Two particles are linked if their distance is not larger than LinkLen
+//                   --> Groups are the connected sets of linked particles
+//                2. Distributed union-find
+//                   --> (a) The domain is divided into spatial buckets with widths >= LinkLen, and each bucket
+//                           is assigned to a rank
+//                       (b) Each particle is sent to the rank of its bucket and, if it lies within LinkLen of
+//                           the bucket faces, to the ranks of the adjacent buckets as well
+//                       (c) Each rank links all pairs involving at least one of its own particles using a
+//                           linked-cell grid, so that every linked pair is found on at least one rank
+//                       (d) Copies of particles owned by other ranks connect the local groups to the groups on
+//                           their owner ranks, which are then merged with a global union-find forest
+//                   --> Particles are communicated once, which is comparable to the cost of depositing
+//                       particle mass for Aux_FindExtrema() with _PAR_DENS
+//                3. Tracer particles are excluded
+//                4. Group properties are weighted by the particle mass (see "include/Clump.h")
+//                5. Support periodic BC
+//                   --> Groups must be smaller than half of the simulation box to get correct centers
+//                6. All ranks will share the same results after invoking this function
+//                7. Groups are sorted by their mass in descending order
+//                8. *Group is allocated by this function and must be freed by the caller with delete []
+//                9. Particle positions are not predicted to the same physical time
+//
+// Parameter   :  Group   : Array of particle groups to be returned
+//                NGroup  : Number of particle groups to be returned
+//                LinkLen : Linking length
+//                MinNPar : Only return groups with at least this number of particles
+//
+// Return      :  Group, NGroup
+//-------------------------------------------------------------------------------------------------------
+void Aux_FindParticleGroup( Clump_t **Group, int *NGroup, const double LinkLen, const long MinNPar )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( Group == NULL  ||  NGroup == NULL )
+      Aux_Error( ERROR_INFO, "Group == NULL or NGroup == NULL !!\n" );
+
+   if ( LinkLen <= 0.0 )
+      Aux_Error( ERROR_INFO, "LinkLen (%14.7e) <= 0.0 !!\n", LinkLen );
+
+   if ( MinNPar < 1 )
+      Aux_Error( ERROR_INFO, "MinNPar (%ld) < 1 !!\n", MinNPar );
+#  endif
+
+
+   const bool   Periodic[3] = { OPT__BC_FLU[0] == BC_FLU_PERIODIC,
+                                OPT__BC_FLU[2] == BC_FLU_PERIODIC,
+                                OPT__BC_FLU[4] == BC_FLU_PERIODIC };
+   const double LinkLen2    = SQR( LinkLen );
+   const long   NParLocal   = amr->Par->NPar_AcPlusInac;
+   const real_par *Mass     = amr->Par->Mass;
+   const real_par *Pos[3]   = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+   const real_par *Vel[3]   = { amr->Par->VelX, amr->Par->VelY, amr->Par->VelZ };
+   const long_par *PType    = amr->Par->Type;
+
+// spatial buckets and linked-cell grid, both with widths >= LinkLen
+   int    NBucket[3], NGrid[3];
+   double BucketWidth[3], GridWidth[3];
+
+   for (int d=0; d<3; d++)
+   {
+      NGrid      [d] = MAX( 1, (int)floor(amr->BoxSize[d]/LinkLen) );
+      NBucket    [d] = MIN( NX0_TOT[d], NGrid[d] );
+      GridWidth  [d] = amr->BoxSize[d] / NGrid  [d];
+      BucketWidth[d] = amr->BoxSize[d] / NBucket[d];
+   }
+
+   const long NBucketTotal = (long)NBucket[0]*NBucket[1]*NBucket[2];
+
+
+// 1. select the massive particles and get their global indices
+   long NSel = 0;
+   for (long p=0; p<NParLocal; p++)
+      if ( Mass[p] > (real_par)0.0  &&  PType[p] != PTYPE_TRACER )   NSel ++;
+
+   long *SelPar = new long [ MAX(NSel,1L) ];
+   NSel = 0;
+   for (long p=0; p<NParLocal; p++)
+      if ( Mass[p] > (real_par)0.0  &&  PType[p] != PTYPE_TRACER )   SelPar[ NSel ++ ] = p;
+
+   const long ParOffset = GetLabelOffset( NSel );
+
+
+// 2. send particles to the ranks of their own and adjacent buckets
+   const int NFlt = 7;   // position, velocity, mass
+   const int NInt = 3;   // global index, home flag, home rank
+   long *Send_NCount_Flt = new long [MPI_NRank];
+   long *Recv_NCount_Flt = new long [MPI_NRank];
+   long *Send_NDisp_Flt  = new long [MPI_NRank];
+   long *Recv_NDisp_Flt  = new long [MPI_NRank];
+   long *Send_NCount_Int = new long [MPI_NRank];
+   long *Recv_NCount_Int = new long [MPI_NRank];
+   long *Send_NDisp_Int  = new long [MPI_NRank];
+   long *Recv_NDisp_Int  = new long [MPI_NRank];
+   long *Send_NPar       = new long [MPI_NRank];
+   long *Recv_NPar       = new long [MPI_NRank];
+   long *Counter         = new long [MPI_NRank];
+
+// get the target ranks of a selected particle
+// --> TRank[0] is the home rank and duplicate ranks are removed so that each rank receives at most one copy
+#  define GET_TARGET_RANK( s, x, TRank, NTRank )                                                        \
+   {                                                                                                     \
+      const long p_ = SelPar[s];                                                                         \
+      int b_[3], Lo_[3], Hi_[3];                                                                         \
+                                                                                                         \
+      for (int d=0; d<3; d++)                                                                            \
+      {                                                                                                  \
+         x[d] = (double)Pos[d][p_];                                                                      \
+         if ( Periodic[d] )                                                                              \
+         {                                                                                               \
+            if      ( x[d] <  amr->BoxEdgeL[d] )  x[d] += amr->BoxSize[d];                               \
+            else if ( x[d] >= amr->BoxEdgeR[d] )  x[d] -= amr->BoxSize[d];                               \
+         }                                                                                               \
+                                                                                                         \
+         b_[d] = (int)floor( (x[d]-amr->BoxEdgeL[d])/BucketWidth[d] );                                   \
+         b_[d] = MAX( 0, MIN( NBucket[d]-1, b_[d] ) );                                                   \
+                                                                                                         \
+         const double xL_ = amr->BoxEdgeL[d] + b_[d]*BucketWidth[d];                                     \
+         Lo_[d] = ( x[d]-xL_                <= LinkLen ) ? -1 : 0;                                       \
+         Hi_[d] = ( xL_+BucketWidth[d]-x[d] <= LinkLen ) ? +1 : 0;                                       \
+      }                                                                                                  \
+                                                                                                         \
+      const long BIdx0_ = ( (long)b_[2]*NBucket[1] + b_[1] )*NBucket[0] + b_[0];                         \
+      TRank[0] = (int)( BIdx0_*MPI_NRank/NBucketTotal );                                                 \
+      NTRank   = 1;                                                                                      \
+                                                                                                         \
+      for (int k_=Lo_[2]; k_<=Hi_[2]; k_++)                                                              \
+      for (int j_=Lo_[1]; j_<=Hi_[1]; j_++)                                                              \
+      for (int i_=Lo_[0]; i_<=Hi_[0]; i_++)                                                              \
+      {                                                                                                  \
+         const int Off_[3] = { i_, j_, k_ };                                                             \
+         int  bb_[3];                                                                                    \
+         bool Valid_ = true;                                                                             \
+                                                                                                         \
+         for (int d=0; d<3; d++)                                                                         \
+         {                                                                                               \
+            bb_[d] = b_[d] + Off_[d];                                                                    \
+            if ( bb_[d] < 0  ||  bb_[d] >= NBucket[d] )                                                  \
+            {                                                                                            \
+               if ( Periodic[d] )   bb_[d] = ( bb_[d] + NBucket[d] ) % NBucket[d];                       \
+               else                 Valid_ = false;                                                      \
+            }                                                                                            \
+         }                                                                                               \
+                                                                                                         \
+         if ( !Valid_ )    continue;                                                                     \
+                                                                                                         \
+         const long BIdx_ = ( (long)bb_[2]*NBucket[1] + bb_[1] )*NBucket[0] + bb_[0];                    \
+         const int  r_    = (int)( BIdx_*MPI_NRank/NBucketTotal );                                       \
+         bool       New_  = true;                                                                        \
+                                                                                                         \
+         for (int t_=0; t_<NTRank; t_++)  if ( TRank[t_] == r_ )  {  New_ = false;  break;  }            \
+                                                                                                         \
+         if ( New_ )    TRank[ NTRank ++ ] = r_;                                                         \
+      }                                                                                                  \
+   }
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NPar[r] = 0;
+
+   for (long s=0; s<NSel; s++)
+   {
+      double x[3];
+      int    TRank[27], NTRank;
+
+      GET_TARGET_RANK( s, x, TRank, NTRank );
+
+      for (int t=0; t<NTRank; t++)  Send_NPar[ TRank[t] ] ++;
+   }
+
+   MPI_Alltoall( Send_NPar, 1, MPI_LONG, Recv_NPar, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Send_NCount_Flt[r] = NFlt*Send_NPar[r];
+      Recv_NCount_Flt[r] = NFlt*Recv_NPar[r];
+      Send_NCount_Int[r] = NInt*Send_NPar[r];
+      Recv_NCount_Int[r] = NInt*Recv_NPar[r];
+   }
+
+   Send_NDisp_Flt[0] = 0;
+   Recv_NDisp_Flt[0] = 0;
+   Send_NDisp_Int[0] = 0;
+   Recv_NDisp_Int[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp_Flt[r] = Send_NDisp_Flt[r-1] + Send_NCount_Flt[r-1];
+      Recv_NDisp_Flt[r] = Recv_NDisp_Flt[r-1] + Recv_NCount_Flt[r-1];
+      Send_NDisp_Int[r] = Send_NDisp_Int[r-1] + Send_NCount_Int[r-1];
+      Recv_NDisp_Int[r] = Recv_NDisp_Int[r-1] + Recv_NCount_Int[r-1];
+   }
+
+   long NSendPar = 0, NRecvPar = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSendPar += Send_NPar[r];
+      NRecvPar += Recv_NPar[r];
+   }
+
+   double *SendFlt = new double [ NFlt*MAX(NSendPar,1L) ];
+   double *RecvFlt = new double [ NFlt*MAX(NRecvPar,1L) ];
+   long   *SendInt = new long   [ NInt*MAX(NSendPar,1L) ];
+   long   *RecvInt = new long   [ NInt*MAX(NRecvPar,1L) ];
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = 0;
+
+   for (long s=0; s<NSel; s++)
+   {
+      const long p = SelPar[s];
+      double x[3];
+      int    TRank[27], NTRank;
+
+      GET_TARGET_RANK( s, x, TRank, NTRank );
+
+      for (int t=0; t<NTRank; t++)
+      {
+         const int  r   = TRank[t];
+         double    *Flt = SendFlt + Send_NDisp_Flt[r] + NFlt*Counter[r];
+         long      *Int = SendInt + Send_NDisp_Int[r] + NInt*Counter[r];
+
+         for (int d=0; d<3; d++)
+         {
+            Flt[  d] = x[d];
+            Flt[3+d] = (double)Vel[d][p];
+         }
+         Flt[6] = (double)Mass[p];
+         Int[0] = ParOffset + s;
+         Int[1] = ( t == 0 ) ? 1 : 0;
+         Int[2] = TRank[0];
+
+         Counter[r] ++;
+      }
+   }
+
+#  undef GET_TARGET_RANK
+
+   MPI_Alltoallv_GAMER( SendFlt, Send_NCount_Flt, Send_NDisp_Flt, MPI_DOUBLE,
+                        RecvFlt, Recv_NCount_Flt, Recv_NDisp_Flt, MPI_DOUBLE, MPI_COMM_WORLD );
+   MPI_Alltoallv_GAMER( SendInt, Send_NCount_Int, Send_NDisp_Int, MPI_LONG,
+                        RecvInt, Recv_NCount_Int, Recv_NDisp_Int, MPI_LONG, MPI_COMM_WORLD );
+
+   delete [] SelPar;
+   delete [] SendFlt;
+   delete [] SendInt;
+
+
+// 3. link all pairs involving at least one home particle using a linked-cell grid
+   ClumpHash_t *GridHash = new ClumpHash_t( NRecvPar );
+   long        *Next     = new long [ MAX(NRecvPar,1L) ];
+   long        *Parent   = new long [ MAX(NRecvPar,1L) ];
+   int        (*GridIdx)[3] = new int [ MAX(NRecvPar,1L) ][3];
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      for (int d=0; d<3; d++)
+      {
+         GridIdx[t][d] = (int)floor( (RecvFlt[NFlt*t+d]-amr->BoxEdgeL[d])/GridWidth[d] );
+         GridIdx[t][d] = MAX( 0, MIN( NGrid[d]-1, GridIdx[t][d] ) );
+      }
+
+      const long Key[4] = { 0, GridIdx[t][0], GridIdx[t][1], GridIdx[t][2] };
+      const long Head   = GridHash->Insert( Key, t );
+
+//    prepend particle t to the chain of its grid cell if the cell already exists
+      if ( Head != t )
+      {
+         Next[t] = Next[Head];
+         Next[Head] = t;
+      }
+      else
+         Next[t] = -1;
+
+      Parent[t] = t;
+   }
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      const double *x1 = RecvFlt + NFlt*t;
+      long NbrCell[27][4];
+      int  NNbrCell = 0;
+
+      for (int k=-1; k<=1; k++)
+      for (int j=-1; j<=1; j++)
+      for (int i=-1; i<=1; i++)
+      {
+         const int Off[3] = { i, j, k };
+         long Key[4] = { 0, 0, 0, 0 };
+         bool Valid  = true;
+
+         for (int d=0; d<3; d++)
+         {
+            int g = GridIdx[t][d] + Off[d];
+
+            if ( g < 0  ||  g >= NGrid[d] )
+            {
+               if ( Periodic[d] )   g = ( g + NGrid[d] ) % NGrid[d];
+               else                 Valid = false;
+            }
+
+            Key[d+1] = g;
+         }
+
+         if ( !Valid )  continue;
+
+//       remove duplicate cells when there are fewer than three cells along a periodic direction
+         bool New = true;
+         for (int c=0; c<NNbrCell; c++)
+            if ( NbrCell[c][1] == Key[1]  &&  NbrCell[c][2] == Key[2]  &&  NbrCell[c][3] == Key[3] )
+            {
+               New = false;
+               break;
+            }
+
+         if ( New )
+         {
+            for (int d=0; d<4; d++)    NbrCell[NNbrCell][d] = Key[d];
+            NNbrCell ++;
+         }
+      }
+
+      for (int c=0; c<NNbrCell; c++)
+      {
+         for (long s=GridHash->Find(NbrCell[c]); s!=-1; s=Next[s])
+         {
+            if ( s <= t )  continue;
+            if ( RecvInt[NInt*t+1] == 0  &&  RecvInt[NInt*s+1] == 0 )  continue;
+
+            const double *x2 = RecvFlt + NFlt*s;
+            double dr[3] = { x2[0]-x1[0], x2[1]-x1[1], x2[2]-x1[2] };
+
+            MinImage( dr );
+
+            if ( SQR(dr[0]) + SQR(dr[1]) + SQR(dr[2]) <= LinkLen2 )   UF_Union( Parent, t, s );
+         }
+      }
+   } // for (long t=0; t<NRecvPar; t++)
+
+   delete GridHash;
+   delete [] Next;
+   delete [] GridIdx;
+
+
+// 4. label the local groups containing at least one home particle
+   long *CompIdx = new long [ MAX(NRecvPar,1L) ];
+   long  NComp   = 0;
+
+   for (long t=0; t<NRecvPar; t++)  CompIdx[t] = -1;
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0 )   continue;
+
+      const long r = UF_Find( Parent, t );
+      if ( CompIdx[r] == -1 )    CompIdx[r] = NComp ++;
+   }
+
+   for (long t=0; t<NRecvPar; t++)  CompIdx[t] = CompIdx[ UF_Find(Parent,t) ];
+
+   delete [] Parent;
+
+   const long LabelOffset = GetLabelOffset( NComp );
+
+
+// 5. send the labels of the linked copies back to the home ranks of the particles
+// --> the home rank is the rank of the bucket containing the particle (i.e., TRank[0] in GET_TARGET_RANK),
+//     which in general differs from the rank sending the copy since patches are distributed by load balancing
+   long NGhost = 0;
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NPar[r] = 0;
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0  &&  CompIdx[t] != -1 )
+      {
+         Send_NPar[ RecvInt[NInt*t+2] ] ++;
+         NGhost ++;
+      }
+   }
+
+   MPI_Alltoall( Send_NPar, 1, MPI_LONG, Recv_NPar, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   long NRecvGhost = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Send_NCount_Int[r] = 2*Send_NPar[r];
+      Recv_NCount_Int[r] = 2*Recv_NPar[r];
+      NRecvGhost        += Recv_NPar[r];
+   }
+
+   Send_NDisp_Int[0] = 0;
+   Recv_NDisp_Int[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp_Int[r] = Send_NDisp_Int[r-1] + Send_NCount_Int[r-1];
+      Recv_NDisp_Int[r] = Recv_NDisp_Int[r-1] + Recv_NCount_Int[r-1];
+   }
+
+   long *SendGhost = new long [ 2*MAX(NGhost,1L) ];
+   long *RecvGhost = new long [ 2*MAX(NRecvGhost,1L) ];
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = 0;
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0  &&  CompIdx[t] != -1 )
+      {
+         const int  HomeRank = (int)RecvInt[ NInt*t + 2 ];
+         long      *Ghost    = SendGhost + Send_NDisp_Int[HomeRank] + 2*Counter[HomeRank];
+
+         Ghost[0] = RecvInt[NInt*t];
+         Ghost[1] = LabelOffset + CompIdx[t];
+         Counter[HomeRank] ++;
+      }
+   }
+
+   MPI_Alltoallv_GAMER( SendGhost, Send_NCount_Int, Send_NDisp_Int, MPI_LONG,
+                        RecvGhost, Recv_NCount_Int, Recv_NDisp_Int, MPI_LONG, MPI_COMM_WORLD );
+
+
+// 6. connect the groups of the home particles to the groups of their copies on other ranks
+   ClumpHash_t   *HomeHash = new ClumpHash_t( NRecvPar );
+   LabelForest_t *Forest   = new LabelForest_t( 2*NRecvGhost );
+   long           NEdge    = 0;
+   long          *Edge     = new long [ 2*MAX(NRecvGhost,1L) ];
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0 )   continue;
+
+      const long Key[4] = { RecvInt[NInt*t], 0, 0, 0 };
+      HomeHash->Insert( Key, t );
+   }
+
+   for (long g=0; g<NRecvGhost; g++)
+   {
+      const long Key[4] = { RecvGhost[2*g], 0, 0, 0 };
+      const long t      = HomeHash->Find( Key );
+
+      if ( t == -1 )
+         Aux_Error( ERROR_INFO, "home particle %ld is not found !!\n", RecvGhost[2*g] );
+
+      const long Label1 = RecvGhost[ 2*g + 1 ];
+      const long Label2 = LabelOffset + CompIdx[t];
+
+      if ( Forest->Union(Label1, Label2) )
+      {
+         Edge[ 2*NEdge + 0 ] = Label1;
+         Edge[ 2*NEdge + 1 ] = Label2;
+         NEdge ++;
+      }
+   }
+
+   delete HomeHash;
+   delete Forest;
+   delete [] SendGhost;
+   delete [] RecvGhost;
+
+
+// 7. compute the partial properties of the local groups from the home particles
+   Clump_t *Partial = new Clump_t [ MAX(NComp,1L) ];
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0 )   continue;
+
+      const double *Flt = RecvFlt + NFlt*t;
+      Clump_t      *P   = Partial + CompIdx[t];
+
+      if (  HigherPeak( Flt[6], Flt, P->Peak, P->PeakCoord )  )
+      {
+         P->Peak = Flt[6];
+         for (int d=0; d<3; d++)    P->PeakCoord[d] = Flt[d];
+      }
+   }
+
+   for (long t=0; t<NRecvPar; t++)
+   {
+      if ( RecvInt[NInt*t+1] == 0 )   continue;
+
+      const double *Flt = RecvFlt + NFlt*t;
+      const double  w   = Flt[6];
+      Clump_t      *P   = Partial + CompIdx[t];
+      double        dr[3];
+
+      for (int d=0; d<3; d++)    dr[d] = Flt[d] - P->PeakCoord[d];
+
+      MinImage( dr );
+
+      P->NMember ++;
+      P->Mass += w;
+      for (int d=0; d<3; d++)
+      {
+         P->CoM[d] += w*dr[d];
+         P->Vel[d] += w*Flt[3+d];
+      }
+   }
+
+   delete [] RecvFlt;
+   delete [] RecvInt;
+   delete [] CompIdx;
+   delete [] Send_NCount_Flt;
+   delete [] Recv_NCount_Flt;
+   delete [] Send_NDisp_Flt;
+   delete [] Recv_NDisp_Flt;
+   delete [] Send_NCount_Int;
+   delete [] Recv_NCount_Int;
+   delete [] Send_NDisp_Int;
+   delete [] Recv_NDisp_Int;
+   delete [] Send_NPar;
+   delete [] Recv_NPar;
+   delete [] Counter;
+
+
+// 8. merge the groups connected across ranks
+   ResolveClump( NEdge, Edge, NComp, LabelOffset, Partial, MinNPar, Group, NGroup );
+
+   delete [] Edge;
+   delete [] Partial;
+
+} // FUNCTION : Aux_FindParticleGroup
+#endif // #ifdef MASSIVE_PARTICLES
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  UF_Find / UF_Union
+// Description :  Find the root / join the sets of a union-find forest over local indices
+//
+// Note        :  1. Use path halving
+//                2. The root of each set is its minimum index
+//-------------------------------------------------------------------------------------------------------
+long UF_Find( long *Parent, long t )
+{
+
+   while ( Parent[t] != t )
+   {
+      Parent[t] = Parent[ Parent[t] ];
+      t         = Parent[t];
+   }
+
+   return t;
+
+} // FUNCTION : UF_Find
+
+void UF_Union( long *Parent, const long t1, const long t2 )
+{
+
+   const long r1 = UF_Find( Parent, t1 );
+   const long r2 = UF_Find( Parent, t2 );
+
+   if      ( r1 < r2 )   Parent[r2] = r1;
+   else if ( r2 < r1 )   Parent[r1] = r2;
+
+} // FUNCTION : UF_Union
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  HigherPeak
+// Description :  Return true if peak A is higher than peak B
+//
+// Note        :  Ties are broken by the coordinates so that the result does not depend on the order of
+//                the comparisons
+//-------------------------------------------------------------------------------------------------------
+bool HigherPeak( const double PeakA, const double CoordA[], const double PeakB, const double CoordB[] )
+{
+
+   if ( PeakA != PeakB )   return ( PeakA > PeakB );
+
+   for (int d=0; d<3; d++)
+      if ( CoordA[d] != CoordB[d] )    return ( CoordA[d] < CoordB[d] );
+
+   return false;
+
+} // FUNCTION : HigherPeak
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MinImage
+// Description :  Map a separation vector to its minimum image along the periodic directions
+//-------------------------------------------------------------------------------------------------------
+void MinImage( double dr[] )
+{
+
+   for (int d=0; d<3; d++)
+   {
+      if ( OPT__BC_FLU[2*d] != BC_FLU_PERIODIC )   continue;
+
+      if      ( dr[d] > +0.5*amr->BoxSize[d] )   dr[d] -= amr->BoxSize[d];
+      else if ( dr[d] < -0.5*amr->BoxSize[d] )   dr[d] += amr->BoxSize[d];
+   }
+
+} // FUNCTION : MinImage
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLabelOffset
+// Description :  Return the sum of NComp over all lower ranks
+//
+// Note        :  Used to convert local indices into global labels
+//-------------------------------------------------------------------------------------------------------
+long GetLabelOffset( const long NComp )
+{
+
+   long *NComp_AllRank = new long [MPI_NRank];
+   long  LabelOffset   = 0;
+
+   MPI_Allgather( &NComp, 1, MPI_LONG, NComp_AllRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_Rank; r++)   LabelOffset += NComp_AllRank[r];
+
+   delete [] NComp_AllRank;
+
+   return LabelOffset;
+
+} // FUNCTION : GetLabelOffset
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FindFaceNeighbour
+// Description :  Find the selected leaf cells adjacent to a face of a leaf cell in a hash table of cell positions
+//
+// Note        :  1. Face f = 2*d (2*d+1) is the lower (upper) face along direction d
+//                2. Neighbours can be on the same level, one level coarser, or one level finer owing to the
+//                   proper-nesting constraint
+//                3. The key of a neighbour is [level, corner x/y/z]
+//                4. Faces on non-periodic boundaries have no neighbours
+//
+// Parameter   :  Hash   : Hash table to be searched
+//                lv     : AMR level of the target cell
+//                Corner : Corner indices of the target cell in the unit of the finest grid scale
+//                f      : Target face
+//                NbrIdx : Hash values of the neighbours found
+//
+// Return      :  Number of neighbours found, NbrIdx[]
+//-------------------------------------------------------------------------------------------------------
+int FindFaceNeighbour( const ClumpHash_t *Hash, const int lv, const long Corner[], const int f, long NbrIdx[] )
+{
+
+   const int d = f/2;
+   const int s = amr->scale[lv];
+   long Nbr[3] = { Corner[0], Corner[1], Corner[2] };
+
+   Nbr[d] += ( f%2 ) ? s : -s;
+
+   if ( Nbr[d] < 0  ||  Nbr[d] >= amr->BoxScale[d] )
+   {
+      if ( OPT__BC_FLU[2*d] != BC_FLU_PERIODIC )   return 0;
+
+      Nbr[d] = ( Nbr[d] + amr->BoxScale[d] ) % amr->BoxScale[d];
+   }
+
+// same level
+   long Key[4] = { lv, Nbr[0], Nbr[1], Nbr[2] };
+
+   if (  ( NbrIdx[0] = Hash->Find(Key) ) != -1  )   return 1;
+
+// coarser level
+   if ( lv > 0 )
+   {
+      const int S = 2*s;
+
+      Key[0] = lv - 1;
+      for (int t=0; t<3; t++)    Key[t+1] = Nbr[t] - Nbr[t]%S;
+
+      if (  ( NbrIdx[0] = Hash->Find(Key) ) != -1  )   return 1;
+   }
+
+// finer level
+   int NNbr = 0;
+
+   if ( lv < TOP_LEVEL )
+   {
+      const int h  = s/2;
+      const int d1 = (d+1)%3;
+      const int d2 = (d+2)%3;
+
+      Key[0] = lv + 1;
+
+      for (int b=0; b<2; b++)
+      for (int a=0; a<2; a++)
+      {
+         Key[d +1] = Nbr[d ] + ( (f%2) ? 0 : h );
+         Key[d1+1] = Nbr[d1] + a*h;
+         Key[d2+1] = Nbr[d2] + b*h;
+
+         if (  ( NbrIdx[NNbr] = Hash->Find(Key) ) != -1  )    NNbr ++;
+      }
+   }
+
+   return NNbr;
+
+} // FUNCTION : FindFaceNeighbour
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetFaceRank
+// Description :  Return the rank matching a cell face lying on the boundary of a real leaf patch
+//
+// Note        :  1. Return -1 if the face is not sent, which is the case when
+//                   (a) The other side lies in a real patch on this rank, whether or not its cells are selected
+//                   (b) The other side is refined, in which case the finer cells send their faces to this rank
+//                       instead (see (2b))
+//                   (c) The face lies on a non-periodic boundary
+//                2. Otherwise the face is sent to the rank owning the patch on the other side, which is
+//                   (a) A buffer patch on the same level
+//                   (b) A coarser patch when the sibling patch does not exist
+//                   --> Every face between the selected cells of different ranks is matched on at least one rank
+//
+// Parameter   :  lv  : AMR level of the target patch
+//                PID : Target patch ID
+//                f   : Target face, which is also the corresponding sibling direction
+//
+// Return      :  Target rank or -1
+//-------------------------------------------------------------------------------------------------------
+int GetFaceRank( const int lv, const int PID, const int f )
+{
+
+   const int SibPID = amr->patch[0][lv][PID]->sibling[f];
+
+// non-periodic boundary
+   if ( SibPID < -1 )   return -1;
+
+// sibling patch on the same level
+   if ( SibPID >= 0 )
+   {
+      if ( amr->patch[0][lv][SibPID]->son != -1  ||  SibPID < amr->NPatchComma[lv][1] )  return -1;
+
+      return GetPatchRank( lv, amr->patch[0][lv][SibPID]->corner );
+   }
+
+// coarser patch
+   const int d           = f/2;
+   const int FaPatchSize = PS1*amr->scale[lv-1];
+   int Corner[3];
+
+   for (int t=0; t<3; t++)    Corner[t] = amr->patch[0][lv][PID]->corner[t];
+
+   Corner[d] += ( f%2 ) ? PS1*amr->scale[lv] : -amr->scale[lv];
+   Corner[d]  = ( Corner[d] + amr->BoxScale[d] ) % amr->BoxScale[d];
+
+   for (int t=0; t<3; t++)    Corner[t] -= Corner[t] % FaPatchSize;
+
+   const int FaceRank = GetPatchRank( lv-1, Corner );
+
+   return ( FaceRank == MPI_Rank ) ? -1 : FaceRank;
+
+} // FUNCTION : GetFaceRank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPatchRank
+// Description :  Return the rank owning the real patch with the input corner
+//
+// Note        :  1. Periodic B.C. is applied to the input corner
+//                2. Use the load-balance index with LOAD_BALANCE and the rectangular domain decomposition otherwise
+//-------------------------------------------------------------------------------------------------------
+int GetPatchRank( const int lv, const int Corner[] )
+{
+
+#  ifdef LOAD_BALANCE
+   return LB_Index2Rank( lv, LB_Corner2Index(lv, Corner, CHECK_OFF), CHECK_ON );
+
+#  else
+   int RankX[3];
+
+   for (int d=0; d<3; d++)
+      RankX[d] = ( (Corner[d] + amr->BoxScale[d]) % amr->BoxScale[d] ) / ( NX0[d]*amr->scale[0] );
+
+   return ( RankX[2]*MPI_NRank_X[1] + RankX[1] )*MPI_NRank_X[0] + RankX[0];
+#  endif
+
+} // FUNCTION : GetPatchRank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ResolveClump
+// Description :  Merge the local clumps connected across ranks and share the final clumps with all ranks
+//
+// Note        :  1. Invoked by Aux_FindClump() and Aux_FindParticleGroup()
+//                2. The union-find forest over labels is distributed over the ranks owning the labels
+//                   --> Label L is owned by the rank with LabelOffset <= L < LabelOffset+NComp, which stores
+//                       the parent label of L
+//                   --> Each round (a) replaces the two labels of each edge by their parents and removes the
+//                       edges within the same tree, (b) hooks the larger root onto the smaller label on the
+//                       rank owning the root, and (c) halves the tree depth by pointer jumping
+//                   --> The edges are never gathered, and the root of each tree is its minimum label
+//                3. Partial properties are reduced on the rank owning the final label
+//                4. Partial[].CoM[] and Partial[].Vel[] store the weighted sums (see "include/Clump.h")
+//
+// Parameter   :  NEdge       : Number of local edges
+//                Edge        : Pairs of connected labels
+//                NComp       : Number of local clumps
+//                LabelOffset : Label of the first local clump
+//                Partial     : Partial properties of the local clumps
+//                MinNMember  : Minimum number of members of the returned clumps
+//                Clump       : Array of clumps to be returned
+//                NClump      : Number of clumps to be returned
+//
+// Return      :  Clump, NClump
+//-------------------------------------------------------------------------------------------------------
+void ResolveClump( const long NEdge, const long *Edge, const long NComp, const long LabelOffset,
+                   const Clump_t *Partial, const long MinNMember, Clump_t **Clump, int *NClump )
+{
+
+// 1. build the union-find forest distributed over the ranks owning the labels
+// --> RootTable[c] is the parent label of the local label LabelOffset+c
+   int  *NCount              = new int  [MPI_NRank];
+   int  *NDisp               = new int  [MPI_NRank];
+   long *NComp_AllRank       = new long [MPI_NRank];
+   long *LabelOffset_AllRank = new long [MPI_NRank+1];
+
+   MPI_Allgather( &NComp, 1, MPI_LONG, NComp_AllRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   LabelOffset_AllRank[0] = 0;
+   for (int r=0; r<MPI_NRank; r++)  LabelOffset_AllRank[r+1] = LabelOffset_AllRank[r] + NComp_AllRank[r];
+
+   delete [] NComp_AllRank;
+
+   long *RootTable = new long [ MAX(NComp,1L) ];
+   long *Grand     = new long [ MAX(NComp,1L) ];
+   long *Link      = new long [ 2*MAX(NEdge,1L) ];
+   long *LinkRoot  = new long [ 2*MAX(NEdge,1L) ];
+   long  NLink     = NEdge;
+   long  NLink_All, NJump, NJump_All;
+
+   for (long c=0; c<NComp; c++)  RootTable[c] = LabelOffset + c;
+
+   memcpy( Link, Edge, 2*NEdge*sizeof(long) );
+
+   do
+   {
+//    1-1. replace the labels of each link by their parents and remove the links within the same tree
+      GetLabelRoot( 2*NLink, Link, LinkRoot, RootTable, LabelOffset_AllRank );
+
+      const long NLink_Old = NLink;
+      NLink = 0;
+
+      for (long e=0; e<NLink_Old; e++)
+      {
+         if ( LinkRoot[2*e] == LinkRoot[2*e+1] )   continue;
+
+         Link[ 2*NLink + 0 ] = LinkRoot[ 2*e + 0 ];
+         Link[ 2*NLink + 1 ] = LinkRoot[ 2*e + 1 ];
+         NLink ++;
+      }
+
+      MPI_Allreduce( &NLink, &NLink_All, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+//    1-2. hook the larger label onto the smaller one if the larger one is still a root
+//    --> links failing to hook are kept for the next round
+      if ( NLink_All > 0 )
+      {
+         for (int r=0; r<MPI_NRank; r++)  NCount[r] = 0;
+
+         for (long e=0; e<NLink; e++)
+            NCount[ GetLabelRank( MAX(Link[2*e],Link[2*e+1]), LabelOffset_AllRank ) ] += 2;
+
+         int *Recv_NCount = new int [MPI_NRank];
+         int *Recv_NDisp  = new int [MPI_NRank];
+         int *Counter     = new int [MPI_NRank];
+
+         MPI_Alltoall( NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+         NDisp     [0] = 0;
+         Recv_NDisp[0] = 0;
+         for (int r=1; r<MPI_NRank; r++)
+         {
+            NDisp     [r] = NDisp     [r-1] + NCount     [r-1];
+            Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+         }
+
+         const int NRecvHook = Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1];
+         long *SendHook = new long [ 2*MAX(NLink,1L) ];
+         long *RecvHook = new long [ MAX(NRecvHook,1) ];
+
+         for (int r=0; r<MPI_NRank; r++)  Counter[r] = NDisp[r];
+
+         for (long e=0; e<NLink; e++)
+         {
+            const long Hi = MAX( Link[2*e], Link[2*e+1] );
+            const long Lo = MIN( Link[2*e], Link[2*e+1] );
+            const int  r  = GetLabelRank( Hi, LabelOffset_AllRank );
+
+            SendHook[ Counter[r] ++ ] = Hi;
+            SendHook[ Counter[r] ++ ] = Lo;
+         }
+
+         MPI_Alltoallv( SendHook, NCount, NDisp, MPI_LONG, RecvHook, Recv_NCount, Recv_NDisp, MPI_LONG, MPI_COMM_WORLD );
+
+         for (int t=0; t<NRecvHook; t+=2)
+         {
+            const long c = RecvHook[t] - LabelOffset;
+
+            if ( RootTable[c] == RecvHook[t] )  RootTable[c] = RecvHook[t+1];
+         }
+
+         delete [] Recv_NCount;
+         delete [] Recv_NDisp;
+         delete [] Counter;
+         delete [] SendHook;
+         delete [] RecvHook;
+      } // if ( NLink_All > 0 )
+
+//    1-3. pointer jumping
+      GetLabelRoot( NComp, RootTable, Grand, RootTable, LabelOffset_AllRank );
+
+      NJump = 0;
+      for (long c=0; c<NComp; c++)
+      {
+         if ( Grand[c] != RootTable[c] )
+         {
+            RootTable[c] = Grand[c];
+            NJump ++;
+         }
+      }
+
+      MPI_Allreduce( &NJump, &NJump_All, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+   }
+   while ( NLink_All > 0  ||  NJump_All > 0 );
+
+   delete [] Grand;
+   delete [] Link;
+   delete [] LinkRoot;
+
+
+// 2. send the partial properties to the ranks owning the final labels
+#  ifndef SERIAL
+   MPI_Datatype MPI_Clump_t;
+   Partial->CreateMPIType( &MPI_Clump_t );
+#  endif
+
+   int  *Send_NCount = new int [MPI_NRank];
+   int  *Recv_NCount = new int [MPI_NRank];
+   int  *Send_NDisp  = new int [MPI_NRank];
+   int  *Recv_NDisp  = new int [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (long c=0; c<NComp; c++)  Send_NCount[ GetLabelRank(RootTable[c], LabelOffset_AllRank) ] ++;
+
+   MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+
+   const int NRecv = Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1];
+   long    *SendLabel = new long    [ MAX(NComp,1L) ];
+   long    *RecvLabel = new long    [ MAX(NRecv,1) ];
+   Clump_t *SendClump = new Clump_t [ MAX(NComp,1L) ];
+   Clump_t *RecvClump = new Clump_t [ MAX(NRecv,1) ];
+   int     *Counter   = new int     [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = Send_NDisp[r];
+
+   for (long c=0; c<NComp; c++)
+   {
+      const int r = GetLabelRank( RootTable[c], LabelOffset_AllRank );
+
+      SendLabel[ Counter[r] ] = RootTable[c];
+      SendClump[ Counter[r] ] = Partial[c];
+      Counter[r] ++;
+   }
+
+   MPI_Alltoallv( SendLabel, Send_NCount, Send_NDisp, MPI_LONG,
+                  RecvLabel, Recv_NCount, Recv_NDisp, MPI_LONG,    MPI_COMM_WORLD );
+   MPI_Alltoallv( SendClump, Send_NCount, Send_NDisp, MPI_Clump_t,
+                  RecvClump, Recv_NCount, Recv_NDisp, MPI_Clump_t, MPI_COMM_WORLD );
+
+   delete [] SendLabel;
+   delete [] SendClump;
+   delete [] RootTable;
+   delete [] LabelOffset_AllRank;
+   delete [] Counter;
+
+
+// 3. merge the partial properties with the same label
+// --> sort by label and merge the partial clumps in order
+   int     *IdxTable = new int     [ MAX(NRecv,1) ];
+   Clump_t *Final    = new Clump_t [ MAX(NRecv,1) ];
+   int      NFinal   = 0;
+
+   Mis_Heapsort( NRecv, RecvLabel, IdxTable );
+
+   for (int t=0; t<NRecv; )
+   {
+      Clump_t C = RecvClump[ IdxTable[t] ];
+
+      int u;
+      for (u=t+1; u<NRecv && RecvLabel[u]==RecvLabel[t]; u++)
+      {
+         const Clump_t *B = RecvClump + IdxTable[u];
+         double Ref[3], drA[3], drB[3];
+
+//       use the higher peak as the new reference point
+         const bool B_Higher = HigherPeak( B->Peak, B->PeakCoord, C.Peak, C.PeakCoord );
+
+         for (int d=0; d<3; d++)
+         {
+            Ref[d] = ( B_Higher ) ? B->PeakCoord[d] : C.PeakCoord[d];
+            drA[d] = C .PeakCoord[d] - Ref[d];
+            drB[d] = B->PeakCoord[d] - Ref[d];
+         }
+
+         MinImage( drA );
+         MinImage( drB );
+
+         for (int d=0; d<3; d++)
+         {
+            C.CoM      [d] += C.Mass*drA[d] + B->CoM[d] + B->Mass*drB[d];
+            C.Vel      [d] += B->Vel[d];
+            C.PeakCoord[d]  = Ref[d];
+         }
+
+         C.NMember += B->NMember;
+         C.Mass    += B->Mass;
+         if ( B_Higher )   C.Peak = B->Peak;
+      }
+
+      t = u;
+
+      if ( C.NMember < MinNMember )    continue;
+
+//    convert the weighted sums to the center and bulk velocity
+      for (int d=0; d<3; d++)
+      {
+         if ( C.Mass != 0.0 )
+         {
+            C.CoM[d]  = C.PeakCoord[d] + C.CoM[d]/C.Mass;
+            C.Vel[d] /= C.Mass;
+         }
+         else
+            C.CoM[d]  = C.PeakCoord[d];
+
+         if ( OPT__BC_FLU[2*d] == BC_FLU_PERIODIC )
+         {
+            if      ( C.CoM[d] <  amr->BoxEdgeL[d] )   C.CoM[d] += amr->BoxSize[d];
+            else if ( C.CoM[d] >= amr->BoxEdgeR[d] )   C.CoM[d] -= amr->BoxSize[d];
+         }
+      }
+
+      Final[ NFinal ++ ] = C;
+   } // for (int t=0; t<NRecv; )
+
+   delete [] IdxTable;
+   delete [] RecvLabel;
+   delete [] RecvClump;
+
+
+// 4. share the final clumps with all ranks and sort them by mass in descending order
+   MPI_Allgather( &NFinal, 1, MPI_INT, NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  NDisp[r] = NDisp[r-1] + NCount[r-1];
+
+   *NClump = NDisp[MPI_NRank-1] + NCount[MPI_NRank-1];
+
+   Clump_t *Final_All = new Clump_t [ MAX(*NClump,1) ];
+
+   MPI_Allgatherv( Final, NFinal, MPI_Clump_t, Final_All, NCount, NDisp, MPI_Clump_t, MPI_COMM_WORLD );
+
+   double *MinusMass = new double [ MAX(*NClump,1) ];
+   int    *Order     = new int    [ MAX(*NClump,1) ];
+
+   for (int c=0; c<*NClump; c++)    MinusMass[c] = -Final_All[c].Mass;
+
+   Mis_Heapsort( *NClump, MinusMass, Order );
+
+   *Clump = new Clump_t [ MAX(*NClump,1) ];
+
+   for (int c=0; c<*NClump; c++)    (*Clump)[c] = Final_All[ Order[c] ];
+
+   delete [] MinusMass;
+   delete [] Order;
+   delete [] Final;
+   delete [] Final_All;
+   delete [] NCount;
+   delete [] NDisp;
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+
+#  ifndef SERIAL
+   MPI_Type_free( &MPI_Clump_t );
+#  endif
+
+} // FUNCTION : ResolveClump
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLabelRoot
+// Description :  Get the parent labels of the input labels from the ranks owning them
+//
+// Note        :  Invoked by ResolveClump()
+//
+// Parameter   :  NQuery              : Number of input labels
+//                Query               : Input labels
+//                Root                : Parent labels to be returned
+//                RootTable           : Parent labels of the local labels
+//                LabelOffset_AllRank : First label of each rank
+//
+// Return      :  Root[]
+//-------------------------------------------------------------------------------------------------------
+void GetLabelRoot( const long NQuery, const long *Query, long *Root, const long *RootTable,
+                   const long *LabelOffset_AllRank )
+{
+
+   long *Send_NCount = new long [MPI_NRank];
+   long *Recv_NCount = new long [MPI_NRank];
+   long *Send_NDisp  = new long [MPI_NRank];
+   long *Recv_NDisp  = new long [MPI_NRank];
+   long *Counter     = new long [MPI_NRank];
+   int  *QueryRank   = new int  [ MAX(NQuery,1L) ];
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (long q=0; q<NQuery; q++)
+   {
+      QueryRank[q] = GetLabelRank( Query[q], LabelOffset_AllRank );
+      Send_NCount[ QueryRank[q] ] ++;
+   }
+
+   MPI_Alltoall( Send_NCount, 1, MPI_LONG, Recv_NCount, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+
+   const long NRecv     = Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1];
+   long      *SendLabel = new long [ MAX(NQuery,1L) ];
+   long      *RecvLabel = new long [ MAX(NRecv, 1L) ];
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = Send_NDisp[r];
+
+   for (long q=0; q<NQuery; q++)    SendLabel[ Counter[ QueryRank[q] ] ++ ] = Query[q];
+
+   MPI_Alltoallv_GAMER( SendLabel, Send_NCount, Send_NDisp, MPI_LONG,
+                        RecvLabel, Recv_NCount, Recv_NDisp, MPI_LONG, MPI_COMM_WORLD );
+
+// reply in place
+   for (long t=0; t<NRecv; t++)     RecvLabel[t] = RootTable[ RecvLabel[t] - LabelOffset_AllRank[MPI_Rank] ];
+
+   MPI_Alltoallv_GAMER( RecvLabel, Recv_NCount, Recv_NDisp, MPI_LONG,
+                        SendLabel, Send_NCount, Send_NDisp, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = Send_NDisp[r];
+
+   for (long q=0; q<NQuery; q++)    Root[q] = SendLabel[ Counter[ QueryRank[q] ] ++ ];
+
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+   delete [] Counter;
+   delete [] QueryRank;
+   delete [] SendLabel;
+   delete [] RecvLabel;
+
+} // FUNCTION : GetLabelRoot
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLabelRank
+// Description :  Return the rank owning the input label
+//
+// Note        :  1. Label L is owned by the rank with LabelOffset_AllRank[r] <= L < LabelOffset_AllRank[r+1]
+//                   --> Use the largest such rank to skip the ranks without any label
+//-------------------------------------------------------------------------------------------------------
+int GetLabelRank( const long Label, const long *LabelOffset_AllRank )
+{
+
+   int Lo = 0;
+   int Hi = MPI_NRank - 1;
+
+   while ( Lo < Hi )
+   {
+      const int Mid = ( Lo + Hi + 1 ) / 2;
+
+      if ( LabelOffset_AllRank[Mid] <= Label )  Lo = Mid;
+      else                                      Hi = Mid - 1;
+   }
+
+   return Lo;
+
+} // FUNCTION : GetLabelRank
@@ -11,6 +11,9 @@
 //                   (1) VmSize/Peak : current/peak virtual  memory size
 //                   (2) VmRSS/HWM   : current/peak physical memory size
 //                2. Only the maximum values among all MPI ranks will be recorded
+//                3. Also record the memory consumption of the patch pointer tables (amr->patch) and the
+//                   maximum number of patches at each level during the entire simulation (amr->NPatchMax)
+//                   --> Useful for monitoring the growth of the patch tables (see PatchTable.h)
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -26,6 +29,8 @@ void Aux_GetMemInfo()
    char   VmSize[MAX_STRING], VmPeak[MAX_STRING], VmRSS[MAX_STRING], VmHWM[MAX_STRING];
    bool   GetVmSize=false, GetVmPeak=false, GetVmRSS=false, GetVmHWM=false;
    double Vm_double[NInfo], Vm_max[NInfo], Vm_sum[NInfo];
+   double PTab_MB, PTab_max;
+   int    NPatchMax_AllRank[NLEVEL];
    size_t len=0;
 
 
@@ -91,6 +96,16 @@ void Aux_GetMemInfo()
    MPI_Reduce( Vm_double, Vm_max, NInfo, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
    MPI_Reduce( Vm_double, Vm_sum, NInfo, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
+   long PTab_Byte = 0;
+   for (int Sg=0; Sg<2; Sg++)
+   for (int lv=0; lv<NLEVEL; lv++)
+      PTab_Byte += amr->patch[Sg][lv].MemSize();
+
+   PTab_MB = (double)PTab_Byte/SQR(1024.0);
+
+   MPI_Reduce( &PTab_MB, &PTab_max, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( amr->NPatchMax, NPatchMax_AllRank, NLEVEL, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD );
+
 
 // 3. record memory information
    if ( MPI_Rank == 0 )
@@ -109,19 +124,32 @@ void Aux_GetMemInfo()
          fprintf( File_Record, "# Phy_Max  : maximum physical memory size of a single process at the present\n" );
          fprintf( File_Record, "# Phy_Sum  : total   physical memory size of all processes    at the present\n" );
          fprintf( File_Record, "# Phy_Peak : maximum physical memory size of a single process during the entire simulation\n" );
+         fprintf( File_Record, "# PTab_Max : maximum memory size of the patch pointer tables of a single process at the present\n" );
+         fprintf( File_Record, "# NPatch_X : maximum number of patches (real+buffer) on level X of a single process during the\n" );
+         fprintf( File_Record, "#            entire simulation\n" );
          fprintf( File_Record, "#------------------------------------------------------------------------------------------\n\n" );
-         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s\n",
+         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s%20s",
                   "Time", "Step", " ",
                   "Vir_Max (MB)", "Vir_Sum (MB)", "Vir_Peak (MB)",
-                  "Phy_Max (MB)", "Phy_Sum (MB)", "Phy_Peak (MB)" );
+                  "Phy_Max (MB)", "Phy_Sum (MB)", "Phy_Peak (MB)", "PTab_Max (MB)" );
+         for (int lv=0; lv<=MAX_LEVEL; lv++)
+         {
+            char Label[MAX_STRING];
+            sprintf( Label, "NPatch_%d", lv );
+            fprintf( File_Record, "%14s", Label );
+         }
+         fprintf( File_Record, "\n" );
          fclose( File_Record );
       }
 
       FILE *File_Record = fopen( FileName_Record, "a" );
-      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f\n",
+      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f",
                Time[0], Step,
                Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0,
-               Vm_max[2]/1024.0, Vm_sum[2]/1024.0, Vm_max[3]/1024.0 );
+               Vm_max[2]/1024.0, Vm_sum[2]/1024.0, Vm_max[3]/1024.0, PTab_max );
+      for (int lv=0; lv<=MAX_LEVEL; lv++)
+      fprintf( File_Record, "%14d", NPatchMax_AllRank[lv] );
+      fprintf( File_Record, "\n" );
       fclose( File_Record );
 
    } // if ( MPI_Rank == 0 )
@@ -0,0 +1,197 @@
+#include "GAMER.h"
+
+#ifdef PERF_COUNTER
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <errno.h>
+
+
+// file descriptors of the hardware counters of all OpenMP threads
+// --> event PERF_CYCLE is the group leader of each thread
+static int    PerfCounter_NThread = 0;
+static int  (*PerfCounter_FD)[PERF_NEVENT] = NULL;
+static bool   PerfCounter_Enabled = false;
+
+static void PerfCounter_Close();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Init
+// Description :  Open the hardware performance counters of all OpenMP threads for the option "PERF_COUNTER"
+//
+// Note        :  1. Invoked by Aux_CreateTimer()
+//                2. Use the Linux perf_event_open() system call directly
+//                   --> Count user-space events only so that it works with perf_event_paranoid <= 2
+//                   --> All events of a thread are opened as a group so that they are scheduled together
+//                3. Counters of all threads are opened by the master thread using the thread IDs collected
+//                   from an OpenMP parallel region
+//                   --> Assume that the OpenMP runtime reuses the same thread pool afterwards
+//                4. Counters are disabled with a warning message if any event is not supported
+//                   (e.g., inside virtual machines or when perf_event_paranoid > 2)
+//                   --> All counts will be zero in this case
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Init()
+{
+
+#  ifdef OPENMP
+   PerfCounter_NThread = OMP_NTHREAD;
+#  else
+   PerfCounter_NThread = 1;
+#  endif
+
+   PerfCounter_FD = new int [PerfCounter_NThread][PERF_NEVENT];
+
+   for (int t=0; t<PerfCounter_NThread; t++)
+   for (int e=0; e<PERF_NEVENT; e++)   PerfCounter_FD[t][e] = -1;
+
+
+// 1. collect the thread IDs
+   pid_t *TID = new pid_t [PerfCounter_NThread];
+
+#  ifdef OPENMP
+#  pragma omp parallel num_threads( PerfCounter_NThread )
+   TID[ omp_get_thread_num() ] = (pid_t)syscall( SYS_gettid );
+#  else
+   TID[0] = (pid_t)syscall( SYS_gettid );
+#  endif
+
+
+// 2. open the counters
+   const char  *EventName[PERF_NEVENT] = { "cycles", "instructions", "LLC-misses" };
+         ulong  EventConfig[PERF_NEVENT];
+
+   EventConfig[PERF_CYCLE   ] = PERF_COUNT_HW_CPU_CYCLES;
+   EventConfig[PERF_INSTR   ] = PERF_COUNT_HW_INSTRUCTIONS;
+   EventConfig[PERF_LLC_MISS] = PERF_COUNT_HW_CACHE_MISSES;
+
+   PerfCounter_Enabled = true;
+
+   for (int t=0; t<PerfCounter_NThread  &&  PerfCounter_Enabled; t++)
+   for (int e=0; e<PERF_NEVENT          &&  PerfCounter_Enabled; e++)
+   {
+      perf_event_attr Attr;
+      memset( &Attr, 0, sizeof(Attr) );
+
+      Attr.type           = PERF_TYPE_HARDWARE;
+      Attr.size           = sizeof(Attr);
+      Attr.config         = EventConfig[e];
+      Attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      Attr.exclude_kernel = 1;
+      Attr.exclude_hv     = 1;
+
+      const int GroupFD = ( e == 0 ) ? -1 : PerfCounter_FD[t][0];
+
+      PerfCounter_FD[t][e] = (int)syscall( __NR_perf_event_open, &Attr, TID[t], -1, GroupFD, 0 );
+
+      if ( PerfCounter_FD[t][e] < 0 )
+      {
+         Aux_Message( stderr, "WARNING : perf_event_open() fails for the event \"%s\" on rank %d (%s) !!\n",
+                      EventName[e], MPI_Rank, strerror(errno) );
+         Aux_Message( stderr, "          --> All hardware performance counters are disabled on this rank\n" );
+
+         PerfCounter_Close();
+         PerfCounter_Enabled = false;
+      }
+   }
+
+   delete [] TID;
+
+} // FUNCTION : Aux_PerfCounter_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_End
+// Description :  Close the hardware performance counters opened by Aux_PerfCounter_Init()
+//
+// Note        :  Invoked by Aux_DeleteTimer()
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_End()
+{
+
+   PerfCounter_Close();
+
+   delete [] PerfCounter_FD;
+   PerfCounter_FD      = NULL;
+   PerfCounter_NThread = 0;
+   PerfCounter_Enabled = false;
+
+} // FUNCTION : Aux_PerfCounter_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_GetNThread
+// Description :  Return the number of threads monitored by the hardware performance counters
+//-------------------------------------------------------------------------------------------------------
+int Aux_PerfCounter_GetNThread()
+{
+
+   return PerfCounter_NThread;
+
+} // FUNCTION : Aux_PerfCounter_GetNThread
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Read
+// Description :  Take a snapshot of the hardware performance counters of all threads
+//
+// Note        :  1. Invoked by PerfCounter_t::Start() and PerfCounter_t::Stop()
+//                2. Counts are scaled by time_enabled/time_running in case the kernel multiplexes the events
+//                3. Return zeros if the counters are disabled
+//
+// Parameter   :  Count : Array to store the counts of each thread and event
+//
+// Return      :  Count[][]
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Read( long (*Count)[PERF_NEVENT] )
+{
+
+// read format of PERF_FORMAT_GROUP: { nr, time_enabled, time_running, value[nr] }
+   ulong Buf[ 3 + PERF_NEVENT ];
+
+   for (int t=0; t<PerfCounter_NThread; t++)
+   {
+      for (int e=0; e<PERF_NEVENT; e++)   Count[t][e] = 0;
+
+      if ( !PerfCounter_Enabled )   continue;
+
+      if (  read( PerfCounter_FD[t][0], Buf, sizeof(Buf) ) != (ssize_t)sizeof(Buf)  ||  Buf[0] != PERF_NEVENT  )
+         continue;
+
+      const double Scale = ( Buf[2] > 0 ) ? (double)Buf[1]/(double)Buf[2] : 0.0;
+
+      for (int e=0; e<PERF_NEVENT; e++)   Count[t][e] = (long)( Scale*Buf[3+e] );
+   }
+
+} // FUNCTION : Aux_PerfCounter_Read
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PerfCounter_Close
+// Description :  Close all opened file descriptors of the hardware performance counters
+//-------------------------------------------------------------------------------------------------------
+void PerfCounter_Close()
+{
+
+   if ( PerfCounter_FD == NULL )    return;
+
+// close the group members before the group leaders
+   for (int t=0; t<PerfCounter_NThread; t++)
+   for (int e=PERF_NEVENT-1; e>=0; e--)
+   {
+      if ( PerfCounter_FD[t][e] >= 0 )    close( PerfCounter_FD[t][e] );
+
+      PerfCounter_FD[t][e] = -1;
+   }
+
+} // FUNCTION : PerfCounter_Close
+
+
+
+#endif // #ifdef PERF_COUNTER
@@ -0,0 +1,124 @@
+#include "GAMER.h"
+
+static void WriteClump( FILE *File, const int Type, const int NClump, const Clump_t *Clump );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_Clump
+// Description :  Record the clumps above a threshold and, optionally, the friends-of-friends particle groups
+//
+// Note        :  1. Invoked by main()
+//                2. Enabled by the runtime option "OPT__RECORD_CLUMP"
+//                3. This function will be called both during the program initialization and after each global step
+//                4. Cell clumps are found by Aux_FindClump() on the field "CLUMP_FIELD" with the threshold
+//                   "CLUMP_THRESHOLD" and the minimum size "CLUMP_MIN_NCELL"
+//                5. Particle groups are found by Aux_FindParticleGroup() when CLUMP_FOF_LINKLEN > 0.0
+//                   --> CLUMP_FOF_LINKLEN is in units of the mean inter-particle separation of the massive particles
+//                6. Output filename is fixed to "Record__Clump"
+//                   --> Type = 0/1 for cell clumps/particle groups
+//                   --> Clumps of each type are sorted by descending mass
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_Clump()
+{
+
+   const char FileName[] = "Record__Clump";
+   static bool FirstTime = true;
+
+
+// 1. cell clumps
+   Clump_t *Clump  = NULL;
+   int      NClump = 0;
+
+   Aux_FindClump( &Clump, &NClump, GetFieldBIdx(CLUMP_FIELD, CHECK_ON), CLUMP_THRESHOLD, CLUMP_MIN_NCELL );
+
+
+// 2. particle groups
+   Clump_t *Group  = NULL;
+   int      NGroup = 0;
+
+#  ifdef MASSIVE_PARTICLES
+   if ( CLUMP_FOF_LINKLEN > 0.0 )
+   {
+//    get the mean inter-particle separation of the massive particles
+      long NMassive_ThisRank = 0, NMassive_AllRank;
+
+      for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)
+         if ( amr->Par->Mass[p] > (real_par)0.0  &&  amr->Par->Type[p] != PTYPE_TRACER )   NMassive_ThisRank ++;
+
+      MPI_Allreduce( &NMassive_ThisRank, &NMassive_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+      if ( NMassive_AllRank > 0 )
+      {
+         const double BoxVolume = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2];
+         const double LinkLen   = CLUMP_FOF_LINKLEN*cbrt( BoxVolume/(double)NMassive_AllRank );
+
+         Aux_FindParticleGroup( &Group, &NGroup, LinkLen, CLUMP_FOF_MIN_NPAR );
+      }
+   }
+#  endif
+
+
+// 3. output the clumps to file
+   if ( MPI_Rank == 0 )
+   {
+//    output the header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+         else
+         {
+            FILE *File = fopen( FileName, "w" );
+            fprintf( File, "#%19s  %10s  %4s  %8s  %14s  %14s  %14s  %14s  %14s  %14s  %14s  %14s  %14s  %14s  %14s  %14s\n",
+                           "Time", "Step", "Type", "ID", "NMember", "Mass", "Peak", "Peak_x", "Peak_y", "Peak_z",
+                           "CoM_x", "CoM_y", "CoM_z", "Vel_x", "Vel_y", "Vel_z" );
+            fclose( File );
+         }
+
+         FirstTime = false;
+      } // if ( FirstTime )
+
+      FILE *File = fopen( FileName, "a" );
+      WriteClump( File, 0, NClump, Clump );
+      WriteClump( File, 1, NGroup, Group );
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+
+   delete [] Clump;
+   delete [] Group;
+
+} // FUNCTION : Aux_Record_Clump
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteClump
+// Description :  Append one line per clump to the file "Record__Clump"
+//
+// Note        :  1. Invoked by Aux_Record_Clump()
+//
+// Parameter   :  File   : File pointer opened in the append mode
+//                Type   : 0/1 for cell clumps/particle groups
+//                NClump : Number of clumps
+//                Clump  : Array of clumps
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void WriteClump( FILE *File, const int Type, const int NClump, const Clump_t *Clump )
+{
+
+   for (int c=0; c<NClump; c++)
+      fprintf( File, "%20.14e  %10ld  %4d  %8d  %14ld  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e  %14.7e\n",
+               Time[0], Step, Type, c, Clump[c].NMember, Clump[c].Mass, Clump[c].Peak,
+               Clump[c].PeakCoord[0], Clump[c].PeakCoord[1], Clump[c].PeakCoord[2],
+               Clump[c].CoM[0], Clump[c].CoM[1], Clump[c].CoM[2],
+               Clump[c].Vel[0], Clump[c].Vel[1], Clump[c].Vel[2] );
+
+} // FUNCTION : WriteClump
@@ -351,6 +351,12 @@ void Aux_TakeNote()
       fprintf( Note, "TIMING_SOLVER                   OFF\n" );
 #     endif
 
+#     ifdef PERF_COUNTER
+      fprintf( Note, "PERF_COUNTER                    ON\n" );
+#     else
+      fprintf( Note, "PERF_COUNTER                    OFF\n" );
+#     endif
+
 #     ifdef FLOAT8
       fprintf( Note, "FLOAT8                          ON\n" );
 #     else
@@ -665,6 +671,10 @@ void Aux_TakeNote()
       fprintf( Note, "SOR_MOD_REDUCTION              % d\n",      SOR_MOD_REDUCTION );
 #     endif // #if ( defined GRAVITY  &&  POT_SCHEME == SOR  &&  defined GPU )
 
+#     if ( defined GRAVITY  &&  POT_SCHEME == SOR  &&  !defined GPU )
+      fprintf( Note, "SOR_CPU_NLANE                  % d\n",      SOR_CPU_NLANE );
+#     endif
+
 #     ifdef GPU
 #     ifdef DT_FLU_USE_SHUFFLE
       fprintf( Note, "DT_FLU_USE_SHUFFLE              ON\n" );
@@ -918,6 +928,7 @@ void Aux_TakeNote()
       fprintf( Note, "Par->ParICFormat               % d\n",      amr->Par->ParICFormat         );
       fprintf( Note, "PAR_IC_FLOAT8                  % d\n",      PAR_IC_FLOAT8                 );
       fprintf( Note, "PAR_IC_INT8                    % d\n",      PAR_IC_INT8                   );
+      fprintf( Note, "PAR_IC_LOAD_NRANK              % d\n",      PAR_IC_LOAD_NRANK             );
       fprintf( Note, "Par->ParICMass                 % 14.7e\n",  amr->Par->ParICMass           );
       fprintf( Note, "Par->ParICType                 % d\n",      amr->Par->ParICType           );
       fprintf( Note, "Par->Interp                    % d\n",      amr->Par->Interp              );
@@ -984,6 +995,9 @@ void Aux_TakeNote()
       fprintf( Note, "DT__SYNC_CHILDREN_LV           % 14.7e\n",  DT__SYNC_CHILDREN_LV        );
       fprintf( Note, "OPT__DT_USER                   % d\n",      OPT__DT_USER                );
       fprintf( Note, "OPT__DT_LEVEL                  % d\n",      OPT__DT_LEVEL               );
+#     if ( MODEL == HYDRO )
+      fprintf( Note, "OPT__DT_FUSED                  % d\n",      OPT__DT_FUSED               );
+#     endif
       fprintf( Note, "AUTO_REDUCE_DT                 % d\n",      AUTO_REDUCE_DT              );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR          % 14.7e\n",  AUTO_REDUCE_DT_FACTOR       );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR_MIN      % 14.7e\n",  AUTO_REDUCE_DT_FACTOR_MIN   );
@@ -1098,6 +1112,8 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE       % d\n",      OPT__RECORD_LOAD_BALANCE  );
       fprintf( Note, "OPT__LB_EXCHANGE_FATHER        % d\n",      OPT__LB_EXCHANGE_FATHER   );
+      fprintf( Note, "OPT__NODE_AWARE_MPI            % d\n",      OPT__NODE_AWARE_MPI       );
+      fprintf( Note, "OPT__PERSISTENT_MPI            % d\n",      OPT__PERSISTENT_MPI       );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER      % d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -1196,6 +1212,10 @@ void Aux_TakeNote()
       fprintf( Note, "MOLECULAR_WEIGHT               % 14.7e\n",  MOLECULAR_WEIGHT        );
       fprintf( Note, "MU_NORM                        % 14.7e\n",  MU_NORM                 );
       fprintf( Note, "ISO_TEMP                       % 14.7e\n",  ISO_TEMP                );
+#     if ( EOS == EOS_NUCLEAR )
+      fprintf( Note, "NUC_TABLE                       %s\n",      NUC_TABLE               );
+      fprintf( Note, "NUC_BENCHMARK                  % ld\n",     NUC_BENCHMARK           );
+#     endif
       fprintf( Note, "MINMOD_COEFF                   % 14.7e\n",  MINMOD_COEFF            );
       fprintf( Note, "MINMOD_MAX_ITER                % d\n",      MINMOD_MAX_ITER         );
       fprintf( Note, "OPT__LR_LIMITER                 %s\n",      ( OPT__LR_LIMITER == LR_LIMITER_VANLEER    ) ? "VANLEER"    :
@@ -1387,6 +1407,9 @@ void Aux_TakeNote()
       fprintf( Note, "MG_NPOST_SMOOTH                % d\n",      MG_NPOST_SMOOTH         );
       fprintf( Note, "MG_TOLERATED_ERROR             % 14.7e\n",  MG_TOLERATED_ERROR      );
 #     endif
+      fprintf( Note, "OPT__LEVEL_MG                  % d\n",      OPT__LEVEL_MG           );
+      fprintf( Note, "LEVEL_MG_MAX_ITER              % d\n",      LEVEL_MG_MAX_ITER       );
+      fprintf( Note, "LEVEL_MG_TOLERATED_ERROR       % 14.7e\n",  LEVEL_MG_TOLERATED_ERROR);
       fprintf( Note, "POT_GPU_NPGROUP                % d\n",      POT_GPU_NPGROUP         );
       fprintf( Note, "OPT__GRA_P5_GRADIENT           % d\n",      OPT__GRA_P5_GRADIENT    );
       fprintf( Note, "OPT__SELF_GRAVITY              % d\n",      OPT__SELF_GRAVITY       );
@@ -1589,6 +1612,11 @@ void Aux_TakeNote()
 #     endif
 #     endif
       fprintf( Note, "OPT__OUTPUT_BASEPS             % d\n",      OPT__OUTPUT_BASEPS          );
+      fprintf( Note, "OUTPUT_BASEPS_STEP             % d\n",      OUTPUT_BASEPS_STEP          );
+      if ( OPT__OUTPUT_BASEPS  ||  OUTPUT_BASEPS_STEP > 0 ) {
+      fprintf( Note, "   OUTPUT_BASEPS_FIELD          %s\n",      OUTPUT_BASEPS_FIELD         );
+      fprintf( Note, "   OUTPUT_BASEPS_CROSS         % d\n",      OUTPUT_BASEPS_CROSS         );
+      fprintf( Note, "   OUTPUT_BASEPS_LEVEL         % d\n",      OUTPUT_BASEPS_LEVEL         ); }
       fprintf( Note, "OPT__OUTPUT_BASE               % d\n",      OPT__OUTPUT_BASE            );
 #     ifdef GRAVITY
       fprintf( Note, "OPT__OUTPUT_POT                % d\n",      OPT__OUTPUT_POT             );
@@ -1632,6 +1660,22 @@ void Aux_TakeNote()
 
       fprintf( Note, "OPT__OUTPUT_MODE               % d\n",      OPT__OUTPUT_MODE            );
       fprintf( Note, "OPT__OUTPUT_RESTART            % d\n",      OPT__OUTPUT_RESTART         );
+      fprintf( Note, "OPT__OUTPUT_NODE_LOCAL         % d\n",      OPT__OUTPUT_NODE_LOCAL      );
+      if ( OPT__OUTPUT_NODE_LOCAL ) {
+      fprintf( Note, "   NODE_LOCAL_DIR               %s\n",      NODE_LOCAL_DIR              );
+      fprintf( Note, "   OPT__NODE_LOCAL_DRAIN       % d\n",      OPT__NODE_LOCAL_DRAIN       );
+      fprintf( Note, "   NODE_LOCAL_STEP             % d\n",      NODE_LOCAL_STEP             ); }
+      fprintf( Note, "OPT__OUTPUT_DEFLATE            % d\n",      OPT__OUTPUT_DEFLATE         );
+      fprintf( Note, "OUTPUT_LOSSY_REL_ERR           % 21.14e\n", OUTPUT_LOSSY_REL_ERR        );
+      fprintf( Note, "OPT__OUTPUT_IMAGE              % d\n",      OPT__OUTPUT_IMAGE           );
+      if ( OPT__OUTPUT_IMAGE ) {
+      fprintf( Note, "   OUTPUT_IMAGE_STEP           % d\n",      OUTPUT_IMAGE_STEP           );
+      fprintf( Note, "   OUTPUT_IMAGE_NPIX           % d\n",      OUTPUT_IMAGE_NPIX           );
+      fprintf( Note, "   OUTPUT_IMAGE_AXIS           % d\n",      OUTPUT_IMAGE_AXIS           );
+      fprintf( Note, "   OUTPUT_IMAGE_FIELD           %s\n",      OUTPUT_IMAGE_FIELD          );
+      fprintf( Note, "   OUTPUT_IMAGE_SLICE_X        % 21.14e\n", OUTPUT_IMAGE_SLICE_X        );
+      fprintf( Note, "   OUTPUT_IMAGE_SLICE_Y        % 21.14e\n", OUTPUT_IMAGE_SLICE_Y        );
+      fprintf( Note, "   OUTPUT_IMAGE_SLICE_Z        % 21.14e\n", OUTPUT_IMAGE_SLICE_Z        ); }
       fprintf( Note, "OUTPUT_STEP                    % d\n",      OUTPUT_STEP                 );
       fprintf( Note, "OUTPUT_DT                      % 21.14e\n", OUTPUT_DT                   );
       fprintf( Note, "OUTPUT_WALLTIME                % 21.14e\n", OUTPUT_WALLTIME             );
@@ -1670,6 +1714,13 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__RECORD_UNPHY              % d\n",      OPT__RECORD_UNPHY        );
       fprintf( Note, "OPT__RECORD_MEMORY             % d\n",      OPT__RECORD_MEMORY       );
       fprintf( Note, "OPT__RECORD_PERFORMANCE        % d\n",      OPT__RECORD_PERFORMANCE  );
+      fprintf( Note, "OPT__RECORD_TRACE              % d\n",      OPT__RECORD_TRACE        );
+      if ( OPT__RECORD_TRACE )
+      {
+      fprintf( Note, "   TRACE_STEP_START            % ld\n",     TRACE_STEP_START         );
+      fprintf( Note, "   TRACE_STEP_END              % ld\n",     TRACE_STEP_END           );
+      fprintf( Note, "   TRACE_MAX_EVENT             % d\n",      TRACE_MAX_EVENT          );
+      }
       fprintf( Note, "OPT__RECORD_CENTER             % d\n",      OPT__RECORD_CENTER       );
       if ( OPT__RECORD_CENTER )
       {
@@ -1680,6 +1731,17 @@ void Aux_TakeNote()
       fprintf( Note, "   COM_MIN_RHO                 % 14.7e\n",  COM_MIN_RHO              );
       fprintf( Note, "   COM_TOLERR_R                % 14.7e\n",  COM_TOLERR_R             );
       fprintf( Note, "   COM_MAX_ITER                % d\n",      COM_MAX_ITER             );
+      }
+      fprintf( Note, "OPT__RECORD_CLUMP              % d\n",      OPT__RECORD_CLUMP        );
+      if ( OPT__RECORD_CLUMP )
+      {
+      fprintf( Note, "   CLUMP_FIELD                 %s\n",       CLUMP_FIELD              );
+      fprintf( Note, "   CLUMP_THRESHOLD             % 14.7e\n",  CLUMP_THRESHOLD          );
+      fprintf( Note, "   CLUMP_MIN_NCELL             % d\n",      CLUMP_MIN_NCELL          );
+#     ifdef MASSIVE_PARTICLES
+      fprintf( Note, "   CLUMP_FOF_LINKLEN           % 14.7e\n",  CLUMP_FOF_LINKLEN        );
+      fprintf( Note, "   CLUMP_FOF_MIN_NPAR          % d\n",      CLUMP_FOF_MIN_NPAR       );
+#     endif
       }
       fprintf( Note, "OPT__MANUAL_CONTROL            % d\n",      OPT__MANUAL_CONTROL      );
       fprintf( Note, "OPT__RECORD_USER               % d\n",      OPT__RECORD_USER         );
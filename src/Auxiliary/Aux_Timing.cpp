@@ -6,6 +6,9 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 #ifdef TIMING_SOLVER
 void Timing__Solver( const char FileName[] );
 #endif
+#ifdef PERF_COUNTER
+void Timing__PerfCounter( const char FileName[] );
+#endif
 
 
 // global timing variables
@@ -71,6 +74,10 @@ static double libyt_Acc   [3] = { 0.0, 0.0, 0.0 };
 void Aux_CreateTimer()
 {
 
+#  ifdef PERF_COUNTER
+   Aux_PerfCounter_Init();
+#  endif
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "Aux_CreateTimer ... " );
 
 
@@ -111,6 +118,17 @@ void Aux_CreateTimer()
       Timer_Poi_PrePot_C[lv] = new Timer_t;
       Timer_Poi_PrePot_F[lv] = new Timer_t;
 #     endif
+
+//    attach the hardware performance counters to the solver timers
+#     ifdef PERF_COUNTER
+      for (int v=0; v<NSOLVER; v++)
+      {
+         Timer_Pre[lv][v]->Perf = new PerfCounter_t;
+         Timer_Sol[lv][v]->Perf = new PerfCounter_t;
+         Timer_Clo[lv][v]->Perf = new PerfCounter_t;
+      }
+      Timer_Poi_PreRho  [lv]->Perf = new PerfCounter_t;
+#     endif
    } // for (int lv=0; lv<NLEVEL; lv++)
 
 
@@ -152,6 +170,16 @@ void Aux_DeleteTimer()
       delete Timer_Par_Collect[lv];
       for (int t=0; t<6; t++)    delete Timer_Par_MPI   [lv][t];
 
+#     ifdef PERF_COUNTER
+      for (int v=0; v<NSOLVER; v++)
+      {
+         delete Timer_Pre      [lv][v]->Perf;
+         delete Timer_Sol      [lv][v]->Perf;
+         delete Timer_Clo      [lv][v]->Perf;
+      }
+      delete Timer_Poi_PreRho  [lv]->Perf;
+#     endif
+
 #     ifdef TIMING_SOLVER
       for (int v=0; v<NSOLVER; v++)
       {
@@ -166,6 +194,10 @@ void Aux_DeleteTimer()
 #     endif
    }
 
+#  ifdef PERF_COUNTER
+   Aux_PerfCounter_End();
+#  endif
+
 } // FUNCTION : Aux_DeleteTimer
 
 
@@ -211,6 +243,16 @@ void Aux_ResetTimer()
       Timer_Poi_PrePot_C[lv]->Reset();
       Timer_Poi_PrePot_F[lv]->Reset();
 #     endif
+
+#     ifdef PERF_COUNTER
+      for (int v=0; v<NSOLVER; v++)
+      {
+         Timer_Pre      [lv][v]->Perf->Reset();
+         Timer_Sol      [lv][v]->Perf->Reset();
+         Timer_Clo      [lv][v]->Perf->Reset();
+      }
+      Timer_Poi_PreRho  [lv]->Perf->Reset();
+#     endif
    }
 
 } // FUNCTION : Aux_ResetTimer
@@ -370,6 +412,12 @@ void Aux_Record_Timing()
 #  endif
 
 
+// 4. hardware performance counters of GPU/CPU solvers
+#  ifdef PERF_COUNTER
+   Timing__PerfCounter( FileName );
+#  endif
+
+
    if ( MPI_Rank == 0 )
    {
       FILE *File = fopen( FileName, "a" );
@@ -973,6 +1021,146 @@ void Timing__Solver( const char FileName[] )
 
 
 
+#ifdef PERF_COUNTER
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__PerfCounter
+// Description :  Record the hardware performance counters of GPU/CPU solvers for the option "PERF_COUNTER"
+//
+// Note        :  1. Counts are summed over all threads and ranks
+//                   --> "Time" records the MAXIMUM value of all ranks as in Timing__Solver()
+//                2. "MemGB" is estimated as the number of LLC misses times the cache line size
+//                   and "GB/s" is MemGB divided by Time
+//                3. "Imbal" is the maximum number of cycles of all threads in all ranks divided by the
+//                   average value
+//                4. Only phases with non-zero cycles are recorded
+//                5. PreRho is a subset of Poi_Pre and PoiGra_Pre, and it includes the particle mass
+//                   assignment (i.e., Par_MassAssignment())
+//                6. Only the CPU side is monitored
+//                   --> Sol of GPU solvers mostly records the time waiting for GPUs
+//-------------------------------------------------------------------------------------------------------
+void Timing__PerfCounter( const char FileName[] )
+{
+
+   const int   NPhase              = 3*NSOLVER + 1;
+   const int   PreRho              = 3*NSOLVER;
+   const char *SolverName[NSOLVER] = { "Flu", "Poi", "Gra", "PoiGra", "Che", "dtFlu", "dtGra" };
+   const char *StepName  [3]       = { "Pre", "Sol", "Clo" };
+
+   long LineSize = sysconf( _SC_LEVEL1_DCACHE_LINESIZE );
+   if ( LineSize <= 0 )    LineSize = 64;
+
+   char    (*PhaseName)[MAX_STRING] = new char [NPhase][MAX_STRING];
+   Timer_t **Timer                  = new Timer_t* [NPhase];
+
+
+// 1. sum over all threads in this rank
+   const int NThread_loc = Aux_PerfCounter_GetNThread();
+   int       NThread_sum;
+
+   double  *Time_loc                = new double [NLEVEL*NPhase];
+   double  *Time_max                = new double [NLEVEL*NPhase];
+   double  *CycleMax_loc            = new double [NLEVEL*NPhase];   // maximum cycles of all threads
+   double  *CycleMax_all            = new double [NLEVEL*NPhase];
+   double (*Count_loc)[PERF_NEVENT] = new double [NLEVEL*NPhase][PERF_NEVENT];
+   double (*Count_sum)[PERF_NEVENT] = new double [NLEVEL*NPhase][PERF_NEVENT];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      for (int v=0; v<NSOLVER; v++)
+      {
+         Timer[ 3*v + 0 ] = Timer_Pre[lv][v];
+         Timer[ 3*v + 1 ] = Timer_Sol[lv][v];
+         Timer[ 3*v + 2 ] = Timer_Clo[lv][v];
+      }
+      Timer[PreRho] = Timer_Poi_PreRho[lv];
+
+      for (int p=0; p<NPhase; p++)
+      {
+         const int            ID   = lv*NPhase + p;
+         const PerfCounter_t *Perf = Timer[p]->Perf;
+
+         Time_loc    [ID] = Timer[p]->GetValue();
+         CycleMax_loc[ID] = 0.0;
+
+         for (int e=0; e<PERF_NEVENT; e++)   Count_loc[ID][e] = 0.0;
+
+         for (int t=0; t<Perf->NThread; t++)
+         {
+            for (int e=0; e<PERF_NEVENT; e++)   Count_loc[ID][e] += (double)Perf->Count[t][e];
+
+            CycleMax_loc[ID] = MAX( CycleMax_loc[ID], (double)Perf->Count[t][PERF_CYCLE] );
+         }
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 2. sum/max over all ranks
+   MPI_Reduce( &NThread_loc,  &NThread_sum,  1,                         MPI_INT,    MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Time_loc,      Time_max,      NLEVEL*NPhase,             MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Count_loc[0],  Count_sum[0],  NLEVEL*NPhase*PERF_NEVENT, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( CycleMax_loc,  CycleMax_all,  NLEVEL*NPhase,             MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+// 3. record the results
+   if ( MPI_Rank == 0 )
+   {
+      for (int v=0; v<NSOLVER; v++)
+      for (int s=0; s<3; s++)
+         sprintf( PhaseName[ 3*v + s ], "%s_%s", SolverName[v], StepName[s] );
+      sprintf( PhaseName[PreRho], "%s", "PreRho" );
+
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "\nHardware performance counters of GPU/CPU solvers (summed over %d threads in all ranks)\n",
+               NThread_sum );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%3s%12s%10s%12s%12s%7s%12s%10s%10s%7s\n",
+               "Lv", "Phase", "Time", "Cycles", "Instr", "IPC", "LLC_Miss", "MemGB", "GB/s", "Imbal" );
+
+      int NRow = 0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int p=0; p<NPhase; p++)
+      {
+         const int     ID    = lv*NPhase + p;
+         const double *Count = Count_sum[ID];
+
+         if ( Count[PERF_CYCLE] <= 0.0 )  continue;
+
+         NRow ++;
+
+         const double MemGB = Count[PERF_LLC_MISS]*LineSize*1.0e-9;
+
+         fprintf( File, "%3d%12s%10.4f%12.4e%12.4e%7.3f%12.4e%10.4f%10.4f%7.3f\n",
+                  lv, PhaseName[p], Time_max[ID], Count[PERF_CYCLE], Count[PERF_INSTR],
+                  Count[PERF_INSTR]/Count[PERF_CYCLE], Count[PERF_LLC_MISS], MemGB,
+                  ( Time_max[ID] > 0.0 ) ? MemGB/Time_max[ID] : 0.0,
+                  CycleMax_all[ID]*NThread_sum/Count[PERF_CYCLE] );
+      }
+
+      if ( NRow == 0 )  fprintf( File, "%3s   no data (counters are not supported or no solver has been invoked)\n", "N/A" );
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+
+   delete [] PhaseName;
+   delete [] Timer;
+   delete [] Time_loc;
+   delete [] Time_max;
+   delete [] Count_loc;
+   delete [] Count_sum;
+   delete [] CycleMax_loc;
+   delete [] CycleMax_all;
+
+} // FUNCTION : Timing__PerfCounter
+#endif // PERF_COUNTER
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Aux_AccumulatedTiming
 // Description :  Record the accumulated timing results (in second)
@@ -0,0 +1,372 @@
+#include "GAMER.h"
+#include <ctype.h>
+
+#ifdef TIMING
+
+
+
+
+// maximum nesting depth of the traced regions on each thread
+#define TRACE_MAX_DEPTH    64
+
+
+// a completed traced region
+struct TraceEvent_t
+{
+   const char *Name;       // region name (must be a string literal or have static storage)
+   int         Level;      // AMR level (<0 if not applicable)
+   double      Begin;      // begin time relative to Trace_T0 (in microseconds)
+   double      Duration;   // duration (in microseconds)
+};
+
+// per-thread ring buffer
+// --> each thread only touches its own buffer so that no lock is required
+struct TraceBuffer_t
+{
+   TraceEvent_t *Event;                      // ring buffer with TRACE_MAX_EVENT elements
+   long          NEvent;                     // total number of completed events (including the overwritten ones)
+   int           Depth;                      // current nesting depth
+   int           NOverDepth;                 // number of regions deeper than TRACE_MAX_DEPTH
+   TraceEvent_t  Open[TRACE_MAX_DEPTH];      // regions that have begun but not yet ended
+   char          Padding[64];                // avoid false sharing between threads
+};
+
+static int            Trace_NThread = 0;
+static TraceBuffer_t *Trace_Buffer  = NULL;
+static double         Trace_T0      = 0.0;
+static bool           Trace_Dumped  = false;
+
+static double Trace_GetTime();
+static int    Trace_GetThreadID();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_CreateTrace
+// Description :  Allocate the per-thread ring buffers of the event tracer for OPT__RECORD_TRACE
+//
+// Note        :  1. Invoked by Init_GAMER()
+//                2. The reference time Trace_T0 is taken right after an MPI barrier on each rank
+//                   --> Rank timelines are aligned to within the barrier exit skew
+//-------------------------------------------------------------------------------------------------------
+void Aux_CreateTrace()
+{
+
+   if ( !OPT__RECORD_TRACE )  return;
+
+#  ifdef OPENMP
+   Trace_NThread = OMP_NTHREAD;
+#  else
+   Trace_NThread = 1;
+#  endif
+
+   Trace_Buffer = new TraceBuffer_t [Trace_NThread];
+
+   for (int t=0; t<Trace_NThread; t++)
+   {
+      Trace_Buffer[t].Event      = new TraceEvent_t [TRACE_MAX_EVENT];
+      Trace_Buffer[t].NEvent     = 0;
+      Trace_Buffer[t].Depth      = 0;
+      Trace_Buffer[t].NOverDepth = 0;
+   }
+
+   Trace_Active = false;
+   Trace_Dumped = false;
+
+   MPI_Barrier( MPI_COMM_WORLD );
+   Trace_T0 = Trace_GetTime();
+
+} // FUNCTION : Aux_CreateTrace
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_DeleteTrace
+// Description :  Dump the remaining events and free the ring buffers allocated by Aux_CreateTrace()
+//
+// Note        :  1. Invoked by End_GAMER()
+//                2. Events are dumped here if the run ends before TRACE_STEP_END
+//-------------------------------------------------------------------------------------------------------
+void Aux_DeleteTrace()
+{
+
+   if ( Trace_Buffer == NULL )   return;
+
+   if ( !Trace_Dumped )    Aux_Record_Trace();
+
+   for (int t=0; t<Trace_NThread; t++)    delete [] Trace_Buffer[t].Event;
+
+   delete [] Trace_Buffer;
+   Trace_Buffer  = NULL;
+   Trace_NThread = 0;
+   Trace_Active  = false;
+
+} // FUNCTION : Aux_DeleteTrace
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_SetStep
+// Description :  Switch the event tracer on/off according to TRACE_STEP_START/END
+//
+// Note        :  1. Invoked by main() at the beginning of each step, outside of all traced regions
+//                2. A step is traced if TRACE_STEP_START <= NextStep <= TRACE_STEP_END
+//
+// Parameter   :  NextStep : Step index after the upcoming update (i.e., Step+1)
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_SetStep( const long NextStep )
+{
+
+   Trace_Active = ( Trace_Buffer != NULL  &&  !Trace_Dumped  &&
+                    NextStep >= TRACE_STEP_START  &&  NextStep <= TRACE_STEP_END );
+
+} // FUNCTION : Aux_Trace_SetStep
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Begin
+// Description :  Mark the beginning of a traced region on the calling thread
+//
+// Note        :  1. Use the macro TRACE_BEGIN() instead, which checks Trace_Active first
+//                2. Can be called inside OpenMP parallel regions
+//                3. Must be paired with Aux_Trace_End() on the same thread
+//
+// Parameter   :  Name  : Region name
+//                         --> Only the pointer is stored, so it must be a string literal
+//                         --> For a stringified call, only the function name is kept in the output
+//                Level : AMR level (<0 if not applicable)
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Begin( const char *Name, const int Level )
+{
+
+   const int TID = Trace_GetThreadID();
+
+   if ( TID >= Trace_NThread )   return;
+
+   TraceBuffer_t *Buf = Trace_Buffer + TID;
+
+   if ( Buf->Depth < TRACE_MAX_DEPTH )
+   {
+      TraceEvent_t *Event = Buf->Open + Buf->Depth;
+
+      Event->Name  = Name;
+      Event->Level = Level;
+      Event->Begin = Trace_GetTime() - Trace_T0;
+   }
+
+   else
+      Buf->NOverDepth ++;
+
+   Buf->Depth ++;
+
+} // FUNCTION : Aux_Trace_Begin
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_End
+// Description :  Mark the end of the innermost traced region on the calling thread
+//
+// Note        :  1. Use the macro TRACE_END() instead, which checks Trace_Active first
+//                2. The completed region is stored in the ring buffer, overwriting the oldest event
+//                   when the buffer is full
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_End()
+{
+
+   const int TID = Trace_GetThreadID();
+
+   if ( TID >= Trace_NThread )   return;
+
+   TraceBuffer_t *Buf = Trace_Buffer + TID;
+
+   if ( Buf->Depth <= 0 )  return;
+
+   Buf->Depth --;
+
+   if ( Buf->Depth >= TRACE_MAX_DEPTH )   return;
+
+   TraceEvent_t *Event = Buf->Event + ( Buf->NEvent % TRACE_MAX_EVENT );
+
+   *Event          = Buf->Open[ Buf->Depth ];
+   Event->Duration = Trace_GetTime() - Trace_T0 - Event->Begin;
+
+   Buf->NEvent ++;
+
+} // FUNCTION : Aux_Trace_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_Trace
+// Description :  Dump the traced events of all threads and ranks to "Record__Trace.json"
+//
+// Note        :  1. Invoked by main() after step TRACE_STEP_END and by Aux_DeleteTrace()
+//                2. Output follows the Chrome trace event format and can be loaded by
+//                   chrome://tracing or https://ui.perfetto.dev
+//                   --> pid = MPI rank, tid = OpenMP thread
+//                   --> Each traced region is a complete event ("ph":"X") with timestamps in microseconds
+//                3. Ranks write the file one after another
+//                4. Events are only dumped once per run
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_Trace()
+{
+
+   if ( Trace_Buffer == NULL  ||  Trace_Dumped )   return;
+
+   const char FileName[] = "Record__Trace.json";
+
+   Trace_Active = false;
+   Trace_Dumped = true;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
+
+
+// count the events
+   long NEvent_loc = 0, NEvent_all, NLost_loc = 0, NLost_all;
+
+   for (int t=0; t<Trace_NThread; t++)
+   {
+      NEvent_loc += MIN( Trace_Buffer[t].NEvent, (long)TRACE_MAX_EVENT );
+      NLost_loc  += MAX( Trace_Buffer[t].NEvent - (long)TRACE_MAX_EVENT, 0L ) + Trace_Buffer[t].NOverDepth;
+   }
+
+   MPI_Reduce( &NEvent_loc, &NEvent_all, 1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( &NLost_loc,  &NLost_all,  1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// write the events rank by rank
+   for (int TargetRank=0; TargetRank<MPI_NRank; TargetRank++)
+   {
+      if ( MPI_Rank == TargetRank )
+      {
+         if ( MPI_Rank == 0  &&  Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+         FILE *File = fopen( FileName, ( MPI_Rank == 0 ) ? "w" : "a" );
+
+         if ( MPI_Rank == 0 )
+            fprintf( File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+         else
+            fprintf( File, ",\n" );
+
+//       metadata
+         fprintf( File, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Rank %d\"}}",
+                  MPI_Rank, MPI_Rank );
+
+         for (int t=0; t<Trace_NThread; t++)
+            fprintf( File, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}",
+                     MPI_Rank, t, t );
+
+//       events in chronological order of completion
+         for (int t=0; t<Trace_NThread; t++)
+         {
+            const TraceBuffer_t *Buf    = Trace_Buffer + t;
+            const long           NStore = MIN( Buf->NEvent, (long)TRACE_MAX_EVENT );
+
+            for (long n=Buf->NEvent-NStore; n<Buf->NEvent; n++)
+            {
+               const TraceEvent_t *Event = Buf->Event + ( n % TRACE_MAX_EVENT );
+
+//             keep the function name only for the regions named after the stringified calls in TIMING_FUNC()
+//             (e.g., "FluStatus = Flu_AdvanceDt( lv, ... )" --> "Flu_AdvanceDt") and escape the characters not
+//             allowed in JSON strings
+               const char *NameBeg = Event->Name;
+               const char *NameEnd = strchr( Event->Name, '(' );
+
+               if ( NameEnd == NULL )  NameEnd = Event->Name + strlen( Event->Name );
+               else
+               {
+                  while ( NameEnd > Event->Name  &&  NameEnd[-1] == ' ' )   NameEnd --;
+
+                  NameBeg = NameEnd;
+                  while (  NameBeg > Event->Name  &&  ( isalnum(NameBeg[-1]) || NameBeg[-1] == '_' || NameBeg[-1] == ':' )  )
+                     NameBeg --;
+               }
+
+               char Name[MAX_STRING];
+               int  Len = 0;
+
+               for (const char *c=NameBeg; c<NameEnd && Len<MAX_STRING-2; c++)
+               {
+                  if ( *c == '\n' )                   continue;
+                  if ( *c == '"'  ||  *c == '\\' )    Name[ Len++ ] = '\\';
+                  Name[ Len++ ] = *c;
+               }
+
+               Name[Len] = '\0';
+
+               fprintf( File, ",\n{\"name\":\"%s\",\"cat\":\"gamer\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d",
+                        Name, Event->Begin, Event->Duration, MPI_Rank, t );
+
+               if ( Event->Level >= 0 )   fprintf( File, ",\"args\":{\"lv\":%d}}", Event->Level );
+               else                       fprintf( File, "}" );
+            }
+         }
+
+         if ( MPI_Rank == MPI_NRank-1 )   fprintf( File, "\n]}\n" );
+
+         fclose( File );
+      } // if ( MPI_Rank == TargetRank )
+
+      MPI_Barrier( MPI_COMM_WORLD );
+   } // for (int TargetRank=0; TargetRank<MPI_NRank; TargetRank++)
+
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "   Number of recorded events = %ld\n", NEvent_all );
+
+      if ( NLost_all > 0 )
+         Aux_Message( stderr, "WARNING : %ld events are lost in the trace --> consider increasing TRACE_MAX_EVENT !!\n",
+                      NLost_all );
+
+      Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+   }
+
+} // FUNCTION : Aux_Record_Trace
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Trace_GetTime
+// Description :  Return the current wall-clock time in microseconds
+//-------------------------------------------------------------------------------------------------------
+double Trace_GetTime()
+{
+
+   timeval tv;
+   gettimeofday( &tv, NULL );
+
+   return tv.tv_sec*1.0e6 + tv.tv_usec;
+
+} // FUNCTION : Trace_GetTime
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Trace_GetThreadID
+// Description :  Return the index of the ring buffer owned by the calling thread
+//
+// Note        :  1. Use the thread number in the outermost parallel region since some parallel functions
+//                   (e.g., Prepare_PatchData() called by Flag_Real()) are invoked inside another parallel
+//                   region, where the inner serialized regions always return omp_get_thread_num() == 0
+//                   --> Nested parallelism is disabled by Init_OpenMP(), so this number identifies
+//                       a unique thread
+//-------------------------------------------------------------------------------------------------------
+int Trace_GetThreadID()
+{
+
+#  ifdef OPENMP
+   return ( omp_get_level() > 0 ) ? omp_get_ancestor_thread_num( 1 ) : 0;
+#  else
+   return 0;
+#  endif
+
+} // FUNCTION : Trace_GetThreadID
+
+
+
+#endif // #ifdef TIMING
@@ -0,0 +1,87 @@
+#include "GAMER.h"
+
+#ifndef SERIAL
+
+static void Bench_Alltoallv_Run( const int NRep );
+
+static char *Bench_SendBuf     = NULL;
+static char *Bench_RecvBuf     = NULL;
+static long *Bench_Send_NCount = NULL;
+static long *Bench_Send_NDisp  = NULL;
+static long *Bench_Recv_NCount = NULL;
+static long *Bench_Recv_NDisp  = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Alltoallv
+// Description :  Measure the bandwidth of MPI_Alltoallv_GAMER()
+//
+// Note        :  1. Each rank sends the same number of bytes to all ranks (including itself)
+//                   --> Message sizes of 1 KiB, 64 KiB, and 1 MiB per rank pair mimic the typical sizes of
+//                       buffer-patch and particle exchanges
+//                2. Use OPT__NODE_AWARE_MPI if it is enabled, same as the regular data exchange
+//                3. No thread scaling since the data exchange is performed by the master thread only
+//                4. Work unit = number of bytes sent
+//-------------------------------------------------------------------------------------------------------
+void Bench_Alltoallv()
+{
+
+   const int   NSize          = 3;
+   const long  MsgSize[NSize] = { 1L<<10, 1L<<16, 1L<<20 };
+   const char *Variant[NSize] = { "1KiB", "64KiB", "1MiB" };
+
+   Bench_Send_NCount = new long [MPI_NRank];
+   Bench_Send_NDisp  = new long [MPI_NRank];
+   Bench_Recv_NCount = new long [MPI_NRank];
+   Bench_Recv_NDisp  = new long [MPI_NRank];
+
+   for (int s=0; s<NSize; s++)
+   {
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         Bench_Send_NCount[r] = MsgSize[s];
+         Bench_Recv_NCount[r] = MsgSize[s];
+         Bench_Send_NDisp [r] = r*MsgSize[s];
+         Bench_Recv_NDisp [r] = r*MsgSize[s];
+      }
+
+      Bench_SendBuf = new char [ MPI_NRank*MsgSize[s] ];
+      Bench_RecvBuf = new char [ MPI_NRank*MsgSize[s] ];
+
+      memset( Bench_SendBuf, MPI_Rank, MPI_NRank*MsgSize[s] );
+
+      Bench_Measure( "Alltoallv", Variant[s], "byte", (double)MPI_NRank*MsgSize[s], Bench_Alltoallv_Run, false );
+
+      delete [] Bench_SendBuf;   Bench_SendBuf = NULL;
+      delete [] Bench_RecvBuf;   Bench_RecvBuf = NULL;
+   }
+
+   delete [] Bench_Send_NCount;
+   delete [] Bench_Send_NDisp;
+   delete [] Bench_Recv_NCount;
+   delete [] Bench_Recv_NDisp;
+
+} // FUNCTION : Bench_Alltoallv
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Alltoallv_Run
+// Description :  Invoke MPI_Alltoallv_GAMER() NRep times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_Alltoallv_Run( const int NRep )
+{
+
+   for (int r=0; r<NRep; r++)
+      MPI_Alltoallv_GAMER( Bench_SendBuf, Bench_Send_NCount, Bench_Send_NDisp, MPI_CHAR,
+                           Bench_RecvBuf, Bench_Recv_NCount, Bench_Recv_NDisp, MPI_CHAR, MPI_COMM_WORLD );
+
+} // FUNCTION : Bench_Alltoallv_Run
+
+
+
+#endif // #ifndef SERIAL
@@ -0,0 +1,118 @@
+#include "GAMER.h"
+
+static void Bench_Interpolate_Run( const int NRep );
+
+// number of independent interpolation blocks per repetition
+#define BENCH_INT_NBLOCK   256
+
+static IntScheme_t Bench_IntScheme;
+static int         Bench_CSize;
+static real       *Bench_CData = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Interpolate
+// Description :  Measure the throughput of all spatial interpolation schemes
+//
+// Note        :  1. Each repetition interpolates BENCH_INT_NBLOCK blocks of PS1^3 coarse cells with NCOMP_TOTAL
+//                   components, which is equivalent to the interpolation of a refined patch group
+//                   --> Blocks are distributed to OpenMP threads in the same way as Prepare_PatchData()
+//                2. Input data are synthetic smooth fields with a few sign changes
+//                3. Work unit = number of fine cells interpolated (for all NCOMP_TOTAL components)
+//-------------------------------------------------------------------------------------------------------
+void Bench_Interpolate()
+{
+
+   const int         NScheme          = 8;
+   const IntScheme_t Scheme [NScheme] = { INT_MINMOD3D, INT_MINMOD1D, INT_VANLEER, INT_CQUAD,
+                                          INT_QUAD, INT_CQUAR, INT_QUAR, INT_SPECTRAL };
+   const char       *Variant[NScheme] = { "MINMOD3D", "MINMOD1D", "VANLEER", "CQUAD",
+                                          "QUAD", "CQUAR", "QUAR", "SPECTRAL" };
+
+   for (int s=0; s<NScheme; s++)
+   {
+#     ifndef SUPPORT_SPECTRAL_INT
+      if ( Scheme[s] == INT_SPECTRAL )    continue;
+#     endif
+
+      int NSide, NGhost;
+      Int_Table( Scheme[s], NSide, NGhost );
+
+      Bench_IntScheme = Scheme[s];
+      Bench_CSize     = PS1 + 2*NGhost;
+      Bench_CData     = new real [ NCOMP_TOTAL*CUBE(Bench_CSize) ];
+
+//    synthetic smooth input data
+      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int k=0; k<Bench_CSize; k++)
+      for (int j=0; j<Bench_CSize; j++)
+      for (int i=0; i<Bench_CSize; i++)
+      {
+         const double x = 2.0*M_PI*i/Bench_CSize;
+         const double y = 2.0*M_PI*j/Bench_CSize;
+         const double z = 2.0*M_PI*k/Bench_CSize;
+
+         Bench_CData[ IDX321( i, j, k, Bench_CSize, Bench_CSize ) + v*CUBE(Bench_CSize) ]
+            = (real)(  ( v+1 )*( 2.0 + sin(x)*cos(y) + 0.5*sin(z+v) )  );
+      }
+
+      Bench_Measure( "Interpolate", Variant[s], "cell", (double)BENCH_INT_NBLOCK*CUBE(PS2),
+                     Bench_Interpolate_Run, true );
+
+      delete [] Bench_CData;
+      Bench_CData = NULL;
+   } // for (int s=0; s<NScheme; s++)
+
+} // FUNCTION : Bench_Interpolate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Interpolate_Run
+// Description :  Invoke Interpolate() NRep*BENCH_INT_NBLOCK times
+//
+// Note        :  CData[] is copied to a per-thread buffer before each call since Interpolate() may overwrite it
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_Interpolate_Run( const int NRep )
+{
+
+   const int  CSize [3]  = { Bench_CSize, Bench_CSize, Bench_CSize };
+   const int  CStart[3]  = { (Bench_CSize-PS1)/2, (Bench_CSize-PS1)/2, (Bench_CSize-PS1)/2 };
+   const int  CRange[3]  = { PS1, PS1, PS1 };
+   const int  FSize [3]  = { PS2, PS2, PS2 };
+   const int  FStart[3]  = { 0, 0, 0 };
+   const int  CSize3D    = NCOMP_TOTAL*CUBE(Bench_CSize);
+   const bool UnwrapPhase_No     = false;
+   const bool OppSign0thOrder_No = false;
+   const bool AllCons_No         = false;
+
+   bool Monotonic[NCOMP_TOTAL];
+   for (int v=0; v<NCOMP_TOTAL; v++)   Monotonic[v] = true;
+
+#  pragma omp parallel
+   {
+      real *CData = new real [ CSize3D ];
+      real *FData = new real [ NCOMP_TOTAL*CUBE(PS2) ];
+
+      for (int r=0; r<NRep; r++)
+      {
+#        pragma omp for schedule( runtime )
+         for (int b=0; b<BENCH_INT_NBLOCK; b++)
+         {
+            memcpy( CData, Bench_CData, CSize3D*sizeof(real) );
+
+            Interpolate( CData, CSize, CStart, CRange, FData, FSize, FStart, NCOMP_TOTAL, Bench_IntScheme,
+                         UnwrapPhase_No, Monotonic, OppSign0thOrder_No, AllCons_No, INT_PRIM_NO, INT_FIX_MONO_COEFF,
+                         NULL, NULL );
+         }
+      }
+
+      delete [] CData;
+      delete [] FData;
+   } // OpenMP parallel region
+
+} // FUNCTION : Bench_Interpolate_Run
@@ -0,0 +1,256 @@
+#include "GAMER.h"
+
+
+// target elapsed time and minimum number of repetitions of each measurement
+#define BENCH_TARGET_TIME  0.5
+#define BENCH_MIN_NREP     3
+
+static const char  Bench_FileName[] = "Record__Bench";
+static int         Bench_NKernel    = 0;
+static char      **Bench_Kernel     = NULL;
+
+static void Bench_Init();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Main function of the micro-benchmark suite "gamer_bench"
+//
+// Note        :  1. Built by "make gamer_bench", which links all object files of GAMER except the main()
+//                   of Main.cpp
+//                2. Simulation is initialized by Init_GAMER() as usual, so gamer_bench must be launched in
+//                   a directory with all the input files of a test problem
+//                   --> The initialized grid provides the patch data of the fluid solver and Prepare_PatchData()
+//                       while the other kernels use synthetic data
+//                3. Command-line arguments select the kernels to be measured (e.g., "./gamer_bench Interpolate")
+//                   --> Measure all kernels if no argument is given
+//                4. Results are recorded in "Record__Bench"
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+
+   Init_GAMER( &argc, &argv );
+
+
+// gamer_bench never evolves the simulation or dumps data
+// --> disable the time-step constraint of the next dump and the time-step log in Mis_GetTimeStep()
+   DumpTime       = HUGE_NUMBER;
+   OPT__RECORD_DT = false;
+
+
+// record the kernels selected from the command line
+   Bench_NKernel = argc - 1;
+   Bench_Kernel  = argv + 1;
+
+   Bench_Init();
+
+
+// measure all kernels
+   if ( Bench_Selected("FluidSolver") )         Bench_FluidSolver();
+   if ( Bench_Selected("PreparePatchData") )    Bench_PreparePatchData();
+   if ( Bench_Selected("Interpolate") )         Bench_Interpolate();
+#  ifdef GRAVITY
+   if ( Bench_Selected("PoissonSolver") )       Bench_PoissonSolver();
+   if ( Bench_Selected("LevelMG") )             Bench_LevelMG();
+#  endif
+#  ifdef MASSIVE_PARTICLES
+   if ( Bench_Selected("MassAssignment") )      Bench_MassAssignment();
+#  endif
+#  ifndef SERIAL
+   if ( Bench_Selected("Alltoallv") )           Bench_Alltoallv();
+#  endif
+
+
+#  ifdef OPENMP
+   omp_set_num_threads( OMP_NTHREAD );
+#  endif
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "Results are recorded in \"%s\"\n", Bench_FileName );
+
+   End_GAMER();
+
+   return 0;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Selected
+// Description :  Check whether the target kernel is selected from the command line
+//
+// Parameter   :  Kernel : Kernel name
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Selected( const char *Kernel )
+{
+
+   if ( Bench_NKernel == 0 )  return true;
+
+   for (int k=0; k<Bench_NKernel; k++)
+      if (  strcmp( Bench_Kernel[k], Kernel ) == 0  )    return true;
+
+   return false;
+
+} // FUNCTION : Bench_Selected
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Init
+// Description :  Write the header of "Record__Bench"
+//
+// Note        :  1. Each data row records one kernel variant with a given number of OpenMP threads
+//                   --> Columns are separated by spaces and names contain no space so that the file can be
+//                       parsed by, e.g., numpy.genfromtxt( "Record__Bench", dtype=None, encoding=None )
+//                2. Lines starting with '#' are comments
+//-------------------------------------------------------------------------------------------------------
+void Bench_Init()
+{
+
+   if ( MPI_Rank != 0 )    return;
+
+   if ( Aux_CheckFileExist(Bench_FileName) )
+      Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", Bench_FileName );
+
+   FILE *File = fopen( Bench_FileName, "w" );
+
+   fprintf( File, "# GAMER micro-benchmark suite\n" );
+#  ifdef GIT_BRANCH
+   fprintf( File, "# Git branch     : %s\n", EXPAND_AND_QUOTE(GIT_BRANCH) );
+#  endif
+#  ifdef GIT_COMMIT
+   fprintf( File, "# Git commit     : %s\n", EXPAND_AND_QUOTE(GIT_COMMIT) );
+#  endif
+   fprintf( File, "# Model          : %d\n", MODEL );
+   fprintf( File, "# PATCH_SIZE     : %d\n", PATCH_SIZE );
+#  ifdef FLOAT8
+   fprintf( File, "# Precision      : double\n" );
+#  else
+   fprintf( File, "# Precision      : single\n" );
+#  endif
+   fprintf( File, "# MPI ranks      : %d\n", MPI_NRank );
+   fprintf( File, "# OpenMP threads : %d\n", OMP_NTHREAD );
+   fprintf( File, "# Target time    : %.2f s\n", BENCH_TARGET_TIME );
+   fprintf( File, "#\n" );
+   fprintf( File, "# Time         : maximum elapsed time among all ranks (s)\n" );
+   fprintf( File, "# Work         : total amount of work among all ranks per repetition (in Unit)\n" );
+   fprintf( File, "# Throughput   : Work*NRep/Time (Unit/s)\n" );
+   fprintf( File, "# PerCore      : Throughput/(NRank*NThread) (Unit/s)\n" );
+   fprintf( File, "# Efficiency   : PerCore/PerCore(smallest NThread) of the same kernel and variant\n" );
+   fprintf( File, "#\n" );
+   fprintf( File, "#%-19s %-24s %7s %7s %13s %13s %-6s %13s %13s %10s\n",
+            "Kernel", "Variant", "NThread", "NRep", "Time", "Work", "Unit", "Throughput", "PerCore", "Efficiency" );
+
+   fclose( File );
+
+} // FUNCTION : Bench_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Measure
+// Description :  Measure the throughput of a kernel with different numbers of OpenMP threads and record the
+//                results in "Record__Bench"
+//
+// Note        :  1. Invoked by the individual benchmark functions Bench_*() after preparing the input data
+//                2. The number of repetitions is calibrated after a warm-up run so that each measurement takes
+//                   about BENCH_TARGET_TIME seconds
+//                   --> It is synchronized among all ranks since some kernels are collective
+//                3. Number of threads = 1, 2, 4, ..., OMP_NTHREAD
+//                   --> The kernel must set the number of threads by omp_set_num_threads()
+//                       (i.e., it must not use the clause "num_threads")
+//
+// Parameter   :  Kernel        : Kernel name
+//                Variant       : Kernel variant (e.g., interpolation scheme)
+//                Unit          : Unit of Work
+//                Work          : Amount of work per repetition on this rank
+//                Func          : Function to run the kernel NRep times
+//                ThreadScaling : Measure with different numbers of threads
+//                                --> Otherwise only measure with OMP_NTHREAD threads
+//-------------------------------------------------------------------------------------------------------
+void Bench_Measure( const char *Kernel, const char *Variant, const char *Unit, const double Work,
+                    void (*Func)( const int NRep ), const bool ThreadScaling )
+{
+
+   double Work_AllRank;
+
+   MPI_Allreduce( &Work, &Work_AllRank, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   double PerCore_Ref = -1.0;
+
+   for (int NThread=( ThreadScaling ? 1 : OMP_NTHREAD ); NThread>0; )
+   {
+#     ifdef OPENMP
+      omp_set_num_threads( NThread );
+#     endif
+
+//    1. warm up and then determine the number of repetitions by doubling it until the elapsed time
+//       exceeds 10% of BENCH_TARGET_TIME
+      Timer_t Timer;
+      double  Time, Time_Max;
+      int     NRep;
+
+      Func( 1 );
+
+      for (NRep=1; true; NRep*=2)
+      {
+         Timer.Reset();
+
+         MPI_Barrier( MPI_COMM_WORLD );
+         Timer.Start();
+         Func( NRep );
+         Timer.Stop();
+
+         Time = Timer.GetValue();
+         MPI_Allreduce( &Time, &Time_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+
+         if ( Time_Max >= 0.1*BENCH_TARGET_TIME )   break;
+      }
+
+      NRep = (int)ceil( NRep*BENCH_TARGET_TIME/Time_Max );
+      NRep = MAX( NRep, BENCH_MIN_NREP );
+
+
+//    2. measure
+      Timer.Reset();
+
+      MPI_Barrier( MPI_COMM_WORLD );
+      Timer.Start();
+      Func( NRep );
+      Timer.Stop();
+
+      Time = Timer.GetValue();
+      MPI_Reduce( &Time, &Time_Max, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+//    3. record
+      if ( MPI_Rank == 0 )
+      {
+         const double Throughput = ( Time_Max > 0.0 ) ? Work_AllRank*NRep/Time_Max : 0.0;
+         const double PerCore    = Throughput/( MPI_NRank*NThread );
+
+         if ( PerCore_Ref < 0.0 )  PerCore_Ref = PerCore;
+
+         const double Efficiency = ( PerCore_Ref > 0.0 ) ? PerCore/PerCore_Ref : 0.0;
+
+         FILE *File = fopen( Bench_FileName, "a" );
+         fprintf( File, " %-19s %-24s %7d %7d %13.6e %13.6e %-6s %13.6e %13.6e %10.4f\n",
+                  Kernel, Variant, NThread, NRep, Time_Max, Work_AllRank, Unit, Throughput, PerCore, Efficiency );
+         fclose( File );
+
+         Aux_Message( stdout, "   %-19s %-24s NThread %3d : %13.6e %s/s/core (efficiency %6.4f)\n",
+                      Kernel, Variant, NThread, PerCore, Unit, Efficiency );
+      }
+
+
+//    4. next number of threads
+      if      ( NThread == OMP_NTHREAD )   NThread = 0;
+      else if ( 2*NThread < OMP_NTHREAD )  NThread *= 2;
+      else                                 NThread = OMP_NTHREAD;
+   } // for (int NThread=( ThreadScaling ? 1 : OMP_NTHREAD ); NThread>0; )
+
+} // FUNCTION : Bench_Measure
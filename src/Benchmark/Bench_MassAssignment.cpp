@@ -0,0 +1,127 @@
+#include "GAMER.h"
+
+#ifdef MASSIVE_PARTICLES
+
+static void Bench_MassAssignment_Run( const int NRep );
+
+// number of independent blocks and particles per block
+#define BENCH_PAR_NBLOCK   64
+#define BENCH_PAR_NPAR     4096
+
+// ghost zones of the density array on each side, which must be large enough for all schemes
+#define BENCH_PAR_GHOST    2
+
+static ParInterp_t Bench_ParIntScheme;
+static real_par   *Bench_MassPos[BENCH_PAR_NBLOCK][PAR_NATT_FLT_TOTAL];
+static long_par   *Bench_Type   [BENCH_PAR_NBLOCK][PAR_NATT_INT_TOTAL];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_MassAssignment
+// Description :  Measure the throughput of the particle mass assignment for all interpolation schemes
+//
+// Note        :  1. Each repetition deposits BENCH_PAR_NBLOCK blocks of BENCH_PAR_NPAR particles randomly
+//                   distributed in a patch group
+//                   --> Blocks are distributed to OpenMP threads in the same way as the particle density
+//                       preparation in Prepare_PatchData()
+//                2. Use UseInputMassPos to bypass the global particle repository
+//                3. Work unit = number of particles deposited
+//-------------------------------------------------------------------------------------------------------
+void Bench_MassAssignment()
+{
+
+   const int         NScheme          = 3;
+   const ParInterp_t Scheme [NScheme] = { PAR_INTERP_NGP, PAR_INTERP_CIC, PAR_INTERP_TSC };
+   const char       *Variant[NScheme] = { "NGP", "CIC", "TSC" };
+
+
+// allocate and initialize particles with a fixed random seed
+   srand( 1234 + MPI_Rank );
+
+   for (int b=0; b<BENCH_PAR_NBLOCK; b++)
+   {
+      for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)  Bench_MassPos[b][v] = NULL;
+      for (int v=0; v<PAR_NATT_INT_TOTAL; v++)  Bench_Type   [b][v] = NULL;
+
+      Bench_MassPos[b][PAR_MASS] = new real_par [BENCH_PAR_NPAR];
+      Bench_MassPos[b][PAR_POSX] = new real_par [BENCH_PAR_NPAR];
+      Bench_MassPos[b][PAR_POSY] = new real_par [BENCH_PAR_NPAR];
+      Bench_MassPos[b][PAR_POSZ] = new real_par [BENCH_PAR_NPAR];
+      Bench_Type   [b][PAR_TYPE] = new long_par [BENCH_PAR_NPAR];
+
+      for (int p=0; p<BENCH_PAR_NPAR; p++)
+      {
+         Bench_MassPos[b][PAR_MASS][p] = (real_par)1.0;
+         Bench_MassPos[b][PAR_POSX][p] = ( (real_par)rand()/RAND_MAX )*PS2;
+         Bench_MassPos[b][PAR_POSY][p] = ( (real_par)rand()/RAND_MAX )*PS2;
+         Bench_MassPos[b][PAR_POSZ][p] = ( (real_par)rand()/RAND_MAX )*PS2;
+         Bench_Type   [b][PAR_TYPE][p] = PTYPE_GENERIC_MASSIVE;
+      }
+   }
+
+
+   for (int s=0; s<NScheme; s++)
+   {
+      Bench_ParIntScheme = Scheme[s];
+
+      Bench_Measure( "MassAssignment", Variant[s], "par", (double)BENCH_PAR_NBLOCK*BENCH_PAR_NPAR,
+                     Bench_MassAssignment_Run, true );
+   }
+
+
+   for (int b=0; b<BENCH_PAR_NBLOCK; b++)
+   {
+      delete [] Bench_MassPos[b][PAR_MASS];
+      delete [] Bench_MassPos[b][PAR_POSX];
+      delete [] Bench_MassPos[b][PAR_POSY];
+      delete [] Bench_MassPos[b][PAR_POSZ];
+      delete [] Bench_Type   [b][PAR_TYPE];
+   }
+
+} // FUNCTION : Bench_MassAssignment
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_MassAssignment_Run
+// Description :  Invoke Par_MassAssignment() NRep*BENCH_PAR_NBLOCK times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_MassAssignment_Run( const int NRep )
+{
+
+   const int    RhoSize         = PS2 + 2*BENCH_PAR_GHOST;
+   const double EdgeL[3]        = { -BENCH_PAR_GHOST, -BENCH_PAR_GHOST, -BENCH_PAR_GHOST };
+   const double dh              = 1.0;
+   const bool   Periodic[3]     = { false, false, false };
+   const int    PeriodicSize[3] = { NULL_INT, NULL_INT, NULL_INT };
+   const bool   PredictPos_No   = false;
+   const bool   InitZero_Yes    = true;
+   const bool   UnitDens_No     = false;
+   const bool   CheckFarAway_No = false;
+   const bool   UseInputMassPos = true;
+
+#  pragma omp parallel
+   {
+      real *Rho = new real [ CUBE(RhoSize) ];
+
+      for (int r=0; r<NRep; r++)
+      {
+#        pragma omp for schedule( runtime )
+         for (int b=0; b<BENCH_PAR_NBLOCK; b++)
+            Par_MassAssignment( NULL, BENCH_PAR_NPAR, Bench_ParIntScheme, Rho, RhoSize, EdgeL, dh,
+                                PredictPos_No, NULL_REAL, InitZero_Yes, Periodic, PeriodicSize,
+                                UnitDens_No, CheckFarAway_No, UseInputMassPos, Bench_MassPos[b], Bench_Type[b] );
+      }
+
+      delete [] Rho;
+   } // OpenMP parallel region
+
+} // FUNCTION : Bench_MassAssignment_Run
+
+
+
+#endif // #ifdef MASSIVE_PARTICLES
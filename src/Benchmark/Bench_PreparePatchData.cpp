@@ -0,0 +1,96 @@
+#include "GAMER.h"
+
+static void Bench_PreparePatchData_Run( const int NRep );
+
+static int   Bench_lv;
+static int   Bench_NPG;
+static int  *Bench_PID0_List = NULL;
+static real *Bench_CC        = NULL;
+static real *Bench_FC        = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_PreparePatchData
+// Description :  Measure the throughput of Prepare_PatchData()
+//
+// Note        :  1. Prepare all fluid variables (and B field for MHD) with FLU_GHOST_SIZE ghost zones for
+//                   the first FLU_GPU_NPGROUP patch groups, which is identical to the preparation of the
+//                   fluid solver
+//                2. Measure both level 0 and the finest level with patches
+//                   --> The latter includes the spatial interpolation of coarse-grid ghost zones
+//                3. Work unit = number of cells prepared (including ghost zones)
+//-------------------------------------------------------------------------------------------------------
+void Bench_PreparePatchData()
+{
+
+// find the finest level with patches
+   int TopLv = 0;
+   for (int lv=1; lv<NLEVEL; lv++)
+      if ( NPatchTotal[lv] > 0 )    TopLv = lv;
+
+   const int TargetLv[2] = { 0, TopLv };
+   const int NTargetLv   = ( TopLv > 0 ) ? 2 : 1;
+
+   for (int t=0; t<NTargetLv; t++)
+   {
+      const int lv = TargetLv[t];
+
+      Bench_lv  = lv;
+      Bench_NPG = MIN( FLU_GPU_NPGROUP, amr->NPatchComma[lv][1]/8 );
+
+      Bench_PID0_List = new int  [Bench_NPG];
+      Bench_CC        = new real [ (long)Bench_NPG*NCOMP_TOTAL*CUBE(FLU_NXT) ];
+#     ifdef MHD
+      Bench_FC        = new real [ (long)Bench_NPG*NCOMP_MAG*FLU_NXT_P1*SQR(FLU_NXT) ];
+#     endif
+
+      for (int t=0; t<Bench_NPG; t++)  Bench_PID0_List[t] = 8*t;
+
+      char Variant[MAX_STRING];
+      sprintf( Variant, "Lv%d", lv );
+
+      Bench_Measure( "PreparePatchData", Variant, "cell", (double)Bench_NPG*CUBE(FLU_NXT), Bench_PreparePatchData_Run, true );
+
+      delete [] Bench_PID0_List;    Bench_PID0_List = NULL;
+      delete [] Bench_CC;           Bench_CC        = NULL;
+      delete [] Bench_FC;           Bench_FC        = NULL;
+   }
+
+} // FUNCTION : Bench_PreparePatchData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_PreparePatchData_Run
+// Description :  Invoke Prepare_PatchData() NRep times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_PreparePatchData_Run( const int NRep )
+{
+
+   if ( Bench_NPG == 0 )   return;
+
+   const bool IntPhase_No       = false;
+   const real MinDens_No        = -1.0;
+   const real MinPres_No        = -1.0;
+   const real MinTemp_No        = -1.0;
+   const real MinEntr_No        = -1.0;
+   const bool DE_Consistency_No = false;
+#  ifdef MHD
+   const long TVarFC            = _MAG;
+   const IntScheme_t IntScheme_FC = OPT__MAG_INT_SCHEME;
+#  else
+   const long TVarFC            = _NONE;
+   const IntScheme_t IntScheme_FC = INT_NONE;
+#  endif
+
+   for (int r=0; r<NRep; r++)
+      Prepare_PatchData( Bench_lv, Time[Bench_lv], Bench_CC, Bench_FC,
+                         FLU_GHOST_SIZE, Bench_NPG, Bench_PID0_List, _TOTAL, TVarFC,
+                         OPT__FLU_INT_SCHEME, IntScheme_FC, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                         OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+} // FUNCTION : Bench_PreparePatchData_Run
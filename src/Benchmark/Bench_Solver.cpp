@@ -0,0 +1,360 @@
+#include "GAMER.h"
+
+static void Bench_FluidSolver_Run( const int NRep );
+#ifdef GRAVITY
+static void Bench_PoissonSolver_Run( const int NRep );
+static void Bench_LevelMG_Run( const int NRep );
+static void Bench_PerPatchPoisson_Run( const int NRep );
+#endif
+
+static int    Bench_NPG;
+static double Bench_dt;
+static double Bench_Poi_Coeff;
+#ifdef GRAVITY
+static int    Bench_Lv;
+static int    Bench_MaxIter;
+static double *Bench_ErrHist;
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_FluidSolver
+// Description :  Measure the throughput of the fluid solver
+//
+// Note        :  1. Input data are prepared from the first FLU_GPU_NPGROUP patch groups on level 0 by the
+//                   regular preparation step of InvokeSolver()
+//                   --> Only the solver itself is measured; see Bench_PreparePatchData() for the preparation
+//                2. The solution is not updated, so all repetitions advance the same input data by the same dt
+//                3. Work unit = number of cells updated
+//-------------------------------------------------------------------------------------------------------
+void Bench_FluidSolver()
+{
+
+   const int lv = 0;
+
+   Bench_NPG = MIN( FLU_GPU_NPGROUP, amr->NPatchComma[lv][1]/8 );
+
+   int NPG_AllRank;
+   MPI_Allreduce( &Bench_NPG, &NPG_AllRank, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+
+   if ( NPG_AllRank == 0 )
+   {
+      if ( MPI_Rank == 0 )    Aux_Message( stderr, "WARNING : no patch on level %d --> skip the fluid solver !!\n", lv );
+      return;
+   }
+
+
+// prepare the input data once
+   const double dTime = Mis_GetTimeStep( lv, NULL_REAL, 1.0 );
+   Bench_dt = Mis_dTime2dt( Time[lv], dTime );
+
+   int *PID0_List = new int [Bench_NPG];
+   for (int t=0; t<Bench_NPG; t++)  PID0_List[t] = 8*t;
+
+   InvokeSolver_Prepare( FLUID_SOLVER, lv, Time[lv]+dTime, Time[lv], Bench_NPG, PID0_List );
+
+   delete [] PID0_List;
+
+
+// set the variant name
+#  if   ( MODEL == HYDRO )
+#  if   ( FLU_SCHEME == RTVD )
+   const char *Scheme = "RTVD";
+#  elif ( FLU_SCHEME == MHM )
+   const char *Scheme = "MHM";
+#  elif ( FLU_SCHEME == MHM_RP )
+   const char *Scheme = "MHM_RP";
+#  elif ( FLU_SCHEME == CTU )
+   const char *Scheme = "CTU";
+#  else
+   const char *Scheme = "UNKNOWN";
+#  endif
+
+#  if   ( LR_SCHEME == PLM )
+   const char *LR = "_PLM";
+#  elif ( LR_SCHEME == PPM )
+   const char *LR = "_PPM";
+#  else
+   const char *LR = "";
+#  endif
+
+#  if   ( RSOLVER == EXACT )
+   const char *RS = "_EXACT";
+#  elif ( RSOLVER == ROE )
+   const char *RS = "_ROE";
+#  elif ( RSOLVER == HLLE )
+   const char *RS = "_HLLE";
+#  elif ( RSOLVER == HLLC )
+   const char *RS = "_HLLC";
+#  elif ( RSOLVER == HLLD )
+   const char *RS = "_HLLD";
+#  else
+   const char *RS = "";
+#  endif
+
+#  elif ( MODEL == ELBDM )
+#  if   ( WAVE_SCHEME == WAVE_FD )
+   const char *Scheme = "WAVE_FD";
+#  elif ( WAVE_SCHEME == WAVE_GRAMFE )
+   const char *Scheme = "WAVE_GRAMFE";
+#  else
+   const char *Scheme = "UNKNOWN";
+#  endif
+   const char *LR     = "";
+   const char *RS     = "";
+
+#  else
+   const char *Scheme = "UNKNOWN";
+   const char *LR     = "";
+   const char *RS     = "";
+#  endif // MODEL
+
+   char Variant[MAX_STRING];
+   sprintf( Variant, "%s%s%s", Scheme, LR, RS );
+
+
+   Bench_Measure( "FluidSolver", Variant, "cell", (double)Bench_NPG*8*CUBE(PS1), Bench_FluidSolver_Run, true );
+
+} // FUNCTION : Bench_FluidSolver
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_FluidSolver_Run
+// Description :  Invoke the fluid solver NRep times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_FluidSolver_Run( const int NRep )
+{
+
+   for (int r=0; r<NRep; r++)
+      InvokeSolver_Solve( FLUID_SOLVER, 0, Time[0]+Bench_dt, Time[0], Bench_NPG, Bench_dt, NULL_REAL );
+
+} // FUNCTION : Bench_FluidSolver_Run
+
+
+
+#ifdef GRAVITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_PoissonSolver
+// Description :  Measure the throughput of the Poisson solver on refined patches
+//
+// Note        :  1. Use synthetic density and boundary potential for POT_GPU_NPGROUP patch groups so that
+//                   the measurement does not depend on the existence of refined patches
+//                   --> The Poisson solver on level 0 uses FFT instead
+//                2. Work unit = number of cells solved
+//-------------------------------------------------------------------------------------------------------
+void Bench_PoissonSolver()
+{
+
+   const int lv = 0;
+
+   Bench_NPG = POT_GPU_NPGROUP;
+
+#  ifdef COMOVING
+   Bench_Poi_Coeff = 4.0*M_PI*NEWTON_G*Time[lv];
+#  else
+   Bench_Poi_Coeff = 4.0*M_PI*NEWTON_G;
+#  endif
+
+
+// synthetic density with a smooth Gaussian profile and zero boundary potential
+   const real Rho0 = 1.0;
+   const real Sigma = 0.25*RHO_NXT;
+
+   for (int P=0; P<8*Bench_NPG; P++)
+   {
+      for (int k=0; k<RHO_NXT; k++)
+      for (int j=0; j<RHO_NXT; j++)
+      for (int i=0; i<RHO_NXT; i++)
+      {
+         const real r2 = SQR( i-0.5*RHO_NXT ) + SQR( j-0.5*RHO_NXT ) + SQR( k-0.5*RHO_NXT );
+         h_Rho_Array_P[0][P][k][j][i] = Rho0*EXP( -r2/SQR(Sigma) ) + (real)0.1*Rho0*(real)( P%8 );
+      }
+
+      for (int k=0; k<POT_NXT; k++)
+      for (int j=0; j<POT_NXT; j++)
+      for (int i=0; i<POT_NXT; i++)
+         h_Pot_Array_P_In[0][P][k][j][i] = (real)0.0;
+   }
+
+
+#  if   ( POT_SCHEME == SOR )
+   const char *Variant = "SOR";
+#  elif ( POT_SCHEME == MG )
+   const char *Variant = "MG";
+#  else
+   const char *Variant = "UNKNOWN";
+#  endif
+
+   Bench_Measure( "PoissonSolver", Variant, "cell", (double)Bench_NPG*8*CUBE(PS1), Bench_PoissonSolver_Run, true );
+
+} // FUNCTION : Bench_PoissonSolver
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_PoissonSolver_Run
+// Description :  Invoke the Poisson solver NRep times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_PoissonSolver_Run( const int NRep )
+{
+
+   for (int r=0; r<NRep; r++)
+      InvokeSolver_Solve( POISSON_SOLVER, 0, Time[0], Time[0], Bench_NPG, NULL_REAL, Bench_Poi_Coeff );
+
+} // FUNCTION : Bench_PoissonSolver_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_LevelMG
+// Description :  Compare the convergence and throughput of the level-wide multigrid solver (OPT__LEVEL_MG)
+//                with those of the per-patch Poisson solver
+//
+// Note        :  1. Use the finest refinement level with patches in the initial condition
+//                   --> Skip if there is no refined patch
+//                2. Both solvers are evaluated by the level-wide error estimator of CPU_PoissonSolver_LevelMG()
+//                   --> Level-wide multigrid: error of the interpolated coarse-grid potential and after each V-cycle
+//                   --> Per-patch SOR       : error after 1, 2, 4, ..., SOR_MAX_ITER iterations
+//                   --> Per-patch MG        : error of the solution converged by the per-patch criterion
+//                   --> Results are printed to stdout
+//                3. Overwrite the potential of the target level
+//                4. Work unit = number of cells solved
+//-------------------------------------------------------------------------------------------------------
+void Bench_LevelMG()
+{
+
+// find the finest level with patches
+   Bench_Lv = -1;
+   for (int lv=TOP_LEVEL; lv>0; lv--)
+   {
+      if ( NPatchTotal[lv] > 0 )
+      {
+         Bench_Lv = lv;
+         break;
+      }
+   }
+
+   if ( Bench_Lv < 0 )
+   {
+      if ( MPI_Rank == 0 )    Aux_Message( stderr, "WARNING : no refined patch --> skip the level-wide multigrid solver !!\n" );
+      return;
+   }
+
+   const int lv     = Bench_Lv;
+   const int SaveSg = amr->PotSg[lv];
+
+#  ifdef COMOVING
+   Bench_Poi_Coeff = 4.0*M_PI*NEWTON_G*Time[lv];
+#  else
+   Bench_Poi_Coeff = 4.0*M_PI*NEWTON_G;
+#  endif
+
+   Bench_MaxIter = LEVEL_MG_MAX_ITER;
+   Bench_ErrHist = new double [Bench_MaxIter+1];
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "Level-wide multigrid vs. per-patch solver on level %d (%ld patches):\n", lv, NPatchTotal[lv] );
+
+
+// 1. level-wide multigrid from the interpolated coarse-grid potential
+   const int NIter = CPU_PoissonSolver_LevelMG( lv, Bench_Poi_Coeff, SaveSg, Time[lv], Bench_MaxIter, false, Bench_ErrHist );
+
+   if ( MPI_Rank == 0 )
+      for (int t=0; t<=NIter; t++)
+         Aux_Message( stdout, "   LevelMG  V-cycle %4d : error = %13.7e\n", t, Bench_ErrHist[t] );
+
+
+// 2. per-patch solver evaluated by the same error estimator
+#  if   ( POT_SCHEME == SOR )
+   const int SOR_MinIter_Backup = SOR_MIN_ITER;
+   const int SOR_MaxIter_Backup = SOR_MAX_ITER;
+
+   for (int NSOR=1; ; NSOR=MIN( 2*NSOR, SOR_MaxIter_Backup ))
+   {
+      SOR_MIN_ITER = NSOR;
+      SOR_MAX_ITER = NSOR;
+
+      InvokeSolver( POISSON_SOLVER, lv, Time[lv], NULL_REAL, NULL_REAL, Bench_Poi_Coeff,
+                    NULL_INT, NULL_INT, SaveSg, false, false );
+      CPU_PoissonSolver_LevelMG( lv, Bench_Poi_Coeff, SaveSg, Time[lv], 0, true, Bench_ErrHist );
+
+      if ( MPI_Rank == 0 )
+         Aux_Message( stdout, "   SOR      iter    %4d : error = %13.7e\n", NSOR, Bench_ErrHist[0] );
+
+      if ( NSOR >= SOR_MaxIter_Backup )   break;
+   }
+
+   SOR_MIN_ITER = SOR_MinIter_Backup;
+   SOR_MAX_ITER = SOR_MaxIter_Backup;
+
+#  else
+   InvokeSolver( POISSON_SOLVER, lv, Time[lv], NULL_REAL, NULL_REAL, Bench_Poi_Coeff,
+                 NULL_INT, NULL_INT, SaveSg, false, false );
+   CPU_PoissonSolver_LevelMG( lv, Bench_Poi_Coeff, SaveSg, Time[lv], 0, true, Bench_ErrHist );
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "   PerPatch converged : error = %13.7e\n", Bench_ErrHist[0] );
+#  endif
+
+
+// 3. throughput
+#  if   ( POT_SCHEME == SOR )
+   const char *Variant = "PerPatch_SOR";
+#  elif ( POT_SCHEME == MG )
+   const char *Variant = "PerPatch_MG";
+#  else
+   const char *Variant = "PerPatch_UNKNOWN";
+#  endif
+
+   const double Work = (double)NPatchTotal[lv]*CUBE(PS1);
+
+   Bench_Measure( "LevelMG", "LevelMG", "cell", Work, Bench_LevelMG_Run,         true );
+   Bench_Measure( "LevelMG", Variant,   "cell", Work, Bench_PerPatchPoisson_Run, true );
+
+   delete [] Bench_ErrHist;
+
+} // FUNCTION : Bench_LevelMG
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_LevelMG_Run
+// Description :  Invoke the level-wide multigrid solver NRep times
+//
+// Note        :  1. Pass Bench_ErrHist to suppress the warning of unconverged solutions
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_LevelMG_Run( const int NRep )
+{
+
+   for (int r=0; r<NRep; r++)
+      CPU_PoissonSolver_LevelMG( Bench_Lv, Bench_Poi_Coeff, amr->PotSg[Bench_Lv], Time[Bench_Lv], Bench_MaxIter,
+                                 false, Bench_ErrHist );
+
+} // FUNCTION : Bench_LevelMG_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_PerPatchPoisson_Run
+// Description :  Invoke the per-patch Poisson solver on all patches of Bench_Lv NRep times
+//
+// Parameter   :  NRep : Number of repetitions
+//-------------------------------------------------------------------------------------------------------
+void Bench_PerPatchPoisson_Run( const int NRep )
+{
+
+   for (int r=0; r<NRep; r++)
+      InvokeSolver( POISSON_SOLVER, Bench_Lv, Time[Bench_Lv], NULL_REAL, NULL_REAL, Bench_Poi_Coeff,
+                    NULL_INT, NULL_INT, amr->PotSg[Bench_Lv], false, false );
+
+} // FUNCTION : Bench_PerPatchPoisson_Run
+#endif // #ifdef GRAVITY
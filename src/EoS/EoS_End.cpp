@@ -10,7 +10,7 @@
 #elif ( EOS == EOS_ISOTHERMAL )
 // nothing to do
 #elif ( EOS == EOS_NUCLEAR )
-# error : ERROR : EOS_NUCLEAR is NOT supported yet !!
+void EoS_End_Nuclear();
 #elif ( EOS == EOS_COSMIC_RAY )
 // nothing to do
 #endif // # EOS
@@ -44,7 +44,7 @@ void EoS_End()
 #  elif ( EOS == EOS_ISOTHERMAL )
 // nothing to do
 #  elif ( EOS == EOS_NUCLEAR )
-#  error : ERROR : EOS_NUCLEAR is NOT supported yet !!
+   EoS_End_Ptr = EoS_End_Nuclear;
 #  elif ( EOS == EOS_COSMIC_RAY )
 // nothing to do
 #  elif ( EOS == EOS_TAUBMATHEWS )
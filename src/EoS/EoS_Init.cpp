@@ -12,7 +12,7 @@ void EoS_Init_Isothermal();
 #elif ( EOS == EOS_TAUBMATHEWS )
 void EoS_Init_TaubMathews();
 #elif ( EOS == EOS_NUCLEAR )
-# error : ERROR : EOS_NUCLEAR is NOT supported yet !!
+void EoS_Init_Nuclear();
 #elif ( EOS == EOS_COSMIC_RAY )
 void EoS_Init_GammaCR();
 #endif // # EOS
@@ -71,7 +71,7 @@ void EoS_Init()
 #  elif ( EOS == EOS_TAUBMATHEWS )
    EoS_Init_Ptr = EoS_Init_TaubMathews;
 #  elif ( EOS == EOS_NUCLEAR )
-#  error : ERROR : EOS_NUCLEAR is NOT supported yet !!
+   EoS_Init_Ptr = EoS_Init_Nuclear;
 #  elif ( EOS == EOS_COSMIC_RAY )
    EoS_Init_Ptr = EoS_Init_GammaCR;
 #  endif // # EOS
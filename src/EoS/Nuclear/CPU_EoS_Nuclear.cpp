@@ -0,0 +1,900 @@
+#include "CUFLU.h"
+#ifdef __CUDACC__
+#include "CUDA_CheckError.h"
+#include "CUFLU_Shared_FluUtility.cu"
+#endif
+
+#if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
+
+
+
+/********************************************************
+1. Tabulated nuclear EoS (EOS_NUCLEAR)
+   --> Table variables are functions of (log10(rho), log10(T), Ye) on uniform grids
+   --> All NUC_NVAR variables of a table node are stored contiguously (i.e., [Ye][T][rho][var])
+       so that one trilinear interpolation touches only eight short contiguous blocks and the
+       innermost loop over variables can be vectorized
+   --> Temperature is obtained by inverting the interpolant along log10(T) (see Nuc_InvertTemp())
+
+2. This file is shared by both CPU and GPU
+
+   GPU_EoS_Nuclear.cu -> CPU_EoS_Nuclear.cpp
+
+3. Three steps are required to implement an EoS
+
+   I.   Set EoS auxiliary arrays
+   II.  Implement EoS conversion functions
+   III. Set EoS initialization functions
+********************************************************/
+
+
+
+// temperature bracket of the previous inversion on each CPU thread
+// --> consecutive cells usually have similar temperatures, so reusing it skips most bracket searches
+// --> GPU threads always start from the middle of the table
+#ifndef __CUDACC__
+static int Nuc_TempHint = 0;
+#ifdef OPENMP
+#pragma omp threadprivate( Nuc_TempHint )
+#endif
+#endif
+
+
+
+// =============================================
+// I. Set EoS auxiliary arrays
+// =============================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_SetAuxArray_Nuclear
+// Description :  Set the auxiliary arrays AuxArray_Flt/Int[]
+//
+//                   AuxArray_Flt[ 0] = log10(minimum density in g/cm^3) of the table
+//                   AuxArray_Flt[ 1] = 1/(log10 density spacing)
+//                   AuxArray_Flt[ 2] = log10(minimum temperature in MeV) of the table
+//                   AuxArray_Flt[ 3] = log10 temperature spacing
+//                   AuxArray_Flt[ 4] = minimum Ye of the table
+//                   AuxArray_Flt[ 5] = 1/(Ye spacing)
+//                   AuxArray_Flt[ 6] = energy shift of the table in erg/g
+//                   AuxArray_Flt[ 7] = log10(UNIT_D)
+//                   AuxArray_Flt[ 8] = UNIT_E/UNIT_M (code specific energy -> erg/g)
+//                   AuxArray_Flt[ 9] = log10(1/UNIT_P)
+//                   AuxArray_Flt[10] = UNIT_M/UNIT_E (cm^2/s^2 -> code sound speed squared)
+//                   AuxArray_Flt[11] = MeV/kB (MeV -> kelvin)
+//                   AuxArray_Flt[12] = 1/(log10 temperature spacing)
+//
+//                   AuxArray_Int[ 0] = index of Ye*density in Passive[]
+//                   AuxArray_Int[ 1] = number of density nodes
+//                   AuxArray_Int[ 2] = number of temperature nodes
+//                   AuxArray_Int[ 3] = number of Ye nodes
+//
+// Note        :  1. Invoked by EoS_Init_Nuclear()
+//                2. AuxArray_Flt/Int[] have the size of EOS_NAUX_MAX defined in Macro.h (default = 20)
+//                3. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//                4. Electron fraction must be stored as a passive scalar named "Ye" (i.e., density*Ye)
+//                   --> It must be added by the test problem initializer through Init_Field_User_Ptr
+//
+// Parameter   :  AuxArray_Flt/Int : Floating-point/Integer arrays to be filled up
+//                NPoint           : Number of table nodes along density, temperature, and Ye
+//                Axis_Min         : Minimum log10(rho), log10(T), and Ye of the table
+//                Axis_Delta       : Spacing of log10(rho), log10(T), and Ye of the table
+//                EnergyShift      : Energy shift of the table in erg/g
+//
+// Return      :  AuxArray_Flt/Int[]
+//-------------------------------------------------------------------------------------------------------
+#ifndef __CUDACC__
+void EoS_SetAuxArray_Nuclear( double AuxArray_Flt[], int AuxArray_Int[], const int NPoint[3],
+                              const double Axis_Min[3], const double Axis_Delta[3], const double EnergyShift )
+{
+
+   AuxArray_Flt[ 0] = Axis_Min[0];
+   AuxArray_Flt[ 1] = 1.0 / Axis_Delta[0];
+   AuxArray_Flt[ 2] = Axis_Min[1];
+   AuxArray_Flt[ 3] = Axis_Delta[1];
+   AuxArray_Flt[ 4] = Axis_Min[2];
+   AuxArray_Flt[ 5] = 1.0 / Axis_Delta[2];
+   AuxArray_Flt[ 6] = EnergyShift;
+   AuxArray_Flt[ 7] = log10( UNIT_D );
+   AuxArray_Flt[ 8] = UNIT_E / UNIT_M;
+   AuxArray_Flt[ 9] = -log10( UNIT_P );
+   AuxArray_Flt[10] = UNIT_M / UNIT_E;
+   AuxArray_Flt[11] = Const_MeV / Const_kB;
+   AuxArray_Flt[12] = 1.0 / Axis_Delta[1];
+
+   AuxArray_Int[ 0] = GetFieldIndex( "Ye", CHECK_ON ) - NCOMP_FLUID;
+   AuxArray_Int[ 1] = NPoint[0];
+   AuxArray_Int[ 2] = NPoint[1];
+   AuxArray_Int[ 3] = NPoint[2];
+
+} // FUNCTION : EoS_SetAuxArray_Nuclear
+#endif // #ifndef __CUDACC__
+
+
+
+// =============================================
+// II. Implement EoS conversion functions
+//     (1) EoS_DensEint2Pres_*
+//     (2) EoS_DensPres2Eint_*
+//     (3) EoS_DensPres2CSqr_*
+//     (4) EoS_DensEint2Temp_* [OPTIONAL]
+//     (5) EoS_DensTemp2Pres_* [OPTIONAL]
+//     (6) EoS_DensEint2Entr_* [OPTIONAL]
+//     (7) EoS_General_*       [OPTIONAL]
+// =============================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_GetIndex
+// Description :  Convert a normalized table coordinate to the lower node index and the linear weight
+//
+// Note        :  1. Coordinates outside the table are clamped to the table boundaries
+//
+// Parameter   :  x     : Normalized coordinate (i.e., (coordinate - minimum) / spacing)
+//                N     : Number of nodes along the target axis
+//                Idx   : Lower node index to be returned
+//                Frac  : Linear weight of node Idx+1 to be returned
+//
+// Return      :  Idx, Frac
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Nuc_GetIndex( real x, const int N, int &Idx, real &Frac )
+{
+
+   x    = FMIN(  FMAX( x, (real)0.0 ), (real)(N-1)  );
+   Idx  = MIN( (int)x, N-2 );
+   Frac = x - (real)Idx;
+
+} // FUNCTION : Nuc_GetIndex
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_GetDensYeIndex
+// Description :  Get the table indices and weights along density and Ye
+//
+// Parameter   :  Dens       : Gas mass density
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see EoS_SetAuxArray_Nuclear())
+//                iD/iY      : Lower node indices along density/Ye to be returned
+//                fD/fY      : Linear weights along density/Ye to be returned
+//
+// Return      :  iD, fD, iY, fY
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Nuc_GetDensYeIndex( const real Dens, const real Passive[], const double AuxArray_Flt[],
+                                const int AuxArray_Int[], int &iD, real &fD, int &iY, real &fY )
+{
+
+   const real LogDens = LOG10( Dens ) + (real)AuxArray_Flt[7];
+   const real Ye      = Passive[ AuxArray_Int[0] ] / Dens;
+
+   Nuc_GetIndex( ( LogDens - (real)AuxArray_Flt[0] )*(real)AuxArray_Flt[1], AuxArray_Int[1], iD, fD );
+   Nuc_GetIndex( ( Ye      - (real)AuxArray_Flt[4] )*(real)AuxArray_Flt[5], AuxArray_Int[3], iY, fY );
+
+} // FUNCTION : Nuc_GetDensYeIndex
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_Interpolate
+// Description :  Trilinear interpolation of all NUC_NVAR table variables
+//
+// Note        :  1. Table layout is [Ye][T][rho][NUC_NVAR]
+//                   --> The innermost loop over NUC_NVAR contiguous values is vectorized by the compiler
+//
+// Parameter   :  Data           : Table data
+//                NDens/NTemp    : Number of density/temperature nodes
+//                iD/iT/iY       : Lower node indices
+//                fD/fT/fY       : Linear weights
+//                Out            : Interpolated variables
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Nuc_Interpolate( const real *Data, const int NDens, const int NTemp,
+                             const int iD, const int iT, const int iY, const real fD, const real fT, const real fY,
+                             real Out[] )
+{
+
+   const long  Stride[3] = { (long)NUC_NVAR, (long)NUC_NVAR*NDens, (long)NUC_NVAR*NDens*NTemp };
+   const real  wD[2]     = { (real)1.0 - fD, fD };
+   const real  wT[2]     = { (real)1.0 - fT, fT };
+   const real  wY[2]     = { (real)1.0 - fY, fY };
+   const real *Node0     = Data + iD*Stride[0] + iT*Stride[1] + iY*Stride[2];
+
+   for (int v=0; v<NUC_NVAR; v++)   Out[v] = (real)0.0;
+
+   for (int c=0; c<8; c++)
+   {
+      const int   cD   = ( c      ) & 1;
+      const int   cT   = ( c >> 1 ) & 1;
+      const int   cY   = ( c >> 2 ) & 1;
+      const real  w    = wD[cD]*wT[cT]*wY[cY];
+      const real *Node = Node0 + cD*Stride[0] + cT*Stride[1] + cY*Stride[2];
+
+      for (int v=0; v<NUC_NVAR; v++)   Out[v] += w*Node[v];
+   }
+
+} // FUNCTION : Nuc_Interpolate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_InvertTemp
+// Description :  Find the temperature at which the interpolated table variable "Var" equals "Target"
+//
+// Note        :  1. Var must increase monotonically with temperature (e.g., NUC_VAR_EINT and NUC_VAR_PRES)
+//                2. The bracket [iT, iT+1] is found first, starting from the bracket of the previous
+//                   inversion on the same CPU thread and falling back to bisection if it does not enclose Target
+//                3. Within a bracket the interpolant is linear in log10(T) at fixed density and Ye, so a
+//                   single Newton step gives the exact root
+//                4. Target outside the table is clamped to the table boundaries
+//
+// Parameter   :  Data           : Table data
+//                NDens/NTemp    : Number of density/temperature nodes
+//                iD/iY          : Lower node indices along density/Ye
+//                fD/fY          : Linear weights along density/Ye
+//                Var            : Target table variable
+//                Target         : Target value of Var
+//                iT             : Lower node index along temperature to be returned
+//
+// Return      :  Linear weight along temperature, iT
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static real Nuc_InvertTemp( const real *Data, const int NDens, const int NTemp,
+                            const int iD, const int iY, const real fD, const real fY,
+                            const int Var, const real Target, int &iT )
+{
+
+   const long  Stride[3] = { (long)NUC_NVAR, (long)NUC_NVAR*NDens, (long)NUC_NVAR*NDens*NTemp };
+   const real  w00       = ( (real)1.0 - fD )*( (real)1.0 - fY );
+   const real  w10       = (             fD )*( (real)1.0 - fY );
+   const real  w01       = ( (real)1.0 - fD )*(             fY );
+   const real  w11       = (             fD )*(             fY );
+   const real *Node0     = Data + iD*Stride[0] + iY*Stride[2] + Var;
+
+// bilinear interpolation along density and Ye on the temperature node t
+#  define BILINEAR( t )                                                                        \
+   (  w00*Node0[ (t)*Stride[1]                         ] + w10*Node0[ (t)*Stride[1] + Stride[0]             ] + \
+      w01*Node0[ (t)*Stride[1]             + Stride[2] ] + w11*Node0[ (t)*Stride[1] + Stride[0] + Stride[2] ]   )
+
+#  ifdef __CUDACC__
+   int Hint = NTemp/2;
+#  else
+   int Hint = Nuc_TempHint;
+#  endif
+   Hint = MIN(  MAX( Hint, 0 ), NTemp-2  );
+
+   real ValL = BILINEAR( Hint   );
+   real ValR = BILINEAR( Hint+1 );
+   real Frac;
+
+// 1. reuse the previous bracket
+   if ( ValL <= Target  &&  Target <= ValR )
+      iT = Hint;
+
+// 2. bisection
+   else
+   {
+      int Lo, Hi;
+
+      if ( Target < ValL )    {  Lo = 0;        Hi = Hint;      }
+      else                    {  Lo = Hint + 1; Hi = NTemp - 1; }
+
+      if      ( Target <  BILINEAR( Lo ) )   Hi = Lo + 1;   // below the table (only possible when Lo == 0)
+      else if ( Target >= BILINEAR( Hi ) )   Lo = Hi - 1;   // above the table (only possible when Hi == NTemp-1)
+      else
+      {
+         while ( Hi - Lo > 1 )
+         {
+            const int Mid = ( Lo + Hi )/2;
+
+            if ( BILINEAR( Mid ) <= Target )    Lo = Mid;
+            else                                Hi = Mid;
+         }
+      }
+
+      iT   = MIN( Lo, NTemp-2 );
+      ValL = BILINEAR( iT   );
+      ValR = BILINEAR( iT+1 );
+   } // if ( ValL <= Target  &&  Target <= ValR ) ... else ...
+
+#  undef BILINEAR
+
+// 3. Newton step within the bracket
+   Frac = ( ValR > ValL ) ? ( Target - ValL )/( ValR - ValL ) : (real)0.0;
+   Frac = FMIN(  FMAX( Frac, (real)0.0 ), (real)1.0  );
+
+#  ifndef __CUDACC__
+   Nuc_TempHint = iT;
+#  endif
+
+   return Frac;
+
+} // FUNCTION : Nuc_InvertTemp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_DensEint2All
+// Description :  Interpolate all table variables from gas mass density and internal energy density
+//
+// Parameter   :  Dens       : Gas mass density
+//                Eint       : Gas internal energy density
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see EoS_SetAuxArray_Nuclear())
+//                Table      : EoS tables
+//                Out        : Interpolated variables
+//
+// Return      :  Normalized log10(T) coordinate, Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static real Nuc_DensEint2All( const real Dens, const real Eint, const real Passive[],
+                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                              const real *const Table[EOS_NTABLE_MAX], real Out[] )
+{
+
+   const real *Data  = Table[NUC_TABLE_DATA];
+   const int   NDens = AuxArray_Int[1];
+   const int   NTemp = AuxArray_Int[2];
+   const real  Eps   = Eint/Dens*(real)AuxArray_Flt[8];
+   const real  LogE  = LOG10(  FMAX( Eps + (real)AuxArray_Flt[6], TINY_NUMBER )  );
+   int  iD, iT, iY;
+   real fD, fT, fY;
+
+   Nuc_GetDensYeIndex( Dens, Passive, AuxArray_Flt, AuxArray_Int, iD, fD, iY, fY );
+   fT = Nuc_InvertTemp( Data, NDens, NTemp, iD, iY, fD, fY, NUC_VAR_EINT, LogE, iT );
+   Nuc_Interpolate( Data, NDens, NTemp, iD, iT, iY, fD, fT, fY, Out );
+
+   return (real)iT + fT;
+
+} // FUNCTION : Nuc_DensEint2All
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_DensPres2All
+// Description :  Interpolate all table variables from gas mass density and pressure
+//
+// Parameter   :  Dens       : Gas mass density
+//                Pres       : Gas pressure
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see EoS_SetAuxArray_Nuclear())
+//                Table      : EoS tables
+//                Out        : Interpolated variables
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Nuc_DensPres2All( const real Dens, const real Pres, const real Passive[],
+                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                              const real *const Table[EOS_NTABLE_MAX], real Out[] )
+{
+
+   const real *Data  = Table[NUC_TABLE_DATA];
+   const int   NDens = AuxArray_Int[1];
+   const int   NTemp = AuxArray_Int[2];
+   const real  LogP  = LOG10(  FMAX( Pres, TINY_NUMBER )  ) - (real)AuxArray_Flt[9];
+   int  iD, iT, iY;
+   real fD, fT, fY;
+
+   Nuc_GetDensYeIndex( Dens, Passive, AuxArray_Flt, AuxArray_Int, iD, fD, iY, fY );
+   fT = Nuc_InvertTemp( Data, NDens, NTemp, iD, iY, fD, fY, NUC_VAR_PRES, LogP, iT );
+   Nuc_Interpolate( Data, NDens, NTemp, iD, iT, iY, fD, fT, fY, Out );
+
+} // FUNCTION : Nuc_DensPres2All
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Pres_Nuclear
+// Description :  Convert gas mass density and internal energy density to gas pressure
+//
+// Note        :  1. Internal energy density here is per unit volume instead of per unit mass
+//                2. See EoS_SetAuxArray_Nuclear() for the values stored in AuxArray_Flt/Int[]
+//
+// Parameter   :  Dens       : Gas mass density
+//                Eint       : Gas internal energy density
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Gas pressure
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensEint2Pres_Nuclear( const real Dens, const real Eint, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   real Out[NUC_NVAR], Pres;
+
+   Nuc_DensEint2All( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table, Out );
+
+   Pres = POW(  (real)10.0, Out[NUC_VAR_PRES] + (real)AuxArray_Flt[9]  );
+
+   return Pres;
+
+} // FUNCTION : EoS_DensEint2Pres_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2Eint_Nuclear
+// Description :  Convert gas mass density and pressure to gas internal energy density
+//
+// Note        :  1. See EoS_DensEint2Pres_Nuclear()
+//
+// Parameter   :  Dens       : Gas mass density
+//                Pres       : Gas pressure
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Gas internal energy density
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensPres2Eint_Nuclear( const real Dens, const real Pres, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Pres, "input pressure",
+                       (real)0.0,   HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   real Out[NUC_NVAR], Eps, Eint;
+
+   Nuc_DensPres2All( Dens, Pres, Passive, AuxArray_Flt, AuxArray_Int, Table, Out );
+
+   Eps  = POW( (real)10.0, Out[NUC_VAR_EINT] ) - (real)AuxArray_Flt[6];
+   Eint = Dens*Eps*(real)AuxArray_Flt[10];
+
+   return Eint;
+
+} // FUNCTION : EoS_DensPres2Eint_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2CSqr_Nuclear
+// Description :  Convert gas mass density and pressure to sound speed squared
+//
+// Note        :  1. See EoS_DensEint2Pres_Nuclear()
+//
+// Parameter   :  Dens       : Gas mass density
+//                Pres       : Gas pressure
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Sound speed squared
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensPres2CSqr_Nuclear( const real Dens, const real Pres, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Pres, "input pressure",
+                       (real)0.0,   HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   real Out[NUC_NVAR], Cs2;
+
+   Nuc_DensPres2All( Dens, Pres, Passive, AuxArray_Flt, AuxArray_Int, Table, Out );
+
+   Cs2 = Out[NUC_VAR_CSQR]*(real)AuxArray_Flt[10];
+
+   return Cs2;
+
+} // FUNCTION : EoS_DensPres2CSqr_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Temp_Nuclear
+// Description :  Convert gas mass density and internal energy density to gas temperature
+//
+// Note        :  1. Internal energy density here is per unit volume instead of per unit mass
+//                2. See EoS_SetAuxArray_Nuclear() for the values stored in AuxArray_Flt/Int[]
+//                3. Temperature is in kelvin
+//
+// Parameter   :  Dens       : Gas mass density
+//                Eint       : Gas internal energy density
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Gas temperature in kelvin
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensEint2Temp_Nuclear( const real Dens, const real Eint, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   real Out[NUC_NVAR], xT, LogT, Temp;
+
+   xT   = Nuc_DensEint2All( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table, Out );
+   LogT = (real)AuxArray_Flt[2] + xT*(real)AuxArray_Flt[3];
+   Temp = POW( (real)10.0, LogT )*(real)AuxArray_Flt[11];
+
+   return Temp;
+
+} // FUNCTION : EoS_DensEint2Temp_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensTemp2Pres_Nuclear
+// Description :  Convert gas mass density and temperature to gas pressure
+//
+// Note        :  1. See EoS_SetAuxArray_Nuclear() for the values stored in AuxArray_Flt/Int[]
+//                2. Temperature is in kelvin
+//                3. Direct table lookup without temperature inversion
+//
+// Parameter   :  Dens       : Gas mass density
+//                Temp       : Gas temperature in kelvin
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Gas pressure
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensTemp2Pres_Nuclear( const real Dens, const real Temp, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Temp, "input temperature",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   const real *Data  = Table[NUC_TABLE_DATA];
+   const int   NDens = AuxArray_Int[1];
+   const int   NTemp = AuxArray_Int[2];
+   const real  LogT  = LOG10( Temp/(real)AuxArray_Flt[11] );
+   int  iD, iT, iY;
+   real fD, fT, fY, Out[NUC_NVAR], Pres;
+
+   Nuc_GetDensYeIndex( Dens, Passive, AuxArray_Flt, AuxArray_Int, iD, fD, iY, fY );
+   Nuc_GetIndex( ( LogT - (real)AuxArray_Flt[2] )*(real)AuxArray_Flt[12], NTemp, iT, fT );
+   Nuc_Interpolate( Data, NDens, NTemp, iD, iT, iY, fD, fT, fY, Out );
+
+   Pres = POW(  (real)10.0, Out[NUC_VAR_PRES] + (real)AuxArray_Flt[9]  );
+
+   return Pres;
+
+} // FUNCTION : EoS_DensTemp2Pres_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Entr_Nuclear
+// Description :  Convert gas mass density and internal energy density to gas entropy
+//                --> Here entropy is the entropy per baryon in kB
+//
+// Note        :  1. See EoS_SetAuxArray_Nuclear() for the values stored in AuxArray_Flt/Int[]
+//
+// Parameter   :  Dens       : Gas mass density
+//                Eint       : Gas internal energy density
+//                Passive    : Passive scalars (Passive[AuxArray_Int[0]] gives density*Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Gas entropy
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensEint2Entr_Nuclear( const real Dens, const real Eint, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Passive      == NULL )   printf( "ERROR : Passive == NULL in %s !!\n", __FUNCTION__ );
+
+   Hydro_IsUnphysical( UNPHY_MODE_SING, &Dens, "input density",
+                       TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                       ERROR_INFO, UNPHY_VERBOSE );
+#  endif // GAMER_DEBUG
+
+
+   real Out[NUC_NVAR], Entr;
+
+   Nuc_DensEint2All( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table, Out );
+
+   Entr = Out[NUC_VAR_ENTR];
+
+   return Entr;
+
+} // FUNCTION : EoS_DensEint2Entr_Nuclear
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_General_Nuclear
+// Description :  General EoS converter: In_*[] -> Out[]
+//
+// Note        :  1. See EoS_DensEint2Pres_Nuclear()
+//                2. In_*[] and Out[] must NOT overlap
+//                3. Useless for this EoS
+//
+// Parameter   :  Mode       : To support multiple modes in this general converter
+//                Out        : Output array
+//                In_*       : Input array
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static void EoS_General_Nuclear( const int Mode, real Out[], const real In_Flt[], const int In_Int[],
+                                 const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// not used by this EoS
+
+} // FUNCTION : EoS_General_Nuclear
+
+
+
+// =============================================
+// III. Set EoS initialization functions
+// =============================================
+
+#ifdef __CUDACC__
+#  define FUNC_SPACE __device__ static
+#else
+#  define FUNC_SPACE            static
+#endif
+
+FUNC_SPACE EoS_DE2P_t EoS_DensEint2Pres_Ptr = EoS_DensEint2Pres_Nuclear;
+FUNC_SPACE EoS_DP2E_t EoS_DensPres2Eint_Ptr = EoS_DensPres2Eint_Nuclear;
+FUNC_SPACE EoS_DP2C_t EoS_DensPres2CSqr_Ptr = EoS_DensPres2CSqr_Nuclear;
+FUNC_SPACE EoS_DE2T_t EoS_DensEint2Temp_Ptr = EoS_DensEint2Temp_Nuclear;
+FUNC_SPACE EoS_DT2P_t EoS_DensTemp2Pres_Ptr = EoS_DensTemp2Pres_Nuclear;
+FUNC_SPACE EoS_DE2S_t EoS_DensEint2Entr_Ptr = EoS_DensEint2Entr_Nuclear;
+FUNC_SPACE EoS_GENE_t EoS_General_Ptr       = EoS_General_Nuclear;
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_SetCPU/GPUFunc_Nuclear
+// Description :  Return the function pointers of the CPU/GPU EoS routines
+//
+// Note        :  1. Invoked by EoS_Init_Nuclear()
+//                2. Must obtain the CPU and GPU function pointers by **separate** routines
+//                   since CPU and GPU functions are compiled completely separately in GAMER
+//                   --> In other words, a unified routine like the following won't work
+//
+//                      EoS_SetFunc_Nuclear( CPU_FuncPtr, GPU_FuncPtr );
+//
+//                3. Call-by-reference
+//
+// Parameter   :  EoS_DensEint2Pres_CPU/GPUPtr : CPU/GPU function pointers to be set
+//                EoS_DensPres2Eint_CPU/GPUPtr : ...
+//                EoS_DensPres2CSqr_CPU/GPUPtr : ...
+//                EoS_DensEint2Temp_CPU/GPUPtr : ...
+//                EoS_DensTemp2Pres_CPU/GPUPtr : ...
+//                EoS_DensEint2Entr_CPU/GPUPtr : ...
+//                EoS_General_CPU/GPUPtr       : ...
+//
+// Return      :  EoS_DensEint2Pres_CPU/GPUPtr, EoS_DensPres2Eint_CPU/GPUPtr,
+//                EoS_DensPres2CSqr_CPU/GPUPtr, EoS_DensEint2Temp_CPU/GPUPtr,
+//                EoS_DensTemp2Pres_CPU/GPUPtr, EoS_DensEint2Entr_CPU/GPUPtr,
+//                EoS_General_CPU/GPUPtr
+//-----------------------------------------------------------------------------------------
+#ifdef __CUDACC__
+__host__
+void EoS_SetGPUFunc_Nuclear( EoS_DE2P_t &EoS_DensEint2Pres_GPUPtr,
+                             EoS_DP2E_t &EoS_DensPres2Eint_GPUPtr,
+                             EoS_DP2C_t &EoS_DensPres2CSqr_GPUPtr,
+                             EoS_DE2T_t &EoS_DensEint2Temp_GPUPtr,
+                             EoS_DT2P_t &EoS_DensTemp2Pres_GPUPtr,
+                             EoS_DE2S_t &EoS_DensEint2Entr_GPUPtr,
+                             EoS_GENE_t &EoS_General_GPUPtr )
+{
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensEint2Pres_GPUPtr, EoS_DensEint2Pres_Ptr, sizeof(EoS_DE2P_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensPres2Eint_GPUPtr, EoS_DensPres2Eint_Ptr, sizeof(EoS_DP2E_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensPres2CSqr_GPUPtr, EoS_DensPres2CSqr_Ptr, sizeof(EoS_DP2C_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensEint2Temp_GPUPtr, EoS_DensEint2Temp_Ptr, sizeof(EoS_DE2T_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensTemp2Pres_GPUPtr, EoS_DensTemp2Pres_Ptr, sizeof(EoS_DT2P_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensEint2Entr_GPUPtr, EoS_DensEint2Entr_Ptr, sizeof(EoS_DE2S_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_General_GPUPtr,       EoS_General_Ptr,       sizeof(EoS_GENE_t) )  );
+}
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_SetGPUTable_Nuclear / EoS_FreeGPUTable_Nuclear
+// Description :  Allocate and copy / free the GPU table
+//
+// Note        :  1. Invoked by EoS_Init_Nuclear() / EoS_End_Nuclear()
+//                2. The GPU table pointer is passed to the GPU constant memory by CUAPI_SetConstMemory_EoS()
+//
+// Parameter   :  h_Table : CPU table
+//                d_Table : GPU table to be allocated / freed
+//                Size    : Number of elements in the table
+//-----------------------------------------------------------------------------------------
+__host__
+void EoS_SetGPUTable_Nuclear( const real *h_Table, real *&d_Table, const long Size )
+{
+   CUDA_CHECK_ERROR(  cudaMalloc( (void**)&d_Table, Size*sizeof(real) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpy( d_Table, h_Table, Size*sizeof(real), cudaMemcpyHostToDevice )  );
+}
+
+__host__
+void EoS_FreeGPUTable_Nuclear( real *&d_Table )
+{
+   if ( d_Table != NULL )  CUDA_CHECK_ERROR(  cudaFree( d_Table )  );
+   d_Table = NULL;
+}
+
+#else // #ifdef __CUDACC__
+
+void EoS_SetCPUFunc_Nuclear( EoS_DE2P_t &EoS_DensEint2Pres_CPUPtr,
+                             EoS_DP2E_t &EoS_DensPres2Eint_CPUPtr,
+                             EoS_DP2C_t &EoS_DensPres2CSqr_CPUPtr,
+                             EoS_DE2T_t &EoS_DensEint2Temp_CPUPtr,
+                             EoS_DT2P_t &EoS_DensTemp2Pres_CPUPtr,
+                             EoS_DE2S_t &EoS_DensEint2Entr_CPUPtr,
+                             EoS_GENE_t &EoS_General_CPUPtr )
+{
+   EoS_DensEint2Pres_CPUPtr = EoS_DensEint2Pres_Ptr;
+   EoS_DensPres2Eint_CPUPtr = EoS_DensPres2Eint_Ptr;
+   EoS_DensPres2CSqr_CPUPtr = EoS_DensPres2CSqr_Ptr;
+   EoS_DensEint2Temp_CPUPtr = EoS_DensEint2Temp_Ptr;
+   EoS_DensTemp2Pres_CPUPtr = EoS_DensTemp2Pres_Ptr;
+   EoS_DensEint2Entr_CPUPtr = EoS_DensEint2Entr_Ptr;
+   EoS_General_CPUPtr       = EoS_General_Ptr;
+}
+
+#endif // #ifdef __CUDACC__ ... else ...
+
+
+
+#ifndef __CUDACC__
+
+// local function prototypes
+void EoS_SetAuxArray_Nuclear( double [], int [], const int [], const double [], const double [], const double );
+void EoS_SetCPUFunc_Nuclear( EoS_DE2P_t &, EoS_DP2E_t &, EoS_DP2C_t &, EoS_DE2T_t &, EoS_DT2P_t &, EoS_DE2S_t &, EoS_GENE_t & );
+#ifdef GPU
+void EoS_SetGPUFunc_Nuclear( EoS_DE2P_t &, EoS_DP2E_t &, EoS_DP2C_t &, EoS_DE2T_t &, EoS_DT2P_t &, EoS_DE2S_t &, EoS_GENE_t & );
+void EoS_SetGPUTable_Nuclear( const real *, real *&, const long );
+void EoS_FreeGPUTable_Nuclear( real *& );
+extern real *d_EoS_Table[EOS_NTABLE_MAX];
+#endif
+void EoS_LoadTable_Nuclear( const char *FileName, real *&Data, int NPoint[3], double Axis_Min[3],
+                            double Axis_Delta[3], double &EnergyShift );
+void EoS_Benchmark_Nuclear( const long NLookup );
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_Init_Nuclear
+// Description :  Initialize EoS
+//
+// Note        :  1. Load the table NUC_TABLE by invoking EoS_LoadTable_Nuclear()
+//                2. Set auxiliary arrays by invoking EoS_SetAuxArray_*()
+//                   --> It will be copied to GPU automatically in CUAPI_SetConstMemory()
+//                3. Set the CPU/GPU EoS routines by invoking EoS_SetCPU/GPUFunc_*()
+//                4. Invoked by EoS_Init()
+//                   --> Enable it by linking to the function pointer "EoS_Init_Ptr"
+//                5. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void EoS_Init_Nuclear()
+{
+
+   int    NPoint[3];
+   double Axis_Min[3], Axis_Delta[3], EnergyShift;
+
+   EoS_LoadTable_Nuclear( NUC_TABLE, h_EoS_Table[NUC_TABLE_DATA], NPoint, Axis_Min, Axis_Delta, EnergyShift );
+
+   EoS_SetAuxArray_Nuclear( EoS_AuxArray_Flt, EoS_AuxArray_Int, NPoint, Axis_Min, Axis_Delta, EnergyShift );
+   EoS_SetCPUFunc_Nuclear( EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr,
+                           EoS_DensPres2CSqr_CPUPtr, EoS_DensEint2Temp_CPUPtr,
+                           EoS_DensTemp2Pres_CPUPtr, EoS_DensEint2Entr_CPUPtr,
+                           EoS_General_CPUPtr );
+#  ifdef GPU
+   EoS_SetGPUFunc_Nuclear( EoS_DensEint2Pres_GPUPtr, EoS_DensPres2Eint_GPUPtr,
+                           EoS_DensPres2CSqr_GPUPtr, EoS_DensEint2Temp_GPUPtr,
+                           EoS_DensTemp2Pres_GPUPtr, EoS_DensEint2Entr_GPUPtr,
+                           EoS_General_GPUPtr );
+   EoS_SetGPUTable_Nuclear( h_EoS_Table[NUC_TABLE_DATA], d_EoS_Table[NUC_TABLE_DATA],
+                            (long)NUC_NVAR*NPoint[0]*NPoint[1]*NPoint[2] );
+#  endif
+
+   if ( NUC_BENCHMARK > 0  &&  MPI_Rank == 0 )   EoS_Benchmark_Nuclear( NUC_BENCHMARK );
+
+} // FUNCTION : EoS_Init_Nuclear
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_End_Nuclear
+// Description :  Free the EoS table
+//
+// Note        :  1. Invoked by EoS_End()
+//                   --> Enable it by linking to the function pointer "EoS_End_Ptr"
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void EoS_End_Nuclear()
+{
+
+   delete [] h_EoS_Table[NUC_TABLE_DATA];
+   h_EoS_Table[NUC_TABLE_DATA] = NULL;
+
+#  ifdef GPU
+   EoS_FreeGPUTable_Nuclear( d_EoS_Table[NUC_TABLE_DATA] );
+#  endif
+
+} // FUNCTION : EoS_End_Nuclear
+
+#endif // #ifndef __CUDACC__
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
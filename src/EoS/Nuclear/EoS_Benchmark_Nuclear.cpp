@@ -0,0 +1,135 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
+
+
+
+// the passive scalar "Ye" is required (see also Aux_Check_Parameter())
+#if ( NCOMP_PASSIVE_USER < 1 )
+#  error : ERROR : EOS_NUCLEAR requires the passive scalar "Ye" (NCOMP_PASSIVE_USER >= 1) !!
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Benchmark_Nuclear
+// Description :  Measure the throughput of the nuclear EoS table lookups
+//
+// Note        :  1. Invoked by EoS_Init_Nuclear() on rank 0 when NUC_BENCHMARK > 0
+//                2. Two sets of NLookup samples in (rho, T, Ye) are drawn inside the table
+//                   (1) Random   : independent uniform samples in log10(rho), log10(T), and Ye
+//                   (2) Coherent : a smooth path through the table mimicking neighbouring cells,
+//                                  for which the temperature bracket of the previous lookup is reused
+//                3. Internal energy of each sample is computed by DensTemp2Pres + DensPres2Eint in advance
+//                   and the timed lookups are DensEint2Pres and DensEint2Temp (i.e., with temperature inversion)
+//                4. Also report the maximum relative error of the recovered temperature as a sanity check
+//                5. Run serially on a single thread
+//
+// Parameter   :  NLookup : Number of samples in each set
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void EoS_Benchmark_Nuclear( const long NLookup )
+{
+
+   Aux_Message( stdout, "   Benchmarking the nuclear EoS table with %ld lookups ...\n", NLookup );
+
+
+   const int     YeIdx        = EoS_AuxArray_Int[0];
+   const int     NPoint[3]    = { EoS_AuxArray_Int[1], EoS_AuxArray_Int[2], EoS_AuxArray_Int[3] };
+   const double  Axis_Min[3]  = { EoS_AuxArray_Flt[0], EoS_AuxArray_Flt[2], EoS_AuxArray_Flt[4] };
+   const double  Axis_Max[3]  = { Axis_Min[0] + (NPoint[0]-1)/EoS_AuxArray_Flt[1],
+                                  Axis_Min[1] + (NPoint[1]-1)*EoS_AuxArray_Flt[3],
+                                  Axis_Min[2] + (NPoint[2]-1)/EoS_AuxArray_Flt[5] };
+   const double  MeV2K        = EoS_AuxArray_Flt[11];
+   const char   *SetName[2]   = { "random", "coherent" };
+
+   real   *Dens    = new real [NLookup];
+   real   *Eint    = new real [NLookup];
+   real   *Temp    = new real [NLookup];
+   real  (*Passive)[NCOMP_PASSIVE] = new real [NLookup][NCOMP_PASSIVE];
+   real    Sum     = (real)0.0;
+   Timer_t Timer;
+
+   RandomNumber_t RNG( 1 );
+   RNG.SetSeed( 0, 123 );
+
+   for (int Set=0; Set<2; Set++)
+   {
+//    1. set the samples
+//    --> stay slightly inside the table to avoid clamping
+      for (long n=0; n<NLookup; n++)
+      {
+         double Coord[3];
+
+         for (int d=0; d<3; d++)
+         {
+            const double Margin = 0.01*( Axis_Max[d] - Axis_Min[d] );
+            const double Min    = Axis_Min[d] + Margin;
+            const double Max    = Axis_Max[d] - Margin;
+
+            if ( Set == 0 )   Coord[d] = RNG.GetValue( 0, Min, Max );
+            else              Coord[d] = Min + ( Max - Min )*0.5*(  1.0 - cos( M_PI*(d+1)*(n+0.5)/NLookup )  );
+         }
+
+         Dens[n] = (real)(  pow( 10.0, Coord[0] ) / UNIT_D  );
+         Temp[n] = (real)(  pow( 10.0, Coord[1] ) * MeV2K  );
+
+         for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[n][v] = (real)0.0;
+         Passive[n][YeIdx] = Dens[n]*(real)Coord[2];
+
+         const real Pres = EoS_DensTemp2Pres_CPUPtr( Dens[n], Temp[n], Passive[n], EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+         Eint[n] = EoS_DensPres2Eint_CPUPtr( Dens[n], Pres, Passive[n], EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+      }
+
+
+//    2. DensEint2Pres
+      Timer.Reset();
+      Timer.Start();
+
+      for (long n=0; n<NLookup; n++)
+         Sum += EoS_DensEint2Pres_CPUPtr( Dens[n], Eint[n], Passive[n], EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+
+      Timer.Stop();
+
+      const double Time_Pres = Timer.GetValue();
+
+
+//    3. DensEint2Temp
+      double MaxErr = 0.0;
+
+      Timer.Reset();
+      Timer.Start();
+
+      for (long n=0; n<NLookup; n++)
+      {
+         const real T = EoS_DensEint2Temp_CPUPtr( Dens[n], Eint[n], Passive[n], EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+         MaxErr = fmax(  MaxErr, fabs( (double)T - (double)Temp[n] ) / (double)Temp[n]  );
+      }
+
+      Timer.Stop();
+
+      const double Time_Temp = Timer.GetValue();
+
+
+      Aux_Message( stdout, "      %-8s : DensEint2Pres %13.7e lookups/s, DensEint2Temp %13.7e lookups/s, max relative T error %13.7e\n",
+                   SetName[Set], NLookup/Time_Pres, NLookup/Time_Temp, MaxErr );
+   } // for (int Set=0; Set<2; Set++)
+
+
+// print the checksum to prevent the compiler from optimizing away the pressure lookups
+   Aux_Message( stdout, "      checksum : %13.7e\n", Sum );
+   Aux_Message( stdout, "   Benchmarking the nuclear EoS table with %ld lookups ... done\n", NLookup );
+
+
+   delete [] Dens;
+   delete [] Eint;
+   delete [] Temp;
+   delete [] Passive;
+
+} // FUNCTION : EoS_Benchmark_Nuclear
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
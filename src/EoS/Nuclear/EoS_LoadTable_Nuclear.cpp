@@ -0,0 +1,186 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
+
+#ifdef SUPPORT_HDF5
+#include "hdf5.h"
+
+static void Nuc_ReadDataset( const hid_t FID, const char *SetName, const hid_t MemType, void *Buf, const char *FileName );
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_LoadTable_Nuclear
+// Description :  Load the nuclear EoS table and pack it into the interpolation layout
+//
+// Note        :  1. Invoked by EoS_Init_Nuclear()
+//                2. The table must follow the HDF5 format of stellarcollapse.org
+//                   --> Scalars  : pointsrho, pointstemp, pointsye, energy_shift
+//                       Axes     : logrho [g/cm^3], logtemp [MeV], ye
+//                       3D data  : logpress, logenergy, entropy, cs2 with the shape [ye][temp][rho]
+//                3. Axes must be uniformly spaced so that the table index can be computed directly
+//                4. Data are repacked as [ye][temp][rho][NUC_NVAR] so that all variables of a table node
+//                   are contiguous (see NUC_VAR_* in Macro.h)
+//                5. All ranks read the table
+//                6. Data must be freed by EoS_End_Nuclear()
+//
+// Parameter   :  FileName    : Table filename
+//                Data        : Table data to be allocated and filled
+//                NPoint      : Number of table nodes along density, temperature, and Ye
+//                Axis_Min    : Minimum log10(rho), log10(T), and Ye of the table
+//                Axis_Delta  : Spacing of log10(rho), log10(T), and Ye of the table
+//                EnergyShift : Energy shift of the table in erg/g
+//
+// Return      :  Data, NPoint[], Axis_Min[], Axis_Delta[], EnergyShift
+//-------------------------------------------------------------------------------------------------------
+void EoS_LoadTable_Nuclear( const char *FileName, real *&Data, int NPoint[3], double Axis_Min[3],
+                            double Axis_Delta[3], double &EnergyShift )
+{
+
+#  ifndef SUPPORT_HDF5
+   Aux_Error( ERROR_INFO, "SUPPORT_HDF5 must be enabled for EOS_NUCLEAR !!\n" );
+#  else
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the nuclear EoS table \"%s\" ...\n", FileName );
+
+
+   if ( !Aux_CheckFileExist(FileName) )
+      Aux_Error( ERROR_INFO, "nuclear EoS table \"%s\" does not exist !!\n", FileName );
+
+   const hid_t FID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+
+   if ( FID < 0 )    Aux_Error( ERROR_INFO, "failed to open the nuclear EoS table \"%s\" !!\n", FileName );
+
+
+// 1. load the table size and axes
+   const char *NPointName[3] = { "pointsrho", "pointstemp", "pointsye" };
+   const char *AxisName  [3] = { "logrho", "logtemp", "ye" };
+
+   for (int d=0; d<3; d++)
+   {
+      Nuc_ReadDataset( FID, NPointName[d], H5T_NATIVE_INT, NPoint+d, FileName );
+
+      if ( NPoint[d] < 2 )
+         Aux_Error( ERROR_INFO, "%s (%d) < 2 in the nuclear EoS table \"%s\" !!\n", NPointName[d], NPoint[d], FileName );
+   }
+
+   Nuc_ReadDataset( FID, "energy_shift", H5T_NATIVE_DOUBLE, &EnergyShift, FileName );
+
+   for (int d=0; d<3; d++)
+   {
+      double *Axis = new double [ NPoint[d] ];
+
+      Nuc_ReadDataset( FID, AxisName[d], H5T_NATIVE_DOUBLE, Axis, FileName );
+
+      Axis_Min  [d] = Axis[0];
+      Axis_Delta[d] = ( Axis[ NPoint[d]-1 ] - Axis[0] ) / ( NPoint[d] - 1 );
+
+      if ( Axis_Delta[d] <= 0.0 )
+         Aux_Error( ERROR_INFO, "axis \"%s\" is not increasing in the nuclear EoS table \"%s\" !!\n", AxisName[d], FileName );
+
+//    check uniform spacing
+      for (int t=1; t<NPoint[d]; t++)
+      {
+         const double Expect = Axis_Min[d] + t*Axis_Delta[d];
+
+         if (  fabs( Axis[t] - Expect ) > 1.0e-6*Axis_Delta[d]  )
+            Aux_Error( ERROR_INFO, "axis \"%s\" is not uniformly spaced (index %d: %20.14e != %20.14e) in \"%s\" !!\n",
+                       AxisName[d], t, Axis[t], Expect, FileName );
+      }
+
+      delete [] Axis;
+   }
+
+
+// 2. load the 3D data and repack them as [ye][temp][rho][NUC_NVAR]
+   const long  NNode             = (long)NPoint[0]*NPoint[1]*NPoint[2];
+   const char *VarName[NUC_NVAR] = { NULL };
+
+   VarName[NUC_VAR_PRES] = "logpress";
+   VarName[NUC_VAR_EINT] = "logenergy";
+   VarName[NUC_VAR_ENTR] = "entropy";
+   VarName[NUC_VAR_CSQR] = "cs2";
+
+   double *Buf = new double [NNode];
+
+   delete [] Data;
+   Data = new real [ NUC_NVAR*NNode ];
+
+   for (int v=0; v<NUC_NVAR; v++)
+   {
+//    check the dataset shape
+      const hid_t SetID = H5Dopen( FID, VarName[v], H5P_DEFAULT );
+      if ( SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" in \"%s\" !!\n", VarName[v], FileName );
+
+      const hid_t SpaceID = H5Dget_space( SetID );
+      hsize_t Dims[3];
+      const int NDim = H5Sget_simple_extent_dims( SpaceID, Dims, NULL );
+
+      if ( NDim != 3  ||  Dims[0] != (hsize_t)NPoint[2]  ||  Dims[1] != (hsize_t)NPoint[1]  ||  Dims[2] != (hsize_t)NPoint[0] )
+         Aux_Error( ERROR_INFO, "incorrect shape of the dataset \"%s\" in \"%s\" (expect [%d][%d][%d]) !!\n",
+                    VarName[v], FileName, NPoint[2], NPoint[1], NPoint[0] );
+
+      H5Sclose( SpaceID );
+      H5Dclose( SetID );
+
+      Nuc_ReadDataset( FID, VarName[v], H5T_NATIVE_DOUBLE, Buf, FileName );
+
+      for (long n=0; n<NNode; n++)  Data[ n*NUC_NVAR + v ] = (real)Buf[n];
+   }
+
+   delete [] Buf;
+
+   H5Fclose( FID );
+
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "      log10(rho) : [%13.7e, %13.7e], N = %d\n",
+                   Axis_Min[0], Axis_Min[0]+(NPoint[0]-1)*Axis_Delta[0], NPoint[0] );
+      Aux_Message( stdout, "      log10(T)   : [%13.7e, %13.7e], N = %d\n",
+                   Axis_Min[1], Axis_Min[1]+(NPoint[1]-1)*Axis_Delta[1], NPoint[1] );
+      Aux_Message( stdout, "      Ye         : [%13.7e, %13.7e], N = %d\n",
+                   Axis_Min[2], Axis_Min[2]+(NPoint[2]-1)*Axis_Delta[2], NPoint[2] );
+      Aux_Message( stdout, "   Loading the nuclear EoS table \"%s\" ... done\n", FileName );
+   }
+
+#  endif // #ifndef SUPPORT_HDF5 ... else ...
+
+} // FUNCTION : EoS_LoadTable_Nuclear
+
+
+
+#ifdef SUPPORT_HDF5
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Nuc_ReadDataset
+// Description :  Read an entire dataset from the nuclear EoS table
+//
+// Parameter   :  FID      : HDF5 file ID
+//                SetName  : Target dataset name
+//                MemType  : HDF5 memory datatype of Buf
+//                Buf      : Buffer to store the loaded data
+//                FileName : Table filename (for error messages only)
+//
+// Return      :  Buf
+//-------------------------------------------------------------------------------------------------------
+void Nuc_ReadDataset( const hid_t FID, const char *SetName, const hid_t MemType, void *Buf, const char *FileName )
+{
+
+   const hid_t SetID = H5Dopen( FID, SetName, H5P_DEFAULT );
+
+   if ( SetID < 0 )
+      Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" in \"%s\" !!\n", SetName, FileName );
+
+   if (  H5Dread( SetID, MemType, H5S_ALL, H5S_ALL, H5P_DEFAULT, Buf ) < 0  )
+      Aux_Error( ERROR_INFO, "failed to read the dataset \"%s\" in \"%s\" !!\n", SetName, FileName );
+
+   H5Dclose( SetID );
+
+} // FUNCTION : Nuc_ReadDataset
+#endif // #ifdef SUPPORT_HDF5
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  EOS == EOS_NUCLEAR )
@@ -0,0 +1 @@
+CPU_EoS_Nuclear.cpp
\ No newline at end of file
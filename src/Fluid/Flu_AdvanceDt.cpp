@@ -9,6 +9,18 @@ int FluStatus_ThisRank;
 void Flu_SwapFixUpTempArray( const int lv );
 void Flu_InitFixUpTempArray( const int lv );
 
+#ifdef LOAD_BALANCE
+// arguments of the fluid solver overlapped with the MPI communication
+struct FluOverlapArg_t
+{
+   int    lv;
+   double TimeNew, TimeOld, dt;
+   int    SaveSg_Flu, SaveSg_Mag;
+};
+
+static void Flu_AdvanceDt_Async( void *Arg );
+#endif
+
 
 
 
@@ -19,6 +31,13 @@ void Flu_InitFixUpTempArray( const int lv );
 // Note        :  1. Invoke InvokeSolver()
 //                2. Currently the updated data can only be stored in the different sandglass from the
 //                   input data
+//                3. OverlapMPI (LOAD_BALANCE only):
+//                   (1) Advance the patch groups with data to be sent to other ranks (i.e., OverlapMPI_FluSyncPID0)
+//                   (2) Exchange the updated fluid data of buffer patches by non-blocking MPI and advance the
+//                       remaining patch groups (i.e., OverlapMPI_FluAsyncPID0) simultaneously
+//                   --> The buffer data at SaveSg_Flu/Mag are ready when returning from this function, and
+//                       the caller must NOT modify the fluid data of real patches afterward without
+//                       exchanging the buffer data again
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -27,16 +46,14 @@ void Flu_InitFixUpTempArray( const int lv );
 //                dt           : Time interval to advance solution (can be different from TimeNew-TimeOld in COMOVING)
 //                SaveSg_Flu   : Sandglass to store the updated fluid data
 //                SaveSg_Mag   : Sandglass to store the updated B field
-//                OverlapMPI   : true --> Overlap MPI time with CPU/GPU computation
-//                Overlap_Sync : true  --> Advance the patches which cannot be overlapped with MPI communication
-//                               false --> Advance the patches which can    be overlapped with MPI communication
-//                               (useful only if "OverlapMPI == true")
+//                OverlapMPI   : true --> Overlap the exchange of the updated buffer data with CPU/GPU computation
+//                                          --> See Note 3 above
 //
 // Return      : GAMER_SUCCESS / GAMER_FAILED
 //               --> Mainly used for the option "AUTO_REDUCE_DT"
 //-------------------------------------------------------------------------------------------------------
 int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
-                   const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI, const bool Overlap_Sync )
+                   const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI )
 {
 
 // initialize flux_tmp[] (and electric_tmp[] in MHD) on the parent level for AUTO_REDUCE_DT
@@ -56,6 +73,12 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 #  endif
 
 
+// start recording the dt criteria in the closing steps of the fluid/gravity solvers
+#  if ( MODEL == HYDRO )
+   dt_Fused_Start( lv );
+#  endif
+
+
 // invoke the fluid solver
    FluStatus_ThisRank = GAMER_SUCCESS;
 #  if ( MODEL == ELBDM  &&  defined SUPPORT_FFTW )
@@ -65,7 +88,24 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
    }
    else
 #  endif
-   InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
+   if ( OverlapMPI )
+   {
+#     ifdef LOAD_BALANCE
+      FluOverlapArg_t Arg = { lv, TimeNew, TimeOld, dt, SaveSg_Flu, SaveSg_Mag };
+
+//    (1) patch groups with data to be sent
+      InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, true, true );
+
+//    (2) exchange the updated buffer data while advancing the remaining patch groups
+      LB_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf,
+                        Flu_AdvanceDt_Async, &Arg );
+#     else
+      Aux_Error( ERROR_INFO, "MPI overlapping is NOT supported if LOAD_BALANCE is off !!\n" );
+#     endif
+   }
+
+   else
+   InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, false, false );
 
 
 // collect the fluid solver status from all ranks (only necessary for AUTO_REDUCE_DT)
@@ -98,3 +138,26 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
    return FluStatus_AllRank;
 
 } // FUNCTION : Flu_AdvanceDt
+
+
+
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_AdvanceDt_Async
+// Description :  Advance the patch groups with no data to be sent to other ranks
+//
+// Note        :  1. Invoked by LB_GetBufferData() after posting the non-blocking MPI requests
+//                2. These patch groups do not access the buffer data at SaveSg_Flu/Mag being transferred
+//
+// Parameter   :  Arg : Pointer to FluOverlapArg_t storing the arguments of Flu_AdvanceDt()
+//-------------------------------------------------------------------------------------------------------
+void Flu_AdvanceDt_Async( void *Arg )
+{
+
+   const FluOverlapArg_t *FluArg = (FluOverlapArg_t*)Arg;
+
+   InvokeSolver( FLUID_SOLVER, FluArg->lv, FluArg->TimeNew, FluArg->TimeOld, FluArg->dt, NULL_REAL,
+                 FluArg->SaveSg_Flu, FluArg->SaveSg_Mag, NULL_INT, true, false );
+
+} // FUNCTION : Flu_AdvanceDt_Async
+#endif // #ifdef LOAD_BALANCE
@@ -65,6 +65,9 @@ extern void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
 //                4. Get the minimum time-step information of the fluid solver
+//                   --> For OPT__DT_FUSED only, and only when GRAVITY is off since otherwise Gra_Close()
+//                       will update the fluid again
+//                   --> See dt_Fused_Start()
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -130,7 +133,14 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 #     error : ERROR : FLU_NOUT != NCOMP_TOTAL (one must specify how to copy data from h_Flu_Array_F_Out to fluid) !!
 #  endif
 
-#  pragma omp parallel for schedule( static )
+#  if ( MODEL == HYDRO  &&  !defined GRAVITY )
+   const bool FusedDt = OPT__DT_FUSED;
+#  else
+   const bool FusedDt = false;
+#  endif
+   real dt_min = HUGE_NUMBER;
+
+#  pragma omp parallel for reduction( min:dt_min ) schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       const int PID0 = PID0_List[TID];
@@ -214,8 +224,19 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 #        endif // #ifdef MHD
 
       } // for (int LocalID=0; LocalID<8; LocalID++)
+
+//    estimate the fluid dt while the updated data are still in cache
+#     if ( MODEL == HYDRO )
+      if ( FusedDt )    dt_min = FMIN( dt_min, dt_Fused_Flu(lv, SaveSg_Flu, SaveSg_Mag, PID0) );
+#     endif
    } // for (int TID=0; TID<NPG; TID++)
 
+
+// record the minimum fluid dt
+#  if ( MODEL == HYDRO )
+   if ( FusedDt )    dt_Fused_Record( DT_FLU_SOLVER, lv, dt_min );
+#  endif
+
 } // FUNCTION : Flu_Close
 
 
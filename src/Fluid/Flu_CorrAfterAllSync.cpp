@@ -48,6 +48,12 @@ void Flu_CorrAfterAllSync()
       Aux_Message( stdout, "   %s                     ...\n", __FUNCTION__ );
 
 
+// discard the dt recorded for OPT__DT_FUSED since the fluid data are going to be corrected
+#  if ( MODEL == HYDRO )
+   dt_Fused_Invalidate( -1 );
+#  endif
+
+
 // 1. synchronize all particles
 #  if ( defined PARTICLE  &&  defined STORE_PAR_ACC )
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
@@ -118,7 +124,7 @@ void Flu_CorrAfterAllSync()
       if ( lv > 0 )
       Buf_GetBufferData( lv, amr->FluSg[lv], NULL_INT, NULL_INT, DATA_GENERAL, _DENS, _NONE, Rho_ParaBuf, USELB_YES );
 
-      Gra_AdvanceDt( lv, Time[lv], NULL_REAL, NULL_REAL, NULL_INT, amr->PotSg[lv], true, false, false, false, false );
+      Gra_AdvanceDt( lv, Time[lv], NULL_REAL, NULL_REAL, NULL_INT, amr->PotSg[lv], true, false, false, false );
 
       if ( lv > 0 )
       Buf_GetBufferData( lv, NULL_INT, NULL_INT, amr->PotSg[lv], POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
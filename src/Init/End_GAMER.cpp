@@ -17,7 +17,14 @@ void End_GAMER()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// complete the background drain of the last node-local checkpoint
+#  ifdef SUPPORT_HDF5
+   if ( OPT__OUTPUT_NODE_LOCAL )    Output_NodeLocal_WaitDrain();
+#  endif
+
 #  ifdef TIMING
+   Aux_DeleteTrace();
+
    Aux_DeleteTimer();
 #  endif
 
@@ -60,6 +67,10 @@ void End_GAMER()
       Aux_Message( stdout, "\n\n~ GAME OVER ~\n\n\n" );
    }
 
+#  ifndef SERIAL
+   MPI_End_NodeAware();
+#  endif
+
    MPI_Finalize();
 
    exit( 0 );
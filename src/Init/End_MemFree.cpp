@@ -98,6 +98,12 @@ void End_MemFree()
    delete GlobalTree;   GlobalTree = NULL;
 
 
+// 11. arrays for OPT__DT_FUSED
+#  if ( MODEL == HYDRO )
+   dt_Fused_MemFree();
+#  endif
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
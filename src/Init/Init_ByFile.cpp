@@ -1,5 +1,8 @@
 #include "GAMER.h"
 
+// maximum number of bytes loaded by each reader rank per round in Init_ByFile_AssignData()
+#define UM_IC_ROUND_SIZE   ( 1L << 28 )
+
 // declare as static so that other functions cannot invoke it directly and must use the function pointer
 static void Init_ByFile_Default( real fluid_out[], const real fluid_in[], const int nvar_in,
                                  const double x, const double y, const double z, const double Time,
@@ -13,6 +16,8 @@ void (*Init_ByFile_User_Ptr)( real fluid_out[], const real fluid_in[], const int
 static void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const int UM_lv0, const int UM_NVar,
                                     const int UM_LoadNRank, const UM_IC_Format_t UM_Format, const long UM_Size3D[][3],
                                     const int FlagPatch[][6] );
+static void Init_ByFile_AssignPatchGroup( const char *PG_Data, const int UM_lv, const int PID0, const int UM_NVar,
+                                          const UM_IC_Format_t UM_Format, const size_t load_data_size );
 static void Load_RefineRegion( const char Filename[] );
 static void Flag_RefineRegion( const int lv, const int FlagPatch[6] );
 
@@ -465,6 +470,14 @@ void Init_ByFile()
 // Note        :  1. The function pointer Init_ByFile_User_Ptr() points to Init_ByFile_Default() by default
 //                   but may be overwritten by various test problem initializers
 //                2. Can be applied to levels OPT__UM_IC_LEVEL ~ OPT__UM_IC_LEVEL+OPT__UM_IC_NLEVEL-1
+//                3. Only UM_LoadNRank ranks (i.e., the reader ranks) access the file
+//                   --> The file is divided into rows of patch groups along x (i.e., PS2 cells along y and z
+//                       and the entire file along x), and each reader loads a contiguous range of rows
+//                   --> Each reader loads at most UM_IC_ROUND_SIZE bytes per round using one fread() call
+//                       per row, variable, and z plane (or one fread() per row and z plane for UM_IC_FORMAT_ZYXV)
+//                   --> The loaded patch groups are sent to their home ranks by MPI_Alltoallv_GAMER()
+//                4. Reader ranks are evenly distributed among all ranks, which typically places them
+//                   on different nodes
 //
 // Parameter   :  UM_Filename  : Target file name
 //                UM_lv        : Target AMR level --> OPT__UM_IC_LEVEL ~ OPT__UM_IC_LEVEL+OPT__UM_IC_NLEVEL-1
@@ -492,21 +505,25 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
 // check
    if ( Init_ByFile_User_Ptr == NULL )  Aux_Error( ERROR_INFO, "Init_ByFile_User_Ptr == NULL !!\n" );
 
+   if ( UM_LoadNRank <= 0 )   Aux_Error( ERROR_INFO, "UM_LoadNRank (%d) <= 0 !!\n", UM_LoadNRank );
+
 
    const int    dlv         = UM_lv - UM_lv0;
    const long   UM_Size1v   = UM_Size3D[dlv][0]*UM_Size3D[dlv][1]*UM_Size3D[dlv][2];
    const int    NVarPerLoad = ( UM_Format == UM_IC_FORMAT_ZYXV ) ? UM_NVar : 1;
    const int    scale       = amr->scale[UM_lv];
-   const double dh          = amr->dh[UM_lv];
+   const int    NReader     = MIN( UM_LoadNRank, MPI_NRank );
+   const int    NPG_ThisRank= amr->NPatchComma[UM_lv][1] / 8;
+   const long   NPG_File[3] = { UM_Size3D[dlv][0]/PS2, UM_Size3D[dlv][1]/PS2, UM_Size3D[dlv][2]/PS2 };
+   const long   NRow        = NPG_File[1]*NPG_File[2];
 
-   long   Offset3D_File0[3], Offset_File0, Offset_File, Offset_PG, Offset_lv;
-   real   fluid_in[UM_NVar], fluid_out[NCOMP_TOTAL];
-   double x, y, z;
+   long   Offset3D_PG[3], Offset_lv;
 
 
-// determine the load_data_size and allocate buffer for loading UM_IC
+// determine the load_data_size
    size_t load_data_size = ( OPT__UM_IC_FLOAT8 ) ? sizeof(double) : sizeof(float);
-   char*  PG_Data        = new char [ CUBE(PS2)*UM_NVar*load_data_size ];
+   const long PG_Size    = (long)CUBE(PS2)*UM_NVar*load_data_size;
+   const long Row_Size   = PG_Size*NPG_File[0];
 
 
 // calculate the file offset of the target level
@@ -515,106 +532,259 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
       Offset_lv += long(UM_NVar)*UM_Size3D[t][0]*UM_Size3D[t][1]*UM_Size3D[t][2]*load_data_size;
 
 
-// load data with UM_LoadNRank ranks at a time
-   for (int TRank0=0; TRank0<MPI_NRank; TRank0+=UM_LoadNRank)
+// set the range of rows loaded by each reader and the number of rounds
+// --> reader "r" loads rows RowStart[r] ~ RowStart[r+1]-1 and its rank is ReaderRank[r]
+   long RowStart[NReader+1], NRowMax=0;
+   int  ReaderRank[NReader], ThisReader=-1;
+
+   for (int r=0; r<=NReader; r++)   RowStart  [r] = r*NRow/NReader;
+   for (int r=0; r< NReader; r++)   ReaderRank[r] = (int)( (long)r*MPI_NRank/NReader );
+   for (int r=0; r< NReader; r++)
+   {
+      NRowMax = MAX( NRowMax, RowStart[r+1]-RowStart[r] );
+      if ( ReaderRank[r] == MPI_Rank )    ThisReader = r;
+   }
+
+   const long NRowPerRound = MIN(  MAX( UM_IC_ROUND_SIZE/Row_Size, 1L ), MAX( NRowMax, 1L )  );
+   const long NRound       = ( NRowMax + NRowPerRound - 1 ) / NRowPerRound;
+
+
+// 1. record the file indices of all patch groups in this rank sorted by their file indices
+//    --> the data received from each reader will follow the same order
+   long *PG_FileIdx  = new long [NPG_ThisRank];
+   int  *PG_IdxTable = new int  [NPG_ThisRank];
+   int  *PG_Reader   = new int  [NPG_ThisRank];
+   long *PG_Round    = new long [NPG_ThisRank];
+
+   for (int t=0; t<NPG_ThisRank; t++)
+   {
+      for (int d=0; d<3; d++)
+      {
+         Offset3D_PG[d] = amr->patch[0][UM_lv][8*t]->corner[d] / scale;
+
+         if ( dlv > 0 )    Offset3D_PG[d] -= FlagPatch[dlv-1][2*d]*PS2;
+
+         if ( Offset3D_PG[d] < 0  ||  Offset3D_PG[d] >= UM_Size3D[dlv][d] )
+            Aux_Error( ERROR_INFO, "Offset3D_PG[%d] = %ld lies outside the file (size %ld) !!\n",
+                       d, Offset3D_PG[d], UM_Size3D[dlv][d] );
+      }
+
+      PG_FileIdx[t] = IDX321( Offset3D_PG[0]/PS2, Offset3D_PG[1]/PS2, Offset3D_PG[2]/PS2, NPG_File[0], NPG_File[1] );
+   }
+
+   Mis_Heapsort( NPG_ThisRank, PG_FileIdx, PG_IdxTable );
+
+   for (int t=0; t<NPG_ThisRank; t++)
    {
-      if ( MPI_Rank >= TRank0  &&  MPI_Rank < TRank0+UM_LoadNRank )
+      const long Row = PG_FileIdx[t] / NPG_File[0];
+
+      PG_Reader[t] = (int)(  ( (Row+1)*NReader - 1 ) / NRow  );
+      PG_Round [t] = ( Row - RowStart[ PG_Reader[t] ] ) / NRowPerRound;
+   }
+
+// group patch groups by rounds while preserving their order
+// --> patch groups PG_ByRound[ PG_RoundStart[Round] ~ PG_RoundStart[Round+1]-1 ] are received in round "Round"
+   long *PG_RoundStart = new long [NRound+1];
+   int  *PG_ByRound    = new int  [NPG_ThisRank];
+
+   for (long Round=0; Round<=NRound; Round++)   PG_RoundStart[Round] = 0;
+   for (int t=0; t<NPG_ThisRank; t++)           PG_RoundStart[ PG_Round[t]+1 ] ++;
+   for (long Round=0; Round<NRound; Round++)    PG_RoundStart[Round+1] += PG_RoundStart[Round];
+   for (int t=0; t<NPG_ThisRank; t++)           PG_ByRound[ PG_RoundStart[ PG_Round[t] ]++ ] = t;
+   for (long Round=NRound; Round>0; Round--)    PG_RoundStart[Round] = PG_RoundStart[Round-1];
+   PG_RoundStart[0] = 0;
+
+
+// 2. send the requested patch-group indices to the readers
+   int  *Req_NSend   = new int  [MPI_NRank];
+   int  *Req_NRecv   = new int  [MPI_NRank];
+   long *Req_NSend_L = new long [MPI_NRank];
+   long *Req_NRecv_L = new long [MPI_NRank];
+   long *Req_DispS   = new long [MPI_NRank];
+   long *Req_DispR   = new long [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Req_NSend[r] = 0;
+   for (int t=0; t<NPG_ThisRank; t++)  Req_NSend[ ReaderRank[ PG_Reader[t] ] ] ++;
+
+   MPI_Alltoall( Req_NSend, 1, MPI_INT, Req_NRecv, 1, MPI_INT, MPI_COMM_WORLD );
+
+   Req_DispS[0] = 0;
+   Req_DispR[0] = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Req_NSend_L[r] = Req_NSend[r];
+      Req_NRecv_L[r] = Req_NRecv[r];
+      if ( r > 0 )
       {
-         if ( MPI_Rank == TRank0 )  Aux_Message( stdout, "      Loading ranks %4d -- %4d ... ",
-                                                 TRank0, MIN(TRank0+UM_LoadNRank-1, MPI_NRank-1) );
+         Req_DispS[r] = Req_DispS[r-1] + Req_NSend_L[r-1];
+         Req_DispR[r] = Req_DispR[r-1] + Req_NRecv_L[r-1];
+      }
+   }
+
+   const long NReq = Req_DispR[MPI_NRank-1] + Req_NRecv_L[MPI_NRank-1];
+   long *Req_FileIdx = new long [NReq];
+
+// PG_FileIdx[] is sorted and readers are arranged in an ascending order of rank
+// --> the requests sent to each reader are already contiguous in PG_FileIdx[]
+   MPI_Alltoallv_GAMER( PG_FileIdx, Req_NSend_L, Req_DispS, MPI_LONG,
+                        Req_FileIdx, Req_NRecv_L, Req_DispR, MPI_LONG, MPI_COMM_WORLD );
+
+
+// 3. load and distribute data one round at a time
+   long *Data_NSend = new long [MPI_NRank];
+   long *Data_NRecv = new long [MPI_NRank];
+   long *Data_DispS = new long [MPI_NRank];
+   long *Data_DispR = new long [MPI_NRank];
+   long *Req_Next   = new long [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Req_Next[r] = Req_DispR[r];
 
-         FILE *File = fopen( UM_Filename, "rb" );
+   char *Row_Data  = ( ThisReader >= 0 ) ? new char [ NRowPerRound*Row_Size ] : NULL;
+   char *Send_Data = ( ThisReader >= 0 ) ? new char [ NRowPerRound*Row_Size ] : NULL;
+   char *Recv_Data = new char [ MAX( (long)NPG_ThisRank, 1L )*PG_Size ];
+
+   FILE *File = ( ThisReader >= 0 ) ? fopen( UM_Filename, "rb" ) : NULL;
+
+   for (long Round=0; Round<NRound; Round++)
+   {
+      long NSendPG = 0;
+
+//    3-1. load data from the disk (readers only)
+      if ( ThisReader >= 0 )
+      {
+         const long Row0 = RowStart[ThisReader] + Round*NRowPerRound;
+         const long Row1 = MIN( Row0+NRowPerRound, RowStart[ThisReader+1] );
 
-//       load one patch group at a time
-         for (int PID0=0; PID0<amr->NPatchComma[UM_lv][1]; PID0+=8)
+//       Row_Data[] stores each row as [v][z][y][x] (or [z][y][x][v] for UM_IC_FORMAT_ZYXV)
+//       --> each fread() loads PS2 entire x-y rows of the file
+         for (long Row=Row0; Row<Row1; Row++)
          {
-//          calculate Offset_File0, which is the file offset of the target patch group relative to Offset_lv
-            for (int d=0; d<3; d++)    Offset3D_File0[d] = amr->patch[0][UM_lv][PID0]->corner[d] / scale;
+            const long  j0      = ( Row % NPG_File[1] )*PS2;
+            const long  k0      = ( Row / NPG_File[1] )*PS2;
+            const long  NLoad   = (long)NVarPerLoad*PS2*UM_Size3D[dlv][0];
+                  char *RowPtr  = Row_Data + ( Row - Row0 )*Row_Size;
 
-            if ( dlv > 0 )
-            for (int d=0; d<3; d++)
+            for (int v=0; v<UM_NVar; v+=NVarPerLoad)
+            for (int k=0; k<PS2; k++)
             {
-               Offset3D_File0[d] -= FlagPatch[dlv-1][2*d]*PS2;
+               const long Offset_File = Offset_lv
+                                        + (long)NVarPerLoad*load_data_size*( ((k0+k)*UM_Size3D[dlv][1] + j0)*UM_Size3D[dlv][0] )
+                                        + v*UM_Size1v*load_data_size;
 
-               if ( Offset3D_File0[d] < 0 )
-                  Aux_Error( ERROR_INFO, "Offset3D_File0[%d] = %ld < 0 !!\n", d, Offset3D_File0[d] );
+               fseek( File, Offset_File, SEEK_SET );
+
+               if ( fread( RowPtr, load_data_size, NLoad, File ) != (size_t)NLoad )
+                  Aux_Error( ERROR_INFO, "fail to load data from the file \"%s\" !!\n", UM_Filename );
+
+               RowPtr += NLoad*load_data_size;
             }
+         } // for (long Row=Row0; Row<Row1; Row++)
+
 
-            Offset_File0  = IDX321( Offset3D_File0[0], Offset3D_File0[1], Offset3D_File0[2],
-                                    UM_Size3D[dlv][0], UM_Size3D[dlv][1] );
-            Offset_File0 *= (long)NVarPerLoad*load_data_size;
+//       3-2. collect the patch groups requested by each rank in this round
+//            --> stored as [v][k][j][i] (or [k][j][i][v] for UM_IC_FORMAT_ZYXV) for each patch group
+         const long NxRow = (long)NVarPerLoad*UM_Size3D[dlv][0];
 
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            const long ReqEnd = Req_DispR[r] + Req_NRecv_L[r];
 
-//          load data from the disk (one row at a time)
-            Offset_PG = 0;
+            Data_NSend[r] = 0;
+            Data_DispS[r] = NSendPG*PG_Size;
 
-            for (int v=0; v<UM_NVar; v+=NVarPerLoad )
+            for ( ; Req_Next[r]<ReqEnd; Req_Next[r]++)
             {
+               const long Row = Req_FileIdx[ Req_Next[r] ] / NPG_File[0];
+
+               if ( Row >= Row1 )   break;
+
+               const long  i0     = ( Req_FileIdx[ Req_Next[r] ] % NPG_File[0] )*PS2;
+               const char *RowPtr = Row_Data + ( Row - Row0 )*Row_Size;
+                     char *PG_Ptr = Send_Data + NSendPG*PG_Size;
+
+               for (int v=0; v<UM_NVar; v+=NVarPerLoad)
                for (int k=0; k<PS2; k++)
                for (int j=0; j<PS2; j++)
                {
-                  Offset_File = Offset_lv + Offset_File0
-                                + (long)NVarPerLoad*load_data_size*( ((long)k*UM_Size3D[dlv][1] + j)*UM_Size3D[dlv][0] )
-                                + v*UM_Size1v*load_data_size;
-
-                  fseek( File, Offset_File, SEEK_SET );
-                  fread( PG_Data+Offset_PG, load_data_size, NVarPerLoad*PS2, File );
+                  const long Offset_Row = ( ((long)v/NVarPerLoad*PS2 + k)*PS2 + j )*NxRow + NVarPerLoad*i0;
 
-//                verify that the file size is not exceeded
-                  if ( feof(File) )   Aux_Error( ERROR_INFO, "reaching the end of the file \"%s\" !!\n", UM_Filename );
+                  memcpy( PG_Ptr, RowPtr + Offset_Row*load_data_size, NVarPerLoad*PS2*load_data_size );
 
-                  Offset_PG += NVarPerLoad*PS2*load_data_size;
+                  PG_Ptr += NVarPerLoad*PS2*load_data_size;
                }
+
+               NSendPG ++;
+               Data_NSend[r] += PG_Size;
             }
+         } // for (int r=0; r<MPI_NRank; r++)
+      } // if ( ThisReader >= 0 )
 
+      else
+      {
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            Data_NSend[r] = 0;
+            Data_DispS[r] = 0;
+         }
+      }
 
-//          copy data to each patch
-            for (int LocalID=0; LocalID<8; LocalID++)
-            {
-               const int PID    = PID0 + LocalID;
-               const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
-               const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
-               const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
 
-               for (int k=0; k<PS1; k++)  {  z = amr->patch[0][UM_lv][PID]->EdgeL[2] + (k+0.5)*dh;
-               for (int j=0; j<PS1; j++)  {  y = amr->patch[0][UM_lv][PID]->EdgeL[1] + (j+0.5)*dh;
-               for (int i=0; i<PS1; i++)  {  x = amr->patch[0][UM_lv][PID]->EdgeL[0] + (i+0.5)*dh;
+//    3-3. set the number of bytes received from each reader in this round
+      for (int r=0; r<MPI_NRank; r++)  Data_NRecv[r] = 0;
 
-                  Offset_PG = (long)NVarPerLoad*IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS2, PS2 )*load_data_size;
+      for (long p=PG_RoundStart[Round]; p<PG_RoundStart[Round+1]; p++)
+         Data_NRecv[ ReaderRank[ PG_Reader[ PG_ByRound[p] ] ] ] += PG_Size;
 
-                  if ( UM_Format == UM_IC_FORMAT_ZYXV )
-                  {
-                     if ( OPT__UM_IC_FLOAT8 )
-                        for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((double*)( PG_Data + Offset_PG + v*load_data_size )) ) ;
-                     else
-                        for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((float* )( PG_Data + Offset_PG + v*load_data_size )) ) ;
-                  }
+      Data_DispR[0] = 0;
+      for (int r=1; r<MPI_NRank; r++)  Data_DispR[r] = Data_DispR[r-1] + Data_NRecv[r-1];
 
-                  else
-                  {
-                     if ( OPT__UM_IC_FLOAT8 )
-                        for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((double*)( PG_Data + Offset_PG + v*CUBE(PS2)*load_data_size )) );
-                     else
-                        for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((float* )( PG_Data + Offset_PG + v*CUBE(PS2)*load_data_size )) );
-                  }
 
-                  Init_ByFile_User_Ptr( fluid_out, fluid_in, UM_NVar, x, y, z, Time[UM_lv], UM_lv, NULL );
+//    3-4. send data to their home ranks
+      MPI_Alltoallv_GAMER( Send_Data, Data_NSend, Data_DispS, MPI_BYTE,
+                           Recv_Data, Data_NRecv, Data_DispR, MPI_BYTE, MPI_COMM_WORLD );
 
-                  for (int v=0; v<NCOMP_TOTAL; v++)
-                     amr->patch[ amr->FluSg[UM_lv] ][UM_lv][PID]->fluid[v][k][j][i] = fluid_out[v];
-               }}}
-            } // for (int LocalID=0; LocalID<8; LocalID++)
-         } // for (int PID0=0; PID0<amr->NPatchComma[UM_lv][1]; PID0+=8)
 
-         fclose( File );
+//    3-5. assign data to each patch
+//    --> patch groups received from the same reader are sorted by their file indices
+      for (long p=PG_RoundStart[Round]; p<PG_RoundStart[Round+1]; p++)
+      {
+         const int  t      = PG_ByRound[p];
+         const int  Reader = ReaderRank[ PG_Reader[t] ];
+         const long Offset = Data_DispR[Reader];
 
-         if ( MPI_Rank == TRank0 )  Aux_Message( stdout, "done\n" );
-      } // if ( MPI_Rank >= TRank0  &&  MPI_Rank < TRank0+UM_LoadNRank )
+         Data_DispR[Reader] += PG_Size;
 
-      MPI_Barrier( MPI_COMM_WORLD );
-   } // for (int TRank0=0; TRank0<MPI_NRank; TRank0+=UM_LoadNRank)
+         Init_ByFile_AssignPatchGroup( Recv_Data+Offset, UM_lv, 8*PG_IdxTable[t], UM_NVar, UM_Format, load_data_size );
+      }
 
-   delete [] PG_Data;
+      if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+         Aux_Message( stdout, "         Round %6ld/%6ld ... done\n", Round+1, NRound );
+   } // for (long Round=0; Round<NRound; Round++)
+
+   if ( File != NULL )  fclose( File );
+
+
+   delete [] PG_FileIdx;
+   delete [] PG_IdxTable;
+   delete [] PG_Reader;
+   delete [] PG_Round;
+   delete [] PG_RoundStart;
+   delete [] PG_ByRound;
+   delete [] Req_NSend;
+   delete [] Req_NRecv;
+   delete [] Req_NSend_L;
+   delete [] Req_NRecv_L;
+   delete [] Req_DispS;
+   delete [] Req_DispR;
+   delete [] Req_FileIdx;
+   delete [] Data_NSend;
+   delete [] Data_NRecv;
+   delete [] Data_DispS;
+   delete [] Data_DispR;
+   delete [] Req_Next;
+   delete [] Row_Data;
+   delete [] Send_Data;
+   delete [] Recv_Data;
 
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "      Loading data from the input file on level %d ... done\n", UM_lv );
@@ -623,6 +793,73 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ByFile_AssignPatchGroup
+// Description :  Assign data to the eight patches of a patch group using the loaded uniform-mesh data
+//
+// Note        :  1. Invoked by Init_ByFile_AssignData()
+//
+// Parameter   :  PG_Data        : Uniform-mesh data of the target patch group
+//                                 --> [v][k][j][i] for UM_IC_FORMAT_VZYX and [k][j][i][v] for UM_IC_FORMAT_ZYXV
+//                UM_lv          : Target AMR level
+//                PID0           : Patch ID of the first patch in the target patch group
+//                UM_NVar        : Number of variables
+//                UM_Format      : Data format of PG_Data
+//                load_data_size : Size of each element in PG_Data
+//
+// Return      :  amr->patch->fluid
+//-------------------------------------------------------------------------------------------------------
+void Init_ByFile_AssignPatchGroup( const char *PG_Data, const int UM_lv, const int PID0, const int UM_NVar,
+                                   const UM_IC_Format_t UM_Format, const size_t load_data_size )
+{
+
+   const int    NVarPerLoad = ( UM_Format == UM_IC_FORMAT_ZYXV ) ? UM_NVar : 1;
+   const double dh          = amr->dh[UM_lv];
+
+   long   Offset_PG;
+   real   fluid_in[UM_NVar], fluid_out[NCOMP_TOTAL];
+   double x, y, z;
+
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int PID    = PID0 + LocalID;
+      const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
+      const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
+      const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+
+      for (int k=0; k<PS1; k++)  {  z = amr->patch[0][UM_lv][PID]->EdgeL[2] + (k+0.5)*dh;
+      for (int j=0; j<PS1; j++)  {  y = amr->patch[0][UM_lv][PID]->EdgeL[1] + (j+0.5)*dh;
+      for (int i=0; i<PS1; i++)  {  x = amr->patch[0][UM_lv][PID]->EdgeL[0] + (i+0.5)*dh;
+
+         Offset_PG = (long)NVarPerLoad*IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS2, PS2 )*load_data_size;
+
+         if ( UM_Format == UM_IC_FORMAT_ZYXV )
+         {
+            if ( OPT__UM_IC_FLOAT8 )
+               for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((double*)( PG_Data + Offset_PG + v*load_data_size )) ) ;
+            else
+               for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((float* )( PG_Data + Offset_PG + v*load_data_size )) ) ;
+         }
+
+         else
+         {
+            if ( OPT__UM_IC_FLOAT8 )
+               for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((double*)( PG_Data + Offset_PG + v*CUBE(PS2)*load_data_size )) );
+            else
+               for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( *((float* )( PG_Data + Offset_PG + v*CUBE(PS2)*load_data_size )) );
+         }
+
+         Init_ByFile_User_Ptr( fluid_out, fluid_in, UM_NVar, x, y, z, Time[UM_lv], UM_lv, NULL );
+
+         for (int v=0; v<NCOMP_TOTAL; v++)
+            amr->patch[ amr->FluSg[UM_lv] ][UM_lv][PID]->fluid[v][k][j][i] = fluid_out[v];
+      }}}
+   } // for (int LocalID=0; LocalID<8; LocalID++)
+
+} // FUNCTION : Init_ByFile_AssignPatchGroup
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_ByFile_Default
 // Description :  Function to actually set the fluid field from the input uniform-mesh array
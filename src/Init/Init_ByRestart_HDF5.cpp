@@ -3,6 +3,7 @@
 #include "GAMER.h"
 #include "HDF5_Typedef.h"
 #include <typeinfo>
+#include <limits.h>
 
 void FillIn_Makefile (  Makefile_t &Makefile  );
 void FillIn_SymConst (  SymConst_t &SymConst  );
@@ -24,6 +25,10 @@ static void Check_Makefile ( const char *FileName, const int FormatVersion );
 static void Check_SymConst ( const char *FileName, const int FormatVersion );
 static void Check_InputPara( const char *FileName, const int FormatVersion );
 static void ResetParameter( const char *FileName, double *EndT, long *EndStep );
+static void RecordRealPatch();
+#ifdef LOAD_BALANCE
+static void LoadPiece_NodeLocal( const char *FileName, const int FormatVersion );
+#endif
 
 
 
@@ -35,17 +40,22 @@ static void ResetParameter( const char *FileName, double *EndT, long *EndStep );
 // Note        :  1. This function will be invoked by "Init_ByRestart" automatically if the restart file
 //                   is in the HDF5 format
 //                2. Only work for format version >= 2100 (PARTICLE only works for version >= 2200)
+//                3. For NodeLocal == true, FileName is the piece of this rank written by Output_DumpData_NodeLocal()
+//                   --> Invoked by Init_ByRestart_NodeLocal()
+//                   --> Each rank loads its own patches and particles directly without reading the global tree
 //
-// Parameter   :  FileName : Target file name
+// Parameter   :  FileName  : Target file name
+//                NodeLocal : Load the pieces of a node-local checkpoint
 //-------------------------------------------------------------------------------------------------------
-void Init_ByRestart_HDF5( const char *FileName )
+void Init_ByRestart_HDF5( const char *FileName, const bool NodeLocal )
 {
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
 // check
-   if ( MPI_Rank == 0 )
+// --> every rank has its own file for node-local checkpoints
+   if ( MPI_Rank == 0  ||  NodeLocal )
    {
       if ( !Aux_CheckFileExist(FileName) )
          Aux_Error( ERROR_INFO, "restart HDF5 file \"%s\" does not exist !!\n", FileName );
@@ -330,8 +340,9 @@ void Init_ByRestart_HDF5( const char *FileName )
 
 
 // 1-8. set the next dump ID
+// --> node-local checkpoints are not snapshots and their KeyInfo.DumpID already records the next dump ID
    if ( INIT_DUMPID < 0 )
-      DumpID = ( OPT__RESTART_RESET ) ? 0 : KeyInfo.DumpID + 1;
+      DumpID = ( OPT__RESTART_RESET ) ? 0 : ( NodeLocal ) ? KeyInfo.DumpID : KeyInfo.DumpID + 1;
    else
       DumpID = INIT_DUMPID;
 
@@ -364,6 +375,54 @@ void Init_ByRestart_HDF5( const char *FileName )
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading simulation information ... done\n" );
 
 
+// 1-12. load the piece of a node-local checkpoint and skip steps 2-4
+//       --> patches are not redistributed, so the load-balance weighting of particles is taken into account
+//           in step 5-1 as usual
+#  ifdef LOAD_BALANCE
+   if ( NodeLocal )
+   {
+      if ( KeyInfo.NLevel != NLEVEL )
+         Aux_Error( ERROR_INFO, "node-local checkpoints do not support changing NLEVEL (%d -> %d) !!\n",
+                    KeyInfo.NLevel, NLEVEL );
+#     ifdef PARTICLE
+      if ( ReenablePar )
+         Aux_Error( ERROR_INFO, "node-local checkpoints do not support enabling PARTICLE !!\n" );
+#     endif
+
+      LoadPiece_NodeLocal( FileName, KeyInfo.FormatVersion );
+
+      free( KeyInfo.CodeVersion );
+      free( KeyInfo.DumpWallTime );
+      free( KeyInfo.GitBranch );
+      free( KeyInfo.GitCommit );
+
+//    see step 5-1 for details
+      const double ParWeight_Zero    = 0.0;
+      const bool   Redistribute_Yes  = true;
+      const bool   Redistribute_No   = false;
+      const bool   SendGridData_Yes  = true;
+      const bool   SendGridData_No   = false;
+      const bool   ResetLB_Yes       = true;
+      const bool   ResetLB_No        = false;
+      const int    AllLv             = -1;
+
+      LB_Init_LoadBalance( Redistribute_No,  SendGridData_No,  ParWeight_Zero,      ResetLB_No,  OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+
+#     ifdef PARTICLE
+      if ( amr->LB->Par_Weight > 0.0 )
+      LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, amr->LB->Par_Weight, ResetLB_Yes, OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+#     endif
+
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+      return;
+   } // if ( NodeLocal )
+#  else
+   if ( NodeLocal )
+      Aux_Error( ERROR_INFO, "node-local checkpoints only support LOAD_BALANCE !!\n" );
+#  endif // #ifdef LOAD_BALANCE ... else ...
+
+
 
 // 2. load the tree information (load-balance indices, corner, son, ... etc) of all patches (by all ranks)
    H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
@@ -924,26 +983,7 @@ void Init_ByRestart_HDF5( const char *FileName )
 
 
 // 3-5. record the number of real patches (and LB_IdxList_Real)
-   for (int lv=0; lv<NLEVEL; lv++)
-   {
-      for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = amr->num[lv];
-
-#     ifdef LOAD_BALANCE
-      if ( amr->LB->IdxList_Real         [lv] != NULL )   delete [] amr->LB->IdxList_Real         [lv];
-      if ( amr->LB->IdxList_Real_IdxTable[lv] != NULL )   delete [] amr->LB->IdxList_Real_IdxTable[lv];
-
-      amr->LB->IdxList_Real         [lv] = new long [ amr->NPatchComma[lv][1] ];
-      amr->LB->IdxList_Real_IdxTable[lv] = new int  [ amr->NPatchComma[lv][1] ];
-
-      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-         amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
-
-      Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
-#     endif
-
-//    get the total number of real patches at all ranks
-      Mis_GetTotalPatchNumber( lv );
-   }
+   RecordRealPatch();
 
 
 // 3-6. verify that all patches and particles are loaded
@@ -1529,6 +1569,433 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RecordRealPatch
+// Description :  Record the number of real patches (and LB_IdxList_Real) after loading all patches
+//
+// Note        :  1. Invoked by Init_ByRestart_HDF5() and LoadPiece_NodeLocal()
+//-------------------------------------------------------------------------------------------------------
+void RecordRealPatch()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = amr->num[lv];
+
+#     ifdef LOAD_BALANCE
+      if ( amr->LB->IdxList_Real         [lv] != NULL )   delete [] amr->LB->IdxList_Real         [lv];
+      if ( amr->LB->IdxList_Real_IdxTable[lv] != NULL )   delete [] amr->LB->IdxList_Real_IdxTable[lv];
+
+      amr->LB->IdxList_Real         [lv] = new long [ amr->NPatchComma[lv][1] ];
+      amr->LB->IdxList_Real_IdxTable[lv] = new int  [ amr->NPatchComma[lv][1] ];
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+      Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+#     endif
+
+//    get the total number of real patches at all ranks
+      Mis_GetTotalPatchNumber( lv );
+   }
+
+} // FUNCTION : RecordRealPatch
+
+
+
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadPiece_NodeLocal
+// Description :  Load all patches and particles of this rank from the piece of a node-local checkpoint
+//
+// Note        :  1. Invoked by Init_ByRestart_HDF5() after loading the simulation information
+//                2. Patches are stored in the order of level and then PID (see Output_DumpData_NodeLocal())
+//                   --> Patch index in each dataset is a local index and is passed to LoadOnePatch() as GID
+//                3. Load-balance cut points are restored from the piece so that all patches remain in the
+//                   same rank
+//                   --> Number of MPI ranks must be the same as the run writing the checkpoint
+//                4. Load data with RESTART_LOAD_NRANK ranks at a time as Init_ByRestart_HDF5() since the pieces
+//                   may be loaded from a shared file system
+//
+// Parameter   :  FileName      : Name of the piece of this rank
+//                FormatVersion : HDF5 snapshot format version
+//-------------------------------------------------------------------------------------------------------
+void LoadPiece_NodeLocal( const char *FileName, const int FormatVersion )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading node-local patches and particles ...\n" );
+
+   const bool Recursive_No = false;
+
+   hid_t   H5_FileID, H5_SetID, H5_GroupID_GridData;
+   hsize_t H5_SetDims_Field[4], H5_MemDims_Field[4];
+   hid_t   H5_MemID_Field, H5_SpaceID_Field;
+   herr_t  H5_Status;
+   int     NRank, Rank, NPatchLocal[NLEVEL], NPatchLocal_AllLv;
+
+   int NCompStore = NCOMP_TOTAL;
+
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+// do not load STUB field (the hybrid scheme always stores density and phase)
+   NCompStore -= 1;
+#  endif
+
+
+// 1. load the rank layout and the tree information
+   H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+   if ( H5_FileID < 0 )
+      Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
+
+// 1-1. number of ranks and the rank of this piece
+   H5_SetID  = H5Dopen( H5_FileID, "NodeLocal/NRank", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "NodeLocal/NRank" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &NRank );
+   H5_Status = H5Dclose( H5_SetID );
+
+   H5_SetID  = H5Dopen( H5_FileID, "NodeLocal/Rank", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "NodeLocal/Rank" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &Rank );
+   H5_Status = H5Dclose( H5_SetID );
+
+   if ( NRank != MPI_NRank )
+      Aux_Error( ERROR_INFO, "number of MPI ranks in the node-local checkpoint (%d) != current (%d) !!\n",
+                 NRank, MPI_NRank );
+
+   if ( Rank != MPI_Rank )
+      Aux_Error( ERROR_INFO, "piece \"%s\" belongs to rank %d instead of %d !!\n", FileName, Rank, MPI_Rank );
+
+// 1-2. number of patches at each level
+   H5_SetID  = H5Dopen( H5_FileID, "NodeLocal/NPatch", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "NodeLocal/NPatch" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NPatchLocal );
+   H5_Status = H5Dclose( H5_SetID );
+
+   NPatchLocal_AllLv = 0;
+   for (int lv=0; lv<NLEVEL; lv++)  NPatchLocal_AllLv += NPatchLocal[lv];
+
+// 1-3. load-balance cut points
+   long *CutPoint = new long [ NLEVEL*(MPI_NRank+1) ];
+
+   H5_SetID  = H5Dopen( H5_FileID, "NodeLocal/CutPoint", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "NodeLocal/CutPoint" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, CutPoint );
+   H5_Status = H5Dclose( H5_SetID );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+      memcpy( amr->LB->CutPoint[lv], CutPoint+lv*(MPI_NRank+1), (MPI_NRank+1)*sizeof(long) );
+
+   delete [] CutPoint;
+
+// 1-4. corner and LBIdx
+   int  (*CrList)[3] = new int  [ NPatchLocal_AllLv ][3];
+   long  *LBIdxList  = new long [ NPatchLocal_AllLv ];
+
+   H5_SetID  = H5Dopen( H5_FileID, "Tree/Corner", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Corner" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, CrList );
+   H5_Status = H5Dclose( H5_SetID );
+
+   H5_SetID  = H5Dopen( H5_FileID, "Tree/LBIdx", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/LBIdx" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, LBIdxList );
+   H5_Status = H5Dclose( H5_SetID );
+
+// 1-5. number of particles in each patch
+#  ifdef PARTICLE
+   int *NParList = new int [ NPatchLocal_AllLv ];
+
+   H5_SetID  = H5Dopen( H5_FileID, "Tree/NPar", H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/NPar" );
+   H5_Status = H5Dread( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NParList );
+   H5_Status = H5Dclose( H5_SetID );
+#  endif
+
+   H5_Status = H5Fclose( H5_FileID );
+
+
+// 2. initialize the particle repository
+#  ifdef PARTICLE
+   long NParThisRank = 0, MaxNParInOnePatch = 0;
+
+   for (int t=0; t<NPatchLocal_AllLv; t++)
+   {
+      NParThisRank     += NParList[t];
+      MaxNParInOnePatch = MAX( MaxNParInOnePatch, NParList[t] );
+   }
+
+   amr->Par->InitRepo( NParThisRank, MPI_NRank );
+
+// particles will be added later by calling Par->AddOneParticle()
+   amr->Par->NPar_AcPlusInac = 0;
+   amr->Par->NPar_Active     = 0;
+
+   long *GParID_Offset = new long [ NPatchLocal_AllLv ];
+
+   if ( NPatchLocal_AllLv > 0 )  GParID_Offset[0] = 0;
+   for (int t=1; t<NPatchLocal_AllLv; t++)   GParID_Offset[t] = GParID_Offset[t-1] + NParList[t-1];
+
+   long      *NewParList = new long [MaxNParInOnePatch];
+   real_par **ParFltBuf  = NULL;
+   long_par **ParIntBuf  = NULL;
+
+   Aux_AllocateArray2D( ParFltBuf, PAR_NATT_FLT_STORED, MaxNParInOnePatch );
+   Aux_AllocateArray2D( ParIntBuf, PAR_NATT_INT_STORED, MaxNParInOnePatch );
+
+   hsize_t H5_SetDims_ParData[1];
+   hid_t   H5_SetID_ParFltData[PAR_NATT_FLT_STORED], H5_SetID_ParIntData[PAR_NATT_INT_STORED];
+   hid_t   H5_SpaceID_ParData, H5_GroupID_Particle;
+
+   H5_SetDims_ParData[0] = NParThisRank;
+   H5_SpaceID_ParData    = H5Screate_simple( 1, H5_SetDims_ParData, NULL );
+   if ( H5_SpaceID_ParData < 0 )    Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_SpaceID_ParData" );
+
+#  else
+   int       *NParList            = NULL;
+   real_par **ParFltBuf           = NULL;
+   long_par **ParIntBuf           = NULL;
+   long      *NewParList          = NULL;
+   long      *GParID_Offset       = NULL;
+   hid_t     *H5_SetID_ParFltData = NULL;
+   hid_t     *H5_SetID_ParIntData = NULL;
+   hid_t      H5_SpaceID_ParData  = NULL_INT;
+   long       NParThisRank        = NULL_INT;
+#  endif // #ifdef PARTICLE ... else ...
+
+
+// 3. initialize the HDF5 dataspaces
+   hid_t H5_SetID_Field[NCompStore];
+
+   H5_SetDims_Field[0] = NPatchLocal_AllLv;
+   H5_SetDims_Field[1] = PS1;
+   H5_SetDims_Field[2] = PS1;
+   H5_SetDims_Field[3] = PS1;
+
+   H5_SpaceID_Field = H5Screate_simple( 4, H5_SetDims_Field, NULL );
+   if ( H5_SpaceID_Field < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_SpaceID_Field" );
+
+   H5_MemDims_Field[0] = 1;
+   H5_MemDims_Field[1] = PS1;
+   H5_MemDims_Field[2] = PS1;
+   H5_MemDims_Field[3] = PS1;
+
+   H5_MemID_Field = H5Screate_simple( 4, H5_MemDims_Field, NULL );
+   if ( H5_MemID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID_Field" );
+
+#  ifdef MHD
+   hsize_t H5_SetDims_FCMag[4], H5_MemDims_FCMag[4];
+   hid_t   H5_SetID_FCMag[NCOMP_MAG], H5_MemID_FCMag[NCOMP_MAG], H5_SpaceID_FCMag[NCOMP_MAG];
+
+   for (int v=0; v<NCOMP_MAG; v++)
+   {
+      H5_SetDims_FCMag[0] = NPatchLocal_AllLv;
+      H5_MemDims_FCMag[0] = 1;
+      for (int t=1; t<4; t++)
+      {
+         H5_SetDims_FCMag[t] = ( 3-t == v ) ? PS1P1 : PS1;
+         H5_MemDims_FCMag[t] = H5_SetDims_FCMag[t];
+      }
+
+      H5_SpaceID_FCMag[v] = H5Screate_simple( 4, H5_SetDims_FCMag, NULL );
+      if ( H5_SpaceID_FCMag[v] < 0 )
+         Aux_Error( ERROR_INFO, "failed to create the space \"%s[%d]\" !!\n", "H5_SpaceID_FCMag", v );
+
+      H5_MemID_FCMag[v] = H5Screate_simple( 4, H5_MemDims_FCMag, NULL );
+      if ( H5_MemID_FCMag[v] < 0 )
+         Aux_Error( ERROR_INFO, "failed to create the space \"%s[%d]\" !!\n", "H5_MemID_FCMag", v );
+   }
+#  else
+   hid_t *H5_SetID_FCMag   = NULL;
+   hid_t *H5_MemID_FCMag   = NULL;
+   hid_t *H5_SpaceID_FCMag = NULL;
+#  endif // #ifdef MHD ... else ...
+
+
+// 4. load data with RESTART_LOAD_NRANK ranks at a time
+   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+   {
+      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      {
+//       4-1. open the target datasets just once
+         H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+         if ( H5_FileID < 0 )
+            Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
+
+         H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
+         if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+
+         for (int v=0; v<NCompStore; v++)
+         {
+            H5_SetID_Field[v] = H5Dopen( H5_GroupID_GridData, FieldLabel[v], H5P_DEFAULT );
+            if ( H5_SetID_Field[v] < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", FieldLabel[v] );
+         }
+
+#        ifdef MHD
+         for (int v=0; v<NCOMP_MAG; v++)
+         {
+            H5_SetID_FCMag[v] = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
+            if ( H5_SetID_FCMag[v] < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", MagLabel[v] );
+         }
+#        endif
+
+#        ifdef PARTICLE
+         H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
+         if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+
+         for (int v=0; v<PAR_NATT_FLT_STORED; v++)
+         {
+            H5_SetID_ParFltData[v] = H5Dopen( H5_GroupID_Particle, ParAttFltLabel[v], H5P_DEFAULT );
+            if ( H5_SetID_ParFltData[v] < 0 )   Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", ParAttFltLabel[v] );
+         }
+         for (int v=0; v<PAR_NATT_INT_STORED; v++)
+         {
+            H5_SetID_ParIntData[v] = H5Dopen( H5_GroupID_Particle, ParAttIntLabel[v], H5P_DEFAULT );
+            if ( H5_SetID_ParIntData[v] < 0 )   Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", ParAttIntLabel[v] );
+         }
+#        endif
+
+//       4-2. load all patches level by level in the stored order
+         for (int lv=0, t=0; lv<NLEVEL; lv++)
+         for (int PID=0; PID<NPatchLocal[lv]; PID++, t++)
+         {
+            LoadOnePatch( H5_FileID, lv, t, Recursive_No, NULL, CrList,
+                          H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
+                          H5_SetID_FCMag, H5_SpaceID_FCMag, H5_MemID_FCMag,
+                          NParList, ParFltBuf, ParIntBuf, NewParList,
+                          H5_SetID_ParFltData, H5_SetID_ParIntData, H5_SpaceID_ParData,
+                          GParID_Offset, NParThisRank, FormatVersion );
+
+//          check: the loaded patch must belong to this rank and have the same PID
+            const long LB_Idx = amr->patch[0][lv][ amr->num[lv]-1 ]->LB_Idx;
+
+            if ( amr->num[lv]-1 != PID  ||  LB_Idx != LBIdxList[t] )
+               Aux_Error( ERROR_INFO, "lv %d, PID %d (expect %d), LB_Idx %ld (expect %ld) !!\n",
+                          lv, amr->num[lv]-1, PID, LB_Idx, LBIdxList[t] );
+
+            if ( LB_Index2Rank( lv, LB_Idx, CHECK_ON ) != MPI_Rank )
+               Aux_Error( ERROR_INFO, "lv %d, PID %d, LB_Idx %ld belongs to rank %d instead of %d !!\n",
+                          lv, PID, LB_Idx, LB_Index2Rank( lv, LB_Idx, CHECK_ON ), MPI_Rank );
+         }
+
+//       free resource
+         for (int v=0; v<NCompStore; v++)       H5_Status = H5Dclose( H5_SetID_Field[v] );
+#        ifdef MHD
+         for (int v=0; v<NCOMP_MAG;   v++)      H5_Status = H5Dclose( H5_SetID_FCMag[v] );
+#        endif
+         H5_Status = H5Gclose( H5_GroupID_GridData );
+
+#        ifdef PARTICLE
+         for (int v=0; v<PAR_NATT_FLT_STORED; v++)  H5_Status = H5Dclose( H5_SetID_ParFltData[v] );
+         for (int v=0; v<PAR_NATT_INT_STORED; v++)  H5_Status = H5Dclose( H5_SetID_ParIntData[v] );
+         H5_Status = H5Gclose( H5_GroupID_Particle );
+#        endif
+
+         H5_Status = H5Fclose( H5_FileID );
+      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+
+      MPI_Barrier( MPI_COMM_WORLD );
+   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+
+
+// 5. record the number of real patches (and LB_IdxList_Real)
+   RecordRealPatch();
+
+#  ifdef PARTICLE
+   if ( amr->Par->NPar_AcPlusInac != NParThisRank )
+      Aux_Error( ERROR_INFO, "total number of particles in the repository (%ld) != expect (%ld) !!\n",
+                 amr->Par->NPar_AcPlusInac, NParThisRank );
+#  endif
+
+
+// 6. free memory
+   H5_Status = H5Sclose( H5_SpaceID_Field );
+   H5_Status = H5Sclose( H5_MemID_Field );
+#  ifdef MHD
+   for (int v=0; v<NCOMP_MAG; v++)
+   {
+      H5_Status = H5Sclose( H5_SpaceID_FCMag[v] );
+      H5_Status = H5Sclose( H5_MemID_FCMag  [v] );
+   }
+#  endif
+
+   delete [] CrList;
+   delete [] LBIdxList;
+#  ifdef PARTICLE
+   H5_Status = H5Sclose( H5_SpaceID_ParData );
+
+   delete [] NParList;
+   delete [] GParID_Offset;
+   delete [] NewParList;
+   Aux_DeallocateArray2D( ParFltBuf );
+   Aux_DeallocateArray2D( ParIntBuf );
+#  endif
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading node-local patches and particles ... done\n" );
+
+} // FUNCTION : LoadPiece_NodeLocal
+#endif // #ifdef LOAD_BALANCE
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ByRestart_NodeLocal
+// Description :  Reload a node-local checkpoint written by Output_DumpData_NodeLocal() as the initial condition
+//
+// Note        :  1. Invoked by Init_ByRestart() when RESTART is a directory (e.g., a symbolic link to
+//                   "Checkpoint_XXXXXXXXX")
+//                2. Each rank first looks for its piece on the node-local disk (i.e.,
+//                   "NODE_LOCAL_DIR/Checkpoint_XXXXXXXXX/Rank_YYYYYY") and falls back to the drained copy
+//                   "RESTART/Rank_YYYYYY"
+//                3. Number of MPI ranks must be the same as the run writing the checkpoint
+//
+// Parameter   :  DirName : Name of the checkpoint directory
+//-------------------------------------------------------------------------------------------------------
+void Init_ByRestart_NodeLocal( const char *DirName )
+{
+
+#  ifndef LOAD_BALANCE
+   Aux_Error( ERROR_INFO, "restarting from node-local checkpoints only supports LOAD_BALANCE !!\n" );
+#  endif
+
+// get the checkpoint name from the target of the symbolic link
+   char RealDir[PATH_MAX], PieceName[2*MAX_STRING];
+
+   if ( realpath( DirName, RealDir ) == NULL )
+      Aux_Error( ERROR_INFO, "failed to resolve the restart directory \"%s\" !!\n", DirName );
+
+   const char *BaseName = ( strrchr(RealDir, '/') == NULL ) ? RealDir : strrchr(RealDir, '/') + 1;
+
+// look for the piece of this rank
+   int FromNodeLocal = 1, NFromNodeLocal;
+
+   if (  snprintf( PieceName, sizeof(PieceName), "%s/%s/Rank_%06d", NODE_LOCAL_DIR, BaseName, MPI_Rank )
+         >= (int)sizeof(PieceName)  )
+      Aux_Error( ERROR_INFO, "node-local piece name \"%s/%s/Rank_%06d\" is too long !!\n",
+                 NODE_LOCAL_DIR, BaseName, MPI_Rank );
+
+   if ( !Aux_CheckFileExist(PieceName) )
+   {
+      FromNodeLocal = 0;
+
+      if (  snprintf( PieceName, sizeof(PieceName), "%s/Rank_%06d", DirName, MPI_Rank ) >= (int)sizeof(PieceName)  )
+         Aux_Error( ERROR_INFO, "piece name \"%s/Rank_%06d\" is too long !!\n", DirName, MPI_Rank );
+
+      if ( !Aux_CheckFileExist(PieceName) )
+         Aux_Error( ERROR_INFO, "piece of rank %d is found in neither \"%s/%s\" nor \"%s\" !!\n",
+                    MPI_Rank, NODE_LOCAL_DIR, BaseName, DirName );
+   }
+
+   MPI_Reduce( &FromNodeLocal, &NFromNodeLocal, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "%s: %d of %d rank(s) load the checkpoint \"%s\" from \"%s\"\n",
+                   __FUNCTION__, NFromNodeLocal, MPI_NRank, BaseName, NODE_LOCAL_DIR );
+
+   Init_ByRestart_HDF5( PieceName, true );
+
+} // FUNCTION : Init_ByRestart_NodeLocal
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Check_Makefile
 // Description :  Load and compare the Makefile_t structure (runtime vs. restart file)
@@ -1582,6 +2049,7 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "BitwiseReproducibility", &RS.BitwiseReproducibility, SID, TID, NonFatal, &RT.BitwiseReproducibility, 1, NonFatal );
    LoadField( "Timing",                 &RS.Timing,                 SID, TID, NonFatal, &RT.Timing,                 1, NonFatal );
    LoadField( "TimingSolver",           &RS.TimingSolver,           SID, TID, NonFatal, &RT.TimingSolver,           1, NonFatal );
+   LoadField( "PerfCounter",            &RS.PerfCounter,            SID, TID, NonFatal, &RT.PerfCounter,            1, NonFatal );
    LoadField( "Float8",                 &RS.Float8,                 SID, TID, NonFatal, &RT.Float8,                 1, NonFatal );
    LoadField( "Serial",                 &RS.Serial,                 SID, TID, NonFatal, &RT.Serial,                 1, NonFatal );
    LoadField( "LoadBalance",            &RS.LoadBalance,            SID, TID, NonFatal, &RT.LoadBalance,            1, NonFatal );
@@ -1962,6 +2430,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Par_ICMass",              &RS.Par_ICMass,              SID, TID, NonFatal, &RT.Par_ICMass,               1, NonFatal );
    LoadField( "Par_ICType",              &RS.Par_ICType,              SID, TID, NonFatal, &RT.Par_ICType,               1, NonFatal );
    LoadField( "Par_ICFloat8",            &RS.Par_ICFloat8,            SID, TID, NonFatal, &RT.Par_ICFloat8,             1, NonFatal );
+   LoadField( "Par_ICLoadNRank",         &RS.Par_ICLoadNRank,         SID, TID, NonFatal, &RT.Par_ICLoadNRank,          1, NonFatal );
    LoadField( "Par_Interp",              &RS.Par_Interp,              SID, TID, NonFatal, &RT.Par_Interp,               1, NonFatal );
    LoadField( "Par_InterpTracer",        &RS.Par_InterpTracer,        SID, TID, NonFatal, &RT.Par_InterpTracer,         1, NonFatal );
    LoadField( "Par_Integ",               &RS.Par_Integ,               SID, TID, NonFatal, &RT.Par_Integ,                1, NonFatal );
@@ -2014,6 +2483,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__DtUser",             &RS.Opt__DtUser,             SID, TID, NonFatal, &RT.Opt__DtUser,              1, NonFatal );
    LoadField( "Opt__DtLevel",            &RS.Opt__DtLevel,            SID, TID, NonFatal, &RT.Opt__DtLevel,             1, NonFatal );
    LoadField( "Opt__RecordDt",           &RS.Opt__RecordDt,           SID, TID, NonFatal, &RT.Opt__RecordDt,            1, NonFatal );
+   LoadField( "Opt__DtFused",            &RS.Opt__DtFused,            SID, TID, NonFatal, &RT.Opt__DtFused,             1, NonFatal );
    LoadField( "AutoReduceDt",            &RS.AutoReduceDt,            SID, TID, NonFatal, &RT.AutoReduceDt,             1, NonFatal );
    LoadField( "AutoReduceDtFactor",      &RS.AutoReduceDtFactor,      SID, TID, NonFatal, &RT.AutoReduceDtFactor,       1, NonFatal );
    LoadField( "AutoReduceDtFactorMin",   &RS.AutoReduceDtFactorMin,   SID, TID, NonFatal, &RT.AutoReduceDtFactorMin,    1, NonFatal );
@@ -2093,6 +2563,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__RecordLoadBalance",  &RS.Opt__RecordLoadBalance,  SID, TID, NonFatal, &RT.Opt__RecordLoadBalance,   1, NonFatal );
    LoadField( "Opt__LB_ExchangeFather",  &RS.Opt__LB_ExchangeFather,  SID, TID, NonFatal, &RT.Opt__LB_ExchangeFather,   1, NonFatal );
+   LoadField( "Opt__NodeAwareMPI",       &RS.Opt__NodeAwareMPI,       SID, TID, NonFatal, &RT.Opt__NodeAwareMPI,        1, NonFatal );
+   LoadField( "Opt__PersistentMPI",      &RS.Opt__PersistentMPI,      SID, TID, NonFatal, &RT.Opt__PersistentMPI,       1, NonFatal );
 #  endif // #ifdef LOAD_BALANCE
    LoadField( "Opt__MinimizeMPIBarrier", &RS.Opt__MinimizeMPIBarrier, SID, TID, NonFatal, &RT.Opt__MinimizeMPIBarrier,  1, NonFatal );
 
@@ -2102,6 +2574,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "MolecularWeight",         &RS.MolecularWeight,         SID, TID, NonFatal, &RT.MolecularWeight,          1, NonFatal );
    LoadField( "MuNorm",                  &RS.MuNorm,                  SID, TID, NonFatal, &RT.MuNorm,                   1, NonFatal );
    LoadField( "IsoTemp",                 &RS.IsoTemp,                 SID, TID, NonFatal, &RT.IsoTemp,                  1, NonFatal );
+   LoadField( "NucTable",                &RS.NucTable,                SID, TID, NonFatal,  RT.NucTable,                 1, NonFatal );
+   LoadField( "NucBenchmark",            &RS.NucBenchmark,            SID, TID, NonFatal, &RT.NucBenchmark,             1, NonFatal );
    LoadField( "MinMod_Coeff",            &RS.MinMod_Coeff,            SID, TID, NonFatal, &RT.MinMod_Coeff,             1, NonFatal );
    LoadField( "MinMod_MaxIter",          &RS.MinMod_MaxIter,          SID, TID, NonFatal, &RT.MinMod_MaxIter,           1, NonFatal );
    LoadField( "Opt__LR_Limiter",         &RS.Opt__LR_Limiter,         SID, TID, NonFatal, &RT.Opt__LR_Limiter,          1, NonFatal );
@@ -2182,6 +2656,9 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "MG_NPostSmooth",          &RS.MG_NPostSmooth,          SID, TID, NonFatal, &RT.MG_NPostSmooth,           1, NonFatal );
    LoadField( "MG_ToleratedError",       &RS.MG_ToleratedError,       SID, TID, NonFatal, &RT.MG_ToleratedError,        1, NonFatal );
 #  endif
+   LoadField( "Opt__LevelMG",            &RS.Opt__LevelMG,            SID, TID, NonFatal, &RT.Opt__LevelMG,             1, NonFatal );
+   LoadField( "LevelMG_MaxIter",         &RS.LevelMG_MaxIter,         SID, TID, NonFatal, &RT.LevelMG_MaxIter,          1, NonFatal );
+   LoadField( "LevelMG_ToleratedError",  &RS.LevelMG_ToleratedError,  SID, TID, NonFatal, &RT.LevelMG_ToleratedError,   1, NonFatal );
    LoadField( "Pot_GPU_NPGroup",         &RS.Pot_GPU_NPGroup,         SID, TID, NonFatal, &RT.Pot_GPU_NPGroup,          1, NonFatal );
    LoadField( "Opt__GraP5Gradient",      &RS.Opt__GraP5Gradient,      SID, TID, NonFatal, &RT.Opt__GraP5Gradient,       1, NonFatal );
    LoadField( "Opt__SelfGravity",        &RS.Opt__SelfGravity,        SID, TID, NonFatal, &RT.Opt__SelfGravity,         1, NonFatal );
@@ -2319,6 +2796,12 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Output_Par_Mesh",        &RS.Opt__Output_Par_Mesh,        SID, TID, NonFatal, &RT.Opt__Output_Par_Mesh,        1, NonFatal );
 #  endif
    LoadField( "Opt__Output_BasePS",          &RS.Opt__Output_BasePS,          SID, TID, NonFatal, &RT.Opt__Output_BasePS,          1, NonFatal );
+   LoadField( "Output_BasePS_Step",          &RS.Output_BasePS_Step,          SID, TID, NonFatal, &RT.Output_BasePS_Step,          1, NonFatal );
+   if ( OPT__OUTPUT_BASEPS  ||  OUTPUT_BASEPS_STEP > 0 ) {
+   LoadField( "Output_BasePS_Field",         &RS.Output_BasePS_Field,         SID, TID, NonFatal,  RT.Output_BasePS_Field,         1, NonFatal );
+   LoadField( "Output_BasePS_Cross",         &RS.Output_BasePS_Cross,         SID, TID, NonFatal, &RT.Output_BasePS_Cross,         1, NonFatal );
+   LoadField( "Output_BasePS_Level",         &RS.Output_BasePS_Level,         SID, TID, NonFatal, &RT.Output_BasePS_Level,         1, NonFatal );
+   }
    if ( OPT__OUTPUT_PART )
    LoadField( "Opt__Output_Base",            &RS.Opt__Output_Base,            SID, TID, NonFatal, &RT.Opt__Output_Base,            1, NonFatal );
 #  ifdef GRAVITY
@@ -2354,10 +2837,26 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__Output_Mode",            &RS.Opt__Output_Mode,            SID, TID, NonFatal, &RT.Opt__Output_Mode,            1, NonFatal );
    LoadField( "Opt__Output_Restart",         &RS.Opt__Output_Restart,         SID, TID, NonFatal, &RT.Opt__Output_Restart,         1, NonFatal );
+   LoadField( "Opt__Output_NodeLocal",       &RS.Opt__Output_NodeLocal,       SID, TID, NonFatal, &RT.Opt__Output_NodeLocal,       1, NonFatal );
+   LoadField( "NodeLocal_Dir",               &RS.NodeLocal_Dir,               SID, TID, NonFatal,  RT.NodeLocal_Dir,               1, NonFatal );
+   LoadField( "Opt__NodeLocal_Drain",        &RS.Opt__NodeLocal_Drain,        SID, TID, NonFatal, &RT.Opt__NodeLocal_Drain,        1, NonFatal );
+   LoadField( "NodeLocal_Step",              &RS.NodeLocal_Step,              SID, TID, NonFatal, &RT.NodeLocal_Step,              1, NonFatal );
+   LoadField( "Opt__Output_Deflate",         &RS.Opt__Output_Deflate,         SID, TID, NonFatal, &RT.Opt__Output_Deflate,         1, NonFatal );
+   LoadField( "Output_Lossy_RelErr",         &RS.Output_Lossy_RelErr,         SID, TID, NonFatal, &RT.Output_Lossy_RelErr,         1, NonFatal );
    LoadField( "Opt__Output_Step",            &RS.Opt__Output_Step,            SID, TID, NonFatal, &RT.Opt__Output_Step,            1, NonFatal );
    LoadField( "Opt__Output_Dt",              &RS.Opt__Output_Dt,              SID, TID, NonFatal, &RT.Opt__Output_Dt,              1, NonFatal );
    LoadField( "Opt__Output_Text_Format_Flt", &RS.Opt__Output_Text_Format_Flt, SID, TID, NonFatal,  RT.Opt__Output_Text_Format_Flt, 1, NonFatal );
    }
+   LoadField( "Opt__Output_Image",           &RS.Opt__Output_Image,           SID, TID, NonFatal, &RT.Opt__Output_Image,           1, NonFatal );
+   if ( OPT__OUTPUT_IMAGE ) {
+   LoadField( "Output_Image_Step",           &RS.Output_Image_Step,           SID, TID, NonFatal, &RT.Output_Image_Step,           1, NonFatal );
+   LoadField( "Output_Image_NPix",           &RS.Output_Image_NPix,           SID, TID, NonFatal, &RT.Output_Image_NPix,           1, NonFatal );
+   LoadField( "Output_Image_Axis",           &RS.Output_Image_Axis,           SID, TID, NonFatal, &RT.Output_Image_Axis,           1, NonFatal );
+   LoadField( "Output_Image_Field",          &RS.Output_Image_Field,          SID, TID, NonFatal,  RT.Output_Image_Field,          1, NonFatal );
+   LoadField( "Output_Image_SliceX",         &RS.Output_Image_SliceX,         SID, TID, NonFatal, &RT.Output_Image_SliceX,         1, NonFatal );
+   LoadField( "Output_Image_SliceY",         &RS.Output_Image_SliceY,         SID, TID, NonFatal, &RT.Output_Image_SliceY,         1, NonFatal );
+   LoadField( "Output_Image_SliceZ",         &RS.Output_Image_SliceZ,         SID, TID, NonFatal, &RT.Output_Image_SliceZ,         1, NonFatal );
+   }
    if ( OPT__OUTPUT_PART ) {
    LoadField( "Output_PartX",                &RS.Output_PartX,                SID, TID, NonFatal, &RT.Output_PartX,                1, NonFatal );
    LoadField( "Output_PartY",                &RS.Output_PartY,                SID, TID, NonFatal, &RT.Output_PartY,                1, NonFatal );
@@ -2379,6 +2878,10 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__RecordUnphy",        &RS.Opt__RecordUnphy,        SID, TID, NonFatal, &RT.Opt__RecordUnphy,         1, NonFatal );
    LoadField( "Opt__RecordMemory",       &RS.Opt__RecordMemory,       SID, TID, NonFatal, &RT.Opt__RecordMemory,        1, NonFatal );
    LoadField( "Opt__RecordPerformance",  &RS.Opt__RecordPerformance,  SID, TID, NonFatal, &RT.Opt__RecordPerformance,   1, NonFatal );
+   LoadField( "Opt__RecordTrace",        &RS.Opt__RecordTrace,        SID, TID, NonFatal, &RT.Opt__RecordTrace,         1, NonFatal );
+   LoadField( "Trace_StepStart",         &RS.Trace_StepStart,         SID, TID, NonFatal, &RT.Trace_StepStart,          1, NonFatal );
+   LoadField( "Trace_StepEnd",           &RS.Trace_StepEnd,           SID, TID, NonFatal, &RT.Trace_StepEnd,            1, NonFatal );
+   LoadField( "Trace_MaxEvent",          &RS.Trace_MaxEvent,          SID, TID, NonFatal, &RT.Trace_MaxEvent,           1, NonFatal );
    LoadField( "Opt__ManualControl",      &RS.Opt__ManualControl,      SID, TID, NonFatal, &RT.Opt__ManualControl,       1, NonFatal );
    LoadField( "Opt__RecordCenter",       &RS.Opt__RecordCenter,       SID, TID, NonFatal, &RT.Opt__RecordCenter,        1, NonFatal );
    LoadField( "COM_CenX",                &RS.COM_CenX,                SID, TID, NonFatal, &RT.COM_CenX,                 1, NonFatal );
@@ -2388,6 +2891,16 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "COM_MinRho",              &RS.COM_MinRho,              SID, TID, NonFatal, &RT.COM_MinRho,               1, NonFatal );
    LoadField( "COM_TolErrR",             &RS.COM_TolErrR,             SID, TID, NonFatal, &RT.COM_TolErrR,              1, NonFatal );
    LoadField( "COM_MaxIter",             &RS.COM_MaxIter,             SID, TID, NonFatal, &RT.COM_MaxIter,              1, NonFatal );
+   LoadField( "Opt__RecordClump",        &RS.Opt__RecordClump,        SID, TID, NonFatal, &RT.Opt__RecordClump,         1, NonFatal );
+   if ( OPT__RECORD_CLUMP ) {
+   LoadField( "Clump_Field",             &RS.Clump_Field,             SID, TID, NonFatal,  RT.Clump_Field,              1, NonFatal );
+   LoadField( "Clump_Threshold",         &RS.Clump_Threshold,         SID, TID, NonFatal, &RT.Clump_Threshold,          1, NonFatal );
+   LoadField( "Clump_MinNCell",          &RS.Clump_MinNCell,          SID, TID, NonFatal, &RT.Clump_MinNCell,           1, NonFatal );
+#  ifdef MASSIVE_PARTICLES
+   LoadField( "Clump_FoF_LinkLen",       &RS.Clump_FoF_LinkLen,       SID, TID, NonFatal, &RT.Clump_FoF_LinkLen,        1, NonFatal );
+   LoadField( "Clump_FoF_MinNPar",       &RS.Clump_FoF_MinNPar,       SID, TID, NonFatal, &RT.Clump_FoF_MinNPar,        1, NonFatal );
+#  endif
+   }
    LoadField( "Opt__RecordUser",         &RS.Opt__RecordUser,         SID, TID, NonFatal, &RT.Opt__RecordUser,          1, NonFatal );
    LoadField( "Opt__OptimizeAggressive", &RS.Opt__OptimizeAggressive, SID, TID, NonFatal, &RT.Opt__OptimizeAggressive,  1, NonFatal );
    LoadField( "Opt__SortPatchByLBIdx",   &RS.Opt__SortPatchByLBIdx,   SID, TID, NonFatal, &RT.Opt__SortPatchByLBIdx,    1, NonFatal );
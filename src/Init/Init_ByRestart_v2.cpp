@@ -5,6 +5,7 @@
 #endif
 #ifdef SUPPORT_HDF5
 #include "hdf5.h"
+#include <sys/stat.h>
 #endif
 
 void Init_ByRestart_v1( const char FileName[] );
@@ -31,6 +32,8 @@ void CompareVar( const char *VarName, const double RestartVar, const double Runt
 //
 //                2. This function will invoke "Init_ByRestart_HDF5" automatically if the restart file
 //                   is in the HDF5 format
+//                   --> Invoke "Init_ByRestart_NodeLocal" instead if RESTART is a directory of node-local
+//                       checkpoints (see Output_DumpData_NodeLocal())
 //
 //                3. This function will invoke "Init_ByRestart_v1" automatically if the restart file
 //                   is in a simple binary format in version 1 (i.e., FormatVersion < 2000)
@@ -43,9 +46,16 @@ void Init_ByRestart()
 
 // load the HDF5 data
 #  ifdef SUPPORT_HDF5
+   struct stat Stat;
+   if (  stat( FileName, &Stat ) == 0  &&  S_ISDIR( Stat.st_mode )  )
+   {
+      Init_ByRestart_NodeLocal( FileName );
+      return;
+   }
+
    if (  Aux_CheckFileExist(FileName)  &&  H5Fis_hdf5(FileName)  )
    {
-      Init_ByRestart_HDF5( FileName );
+      Init_ByRestart_HDF5( FileName, false );
       return;
    }
 #  endif
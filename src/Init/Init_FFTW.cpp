@@ -2,9 +2,8 @@
 
 #ifdef SUPPORT_FFTW
 
-static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
-
 root_fftw::real_plan_nd FFTW_Plan_PS;                       // PS  : plan for calculating the power spectrum
+root_fftw::real_plan_nd FFTW_Plan_PS_Fine;                  // PS_Fine : plan for calculating the power spectrum on level OUTPUT_BASEPS_LEVEL > 0
 #ifdef GRAVITY
 root_fftw::real_plan_nd FFTW_Plan_Poi, FFTW_Plan_Poi_Inv;   // Poi : plan for the self-gravity Poisson solver
 #endif // #ifdef GRAVITY
@@ -107,6 +106,10 @@ void Init_FFTW()
 // determine the FFT size for the power spectrum
    int PS_FFT_Size[3]      = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
+// determine the FFT size for the power spectrum on the uniform grid of level OUTPUT_BASEPS_LEVEL
+   const bool PS_Fine      = ( OPT__OUTPUT_BASEPS || OUTPUT_BASEPS_STEP > 0 )  &&  OUTPUT_BASEPS_LEVEL > 0;
+   int PS_Fine_FFT_Size[3] = { NX0_TOT[0]<<OUTPUT_BASEPS_LEVEL, NX0_TOT[1]<<OUTPUT_BASEPS_LEVEL, NX0_TOT[2]<<OUTPUT_BASEPS_LEVEL };
+
 // determine the FFT size for the self-gravity solver
 #  ifdef GRAVITY
    int Gravity_FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
@@ -178,6 +181,34 @@ void Init_FFTW()
 
 // create plans for power spectrum and the self-gravity solver
    FFTW_Plan_PS      = root_fftw_create_3d_r2c_plan(PS_FFT_Size, PS, StartupFlag);
+
+// the refined uniform grid can be much larger than the root grid
+// --> only allocate the local slab for creating the plan
+   if ( PS_Fine )
+   {
+      real *PS_Fine_Arr = NULL;
+
+#     if ( SUPPORT_FFTW == FFTW3 )
+#     ifdef SERIAL
+      const long PS_Fine_Size = 2L*( PS_Fine_FFT_Size[0]/2 + 1 )*PS_Fine_FFT_Size[1]*PS_Fine_FFT_Size[2];
+#     else
+      mpi_index_int local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose;
+
+      const long PS_Fine_Size = fftw_mpi_local_size_3d_transposed( PS_Fine_FFT_Size[2], PS_Fine_FFT_Size[1],
+                                                                   2*( PS_Fine_FFT_Size[0]/2 + 1 ), MPI_COMM_WORLD,
+                                                                   &local_nz, &local_z_start, &local_ny_after_transpose,
+                                                                   &local_y_start_after_transpose );
+#     endif
+      PS_Fine_Arr = (real*) root_fftw::fft_malloc( PS_Fine_Size*sizeof(real) );
+#     endif // # if ( SUPPORT_FFTW == FFTW3 )
+
+      FFTW_Plan_PS_Fine = root_fftw_create_3d_r2c_plan(PS_Fine_FFT_Size, PS_Fine_Arr, StartupFlag);
+
+#     if ( SUPPORT_FFTW == FFTW3 )
+      root_fftw::fft_free( PS_Fine_Arr );
+#     endif
+   } // if ( PS_Fine )
+
 #  ifdef GRAVITY
    FFTW_Plan_Poi     = root_fftw_create_3d_r2c_plan(Gravity_FFT_Size, RhoK, StartupFlag);
    FFTW_Plan_Poi_Inv = root_fftw_create_3d_c2r_plan(Gravity_FFT_Size, RhoK, StartupFlag);
@@ -242,6 +273,9 @@ void End_FFTW()
 
    root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS      );
 
+   if (  ( OPT__OUTPUT_BASEPS || OUTPUT_BASEPS_STEP > 0 )  &&  OUTPUT_BASEPS_LEVEL > 0  )
+   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS_Fine );
+
 #  ifdef GRAVITY
    root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi     );
    root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi_Inv );
@@ -9,6 +9,14 @@ void (*Init_Field_User_Ptr)() = NULL;
 
 static int NDefinedField;  // total number of defined fields
 
+// labels of the non-intrinsic fields supported by Prepare_PatchData()
+// --> see GetPrepareFieldBIdx() for their bitwise indices
+#define NPREP_FIELD  13
+
+static const char *PrepFieldLabel[NPREP_FIELD] = { "VelX", "VelY", "VelZ", "Pres", "Temp", "Entr", "Eint",
+                                                   "CCMagX", "CCMagY", "CCMagZ", "Pote", "ParDens", "TotalDens" };
+static long GetPrepareFieldBIdx( const int t );
+
 
 
 
@@ -333,6 +341,133 @@ FieldIdx_t GetFieldIndex( const char *InputLabel, const Check_t Check )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetFieldBIdx
+// Description :  Return the bitwise index of the target field that can be prepared by Prepare_PatchData()
+//
+// Note        :  1. Usage: TVar = GetFieldBIdx( FieldLabel, CHECK_ON );
+//                2. Supported fields:
+//                      All fields with labels set by AddField() (e.g., "Dens", "MomX", "Engy", and passive scalars)
+//                      HYDRO             : "VelX", "VelY", "VelZ", "Pres", "Temp", "Entr", "Eint"
+//                      MHD               : "CCMagX", "CCMagY", "CCMagZ"
+//                      GRAVITY           : "Pote"
+//                      MASSIVE_PARTICLES : "ParDens", "TotalDens"
+//                   --> "TotalDens" is also supported without PARTICLE, in which case it is the same as "Dens"
+//                3. Return 0 if the target field cannot be found
+//
+// Parameter   :  InputLabel : Target field label
+//                Check      : Whether or not to terminate the program if the target field cannot be found
+//                             --> Accepted options: CHECK_ON / CHECK_OFF
+//
+// Return      :  Sucess: bitwise index of the target field
+//                Failed: 0
+//-------------------------------------------------------------------------------------------------------
+long GetFieldBIdx( const char *InputLabel, const Check_t Check )
+{
+
+   long BIdx_Out = 0;
+
+// intrinsic fields
+   const FieldIdx_t FieldIdx = GetFieldIndex( InputLabel, CHECK_OFF );
+
+   if ( FieldIdx != Idx_Undefined )
+      BIdx_Out = BIDX( FieldIdx );
+
+// non-intrinsic fields
+   else
+   {
+      for (int t=0; t<NPREP_FIELD; t++)
+      {
+         if (  strcmp( PrepFieldLabel[t], InputLabel ) == 0  )
+         {
+            BIdx_Out = GetPrepareFieldBIdx( t );
+            break;
+         }
+      }
+   }
+
+   if ( Check == CHECK_ON  &&  BIdx_Out == 0 )
+      Aux_Error( ERROR_INFO, "unsupported target field \"%s\" !!\n", InputLabel );
+
+   return BIdx_Out;
+
+} // FUNCTION : GetFieldBIdx
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetFieldBIdxLabel
+// Description :  Return the label of the target field specified by its bitwise index
+//
+// Note        :  1. Inverse of GetFieldBIdx()
+//                2. Return NULL if the target field cannot be found
+//
+// Parameter   :  BIdx : Bitwise index of a single target field
+//
+// Return      :  Sucess: label of the target field
+//                Failed: NULL
+//-------------------------------------------------------------------------------------------------------
+const char *GetFieldBIdxLabel( const long BIdx )
+{
+
+// intrinsic fields
+   for (int v=0; v<NDefinedField; v++)
+      if ( BIdx == BIDX(v) )  return FieldLabel[v];
+
+// non-intrinsic fields
+   for (int t=0; t<NPREP_FIELD; t++)
+      if ( BIdx != 0  &&  BIdx == GetPrepareFieldBIdx(t) )  return PrepFieldLabel[t];
+
+   return NULL;
+
+} // FUNCTION : GetFieldBIdxLabel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPrepareFieldBIdx
+// Description :  Return the bitwise index of the non-intrinsic field PrepFieldLabel[t]
+//
+// Note        :  1. Invoked by GetFieldBIdx() and GetFieldBIdxLabel()
+//                2. Return 0 for the fields not supported by the current build
+//
+// Parameter   :  t : Target field in the range 0 <= t < NPREP_FIELD
+//
+// Return      :  Bitwise index of the target field
+//-------------------------------------------------------------------------------------------------------
+long GetPrepareFieldBIdx( const int t )
+{
+
+   switch ( t )
+   {
+#     if ( MODEL == HYDRO )
+      case  0:  return _VELX;
+      case  1:  return _VELY;
+      case  2:  return _VELZ;
+      case  3:  return _PRES;
+      case  4:  return _TEMP;
+      case  5:  return _ENTR;
+      case  6:  return _EINT;
+      case  7:  return _MAGX_CC;
+      case  8:  return _MAGY_CC;
+      case  9:  return _MAGZ_CC;
+#     endif
+#     ifdef GRAVITY
+      case 10:  return _POTE;
+#     endif
+#     ifdef MASSIVE_PARTICLES
+      case 11:  return _PAR_DENS;
+#     endif
+#     if ( defined MASSIVE_PARTICLES  ||  !defined PARTICLE )
+      case 12:  return _TOTAL_DENS;
+#     endif
+      default:  return 0;
+   }
+
+} // FUNCTION : GetPrepareFieldBIdx
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_Field_User_Template
 // Description :  Template of adding user-defined fields
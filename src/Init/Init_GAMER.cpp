@@ -164,6 +164,8 @@ void Init_GAMER( int *argc, char ***argv )
 // initialize the timer function
 #  ifdef TIMING
    Aux_CreateTimer();
+
+   Aux_CreateTrace();
 #  endif
 
 
@@ -283,7 +285,7 @@ void Init_GAMER( int *argc, char ***argv )
 
          Buf_GetBufferData( lv, amr->FluSg[lv], NULL_INT, NULL_INT, DATA_GENERAL, _DENS, _NONE, Rho_ParaBuf, USELB_YES );
 
-         Gra_AdvanceDt( lv, Time[lv], NULL_REAL, NULL_REAL, NULL_INT, amr->PotSg[lv], true, false, false, false, true );
+         Gra_AdvanceDt( lv, Time[lv], NULL_REAL, NULL_REAL, NULL_INT, amr->PotSg[lv], true, false, false, true );
 
          if ( lv > 0 )
          Buf_GetBufferData( lv, NULL_INT, NULL_INT, amr->PotSg[lv], POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
@@ -78,6 +78,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "PAR_IC_FORMAT",              &amr->Par->ParICFormat,      PAR_IC_FORMAT_ATT_ID,  1,             2              );
    ReadPara->Add( "PAR_IC_FLOAT8",              &PAR_IC_FLOAT8,                  -1,                NoMin_int,     1              );
    ReadPara->Add( "PAR_IC_INT8",                &PAR_IC_INT8,                    -1,                NoMin_int,     1              );
+   ReadPara->Add( "PAR_IC_LOAD_NRANK",          &PAR_IC_LOAD_NRANK,              -1,                NoMin_int,     NoMax_int      );
    ReadPara->Add( "PAR_IC_MASS",                &amr->Par->ParICMass,            -1.0,              NoMin_double,  NoMax_double   );
    ReadPara->Add( "PAR_IC_TYPE",                &amr->Par->ParICType,            -1,                NoMin_int,     PAR_NTYPE-1    );
    ReadPara->Add( "PAR_INTERP",                 &amr->Par->Interp,                PAR_INTERP_CIC,   1,             3              );
@@ -137,6 +138,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__DT_USER",               &OPT__DT_USER,                    false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__DT_LEVEL",              &OPT__DT_LEVEL,                   3,               1,             3              );
    ReadPara->Add( "OPT__RECORD_DT",             &OPT__RECORD_DT,                  true,            Useless_bool,  Useless_bool   );
+#  if ( MODEL == HYDRO )
+   ReadPara->Add( "OPT__DT_FUSED",              &OPT__DT_FUSED,                   false,           Useless_bool,  Useless_bool   );
+#  endif
    ReadPara->Add( "AUTO_REDUCE_DT",             &AUTO_REDUCE_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR",      &AUTO_REDUCE_DT_FACTOR,           1.0,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR_MIN",  &AUTO_REDUCE_DT_FACTOR_MIN,       0.1,             0.0,           1.0            );
@@ -226,6 +230,8 @@ void Init_Load_Parameter()
 #  else
    ReadPara->Add( "OPT__LB_EXCHANGE_FATHER",    &OPT__LB_EXCHANGE_FATHER,         false,           Useless_bool,  Useless_bool   );
 #  endif // ELBDM_SCHEME
+   ReadPara->Add( "OPT__NODE_AWARE_MPI",        &OPT__NODE_AWARE_MPI,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PERSISTENT_MPI",        &OPT__PERSISTENT_MPI,             false,           Useless_bool,  Useless_bool   );
 #  endif // #ifdef LOAD_BALANCE
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       false,           Useless_bool,  Useless_bool   );
 
@@ -306,6 +312,9 @@ void Init_Load_Parameter()
 #  else
    ReadPara->Add( "ISO_TEMP",                   &ISO_TEMP,                       __DBL_MAX__,      NoMin_double,  NoMax_double   );
 #  endif
+// do not check NUC_TABLE since it may not be used by other EoS
+   ReadPara->Add( "NUC_TABLE",                   NUC_TABLE,                      NoDef_str,       Useless_str,   Useless_str    );
+   ReadPara->Add( "NUC_BENCHMARK",              &NUC_BENCHMARK,                   0L,              0L,            NoMax_long     );
    ReadPara->Add( "MINMOD_COEFF",               &MINMOD_COEFF,                    1.5,             1.0,           2.0            );
    ReadPara->Add( "MINMOD_MAX_ITER",            &MINMOD_MAX_ITER,                   0,               0,           NoMax_int      );
    ReadPara->Add( "OPT__LR_LIMITER",            &OPT__LR_LIMITER,             LR_LIMITER_DEFAULT, -1,             7              );
@@ -395,6 +404,10 @@ void Init_Load_Parameter()
    ReadPara->Add( "MG_NPRE_SMOOTH",             &MG_NPRE_SMOOTH,                 -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPOST_SMOOTH",            &MG_NPOST_SMOOTH,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_TOLERATED_ERROR",         &MG_TOLERATED_ERROR,             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OPT__LEVEL_MG",              &OPT__LEVEL_MG,                   false,           Useless_bool,  Useless_bool   );
+// do not check LEVEL_MG_XXX since they may be reset by Init_ResetParameter()
+   ReadPara->Add( "LEVEL_MG_MAX_ITER",          &LEVEL_MG_MAX_ITER,              -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "LEVEL_MG_TOLERATED_ERROR",   &LEVEL_MG_TOLERATED_ERROR,       -1.0,             NoMin_double,  NoMax_double   );
 // do not check POT_GPU_NPGROUP since it may be reset by either Init_ResetParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "POT_GPU_NPGROUP",            &POT_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__GRA_P5_GRADIENT",       &OPT__GRA_P5_GRADIENT,            false,           Useless_bool,  Useless_bool   );
@@ -512,6 +525,11 @@ void Init_Load_Parameter()
 #  endif
 #  endif
    ReadPara->Add( "OPT__OUTPUT_BASEPS",         &OPT__OUTPUT_BASEPS,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OUTPUT_BASEPS_FIELD",         OUTPUT_BASEPS_FIELD,             "TotalDens",     Useless_str,   Useless_str    );
+   ReadPara->Add( "OUTPUT_BASEPS_CROSS",        &OUTPUT_BASEPS_CROSS,             false,           Useless_bool,  Useless_bool   );
+// do not check OUTPUT_BASEPS_LEVEL since MAX_LEVEL may be reset by the test problems
+   ReadPara->Add( "OUTPUT_BASEPS_LEVEL",        &OUTPUT_BASEPS_LEVEL,             0,               0,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_BASEPS_STEP",         &OUTPUT_BASEPS_STEP,             -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__OUTPUT_BASE",           &OPT__OUTPUT_BASE,                false,           Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__OUTPUT_CC_MAG",         &OPT__OUTPUT_CC_MAG,              true,            Useless_bool,  Useless_bool   );
@@ -542,6 +560,21 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__OUTPUT_USER_FIELD",     &OPT__OUTPUT_USER_FIELD,          false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OUTPUT_MODE",           &OPT__OUTPUT_MODE,               -1,               1,             3              );
    ReadPara->Add( "OPT__OUTPUT_RESTART",        &OPT__OUTPUT_RESTART,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_NODE_LOCAL",     &OPT__OUTPUT_NODE_LOCAL,          false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "NODE_LOCAL_DIR",              NODE_LOCAL_DIR,                  "/tmp",          Useless_str,   Useless_str    );
+   ReadPara->Add( "OPT__NODE_LOCAL_DRAIN",      &OPT__NODE_LOCAL_DRAIN,           true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "NODE_LOCAL_STEP",            &NODE_LOCAL_STEP,                 100,             1,             NoMax_int      );
+   ReadPara->Add( "OPT__OUTPUT_DEFLATE",        &OPT__OUTPUT_DEFLATE,             0,               0,             9              );
+   ReadPara->Add( "OUTPUT_LOSSY_REL_ERR",       &OUTPUT_LOSSY_REL_ERR,           -1.0,             NoMin_double,  1.0            );
+   ReadPara->Add( "OPT__OUTPUT_IMAGE",          &OPT__OUTPUT_IMAGE,               0,               0,             3              );
+   ReadPara->Add( "OUTPUT_IMAGE_STEP",          &OUTPUT_IMAGE_STEP,               1,               1,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_IMAGE_NPIX",          &OUTPUT_IMAGE_NPIX,               512,             1,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_IMAGE_AXIS",          &OUTPUT_IMAGE_AXIS,               3,               0,             3              );
+   ReadPara->Add( "OUTPUT_IMAGE_FIELD",          OUTPUT_IMAGE_FIELD,              "Dens",          Useless_str,   Useless_str    );
+// OUTPUT_IMAGE_SLICE_X/Y/Z < 0.0 will be reset to the box center
+   ReadPara->Add( "OUTPUT_IMAGE_SLICE_X",       &OUTPUT_IMAGE_SLICE_X,           -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_IMAGE_SLICE_Y",       &OUTPUT_IMAGE_SLICE_Y,           -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_IMAGE_SLICE_Z",       &OUTPUT_IMAGE_SLICE_Z,           -1.0,             NoMin_double,  NoMax_double   );
 // do not check OUTPUT_STEP and OUTPUT_DT since they depend on OPT__OUTPUT_MODE
    ReadPara->Add( "OUTPUT_STEP",                &OUTPUT_STEP,                    -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OUTPUT_DT",                  &OUTPUT_DT,                      -1.0,             NoMin_double,  NoMax_double   );
@@ -574,6 +607,10 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__RECORD_UNPHY",          &OPT__RECORD_UNPHY,               true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_MEMORY",         &OPT__RECORD_MEMORY,              true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_PERFORMANCE",    &OPT__RECORD_PERFORMANCE,         true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RECORD_TRACE",          &OPT__RECORD_TRACE,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "TRACE_STEP_START",           &TRACE_STEP_START,                1L,              0L,            NoMax_long     );
+   ReadPara->Add( "TRACE_STEP_END",             &TRACE_STEP_END,                  1L,              0L,            NoMax_long     );
+   ReadPara->Add( "TRACE_MAX_EVENT",            &TRACE_MAX_EVENT,                 100000,          1,             NoMax_int      );
    ReadPara->Add( "OPT__MANUAL_CONTROL",        &OPT__MANUAL_CONTROL,             true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_CENTER",         &OPT__RECORD_CENTER,              false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "COM_CEN_X",                  &COM_CEN_X,                      -1.0,             NoMin_double,  NoMax_double   );
@@ -583,6 +620,14 @@ void Init_Load_Parameter()
    ReadPara->Add( "COM_MIN_RHO",                &COM_MIN_RHO,                     0.0,             0.0,           NoMax_double   );
    ReadPara->Add( "COM_TOLERR_R",               &COM_TOLERR_R,                   -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "COM_MAX_ITER",               &COM_MAX_ITER,                    10,              1,             NoMax_int      );
+   ReadPara->Add( "OPT__RECORD_CLUMP",          &OPT__RECORD_CLUMP,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "CLUMP_FIELD",                 CLUMP_FIELD,                     "Dens",          Useless_str,   Useless_str    );
+   ReadPara->Add( "CLUMP_THRESHOLD",            &CLUMP_THRESHOLD,                 NoDef_double,    NoMin_double,  NoMax_double   );
+   ReadPara->Add( "CLUMP_MIN_NCELL",            &CLUMP_MIN_NCELL,                 8,               1,             NoMax_int      );
+#  ifdef MASSIVE_PARTICLES
+   ReadPara->Add( "CLUMP_FOF_LINKLEN",          &CLUMP_FOF_LINKLEN,              -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "CLUMP_FOF_MIN_NPAR",         &CLUMP_FOF_MIN_NPAR,              20,              1,             NoMax_int      );
+#  endif
    ReadPara->Add( "OPT__RECORD_USER",           &OPT__RECORD_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OPTIMIZE_AGGRESSIVE",   &OPT__OPTIMIZE_AGGRESSIVE,        false,           Useless_bool,  Useless_bool   );
 #  ifdef LOAD_BALANCE
@@ -209,6 +209,29 @@ void Init_ResetParameter()
 #  elif ( POT_SCHEME == MG  )
    Init_Set_Default_MG_Parameter();
 #  endif
+
+// level-wide multigrid Poisson solver parameters
+   if ( LEVEL_MG_MAX_ITER < 0 )
+   {
+#     ifdef FLOAT8
+      LEVEL_MG_MAX_ITER = 40;
+#     else
+      LEVEL_MG_MAX_ITER = 20;
+#     endif
+
+      PRINT_RESET_PARA( LEVEL_MG_MAX_ITER, FORMAT_INT, "" );
+   }
+
+   if ( LEVEL_MG_TOLERATED_ERROR < 0.0 )
+   {
+#     ifdef FLOAT8
+      LEVEL_MG_TOLERATED_ERROR = 1.0e-15;
+#     else
+      LEVEL_MG_TOLERATED_ERROR = 1.0e-6;
+#     endif
+
+      PRINT_RESET_PARA( LEVEL_MG_TOLERATED_ERROR, FORMAT_REAL, "" );
+   }
 #  endif // GRAVITY
 
 
@@ -624,8 +647,7 @@ void Init_ResetParameter()
    }
 
 
-// turn off "OPT__OVERLAP_MPI" if (1) OVERLAP_MPI=ff, (2) SERIAL=on, (3) LOAD_BALANCE=off,
-//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE
+// turn off "OPT__OVERLAP_MPI" if (1) OVERLAP_MPI=off, (2) SERIAL=on, (3) LOAD_BALANCE=off
 #  ifndef OVERLAP_MPI
    if ( OPT__OVERLAP_MPI )
    {
@@ -653,27 +675,6 @@ void Init_ResetParameter()
    }
 #  endif // #ifndef LOAD_BALANCE
 
-#  ifndef OPENMP
-   if ( OPT__OVERLAP_MPI )
-   {
-      OPT__OVERLAP_MPI = false;
-
-      PRINT_RESET_PARA( OPT__OVERLAP_MPI, FORMAT_INT, "since OPENMP is disabled" );
-   }
-#  endif
-
-#  ifndef SERIAL
-// check the level of MPI thread support
-   int MPI_Thread_Status;
-   MPI_Query_thread( &MPI_Thread_Status );
-   if ( OPT__OVERLAP_MPI  &&  MPI_Thread_Status == MPI_THREAD_SINGLE )
-   {
-      OPT__OVERLAP_MPI = false;
-
-      PRINT_RESET_PARA( OPT__OVERLAP_MPI, FORMAT_INT, "since the level of MPI thread support == MPI_THREAD_SINGLE" );
-   }
-#  endif
-
 
 // disable "OPT__CK_FLUX_ALLOCATE" if no flux arrays are going to be allocated
    if ( OPT__CK_FLUX_ALLOCATE  &&  !amr->WithFlux )
@@ -937,9 +938,42 @@ void Init_ResetParameter()
 
       PRINT_RESET_PARA( OPT__OUTPUT_BASEPS, FORMAT_INT, "since SUPPORT_FFTW is disabled" );
    }
+
+   if ( OUTPUT_BASEPS_STEP > 0 )
+   {
+      OUTPUT_BASEPS_STEP = -1;
+
+      PRINT_RESET_PARA( OUTPUT_BASEPS_STEP, FORMAT_INT, "since SUPPORT_FFTW is disabled" );
+   }
 #  endif
 
 
+// set the default slice coordinates of OPT__OUTPUT_IMAGE to the box center
+   if ( OPT__OUTPUT_IMAGE & OUTPUT_IMAGE_SLICE )
+   {
+      if ( OUTPUT_IMAGE_SLICE_X < 0.0 )
+      {
+         OUTPUT_IMAGE_SLICE_X = amr->BoxCenter[0];
+
+         PRINT_RESET_PARA( OUTPUT_IMAGE_SLICE_X, FORMAT_REAL, "" );
+      }
+
+      if ( OUTPUT_IMAGE_SLICE_Y < 0.0 )
+      {
+         OUTPUT_IMAGE_SLICE_Y = amr->BoxCenter[1];
+
+         PRINT_RESET_PARA( OUTPUT_IMAGE_SLICE_Y, FORMAT_REAL, "" );
+      }
+
+      if ( OUTPUT_IMAGE_SLICE_Z < 0.0 )
+      {
+         OUTPUT_IMAGE_SLICE_Z = amr->BoxCenter[2];
+
+         PRINT_RESET_PARA( OUTPUT_IMAGE_SLICE_Z, FORMAT_REAL, "" );
+      }
+   }
+
+
 // reset MPI_NRank_X
 #  ifdef SERIAL
    for (int d=0; d<3; d++)
@@ -990,6 +1024,13 @@ void Init_ResetParameter()
 
       PRINT_RESET_PARA( OPT__TIMING_MPI, FORMAT_INT, "since TIMING is disabled" );
    }
+
+   if ( OPT__RECORD_TRACE )
+   {
+      OPT__RECORD_TRACE = false;
+
+      PRINT_RESET_PARA( OPT__RECORD_TRACE, FORMAT_INT, "since TIMING is disabled" );
+   }
 #  endif // #ifndef TIMING
 
 
@@ -1083,6 +1124,14 @@ void Init_ResetParameter()
 
       PRINT_RESET_PARA( PAR_IC_INT8, FORMAT_INT, "to be consistent with INT8_PAR" );
    }
+
+// PAR_IC_LOAD_NRANK
+   if ( amr->Par->Init == PAR_INIT_BY_FILE  &&  ( PAR_IC_LOAD_NRANK <= 0  ||  PAR_IC_LOAD_NRANK > MPI_NRank )  )
+   {
+      PAR_IC_LOAD_NRANK = MPI_NRank;
+
+      PRINT_RESET_PARA( PAR_IC_LOAD_NRANK, FORMAT_INT, "" );
+   }
 #endif
 
 
@@ -200,6 +200,10 @@ void Interpolate( real CData[], const int CSize[3], const int CStart[3], const i
 //                5. CData[] may be overwritten
 //                6. Only applicable for HYDRO
 //                7. When enabling INTERP_MASK (in Macro.h), only iterate on cells with unphysical results
+//                   --> Coarse cells with any unphysical fine cell are tracked by a bitmask, and each retry only
+//                       converts and interpolates the bounding box of these coarse cells (plus the stencil ghost zones)
+//                   --> All eight fine cells of a coarse cell are stored together to ensure conservation
+//                   --> Otherwise the entire block is re-interpolated whenever any fine cell is unphysical
 //
 // Parameter   :  See Interpolate()
 //
@@ -216,19 +220,25 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
 //###REVISE: support FStart[*] != 0
 // check
    for (int d=0; d<3; d++)
+   {
       if ( FStart[d] != 0 )   Aux_Error( ERROR_INFO, "FStart[%d] = %d != 0 !!\n", d, FStart[d] );
+      if ( FSize[d] != 2*CRange[d] )
+         Aux_Error( ERROR_INFO, "FSize[%d] (%d) != 2*CRange[%d] (%d) !!\n", d, FSize[d], d, 2*CRange[d] );
+   }
 
 
    const int  CSize3D         = CSize[0]*CSize[1]*CSize[2];
    const int  FSize3D         = FSize[0]*FSize[1]*FSize[2];
+   const int  CRange3D        = CRange[0]*CRange[1]*CRange[2];
    const int  MonoMaxIter     = ( ReduceMonoCoeff ) ? MONO_MAX_ITER : 0;
    const int  MaxIter         = ( IntPrim ) ? MonoMaxIter+1 : MonoMaxIter;
    const bool JeansMinPres_No = false;
 
-   int  Iteration;
+   int  Iteration, NSide, CGhost, Box_Start[3], Box_Range[3], Box_End[3];
    real IntMonoCoeff;
    bool Fail_AnyCell, FData_is_Prim, ContinueIteration;
    real Cons[NCOMP_TOTAL_PLUS_MAG], Temp[NCOMP_TOTAL_PLUS_MAG];   // must include B field
+   real Cons_Child[8][NCOMP_TOTAL];
 
 
 // select an interpolation scheme
@@ -238,12 +248,30 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
    if ( IntSchemeFunc == NULL )  Aux_Error( ERROR_INFO, "IntSchemeFunc == NULL!!\n" );
 #  endif
 
+   Int_Table( IntScheme, NSide, CGhost );
+
    real *FData_tmp = new real [NCOMP_TOTAL*FSize3D];
 
-#  ifdef INTERP_MASK
-   bool *Mask      = new bool [FSize3D];
-   for (int i=0; i<FSize3D; i++)    Mask[i] = UNMASKED;
-#  endif
+// bitmask of the coarse cells whose eight fine cells have not been stored yet
+// --> bit (i+j*CRange[0]+k*CRange[0]*CRange[1]) corresponds to the coarse cell CStart[]+(i,j,k)
+// --> all fine cells with the same parent are always interpolated, checked, and stored together
+//     to ensure conservation when disabling IntPrim
+   const int NWord   = ( CRange3D + 31 ) / 32;
+   uint     *Pending = new uint [NWord];
+
+#  define IS_PENDING( idx )   (  ( Pending[ (idx) >> 5 ] >> ( (idx) & 31 ) ) & 1U  )
+#  define SET_PENDING( idx )  (  Pending[ (idx) >> 5 ] |=  ( 1U << ( (idx) & 31 ) )  )
+#  define CLR_PENDING( idx )  (  Pending[ (idx) >> 5 ] &= ~( 1U << ( (idx) & 31 ) )  )
+
+   for (int w=0; w<NWord; w++)      Pending[w] = 0U;
+   for (int t=0; t<CRange3D; t++)   SET_PENDING( t );
+
+// bounding box of the pending coarse cells (relative to CStart[])
+   for (int d=0; d<3; d++)
+   {
+      Box_Start[d] = 0;
+      Box_Range[d] = CRange[d];
+   }
 
 
 // start iterations
@@ -262,14 +290,28 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
       else if ( Iteration == 1  &&  IntPrim )
       {
 //       conserved --> primitive
-         for (int i=0; i<CSize3D; i++)
+//       --> only for the coarse cells required to interpolate the pending box
+//       --> the pending box can only shrink in later iterations, so the converted region remains sufficient
+         int CBox_Start[3], CBox_End[3];
+
+         for (int d=0; d<3; d++)
+         {
+            CBox_Start[d] = MAX( CStart[d] + Box_Start[d] - CGhost, 0 );
+            CBox_End  [d] = MIN( CStart[d] + Box_Start[d] + Box_Range[d] + CGhost, CSize[d] );
+         }
+
+         for (int k=CBox_Start[2]; k<CBox_End[2]; k++)
+         for (int j=CBox_Start[1]; j<CBox_End[1]; j++)
+         for (int i=CBox_Start[0]; i<CBox_End[0]; i++)
          {
+            const int t = IDX321( i, j, k, CSize[0], CSize[1] );
+
 //          assuming **all** elements of CData[] and CMag[] are filled in (i.e., no unused cells)
-            for (int v=0; v<NCOMP_TOTAL; v++)   Cons[v] = CData[ CSize3D*v + i ];
+            for (int v=0; v<NCOMP_TOTAL; v++)   Cons[v] = CData[ CSize3D*v + t ];
 #           ifdef MHD
             for (int v=0; v<NCOMP_MAG; v++)
             {
-               const real B = CMag[ CSize3D*v + i ];
+               const real B = CMag[ CSize3D*v + t ];
                Cons[ MAG_OFFSET + v ] = B;
 
 //             abort if the coarse-grid B field is unphysical
@@ -285,8 +327,8 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
                            EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, NULL );
 
 //          no need to copy the magnetic field here
-            for (int v=0; v<NCOMP_TOTAL; v++)   CData[ CSize3D*v + i ] = Temp[v];
-         } // for (int i=0; i<CSize3D; i++)
+            for (int v=0; v<NCOMP_TOTAL; v++)   CData[ CSize3D*v + t ] = Temp[v];
+         } // i,j,k
 
          FData_is_Prim = true;
       } // else if ( Iteration == 1  &&  IntPrim )
@@ -307,202 +349,233 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
       }
 
 
-//    4. perform interpolation
-      IntSchemeFunc( CData, CSize, CStart, CRange, FData_tmp, FSize, FStart, NComp,
+//    4. perform interpolation on the pending box only
+//       --> the fine-grid results of a coarse cell only depend on its own stencil, so the results outside the box
+//           are unaffected
+      int CStart_Box[3], FStart_Box[3];
+
+      for (int d=0; d<3; d++)
+      {
+         CStart_Box[d] = CStart[d] + Box_Start[d];
+         FStart_Box[d] = FStart[d] + 2*Box_Start[d];
+         Box_End   [d] = Box_Start[d] + Box_Range[d];
+      }
+
+      IntSchemeFunc( CData, CSize, CStart_Box, Box_Range, FData_tmp, FSize, FStart_Box, NComp,
                      UnwrapPhase, Monotonic, IntMonoCoeff, OppSign0thOrder );
 
 
       Fail_AnyCell = false;
 
-      for (int i=0; i<FSize3D; i++)
+      for (int ck=Box_Start[2]; ck<Box_End[2]; ck++)
+      for (int cj=Box_Start[1]; cj<Box_End[1]; cj++)
+      for (int ci=Box_Start[0]; ci<Box_End[0]; ci++)
       {
-//       skip masked cells
-#        ifdef INTERP_MASK
-         if ( Mask[i] == MASKED )   continue;
-#        endif
+         const int CIdx = IDX321( ci, cj, ck, CRange[0], CRange[1] );
 
+//       skip the coarse cells whose fine cells have been stored
+         if ( ! IS_PENDING(CIdx) )  continue;
 
-//       Temp[] can store either conserved or primitive variables
-         for (int v=0; v<NCOMP_TOTAL; v++)   Temp[v] = FData_tmp[ FSize3D*v + i ];
-#        ifdef MHD
-         for (int v=0; v<NCOMP_MAG;   v++)   Temp[ MAG_OFFSET + v ] = FMag[i][v];
-#        endif
+         bool Fail_AnyChild = false;
 
+         for (int c=0; c<8; c++)
+         {
+            const int i = 2*ci + ( (c   ) & 1 );
+            const int j = 2*cj + ( (c>>1) & 1 );
+            const int k = 2*ck + ( (c>>2) & 1 );
+            const int t = IDX321( i, j, k, FSize[0], FSize[1] );
 
-//       5. check unphysical results
-//       5-1. abort if the fine-grid B field is unphysical
-#        ifdef MHD
-         const real Emag = (real)0.5*( SQR(FMag[i][MAGX]) + SQR(FMag[i][MAGY]) + SQR(FMag[i][MAGZ]) );
-         if ( ! Aux_IsFinite(Emag) )   Aux_Error( ERROR_INFO, "unphysical fine-grid B energy (%14.7e) !!\n", Emag );
-#        else
-         const real Emag = NULL_REAL;
-#        endif
+//          Temp[] can store either conserved or primitive variables
+            for (int v=0; v<NCOMP_TOTAL; v++)   Temp[v] = FData_tmp[ FSize3D*v + t ];
+#           ifdef MHD
+            for (int v=0; v<NCOMP_MAG;   v++)   Temp[ MAG_OFFSET + v ] = FMag[t][v];
+#           endif
 
 
-//       5-2. general check
-         bool Fail_ThisCell
-            = Hydro_IsUnphysical( (FData_is_Prim)?UNPHY_MODE_PRIM:UNPHY_MODE_CONS, Temp, NULL,
-                                  NULL_REAL, NULL_REAL, Emag,
-                                  EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                  EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table,
-                                  ERROR_INFO, UNPHY_SILENCE );
+//          5. check unphysical results
+//          5-1. abort if the fine-grid B field is unphysical
+#           ifdef MHD
+            const real Emag = (real)0.5*( SQR(FMag[t][MAGX]) + SQR(FMag[t][MAGY]) + SQR(FMag[t][MAGZ]) );
+            if ( ! Aux_IsFinite(Emag) )   Aux_Error( ERROR_INFO, "unphysical fine-grid B energy (%14.7e) !!\n", Emag );
+#           else
+            const real Emag = NULL_REAL;
+#           endif
 
 
-//       5-3. additional check
-         real Eint=NULL_REAL;
+//          5-2. general check
+            bool Fail_ThisCell
+               = Hydro_IsUnphysical( (FData_is_Prim)?UNPHY_MODE_PRIM:UNPHY_MODE_CONS, Temp, NULL,
+                                     NULL_REAL, NULL_REAL, Emag,
+                                     EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                     EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table,
+                                     ERROR_INFO, UNPHY_SILENCE );
 
-         if ( !Fail_ThisCell )
-         {
-            if ( FData_is_Prim )
+
+//          5-3. additional check
+            real Eint=NULL_REAL;
+
+            if ( !Fail_ThisCell )
             {
-//             check internal energy
-               if ( EoS_DensPres2Eint_CPUPtr != NULL ) {
-//                convert passive scalars from mass fraction back to mass density
-#                 if ( NCOMP_PASSIVE > 0 )
-                  real Passive[NCOMP_PASSIVE];
-
-                  for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = Temp[ NCOMP_FLUID + v ];
-
-                  if ( OPT__INT_FRAC_PASSIVE_LR )
-                     for (int v=0; v<PassiveIntFrac_NVar; v++)    Passive[ PassiveIntFrac_VarIdx[v] ] *= Temp[DENS];
-#                 else
-                  const real *Passive = NULL;
+               if ( FData_is_Prim )
+               {
+//                check internal energy
+                  if ( EoS_DensPres2Eint_CPUPtr != NULL ) {
+//                   convert passive scalars from mass fraction back to mass density
+#                    if ( NCOMP_PASSIVE > 0 )
+                     real Passive[NCOMP_PASSIVE];
+
+                     for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = Temp[ NCOMP_FLUID + v ];
+
+                     if ( OPT__INT_FRAC_PASSIVE_LR )
+                        for (int v=0; v<PassiveIntFrac_NVar; v++)    Passive[ PassiveIntFrac_VarIdx[v] ] *= Temp[DENS];
+#                    else
+                     const real *Passive = NULL;
+#                    endif
+
+                     Eint = EoS_DensPres2Eint_CPUPtr( Temp[DENS], Temp[ENGY], Passive,
+                                                      EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+
+//                   internal energy cannot be negative (even within machine precision) since a pressure floor has been applied
+//                   when calling Hydro_Con2Pri()
+                     if (  Hydro_IsUnphysical( UNPHY_MODE_SING, &Eint, "interpolated internal energy",
+                                               (real)0.0, HUGE_NUMBER, NULL_REAL,
+                                               NULL, NULL, NULL, NULL, NULL, NULL,
+                                               ERROR_INFO, UNPHY_SILENCE )  )
+                        Fail_ThisCell = true;
+                  } // if ( EoS_DensPres2Eint_CPUPtr != NULL )
+               } // if ( FData_is_Prim )
+
+               else
+               {
+//                one can add additional checks for conserved variables here
+               } // if ( FData_is_Prim ) ... else ...
+            } // if ( !Fail_ThisCell )
+
+
+//          6. convert the results
+//          6-1. failed cells
+            if ( Fail_ThisCell )
+            {
+               if ( Iteration == MaxIter )
+               {
+                  Aux_Message( stderr, "ERROR : %s() failed !!\n", __FUNCTION__ );
+                  Aux_Message( stderr, "NComp=%d, IntScheme=%d, UnwrapPhase=%d, Monotonic=%d, OppSign0thOrder=%d\n",
+                               NComp, IntScheme, UnwrapPhase, Monotonic[0], OppSign0thOrder );
+                  Aux_Message( stderr, "FData_is_Prim=%d, Iter=%d, IntMonoCoeff=%13.7e\n", FData_is_Prim, Iteration, IntMonoCoeff );
+
+                  Aux_Message( stderr, "Fluid: " );
+                  for (int v=0; v<NCOMP_TOTAL; v++)   Aux_Message( stderr, " [%d]=%14.7e", v, Temp[v] );
+                  Aux_Message( stderr, "\n" );
+
+#                 ifdef MHD
+                  Aux_Message( stderr, "B field: " );
+                  for (int v=0; v<NCOMP_MAG; v++)     Aux_Message( stderr, " [%d]=%14.7e", v, FMag[t][v] );
+                  Aux_Message( stderr, " Emag=%14.7e\n", Emag );
 #                 endif
 
-                  Eint = EoS_DensPres2Eint_CPUPtr( Temp[DENS], Temp[ENGY], Passive,
-                                                   EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+//                output additional information
+                  if ( FData_is_Prim ) {
+//                   output Eint only if it has been recalculated
+                     if ( Eint != NULL_REAL )   Aux_Message( stderr, "Eint=%14.7e\n", Eint );
+                  }
 
-//                internal energy cannot be negative (even within machine precision) since a pressure floor has been applied
-//                when calling Hydro_Con2Pri()
-                  if (  Hydro_IsUnphysical( UNPHY_MODE_SING, &Eint, "interpolated internal energy",
-                                            (real)0.0, HUGE_NUMBER, NULL_REAL,
-                                            NULL, NULL, NULL, NULL, NULL, NULL,
-                                            ERROR_INFO, UNPHY_SILENCE )  )
-                     Fail_ThisCell = true;
-               } // if ( EoS_DensPres2Eint_CPUPtr != NULL )
-            } // if ( FData_is_Prim )
+                  else {
+                     const real CheckMinPres_No = false;
+                     const real Pres = Hydro_Con2Pres( Temp[DENS], Temp[MOMX], Temp[MOMY], Temp[MOMZ], Temp[ENGY], Temp+NCOMP_FLUID,
+                                                       CheckMinPres_No, NULL_REAL, Emag,
+                                                       EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                       EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, &Eint );
+                     Aux_Message( stderr, "Eint=%14.7e, Pres=%14.7e\n", Eint, Pres );
+                  }
 
-            else
-            {
-//             one can add additional checks for conserved variables here
-            } // if ( FData_is_Prim ) ... else ...
-         } // if ( !Fail_ThisCell )
+                  MPI_Exit();    // abort the simulation if interpolation fails
+               } // if ( Iteration == MaxIter )
 
-         Fail_AnyCell |= Fail_ThisCell;
+               Fail_AnyChild = true;
+               break;   // no need to check the remaining fine cells of this coarse cell
+            } // if ( Fail_ThisCell )
 
 
-//       6. store results
-//       6-1. skip failed cells
-         if ( Fail_ThisCell )
-         {
-            if ( Iteration == MaxIter )
+//          6-2. correct results
+            else
             {
-               Aux_Message( stderr, "ERROR : %s() failed !!\n", __FUNCTION__ );
-               Aux_Message( stderr, "NComp=%d, IntScheme=%d, UnwrapPhase=%d, Monotonic=%d, OppSign0thOrder=%d\n",
-                            NComp, IntScheme, UnwrapPhase, Monotonic[0], OppSign0thOrder );
-               Aux_Message( stderr, "FData_is_Prim=%d, Iter=%d, IntMonoCoeff=%13.7e\n", FData_is_Prim, Iteration, IntMonoCoeff );
-
-               Aux_Message( stderr, "Fluid: " );
-               for (int v=0; v<NCOMP_TOTAL; v++)   Aux_Message( stderr, " [%d]=%14.7e", v, Temp[v] );
-               Aux_Message( stderr, "\n" );
-
-#              ifdef MHD
-               Aux_Message( stderr, "B field: " );
-               for (int v=0; v<NCOMP_MAG; v++)     Aux_Message( stderr, " [%d]=%14.7e", v, FMag[i][v] );
-               Aux_Message( stderr, " Emag=%14.7e\n", Emag );
-#              endif
-
-//             output additional information
+//             primitive --> conserved
                if ( FData_is_Prim ) {
-//                output Eint only if it has been recalculated
-                  if ( Eint != NULL_REAL )   Aux_Message( stderr, "Eint=%14.7e\n", Eint );
+                  Hydro_Pri2Con( Temp, Cons, OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar,
+                                 PassiveIntFrac_VarIdx, EoS_DensPres2Eint_CPUPtr,
+                                 EoS_Temp2HTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                 EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+
+#                 ifdef GAMER_DEBUG
+                  if (  Hydro_IsUnphysical( UNPHY_MODE_CONS, Cons, NULL,
+                                            NULL_REAL, NULL_REAL, Emag,
+                                            EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                            EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table,
+                                            ERROR_INFO, UNPHY_VERBOSE )  )
+                     Aux_Error( ERROR_INFO, "unphysical interpolated energy in %s() !!\n", __FUNCTION__ );
+#                 endif
                }
 
                else {
-                  const real CheckMinPres_No = false;
-                  const real Pres = Hydro_Con2Pres( Temp[DENS], Temp[MOMX], Temp[MOMY], Temp[MOMZ], Temp[ENGY], Temp+NCOMP_FLUID,
-                                                    CheckMinPres_No, NULL_REAL, Emag,
-                                                    EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, &Eint );
-                  Aux_Message( stderr, "Eint=%14.7e, Pres=%14.7e\n", Eint, Pres );
+                  for (int v=0; v<NCOMP_TOTAL; v++)   Cons[v] = Temp[v];
                }
 
-               MPI_Exit();    // abort the simulation if interpolation fails
-            } // if ( Iteration == MaxIter )
+//             no need to copy the magnetic field here
+               for (int v=0; v<NCOMP_TOTAL; v++)   Cons_Child[c][v] = Cons[v];
+            } // if ( Fail_ThisCell ) ... else ...
+         } // for (int c=0; c<8; c++)
 
-#           ifndef INTERP_MASK
-            break;   // no need to check remaining cells if not using mask
-#           endif
-         } // if ( Fail_ThisCell )
 
+//       7. store the results only if all eight fine cells are physical
+         if ( Fail_AnyChild )
+            Fail_AnyCell = true;
 
-//       6-2. store the correct results
          else
          {
-//          primitive --> conserved
-            if ( FData_is_Prim ) {
-               Hydro_Pri2Con( Temp, Cons, OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar,
-                              PassiveIntFrac_VarIdx, EoS_DensPres2Eint_CPUPtr,
-                              EoS_Temp2HTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                              EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
-
-#              ifdef GAMER_DEBUG
-               if (  Hydro_IsUnphysical( UNPHY_MODE_CONS, Cons, NULL,
-                                         NULL_REAL, NULL_REAL, Emag,
-                                         EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                         EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table,
-                                         ERROR_INFO, UNPHY_VERBOSE )  )
-                  Aux_Error( ERROR_INFO, "unphysical interpolated energy in %s() !!\n", __FUNCTION__ );
-#              endif
-            }
+            for (int c=0; c<8; c++)
+            {
+               const int i = 2*ci + ( (c   ) & 1 );
+               const int j = 2*cj + ( (c>>1) & 1 );
+               const int k = 2*ck + ( (c>>2) & 1 );
+               const int t = IDX321( i, j, k, FSize[0], FSize[1] );
 
-            else {
-               for (int v=0; v<NCOMP_TOTAL; v++)   Cons[v] = Temp[v];
+               for (int v=0; v<NCOMP_TOTAL; v++)   FData[ FSize3D*v + t ] = Cons_Child[c][v];
             }
 
-//          no need to copy the magnetic field here
-            for (int v=0; v<NCOMP_TOTAL; v++)   FData[ FSize3D*v + i ] = Cons[v];
-
-#           ifdef INTERP_MASK
-            Mask[i] = MASKED;
-#           endif
-         } // if ( Fail_ThisCell ) ... else ...
-      } // for (int i=0; i<FSize3D; i++)
+            CLR_PENDING( CIdx );
+         } // if ( Fail_AnyChild ) ... else ...
+      } // ci,cj,ck
 
 
-//    7. decide whether to abort the iteration
+//    8. decide whether to abort the iteration
       if ( Fail_AnyCell  &&  Iteration < MaxIter ) {
 
-//       if any fine cell remains failed, unmask all eight fine cells with the same parent cell
-//       --> ensure conservation when disabling IntPrim
 #        ifdef INTERP_MASK
-         typedef bool (*vla)[ FSize[1] ][ FSize[0] ];
-         vla Mask3D = ( vla )Mask;
-
-         for (int k=0; k<FSize[2]; k+=2)  {  const int kp = k+1;
-         for (int j=0; j<FSize[1]; j+=2)  {  const int jp = j+1;
-         for (int i=0; i<FSize[0]; i+=2)  {  const int ip = i+1;
-
-            if ( Mask3D[k ][j ][i ] == UNMASKED  ||
-                 Mask3D[k ][j ][ip] == UNMASKED  ||
-                 Mask3D[k ][jp][i ] == UNMASKED  ||
-                 Mask3D[kp][j ][i ] == UNMASKED  ||
-                 Mask3D[k ][jp][ip] == UNMASKED  ||
-                 Mask3D[kp][jp][i ] == UNMASKED  ||
-                 Mask3D[kp][j ][ip] == UNMASKED  ||
-                 Mask3D[kp][jp][ip] == UNMASKED   )
-            {
-               Mask3D[k ][j ][i ] = UNMASKED;
-               Mask3D[k ][j ][ip] = UNMASKED;
-               Mask3D[k ][jp][i ] = UNMASKED;
-               Mask3D[kp][j ][i ] = UNMASKED;
-               Mask3D[k ][jp][ip] = UNMASKED;
-               Mask3D[kp][jp][i ] = UNMASKED;
-               Mask3D[kp][j ][ip] = UNMASKED;
-               Mask3D[kp][jp][ip] = UNMASKED;
-            }
-         }}}
-#        endif // #ifdef INTERP_MASK
+//       shrink the box to the pending coarse cells
+         int Box_Min[3] = { CRange[0], CRange[1], CRange[2] };
+         int Box_Max[3] = { -1, -1, -1 };
+
+         for (int ck=Box_Start[2]; ck<Box_End[2]; ck++)
+         for (int cj=Box_Start[1]; cj<Box_End[1]; cj++)
+         for (int ci=Box_Start[0]; ci<Box_End[0]; ci++)
+         {
+            if ( ! IS_PENDING( IDX321(ci,cj,ck,CRange[0],CRange[1]) ) )    continue;
+
+            Box_Min[0] = MIN( Box_Min[0], ci );    Box_Max[0] = MAX( Box_Max[0], ci );
+            Box_Min[1] = MIN( Box_Min[1], cj );    Box_Max[1] = MAX( Box_Max[1], cj );
+            Box_Min[2] = MIN( Box_Min[2], ck );    Box_Max[2] = MAX( Box_Max[2], ck );
+         }
+
+         for (int d=0; d<3; d++)
+         {
+            Box_Start[d] = Box_Min[d];
+            Box_Range[d] = Box_Max[d] - Box_Min[d] + 1;
+         }
+
+#        else
+//       retry all coarse cells
+         for (int t=0; t<CRange3D; t++)   SET_PENDING( t );
+#        endif // #ifdef INTERP_MASK ... else ...
 
          ContinueIteration = true;
       } // if ( Fail_AnyCell  &&  Iteration < MaxIter )
@@ -512,24 +585,26 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
       } // if ( Fail_AnyCell  &&  Iteration < MaxIter ) ... else ...
 
 
-//    8. counter increment
+//    9. counter increment
       Iteration ++;
 
    } while ( ContinueIteration );
 
 
 // check if there is any missing cell
-#  if ( defined GAMER_DEBUG  &&  defined INTERP_MASK )
-   for (int i=0; i<FSize3D; i++)
-      if ( Mask[i] == UNMASKED )    Aux_Error( ERROR_INFO, "Mask[%d] == UNMASKED !!\n", i );
+#  ifdef GAMER_DEBUG
+   for (int t=0; t<CRange3D; t++)
+      if ( IS_PENDING(t) )    Aux_Error( ERROR_INFO, "coarse cell %d is still pending !!\n", t );
 #  endif
 
+#  undef IS_PENDING
+#  undef SET_PENDING
+#  undef CLR_PENDING
+
 
-// 9. free resource
+// 10. free resource
    delete [] FData_tmp;
-#  ifdef INTERP_MASK
-   delete [] Mask;
-#  endif
+   delete [] Pending;
 
 } // FUNCTION : Interpolate_Iterate
 #endif // #if ( MODEL == HYDRO )
@@ -774,14 +774,147 @@ LB_GlobalTree::LB_GlobalTree(int root) : PatchCount(), Patches(NULL)
 {
    Patches = LB_GatherTree(PatchCount, root);
    NPatch  = PatchCount.NPatchAllLv;
+
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   WaveMask       = NULL;
+   NPatchWaveMask = 0;
+
+   if ( Patches != NULL )  ConstructWaveMask();
+#  endif
 }
 
 LB_GlobalTree::~LB_GlobalTree()
 {
    delete [] Patches;
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   delete [] WaveMask;
+#  endif
 }
 
 
+#if ( ELBDM_SCHEME == ELBDM_HYBRID )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GlobalTree::ConstructWaveMask
+// Description :  Construct the bitmask of cells with refined wave counterparts for all patches on the fluid levels
+//
+// Note        :  1. Invoked by the constructor (i.e., once per regrid of the fluid levels)
+//                2. Bit IDX321(i,j,k,PS1,PS1) of WaveMask[GID] is set if cell [i,j,k] of patch GID has a wave
+//                   counterpart, which is the same as the result of traversing the tree by FindRefinedCounterpart()
+//                3. Masks are constructed level by level from the finest fluid level since the counterpart of
+//                   a cell is determined by the son cell at its left corner
+//                   --> Cost per patch is independent of the tree depth
+//                4. Masks are only stored for the fluid levels (i.e., GID < NPatchWaveMask)
+//                   --> All cells on the wave levels have wave counterparts since all levels above a wave level
+//                       are wave levels
+//                5. Must be rebuilt when amr->use_wave_flag[] changes, which is guaranteed since the global tree is
+//                   reconstructed after switching levels to the wave scheme
+//-------------------------------------------------------------------------------------------------------
+void LB_GlobalTree::ConstructWaveMask()
+{
+
+// find the first wave level
+   int FirstWaveLv = NLEVEL;
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      if ( amr->use_wave_flag[lv] )
+      {
+         FirstWaveLv = lv;
+         break;
+      }
+   }
+
+   NPatchWaveMask = ( FirstWaveLv < NLEVEL ) ? PatchCount.GID_LvStart[FirstWaveLv] : NPatch;
+
+   if ( NPatchWaveMask == 0 )    return;
+
+   WaveMask = new ulong [NPatchWaveMask][WAVE_MASK_NWORD];
+
+// LocalID of the son patch containing the son cells [2*i, 2*j, 2*k] with 2*i/PS1, 2*j/PS1, 2*k/PS1 = x, y, z
+   int SonLocalID[2][2][2];
+   for (int LocalID=0; LocalID<8; LocalID++)
+      SonLocalID[ TABLE_02(LocalID,'z',0,1) ][ TABLE_02(LocalID,'y',0,1) ][ TABLE_02(LocalID,'x',0,1) ] = LocalID;
+
+   for (int lv=FirstWaveLv-1; lv>=0; lv--)
+   {
+      const long GID_Start = PatchCount.GID_LvStart[lv];
+      const long GID_End   = GID_Start + NPatchTotal[lv];
+
+#     pragma omp parallel for schedule( static )
+      for (long GID=GID_Start; GID<GID_End; GID++)
+      {
+         ulong *Mask   = WaveMask[GID];
+         const long SonGID0 = Patches[GID].son;
+
+         for (int w=0; w<WAVE_MASK_NWORD; w++)  Mask[w] = 0;
+
+//       leaf patches on the fluid levels have no wave counterpart
+         if ( SonGID0 == -1 )    continue;
+
+         const bool SonIsWave = amr->use_wave_flag[lv+1];
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+         {
+            bool HasWave;
+
+            if ( SonIsWave )  HasWave = true;
+            else
+            {
+               const int  ii     = 2*i;
+               const int  jj     = 2*j;
+               const int  kk     = 2*k;
+               const long SonGID = SonGID0 + SonLocalID[ kk/PS1 ][ jj/PS1 ][ ii/PS1 ];
+
+               HasWave = HasWaveCounterpart( ii%PS1, jj%PS1, kk%PS1, SonGID );
+            }
+
+            if ( HasWave )
+            {
+               const int Idx = IDX321( i, j, k, PS1, PS1 );
+               Mask[ Idx >> 6 ] |= (ulong)1 << ( Idx & 63 );
+            }
+         } // i,j,k
+      } // for (long GID=GID_Start; GID<GID_End; GID++)
+   } // for (int lv=FirstWaveLv-1; lv>=0; lv--)
+
+} // LB_GlobalTree::ConstructWaveMask
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GlobalTree::HasWaveCounterpart
+// Description :  Check whether cell [i, j, k] in patch GID has a wave counterpart on refined levels
+//
+// Note        :  1. Look up the bitmask constructed by ConstructWaveMask()
+//                2. Always return true for patches on the wave levels
+//
+// Parameter   :  i   : x-index relative to patch GID (0 <= i < PS1)
+//             :  j   : y-index relative to patch GID (0 <= j < PS1)
+//             :  k   : z-index relative to patch GID (0 <= k < PS1)
+//             : GID  : global ID of patch
+//
+// Return      :  true if cell [i, j, k] in patch GID has a wave counterpart, false otherwise
+//-------------------------------------------------------------------------------------------------------
+bool LB_GlobalTree::HasWaveCounterpart(const int i, const int j, const int k, const long GID) const
+{
+// sanity check
+#  ifdef GAMER_DEBUG
+   if ( GID < 0  ||  GID >= NPatch )
+      Aux_Error( ERROR_INFO, "incorrect GID (%ld), NPatch (%ld) !!\n", GID, NPatch );
+   if ( i < 0  ||  i >= PS1  ||  j < 0  ||  j >= PS1  ||  k < 0  ||  k >= PS1 )
+      Aux_Error( ERROR_INFO, "incorrect cell index [%d, %d, %d] !!\n", i, j, k );
+#  endif
+
+   if ( GID >= NPatchWaveMask )  return true;
+
+   const int Idx = IDX321( i, j, k, PS1, PS1 );
+
+   return (  WaveMask[GID][ Idx >> 6 ] >> ( Idx & 63 )  ) & 1;
+} // LB_GlobalTree::HasWaveCounterpart
+#endif // #if ( ELBDM_SCHEME == ELBDM_HYBRID )
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_GlobalTree::IsInsidePatch
 // Description :  Check whether cell [X, Y, Z] is in patch indexed by GID
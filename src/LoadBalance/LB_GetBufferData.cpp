@@ -15,6 +15,31 @@ static long  RecvBufSize        = -1L;
 extern Timer_t *Timer_MPI[3];
 #endif
 
+// persistent MPI requests for OPT__PERSISTENT_MPI
+#define NPERSIST_REQ    8   // maximum number of exchange patterns stored on each level
+
+struct PersistReq_t
+{
+   GetBufMode_t GetBufMode;            // key: exchange mode
+   long         TVarCC, TVarFC;        // key: target variables
+   int          ParaBuf;               // key: number of ghost zones
+   real        *SendBuf, *RecvBuf;     // send/recv buffers bound to the requests
+   long        *Send_NCount;           // number of elements sent to each rank
+   long        *Recv_NCount;           // number of elements received from each rank
+   int          NReq;                  // number of requests
+   MPI_Request *Req;                   // persistent requests
+};
+
+static PersistReq_t *PersistReq[NLEVEL][NPERSIST_REQ];
+static int           PersistReq_Next[NLEVEL];
+static MPI_Comm      PersistReq_Comm = MPI_COMM_NULL;
+
+static PersistReq_t *GetPersistReq( const int lv, const GetBufMode_t GetBufMode, const long TVarCC, const long TVarFC,
+                                    const int ParaBuf, real *SendBuf, real *RecvBuf,
+                                    const long *Send_NCount, const long *Send_NDisp,
+                                    const long *Recv_NCount, const long *Recv_NDisp );
+static void FreePersistReq( PersistReq_t *&Persist );
+
 
 
 
@@ -28,6 +53,8 @@ extern Timer_t *Timer_MPI[3];
 //                3. The modes "POT_FOR_POISSON" and "POT_AFTER_REFINE" will exchange the potential data only.
 //                   The mode "COARSE_FINE_ELECTRIC" will exchange all electric field components.
 //                   For others modes, the variables to be exchanged depend on the input parameters "TVarCC" and "TVarFC".
+//                4. For OPT__PERSISTENT_MPI, the data are transferred by the persistent requests returned by
+//                   GetPersistReq(), which are reused as long as the send/recv buffers and counts are unchanged
 //
 // Parameter   :  lv         : Target refinement level to exchage data
 //                FluSg      : Sandglass of the requested fluid data
@@ -64,9 +91,17 @@ extern Timer_t *Timer_MPI[3];
 //                                 ELBDM     : none
 //                ParaBuf    : Number of ghost zones to exchange
 //                             --> Useless in DATA_RESTRICT, COARSE_FINE_FLUX, and COARSE_FINE_ELECTRIC
+//                OverlapFunc: Work to be overlapped with the MPI communication (for OPT__OVERLAP_MPI)
+//                             --> If not NULL, the data are transferred by non-blocking MPI_Isend/Irecv and
+//                                 OverlapFunc(OverlapArg) is invoked after posting all requests but before
+//                                 waiting for them to complete
+//                             --> OverlapFunc must neither access the buffer patches at the target sandglass
+//                                 nor invoke any routine using the shared MPI buffers
+//                OverlapArg : Argument passed to OverlapFunc
 //-------------------------------------------------------------------------------------------------------
 void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
-                       const long TVarCC, const long TVarFC, const int ParaBuf )
+                       const long TVarCC, const long TVarFC, const int ParaBuf, void (*OverlapFunc)( void *Arg ),
+                       void *OverlapArg )
 {
 
    bool ExchangeFlu = ( GetBufMode == COARSE_FINE_FLUX ) ?
@@ -1102,22 +1137,107 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 // 4. transfer data by MPI_Alltoallv
 // ============================================================================================================
-#  ifdef TIMING
-// it's better to add barrier before timing transferring data through MPI
-// --> so that the timing results (i.e., the MPI bandwidth reported by OPT__TIMING_MPI ) does NOT include
-//     the time waiting for other ranks to reach here
-// --> make the MPI bandwidth measured here more accurate
-   if ( OPT__TIMING_BARRIER )    MPI_Barrier( MPI_COMM_WORLD );
+// 4-1. blocking transfer
+   if ( OverlapFunc == NULL )
+   {
+#     ifdef TIMING
+//    it's better to add barrier before timing transferring data through MPI
+//    --> so that the timing results (i.e., the MPI bandwidth reported by OPT__TIMING_MPI ) does NOT include
+//        the time waiting for other ranks to reach here
+//    --> make the MPI bandwidth measured here more accurate
+      if ( OPT__TIMING_BARRIER )    TRACE_MPI_BARRIER();
+
+      if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
+#     endif
 
-   if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
-#  endif
+      TRACE_BEGIN( "LB_GetBufferData::Exchange", lv );
 
-   MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
-                        RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+      if ( OPT__PERSISTENT_MPI )
+      {
+         PersistReq_t *Persist = GetPersistReq( lv, GetBufMode, TVarCC, TVarFC, ParaBuf, SendBuf, RecvBuf,
+                                                Send_NCount, Send_NDisp, Recv_NCount, Recv_NDisp );
 
-#  ifdef TIMING
-   if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
-#  endif
+         MPI_Startall( Persist->NReq, Persist->Req );
+         MPI_Waitall ( Persist->NReq, Persist->Req, MPI_STATUSES_IGNORE );
+      }
+
+      else
+         MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
+                              RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+
+      TRACE_END();
+
+#     ifdef TIMING
+      if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
+#     endif
+   }
+
+
+// 4-2. non-blocking transfer overlapped with OverlapFunc()
+// --> skip empty messages and do not add barrier here since the purpose is to hide the communication time
+// --> only the time waiting for the communication to complete is recorded in Timer_MPI[1]
+   else
+   {
+      PersistReq_t *Persist = NULL;
+      MPI_Request  *Req     = NULL;
+      int           NReq    = 0;
+
+      if ( OPT__PERSISTENT_MPI )
+      {
+         Persist = GetPersistReq( lv, GetBufMode, TVarCC, TVarFC, ParaBuf, SendBuf, RecvBuf,
+                                  Send_NCount, Send_NDisp, Recv_NCount, Recv_NDisp );
+         Req     = Persist->Req;
+         NReq    = Persist->NReq;
+
+         MPI_Startall( NReq, Req );
+      }
+
+      else
+      {
+         Req  = new MPI_Request [ 2*MPI_NRank ];
+         NReq = 2*MPI_NRank;
+
+//       use a fixed tag as the persistent requests since there is at most one message between each pair of ranks
+//       and messages between the same pair are non-overtaking
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            if ( Send_NCount[r] > __INT_MAX__ )
+               Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, Send_NCount[r], (long)__INT_MAX__ );
+            if ( Recv_NCount[r] > __INT_MAX__ )
+               Aux_Error( ERROR_INFO, "Recv_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, Recv_NCount[r], (long)__INT_MAX__ );
+
+            if ( Recv_NCount[r] > 0 )
+               MPI_Irecv( RecvBuf+Recv_NDisp[r], (int)Recv_NCount[r], MPI_GAMER_REAL, r, 0,
+                          MPI_COMM_WORLD, &Req[2*r  ] );
+            else
+               Req[2*r  ] = MPI_REQUEST_NULL;
+
+            if ( Send_NCount[r] > 0 )
+               MPI_Isend( SendBuf+Send_NDisp[r], (int)Send_NCount[r], MPI_GAMER_REAL, r, 0,
+                          MPI_COMM_WORLD, &Req[2*r+1] );
+            else
+               Req[2*r+1] = MPI_REQUEST_NULL;
+         }
+      } // if ( OPT__PERSISTENT_MPI ) ... else ...
+
+      OverlapFunc( OverlapArg );
+
+#     ifdef TIMING
+      if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
+#     endif
+
+      TRACE_BEGIN( "LB_GetBufferData::Wait", lv );
+
+      MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+      TRACE_END();
+
+#     ifdef TIMING
+      if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
+#     endif
+
+      if ( Persist == NULL )  delete [] Req;
+   } // if ( OverlapFunc == NULL ) ... else ...
 
 
 
@@ -1900,8 +2020,178 @@ void LB_GetBufferData_MemFree()
       MPI_RecvBuf_Shared = NULL;
    }
 
+// persistent MPI requests
+   for (int lv=0; lv<NLEVEL; lv++)  LB_GetBufferData_FreePersistReq( lv );
+
+   if ( PersistReq_Comm != MPI_COMM_NULL )   MPI_Comm_free( &PersistReq_Comm );
+
 } // FUNCTION : LB_GetBufferData_MemFree
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_FreePersistReq
+// Description :  Free all persistent MPI requests of the target level
+//
+// Note        :  1. Invoked by LB_RecordExchangeDataPatchID() and LB_GetBufferData_MemFree()
+//                2. Persistent requests are only used by OPT__PERSISTENT_MPI
+//                3. Invoked whenever the MPI lists of the target level are reconstructed (e.g., after grid
+//                   refinement and load balancing) since the requests of the old lists are unlikely to be reused
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_FreePersistReq( const int lv )
+{
+
+   for (int t=0; t<NPERSIST_REQ; t++)  FreePersistReq( PersistReq[lv][t] );
+
+   PersistReq_Next[lv] = 0;
+
+} // FUNCTION : LB_GetBufferData_FreePersistReq
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPersistReq
+// Description :  Return the persistent MPI requests for exchanging the buffer data of the target level
+//
+// Note        :  1. Invoked by LB_GetBufferData() for OPT__PERSISTENT_MPI
+//                2. Requests are looked up by (GetBufMode, TVarCC, TVarFC, ParaBuf) on each level
+//                   --> Stored requests are reused only if the send/recv buffers and the number of elements
+//                       exchanged with each rank are unchanged, which guarantees that they match the current
+//                       send/recv lists
+//                   --> Otherwise they are rebuilt
+//                   --> The least recently created entry is replaced when all NPERSIST_REQ entries are in use
+//                3. Empty messages are skipped
+//                4. Use the duplicated communicator PersistReq_Comm so that the messages cannot be
+//                   mismatched with any other messages in MPI_COMM_WORLD
+//
+// Parameter   :  lv          : Target refinement level
+//                GetBufMode  : Exchange mode
+//                TVarCC      : Target cell-centered variables
+//                TVarFC      : Target face-centered variables
+//                ParaBuf     : Number of ghost zones
+//                SendBuf     : MPI send buffer
+//                RecvBuf     : MPI recv buffer
+//                Send_NCount : Number of elements sent to each rank
+//                Send_NDisp  : Displacement of the elements sent to each rank in SendBuf
+//                Recv_NCount : Number of elements received from each rank
+//                Recv_NDisp  : Displacement of the elements received from each rank in RecvBuf
+//
+// Return      :  Pointer to the target PersistReq_t object
+//-------------------------------------------------------------------------------------------------------
+PersistReq_t *GetPersistReq( const int lv, const GetBufMode_t GetBufMode, const long TVarCC, const long TVarFC,
+                             const int ParaBuf, real *SendBuf, real *RecvBuf,
+                             const long *Send_NCount, const long *Send_NDisp,
+                             const long *Recv_NCount, const long *Recv_NDisp )
+{
+
+// 1. look for the stored requests
+   int TSlot = -1;
+
+   for (int t=0; t<NPERSIST_REQ; t++)
+   {
+      const PersistReq_t *Persist = PersistReq[lv][t];
+
+      if ( Persist != NULL  &&  Persist->GetBufMode == GetBufMode  &&  Persist->TVarCC == TVarCC  &&
+           Persist->TVarFC == TVarFC  &&  Persist->ParaBuf == ParaBuf )
+      {
+         TSlot = t;
+         break;
+      }
+   }
+
+   if ( TSlot != -1 )
+   {
+      PersistReq_t *Persist = PersistReq[lv][TSlot];
+      bool          Reuse   = ( Persist->SendBuf == SendBuf  &&  Persist->RecvBuf == RecvBuf );
+
+      for (int r=0; r<MPI_NRank  &&  Reuse; r++)
+         if ( Persist->Send_NCount[r] != Send_NCount[r]  ||  Persist->Recv_NCount[r] != Recv_NCount[r] )
+            Reuse = false;
+
+      if ( Reuse )   return Persist;
+
+      FreePersistReq( PersistReq[lv][TSlot] );
+   }
+
+   else
+   {
+      TSlot = PersistReq_Next[lv];
+      PersistReq_Next[lv] = ( PersistReq_Next[lv] + 1 ) % NPERSIST_REQ;
+
+      FreePersistReq( PersistReq[lv][TSlot] );
+   }
+
+
+// 2. create new requests
+   if ( PersistReq_Comm == MPI_COMM_NULL )   MPI_Comm_dup( MPI_COMM_WORLD, &PersistReq_Comm );
+
+   PersistReq_t *Persist = new PersistReq_t;
+
+   Persist->GetBufMode  = GetBufMode;
+   Persist->TVarCC      = TVarCC;
+   Persist->TVarFC      = TVarFC;
+   Persist->ParaBuf     = ParaBuf;
+   Persist->SendBuf     = SendBuf;
+   Persist->RecvBuf     = RecvBuf;
+   Persist->Send_NCount = new long [MPI_NRank];
+   Persist->Recv_NCount = new long [MPI_NRank];
+   Persist->Req         = new MPI_Request [ 2*MPI_NRank ];
+   Persist->NReq        = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Send_NCount[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, Send_NCount[r], (long)__INT_MAX__ );
+      if ( Recv_NCount[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "Recv_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, Recv_NCount[r], (long)__INT_MAX__ );
+
+      Persist->Send_NCount[r] = Send_NCount[r];
+      Persist->Recv_NCount[r] = Recv_NCount[r];
+
+      if ( Recv_NCount[r] > 0 )
+         MPI_Recv_init( RecvBuf+Recv_NDisp[r], (int)Recv_NCount[r], MPI_GAMER_REAL, r, 0, PersistReq_Comm,
+                        &Persist->Req[ Persist->NReq ++ ] );
+
+      if ( Send_NCount[r] > 0 )
+         MPI_Send_init( SendBuf+Send_NDisp[r], (int)Send_NCount[r], MPI_GAMER_REAL, r, 0, PersistReq_Comm,
+                        &Persist->Req[ Persist->NReq ++ ] );
+   }
+
+   PersistReq[lv][TSlot] = Persist;
+
+   return Persist;
+
+} // FUNCTION : GetPersistReq
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FreePersistReq
+// Description :  Free a PersistReq_t object and its persistent MPI requests
+//
+// Note        :  1. All requests must be inactive (i.e., completed)
+//                2. Persist will be reset to NULL
+//
+// Parameter   :  Persist : PersistReq_t object to be freed (can be NULL)
+//-------------------------------------------------------------------------------------------------------
+void FreePersistReq( PersistReq_t *&Persist )
+{
+
+   if ( Persist == NULL )  return;
+
+   for (int t=0; t<Persist->NReq; t++)    MPI_Request_free( &Persist->Req[t] );
+
+   delete [] Persist->Req;
+   delete [] Persist->Send_NCount;
+   delete [] Persist->Recv_NCount;
+   delete    Persist;
+
+   Persist = NULL;
+
+} // FUNCTION : FreePersistReq
+
+
+
 #endif // #ifdef LOAD_BALANCE
@@ -88,6 +88,12 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
    }
 
 
+// discard the dt recorded for OPT__DT_FUSED since real patches may be redistributed
+#  if ( MODEL == HYDRO )
+   dt_Fused_Invalidate( TLv );
+#  endif
+
+
 // 0. set the target level(s)
    const int lv_min = ( TLv < 0 ) ?         0 : TLv;
    const int lv_max = ( TLv < 0 ) ? TOP_LEVEL : TLv;
@@ -9,7 +9,15 @@
 // Function    :  LB_RecordOverlapMPIPatchID
 // Description :  Construct the patch indices for overlapping MPI time with CPU/GPU computation
 //
-// Note        :  This function must be invoked AFTER LB_RecordExchangeDataPatchID()
+// Note        :  1. This function must be invoked AFTER LB_RecordExchangeDataPatchID()
+//                2. Fluid solver   : Sync  = patch groups with data to be sent to other ranks
+//                                    Async = patch groups with no data to be sent
+//                                    --> Sync patch groups are advanced first and the buffer data are then
+//                                        exchanged while advancing the Async patch groups
+//                3. Poisson solver : Sync  = patch groups adjacent to any sibling buffer patch
+//                                    Async = patch groups whose ghost zones require no sibling buffer patch
+//                                    --> Async patch groups are advanced while exchanging the density field
+//                                        of buffer patches and the Sync patch groups are advanced afterward
 //
 // Parameter   :  Lv : Target refinement level for recording lists
 //-------------------------------------------------------------------------------------------------------
@@ -28,8 +36,6 @@ void LB_RecordOverlapMPIPatchID( const int Lv )
    int **LB_SendH_IDList = amr->LB->SendH_IDList[Lv];
    bool *FluSyncList     = new bool [NReal0];
 #  ifdef GRAVITY
-   int  *LB_SendG_NList  = amr->LB->SendG_NList [Lv];
-   int **LB_SendG_IDList = amr->LB->SendG_IDList[Lv];
    bool *PotSyncList     = new bool [NReal0];
 #  endif
 
@@ -75,22 +81,30 @@ void LB_RecordOverlapMPIPatchID( const int Lv )
 #     endif
 
       FluSyncList[ID0] = true;
-#     ifdef GRAVITY
-      PotSyncList[ID0] = true;
-#     endif
    }
 
 #  ifdef GRAVITY
-   for (int r=0; r<MPI_NRank; r++)
-   for (int t=0; t<LB_SendG_NList[r]; t++)
-   {
-      ID0 = LB_SendG_IDList[r][t] / 8;
+// note that sibling patches not existing at Lv are filled by the coarse-grid data, which are assumed
+// to be ready before invoking the Poisson solver at Lv
+   const int NReal = amr->NPatchComma[Lv][1];
 
-#     ifdef GAMER_DEBUG
-      if ( ID0 >= NReal0 )    Aux_Error( ERROR_INFO, "ID0 (%d) >= NReal0 (%d) (gravity) !!\n", ID0, NReal0 );
-#     endif
-
-      PotSyncList[ID0] = true;
+   for (int t=0; t<NReal0; t++)
+   {
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID = t*8 + LocalID;
+
+         for (int s=0; s<26; s++)
+         {
+            if ( amr->patch[0][Lv][PID]->sibling[s] >= NReal )
+            {
+               PotSyncList[t] = true;
+               break;
+            }
+         }
+
+         if ( PotSyncList[t] )   break;
+      }
    }
 #  endif
 
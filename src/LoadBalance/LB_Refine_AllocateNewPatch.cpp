@@ -103,14 +103,11 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 // ==========================================================================================
    const int MirSib[26] = { 1,0,3,2,5,4,9,8,7,6,13,12,11,10,17,16,15,14,25,24,23,22,21,20,19,18 };
    const int FSg_Flu    = amr->FluSg[SonLv];
-   const int FSg_Flu2   = 1 - FSg_Flu;
 #  ifdef GRAVITY
    const int FSg_Pot    = amr->PotSg[SonLv];
-   const int FSg_Pot2   = 1 - FSg_Pot;
 #  endif
 #  ifdef MHD
    const int FSg_Mag    = amr->MagSg[SonLv];
-   const int FSg_Mag2   = 1 - FSg_Mag;
 #  endif
 
    int NBufBk=0, NBufBk_Dup;  // BufBk : backup the data of buffer patches
@@ -121,21 +118,20 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 
 // to avoid GNU warnings "non-constant array new length must be specified without parentheses around the type-id [-Wvla]"
 // --> see http://stackoverflow.com/questions/4523497/typedef-fixed-length-array
-   /*
-   real (**flu_BufBk)[PS1][PS1][PS1] = ( OPT__REUSE_MEMORY ) ? NULL : new ( real (*[SonNBuff])[PS1][PS1][PS1] );
-#  ifdef GRAVITY
-   real (**pot_BufBk)[PS1][PS1]      = ( OPT__REUSE_MEMORY ) ? NULL : new ( real (*[SonNBuff])[PS1][PS1] );
-#  endif
-   */
+// --> the buffer data are copied to flu/pot/mag_BufBk_Data[] instead of moving the array pointers so that
+//     fluid[], pot[], and magnetic[] never move between patches
    typedef real flu_type[PS1][PS1][PS1];
-   real (**flu_BufBk)[PS1][PS1][PS1]    = ( OPT__REUSE_MEMORY ) ? NULL : new flu_type *[SonNBuff];
+   real (**flu_BufBk)[PS1][PS1][PS1]    = new flu_type *[SonNBuff];
+   real  *flu_BufBk_Data                = NULL;
 #  ifdef GRAVITY
    typedef real pot_type[PS1][PS1];
-   real (**pot_BufBk)[PS1][PS1]         = ( OPT__REUSE_MEMORY ) ? NULL : new pot_type *[SonNBuff];
+   real (**pot_BufBk)[PS1][PS1]         = new pot_type *[SonNBuff];
+   real  *pot_BufBk_Data                = NULL;
 #  endif
 #  ifdef MHD
    typedef real mag_type[ PS1P1*SQR(PS1) ];
-   real (**mag_BufBk)[ PS1P1*SQR(PS1) ] = ( OPT__REUSE_MEMORY ) ? NULL : new mag_type *[SonNBuff];
+   real (**mag_BufBk)[ PS1P1*SQR(PS1) ] = new mag_type *[SonNBuff];
+   real  *mag_BufBk_Data                = NULL;
 #  endif
 
    if ( SonNBuff != 0 )
@@ -176,57 +172,57 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 
 
 //    2-2. backup fluid, potential and magnetic field data
+      flu_BufBk_Data = new real [ (long)NBufBk*NCOMP_TOTAL*CUBE(PS1) ];
+#     ifdef GRAVITY
+      pot_BufBk_Data = new real [ (long)NBufBk*CUBE(PS1) ];
+#     endif
+#     ifdef MHD
+      mag_BufBk_Data = new real [ (long)NBufBk*NCOMP_MAG*PS1P1*SQR(PS1) ];
+#     endif
+
       for (int t=0; t<NBufBk; t++)
       {
 //       note that this patch may have only fluid[]/magnetic[], only pot[], or both
          const int SonPID = PID_BufBk[t];
 
-//       2-2-1. if OPT__REUSE_MEMORY is used, backup fluid[], pot[], and magnetic[] by swapping the pointers of Sg=0/1
-//              so that these temporarily stored buffer patch data won't be overwritten by newly allocated real patches
-//              --> also note that we need to be careful about any routine that may swap patch pointers between
-//                  different PIDs (e.g., DeallocateSonPatch)
-//                  --> must swap back fluid[] with FSg_Flu2, pot[] with FSg_Pot2, and magnetic[] with FSg_Mag2
-//                      (otherwise these pointers will point to wrong arrays after swapping patch pointers)
-//              --> ugly trick ...
-         if ( OPT__REUSE_MEMORY )
-         {
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Flu ][SonLv][SonPID]->fluid,
-                             (void**)&amr->patch[FSg_Flu2][SonLv][SonPID]->fluid );
-
-#           ifdef GRAVITY
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Pot ][SonLv][SonPID]->pot,
-                             (void**)&amr->patch[FSg_Pot2][SonLv][SonPID]->pot );
-#           endif
+//       2-2-1. copy fluid[], pot[], and magnetic[] to the backup arrays
+//              --> no need to backup pot_ext[] since it's actually useless for buffer patches
+         const patch_t *BufPatch_Flu = amr->patch[FSg_Flu][SonLv][SonPID];
 
-#           ifdef MHD
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Mag ][SonLv][SonPID]->magnetic,
-                             (void**)&amr->patch[FSg_Mag2][SonLv][SonPID]->magnetic );
-#           endif
+         flu_BufBk[t] = NULL;
+         if ( BufPatch_Flu->fluid != NULL )
+         {
+            flu_BufBk[t] = ( real (*)[PS1][PS1][PS1] )( flu_BufBk_Data + (long)t*NCOMP_TOTAL*CUBE(PS1) );
+            memcpy( flu_BufBk[t], BufPatch_Flu->fluid, NCOMP_TOTAL*CUBE(PS1)*sizeof(real) );
          }
 
-//       2-2-2. if OPT__REUSE_MEMORY is not used, backup fluid[], pot[], and magnetic[] in temporary pointers
-//              --> no need to backup pot_ext[] since it's actually useless for buffer patches
-         else
+#        ifdef GRAVITY
+         const patch_t *BufPatch_Pot = amr->patch[FSg_Pot][SonLv][SonPID];
+
+         pot_BufBk[t] = NULL;
+         if ( BufPatch_Pot->pot != NULL )
          {
-            flu_BufBk[t] = amr->patch[FSg_Flu][SonLv][SonPID]->fluid;
-            amr->patch[FSg_Flu][SonLv][SonPID]->fluid    = NULL;
+            pot_BufBk[t] = ( real (*)[PS1][PS1] )( pot_BufBk_Data + (long)t*CUBE(PS1) );
+            memcpy( pot_BufBk[t], BufPatch_Pot->pot, CUBE(PS1)*sizeof(real) );
+         }
+#        endif
 
-#           ifdef GRAVITY
-            pot_BufBk[t] = amr->patch[FSg_Pot][SonLv][SonPID]->pot;
-            amr->patch[FSg_Pot][SonLv][SonPID]->pot      = NULL;
-#           endif
+#        ifdef MHD
+         const patch_t *BufPatch_Mag = amr->patch[FSg_Mag][SonLv][SonPID];
 
-#           ifdef MHD
-            mag_BufBk[t] = amr->patch[FSg_Mag][SonLv][SonPID]->magnetic;
-            amr->patch[FSg_Mag][SonLv][SonPID]->magnetic = NULL;
-#           endif
+         mag_BufBk[t] = NULL;
+         if ( BufPatch_Mag->magnetic != NULL )
+         {
+            mag_BufBk[t] = ( real (*)[ PS1P1*SQR(PS1) ] )( mag_BufBk_Data + (long)t*NCOMP_MAG*PS1P1*SQR(PS1) );
+            memcpy( mag_BufBk[t], BufPatch_Mag->magnetic, NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
          }
+#        endif
 
-//       2-2-3. store the padded 1D coordinate
+//       2-2-2. store the padded 1D coordinate
          PCr1D_BufBk[t] = amr->patch[0][SonLv][SonPID]->PaddedCr1D;
       } // for (int t=0; t<NBufBk; t++)
 
-//    2-2-4. sort PCr1D_BufBk
+//    2-2-3. sort PCr1D_BufBk
       Mis_Heapsort( NBufBk, PCr1D_BufBk, PCr1D_BufBk_IdxTable );
 
 
@@ -572,88 +568,45 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 // 10.1 get the match lists
    Mis_Matching_int( amr->num[SonLv], amr->LB->PaddedCr1DList[SonLv], NBufBk, PCr1D_BufBk, Match_BufBk );
 
-// 10.2 reset array pointers
+// 10.2 copy the backup data to the matched buffer patches
+// --> allocate data arrays only for the sandglass with backup data and leave the other sandglass unmodified
+//     (which can thus be NULL) since it will be allocated in LB_RecordExchangeDataPatchID() if necessary
    for (int t=0; t<NBufBk; t++)
    {
-      if ( Match_BufBk[t] != -1 )
-      {
-         MPID = amr->LB->PaddedCr1DList_IdxTable[SonLv][ Match_BufBk[t] ];
-
-#        ifdef GAMER_DEBUG
-         if ( MPID < amr->NPatchComma[SonLv][1] )
-            Aux_Error( ERROR_INFO, "Match_PID = %d matches to a real patch (Match[%d] = %d, SonNReal = %d) !!\n",
-                       MPID, t, Match_BufBk[t], amr->NPatchComma[SonLv][1] );
-#        endif
+      if ( Match_BufBk[t] == -1 )   continue;
 
-         if ( OPT__REUSE_MEMORY )
-         {
-            const int OldBufPID = PID_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-
-//          note that (1) we must swap poniters even if MPID == OldBufPID (because they have different Sg)
-//                    (2) we store the previous buffer data in FSg_Flu2, FSg_Pot2 and FSg_Mag2 instead of FSg_Flu, FSg_Pot, and FSg_Mag
-//                    (3) it's OK to leave FSg_Flu2, FSg_Pot2, and FSg_Mag2 of MPID unmodified after swapping pointers (which can thus be NULL)
-//                        since they will be allocated in LB_RecordExchangeDataPatchID() if necessary
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Flu ][SonLv][     MPID]->fluid,
-                             (void**)&amr->patch[FSg_Flu2][SonLv][OldBufPID]->fluid );
-
-#           ifdef GRAVITY
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Pot ][SonLv][     MPID]->pot,
-                             (void**)&amr->patch[FSg_Pot2][SonLv][OldBufPID]->pot );
-#           endif
+      MPID = amr->LB->PaddedCr1DList_IdxTable[SonLv][ Match_BufBk[t] ];
 
-#           ifdef MHD
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Mag ][SonLv][     MPID]->magnetic,
-                             (void**)&amr->patch[FSg_Mag2][SonLv][OldBufPID]->magnetic );
-#           endif
+#     ifdef GAMER_DEBUG
+      if ( MPID < amr->NPatchComma[SonLv][1] )
+         Aux_Error( ERROR_INFO, "Match_PID = %d matches to a real patch (Match[%d] = %d, SonNReal = %d) !!\n",
+                    MPID, t, Match_BufBk[t], amr->NPatchComma[SonLv][1] );
+#     endif
 
-//          we must reallocate memory for OldBufPID if it becomes a new real patch (which always have data array allocated)
-//          --> for buffer patches their data arrays are not allocated by default so we don't have to do anything here
-            if ( OldBufPID < amr->NPatchComma[SonLv][1] )
-            {
-               amr->patch[FSg_Flu2][SonLv][OldBufPID]->hnew();
-#              ifdef GRAVITY
-               amr->patch[FSg_Pot2][SonLv][OldBufPID]->gnew();
-#              endif
-#              ifdef MHD
-               amr->patch[FSg_Mag2][SonLv][OldBufPID]->mnew();
-#              endif
-            }
-         } // if ( OPT__REUSE_MEMORY )
+      const int BufBkIdx = PCr1D_BufBk_IdxTable[t];
 
-         else
-         {
-//          note that it's OK to leave FSg_Flu2, FSg_Pot2, FSg_Mag2 unmodified (which can thus be NULL) since
-//          it will be allocated in LB_RecordExchangeDataPatchID if necessary
-            real (*flu_ptr)[PS1][PS1][PS1] = flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-            if ( flu_ptr != NULL )
-               amr->patch[FSg_Flu][SonLv][MPID]->fluid = flu_ptr;
-
-#           ifdef GRAVITY
-//          don't worry about pot_ext since it's actually useless for buffer patches
-//          --> after the following operation, some buffer patches may have pot != NULL but pot_ext == NULL (for FSg_Pot)
-            real (*pot_ptr)[PS1][PS1] = pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-            if ( pot_ptr != NULL )
-               amr->patch[FSg_Pot][SonLv][MPID]->pot = pot_ptr;
-#           endif
+      if ( flu_BufBk[BufBkIdx] != NULL )
+      {
+         amr->patch[FSg_Flu][SonLv][MPID]->hnew();
+         memcpy( amr->patch[FSg_Flu][SonLv][MPID]->fluid, flu_BufBk[BufBkIdx], NCOMP_TOTAL*CUBE(PS1)*sizeof(real) );
+      }
 
-#           ifdef MHD
-            real (*mag_ptr)[ PS1P1*SQR(PS1) ] = mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-            if ( mag_ptr != NULL )
-               amr->patch[FSg_Mag][SonLv][MPID]->magnetic = mag_ptr;
-#           endif
-         } // if ( OPT__REUSE_MEMORY ) ... else ...
-      } // if ( Match_BufBk[t] != -1 )
+#     ifdef GRAVITY
+//    don't worry about pot_ext since it's actually useless for buffer patches
+      if ( pot_BufBk[BufBkIdx] != NULL )
+      {
+         amr->patch[FSg_Pot][SonLv][MPID]->gnew();
+         memcpy( amr->patch[FSg_Pot][SonLv][MPID]->pot, pot_BufBk[BufBkIdx], CUBE(PS1)*sizeof(real) );
+      }
+#     endif
 
-      else if ( ! OPT__REUSE_MEMORY )
+#     ifdef MHD
+      if ( mag_BufBk[BufBkIdx] != NULL )
       {
-         delete [] flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        ifdef GRAVITY
-         delete [] pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        endif
-#        ifdef MHD
-         delete [] mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        endif
-      } // if ( Match_BufBk[t] != -1 ) ... else if ...
+         amr->patch[FSg_Mag][SonLv][MPID]->mnew();
+         memcpy( amr->patch[FSg_Mag][SonLv][MPID]->magnetic, mag_BufBk[BufBkIdx], NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+      }
+#     endif
    } // for (int t=0; t<NBufBk; t++)
 
 
@@ -671,11 +624,14 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    delete [] PCr1D_BufBk_IdxTable;
    delete [] PID_BufBk;
    delete [] flu_BufBk;
+   delete [] flu_BufBk_Data;
 #  ifdef GRAVITY
    delete [] pot_BufBk;
+   delete [] pot_BufBk_Data;
 #  endif
 #  ifdef MHD
    delete [] mag_BufBk;
+   delete [] mag_BufBk_Data;
 #  endif
 
 } // FUNCTION : LB_Refine_AllocateNewPatch
@@ -1343,29 +1299,6 @@ void DeallocateSonPatch( const int FaLv, const int FaPID, const int NNew_Real0,
          for (int Sg=0; Sg<2; Sg++)
             Aux_SwapPointer( (void**)&amr->patch[Sg][SonLv][OldPID], (void**)&amr->patch[Sg][SonLv][NewPID] );
 
-//       swap back fluid[] with 1-FluSg, pot[] with 1-PotSg, and magnetic[] with 1-MagSg since
-//       we use them to temporarily store the buffer patch data if OPT__REUSE_MEMORY is used
-//       --> see the description in LB_Refine_AllocateNewPatch
-//       --> ugly trick ...
-         if ( OPT__REUSE_MEMORY )
-         {
-            const int FSg_Flu2 = 1 - amr->FluSg[SonLv];
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Flu2][SonLv][OldPID]->fluid,
-                             (void**)&amr->patch[FSg_Flu2][SonLv][NewPID]->fluid );
-
-#           ifdef GRAVITY
-            const int FSg_Pot2 = 1 - amr->PotSg[SonLv];
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Pot2][SonLv][OldPID]->pot,
-                             (void**)&amr->patch[FSg_Pot2][SonLv][NewPID]->pot );
-#           endif
-
-#           ifdef MHD
-            const int FSg_Mag2 = 1 - amr->MagSg[SonLv];
-            Aux_SwapPointer( (void**)&amr->patch[FSg_Mag2][SonLv][OldPID]->magnetic,
-                             (void**)&amr->patch[FSg_Mag2][SonLv][NewPID]->magnetic );
-#           endif
-         }
-
 //       reconstruct relation : grandson -> son
          OldGraPID0 = amr->patch[0][SonLv][NewPID]->son;
          if ( OldGraPID0 >= 0 )
@@ -61,7 +61,9 @@ void Init_MPI( int *argc, char ***argv )
    if ( MPI_SizePerNode == 1  &&  MPI_Rank == 0 )
       Aux_Message( stderr, "WARNING : Each node has only one MPI rank. Using more ranks per node may improve performance !!\n" );
 
-   MPI_Comm_free( &shmcomm );
+// record the node topology for OPT__NODE_AWARE_MPI
+// --> shmcomm will be freed by MPI_End_NodeAware()
+   MPI_Init_NodeAware( shmcomm );
 
 } // FUNCTION : Init_MPI
 
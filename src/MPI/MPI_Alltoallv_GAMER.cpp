@@ -21,6 +21,8 @@
 //                Recv_Datatype: Received data type for MPI (MPI_GAMER_REAL/MPI_GAMER_REAL_PAR/MPI_GAMER_LONG_PAR)
 //                comm:          MPI communicator
 //
+// Note        :  1. Use MPI_Alltoallv_NodeAware() for OPT__NODE_AWARE_MPI when comm == MPI_COMM_WORLD
+//
 // Return      :  RecvBuf
 //-------------------------------------------------------------------------------------------------------
 template<typename T>
@@ -35,6 +37,23 @@ void MPI_Alltoallv_GAMER( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_D
       if ( Recv_NCount[r] > __INT_MAX__ ) Aux_Error( ERROR_INFO, "Recv_NCount[%d] (%ld) > __INT_MAX__ (%ld)!!\n", r, Recv_NCount[r], (long)__INT_MAX__ );
    }
 
+// use the node-aware exchange if applicable
+#  ifdef LOAD_BALANCE
+   if ( OPT__NODE_AWARE_MPI  &&  comm == MPI_COMM_WORLD )
+   {
+      TRACE_BEGIN( "MPI_Alltoallv_NodeAware", -1 );
+
+      const bool Done = MPI_Alltoallv_NodeAware( SendBuf, Send_NCount, Send_NDisp, Send_Datatype,
+                                                 RecvBuf, Recv_NCount, Recv_NDisp, Recv_Datatype );
+
+      TRACE_END();
+
+      if ( Done )    return;
+   }
+#  endif
+
+   TRACE_BEGIN( "MPI_Alltoallv_GAMER", -1 );
+
    bool use_mpi_gamer_flag = false;
    if (  ( Send_NDisp[MPI_NRank-1] > __INT_MAX__ ) || ( Recv_NDisp[MPI_NRank-1] > __INT_MAX__ )  )    use_mpi_gamer_flag = true;
    MPI_Allreduce( MPI_IN_PLACE, &use_mpi_gamer_flag , 1, MPI_C_BOOL, MPI_LOR, MPI_COMM_WORLD );
@@ -77,11 +96,14 @@ void MPI_Alltoallv_GAMER( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_D
       delete [] Recv_NDisp_int;
    }
 
+   TRACE_END();
+
 } // FUNCTION : MPI_Alltoallv_GAMER
 
 
 
 // explicit template instantiation
+template void MPI_Alltoallv_GAMER <char>   ( char   *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, char   *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
 template void MPI_Alltoallv_GAMER <float>  ( float  *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, float  *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
 template void MPI_Alltoallv_GAMER <double> ( double *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, double *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
 template void MPI_Alltoallv_GAMER <int>    ( int    *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, int    *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
@@ -0,0 +1,393 @@
+#include "GAMER.h"
+
+#ifndef SERIAL
+
+
+
+
+// node topology shared by all node-aware MPI routines
+static MPI_Comm NA_NodeComm   = MPI_COMM_NULL;   // ranks sharing the same node
+static MPI_Comm NA_LeaderComm = MPI_COMM_NULL;   // leader ranks (i.e., NA_LocalRank == 0) of all nodes
+static int      NA_NNode      = 0;               // total number of nodes
+static int      NA_NodeID     = -1;              // node ID of this rank (== rank of its leader in NA_LeaderComm)
+static int      NA_LocalRank  = -1;              // rank of this rank in NA_NodeComm
+static int      NA_LocalNRank = 0;               // number of ranks in NA_NodeComm
+static int     *NA_Rank2Node  = NULL;            // node ID of each MPI_COMM_WORLD rank [MPI_NRank]
+static int     *NA_NodeNRank  = NULL;            // number of ranks on each node [NA_NNode]
+static int    **NA_Node2Rank  = NULL;            // MPI_COMM_WORLD rank of each local rank on each node [NA_NNode][NA_NodeNRank]
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_Init_NodeAware
+// Description :  Construct the node topology for the node-aware MPI routines
+//
+// Note        :  1. Invoked by Init_MPI()
+//                2. The ownership of NodeComm is transferred to this routine and it will be freed by
+//                   MPI_End_NodeAware()
+//                3. Node IDs are assigned according to the MPI_COMM_WORLD rank of the leader rank of each node
+//
+// Parameter   :  NodeComm : Communicator of the ranks sharing the same node (e.g., from MPI_Comm_split_type())
+//-------------------------------------------------------------------------------------------------------
+void MPI_Init_NodeAware( MPI_Comm NodeComm )
+{
+
+   NA_NodeComm = NodeComm;
+   MPI_Comm_rank( NA_NodeComm, &NA_LocalRank  );
+   MPI_Comm_size( NA_NodeComm, &NA_LocalNRank );
+
+   MPI_Comm_split( MPI_COMM_WORLD, (NA_LocalRank==0)?0:MPI_UNDEFINED, MPI_Rank, &NA_LeaderComm );
+
+   if ( NA_LocalRank == 0 )
+   {
+      MPI_Comm_rank( NA_LeaderComm, &NA_NodeID );
+      MPI_Comm_size( NA_LeaderComm, &NA_NNode  );
+   }
+
+   MPI_Bcast( &NA_NodeID, 1, MPI_INT, 0, NA_NodeComm );
+   MPI_Bcast( &NA_NNode,  1, MPI_INT, 0, NA_NodeComm );
+
+
+// record the node ID and local rank of all ranks
+   int  MyInfo[2] = { NA_NodeID, NA_LocalRank };
+   int *AllInfo   = new int [ 2*MPI_NRank ];
+
+   MPI_Allgather( MyInfo, 2, MPI_INT, AllInfo, 2, MPI_INT, MPI_COMM_WORLD );
+
+   NA_Rank2Node = new int  [MPI_NRank];
+   NA_NodeNRank = new int  [NA_NNode];
+   NA_Node2Rank = new int* [NA_NNode];
+
+   for (int r=0; r<MPI_NRank; r++)  NA_Rank2Node[r] = AllInfo[2*r];
+   for (int n=0; n<NA_NNode; n++)   NA_NodeNRank[n] = 0;
+   for (int r=0; r<MPI_NRank; r++)  NA_NodeNRank[ AllInfo[2*r] ] ++;
+   for (int n=0; n<NA_NNode; n++)   NA_Node2Rank[n] = new int [ NA_NodeNRank[n] ];
+   for (int r=0; r<MPI_NRank; r++)  NA_Node2Rank[ AllInfo[2*r] ][ AllInfo[2*r+1] ] = r;
+
+   delete [] AllInfo;
+
+} // FUNCTION : MPI_Init_NodeAware
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_End_NodeAware
+// Description :  Free the communicators and tables allocated by MPI_Init_NodeAware()
+//
+// Note        :  1. Invoked by End_GAMER() before MPI_Finalize()
+//-------------------------------------------------------------------------------------------------------
+void MPI_End_NodeAware()
+{
+
+   if ( NA_LeaderComm != MPI_COMM_NULL )  MPI_Comm_free( &NA_LeaderComm );
+   if ( NA_NodeComm   != MPI_COMM_NULL )  MPI_Comm_free( &NA_NodeComm   );
+
+   for (int n=0; n<NA_NNode; n++)   delete [] NA_Node2Rank[n];
+   delete [] NA_Node2Rank;
+   delete [] NA_NodeNRank;
+   delete [] NA_Rank2Node;
+
+   NA_Node2Rank = NULL;
+   NA_Rank2Node = NULL;
+   NA_NodeNRank = NULL;
+   NA_NNode     = 0;
+
+} // FUNCTION : MPI_End_NodeAware
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_Alltoallv_NodeAware
+// Description :  Node-aware alternative to MPI_Alltoallv() in MPI_COMM_WORLD
+//
+// Note        :  1. Invoked by MPI_Alltoallv_GAMER() when OPT__NODE_AWARE_MPI is on
+//                2. Procedure:
+//                   (1) Exchange data between ranks on the same node by MPI_Alltoallv() in NA_NodeComm
+//                   (2) Gather data to be sent to other nodes to the leader rank of each node
+//                   (3) Exchange the aggregated data between leader ranks, with a single message per pair of nodes
+//                   (4) Scatter the received data from the leader rank to the target ranks of each node
+//                   --> Reduce the number of inter-node messages from O(NRank^2) to O(NNode^2)
+//                3. Data sent to the same target node are ordered by (source local rank, target local rank)
+//                   and data scattered to each target rank are ordered by (source node, source local rank)
+//                4. Return false without transferring any data if the node-aware exchange is not beneficial
+//                   (i.e., only one node or one rank per node) or if the aggregated data may exceed __INT_MAX__
+//                   --> Caller must then fall back to the default exchange
+//                   --> It is a collective decision so that all ranks take the same path
+//                5. Send_Datatype and Recv_Datatype must be the MPI data type of T
+//
+// Parameter   :  See MPI_Alltoallv_GAMER()
+//
+// Return      :  RecvBuf, true/false --> data have/have not been transferred
+//-------------------------------------------------------------------------------------------------------
+template<typename T>
+bool MPI_Alltoallv_NodeAware( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype,
+                              T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype )
+{
+
+// 0. check whether the node-aware exchange is applicable
+   if ( NA_NNode <= 1  ||  NA_NNode == MPI_NRank )    return false;
+
+   const bool IsLeader = ( NA_LocalRank == 0 );
+   const int  L        = NA_LocalNRank;
+   const int *MyRank   = NA_Node2Rank[NA_NodeID];
+
+// number of elements sent to/received from other nodes by this rank
+   long NInter_Send = 0L, NInter_Recv = 0L;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( NA_Rank2Node[r] == NA_NodeID )    continue;
+
+      NInter_Send += Send_NCount[r];
+      NInter_Recv += Recv_NCount[r];
+   }
+
+// all counts and displacements of the aggregated messages must fit in int
+// --> conservatively estimate the size of the aggregated messages by the maximum of all ranks times
+//     the maximum number of ranks per node
+   long MaxN[4] = { MAX( NInter_Send, NInter_Recv ),
+                    Send_NDisp[MPI_NRank-1] + Send_NCount[MPI_NRank-1],
+                    Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1],
+                    (long)L };
+
+   MPI_Allreduce( MPI_IN_PLACE, MaxN, 4, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   if ( MaxN[0]*MaxN[3] > __INT_MAX__  ||  MaxN[1] > __INT_MAX__  ||  MaxN[2] > __INT_MAX__ )  return false;
+
+
+// 1. exchange data between ranks on the same node
+   int *Intra_SendCount = new int [L];
+   int *Intra_SendDisp  = new int [L];
+   int *Intra_RecvCount = new int [L];
+   int *Intra_RecvDisp  = new int [L];
+
+   for (int t=0; t<L; t++)
+   {
+      const int r = MyRank[t];
+
+      Intra_SendCount[t] = (int)Send_NCount[r];
+      Intra_SendDisp [t] = (int)Send_NDisp [r];
+      Intra_RecvCount[t] = (int)Recv_NCount[r];
+      Intra_RecvDisp [t] = (int)Recv_NDisp [r];
+   }
+
+   MPI_Alltoallv( SendBuf, Intra_SendCount, Intra_SendDisp, Send_Datatype,
+                  RecvBuf, Intra_RecvCount, Intra_RecvDisp, Recv_Datatype, NA_NodeComm );
+
+   delete [] Intra_SendCount;
+   delete [] Intra_SendDisp;
+   delete [] Intra_RecvCount;
+   delete [] Intra_RecvDisp;
+
+
+// 2. gather data to be sent to other nodes to the leader rank
+// 2-1. send and receive counts of all local ranks
+   long *SendCountMap = ( IsLeader ) ? new long [ (long)L*MPI_NRank ] : NULL;  // [source local rank][target rank]
+   long *RecvCountMap = ( IsLeader ) ? new long [ (long)L*MPI_NRank ] : NULL;  // [target local rank][source rank]
+
+   MPI_Gather( Send_NCount, MPI_NRank, MPI_LONG, SendCountMap, MPI_NRank, MPI_LONG, 0, NA_NodeComm );
+   MPI_Gather( Recv_NCount, MPI_NRank, MPI_LONG, RecvCountMap, MPI_NRank, MPI_LONG, 0, NA_NodeComm );
+
+// 2-2. pack data ordered by (target node, target local rank)
+   T *Inter_SendBuf = new T [NInter_Send];
+   T *SendPtr       = Inter_SendBuf;
+
+   for (int n=0; n<NA_NNode; n++)
+   {
+      if ( n == NA_NodeID )   continue;
+
+      for (int t=0; t<NA_NodeNRank[n]; t++)
+      {
+         const int r = NA_Node2Rank[n][t];
+
+         memcpy( SendPtr, SendBuf+Send_NDisp[r], Send_NCount[r]*sizeof(T) );
+         SendPtr += Send_NCount[r];
+      }
+   }
+
+// 2-3. gather to the leader rank
+   int *Gather_Count = NULL, *Gather_Disp = NULL;
+   T   *Gather_Buf   = NULL;
+
+   if ( IsLeader )
+   {
+      Gather_Count = new int [L];
+      Gather_Disp  = new int [L];
+
+      for (int s=0; s<L; s++)
+      {
+         long Count = 0L;
+         for (int r=0; r<MPI_NRank; r++)
+            if ( NA_Rank2Node[r] != NA_NodeID )    Count += SendCountMap[ (long)s*MPI_NRank + r ];
+
+         Gather_Count[s] = (int)Count;
+         Gather_Disp [s] = ( s == 0 ) ? 0 : Gather_Disp[s-1] + Gather_Count[s-1];
+      }
+
+      Gather_Buf = new T [ Gather_Disp[L-1] + Gather_Count[L-1] ];
+   }
+
+   MPI_Gatherv( Inter_SendBuf, (int)NInter_Send, Send_Datatype, Gather_Buf, Gather_Count, Gather_Disp, Send_Datatype,
+                0, NA_NodeComm );
+
+   delete [] Inter_SendBuf;
+
+
+// 3. exchange the aggregated data between leader ranks
+   T *Scatter_Buf = NULL;
+   int *Scatter_Count = NULL, *Scatter_Disp = NULL;
+
+   if ( IsLeader )
+   {
+//    3-1. reorder data by (target node, source local rank, target local rank)
+      int  *Leader_SendCount = new int  [NA_NNode];
+      int  *Leader_SendDisp  = new int  [NA_NNode];
+      int  *Leader_RecvCount = new int  [NA_NNode];
+      int  *Leader_RecvDisp  = new int  [NA_NNode];
+      long *Gather_Offset    = new long [L];
+      T    *Leader_SendBuf   = new T    [ Gather_Disp[L-1] + Gather_Count[L-1] ];
+      long  SendIdx          = 0L;
+
+      for (int s=0; s<L; s++)    Gather_Offset[s] = Gather_Disp[s];
+
+      for (int n=0; n<NA_NNode; n++)
+      {
+         Leader_SendDisp[n] = (int)SendIdx;
+
+         if ( n != NA_NodeID )
+         for (int s=0; s<L; s++)
+         {
+            long Count = 0L;
+            for (int t=0; t<NA_NodeNRank[n]; t++)  Count += SendCountMap[ (long)s*MPI_NRank + NA_Node2Rank[n][t] ];
+
+            memcpy( Leader_SendBuf+SendIdx, Gather_Buf+Gather_Offset[s], Count*sizeof(T) );
+            SendIdx          += Count;
+            Gather_Offset[s] += Count;
+         }
+
+         Leader_SendCount[n] = (int)SendIdx - Leader_SendDisp[n];
+      }
+
+      delete [] Gather_Buf;
+      delete [] Gather_Offset;
+
+//    3-2. get the receive counts from the receive counts of all local ranks
+      long RecvIdx = 0L;
+
+      for (int n=0; n<NA_NNode; n++)
+      {
+         long Count = 0L;
+
+         if ( n != NA_NodeID )
+         for (int t=0; t<L; t++)
+         for (int s=0; s<NA_NodeNRank[n]; s++)
+            Count += RecvCountMap[ (long)t*MPI_NRank + NA_Node2Rank[n][s] ];
+
+         Leader_RecvCount[n] = (int)Count;
+         Leader_RecvDisp [n] = (int)RecvIdx;
+         RecvIdx            += Count;
+      }
+
+      T *Leader_RecvBuf = new T [RecvIdx];
+
+      MPI_Alltoallv( Leader_SendBuf, Leader_SendCount, Leader_SendDisp, Send_Datatype,
+                     Leader_RecvBuf, Leader_RecvCount, Leader_RecvDisp, Recv_Datatype, NA_LeaderComm );
+
+      delete [] Leader_SendBuf;
+      delete [] Leader_SendCount;
+      delete [] Leader_SendDisp;
+      delete [] Leader_RecvCount;
+      delete [] Leader_RecvDisp;
+
+//    3-3. reorder data by (target local rank, source node, source local rank)
+      Scatter_Count = new int  [L];
+      Scatter_Disp  = new int  [L];
+      long *Scatter_Offset = new long [L];
+
+      for (int t=0; t<L; t++)
+      {
+         long Count = 0L;
+         for (int r=0; r<MPI_NRank; r++)
+            if ( NA_Rank2Node[r] != NA_NodeID )    Count += RecvCountMap[ (long)t*MPI_NRank + r ];
+
+         Scatter_Count [t] = (int)Count;
+         Scatter_Disp  [t] = ( t == 0 ) ? 0 : Scatter_Disp[t-1] + Scatter_Count[t-1];
+         Scatter_Offset[t] = Scatter_Disp[t];
+      }
+
+      Scatter_Buf = new T [RecvIdx];
+      RecvIdx     = 0L;
+
+      for (int n=0; n<NA_NNode; n++)
+      {
+         if ( n == NA_NodeID )   continue;
+
+         for (int s=0; s<NA_NodeNRank[n]; s++)
+         for (int t=0; t<L; t++)
+         {
+            const long Count = RecvCountMap[ (long)t*MPI_NRank + NA_Node2Rank[n][s] ];
+
+            memcpy( Scatter_Buf+Scatter_Offset[t], Leader_RecvBuf+RecvIdx, Count*sizeof(T) );
+            Scatter_Offset[t] += Count;
+            RecvIdx           += Count;
+         }
+      }
+
+      delete [] Leader_RecvBuf;
+      delete [] Scatter_Offset;
+   } // if ( IsLeader )
+
+   delete [] SendCountMap;
+   delete [] RecvCountMap;
+
+
+// 4. scatter the received data from the leader rank to the target ranks
+   T *Inter_RecvBuf = new T [NInter_Recv];
+
+   MPI_Scatterv( Scatter_Buf, Scatter_Count, Scatter_Disp, Recv_Datatype, Inter_RecvBuf, (int)NInter_Recv, Recv_Datatype,
+                 0, NA_NodeComm );
+
+   delete [] Scatter_Buf;
+   delete [] Scatter_Count;
+   delete [] Scatter_Disp;
+
+// unpack data ordered by (source node, source local rank)
+   T *RecvPtr = Inter_RecvBuf;
+
+   for (int n=0; n<NA_NNode; n++)
+   {
+      if ( n == NA_NodeID )   continue;
+
+      for (int s=0; s<NA_NodeNRank[n]; s++)
+      {
+         const int r = NA_Node2Rank[n][s];
+
+         memcpy( RecvBuf+Recv_NDisp[r], RecvPtr, Recv_NCount[r]*sizeof(T) );
+         RecvPtr += Recv_NCount[r];
+      }
+   }
+
+   delete [] Inter_RecvBuf;
+   delete [] Gather_Count;
+   delete [] Gather_Disp;
+
+
+   return true;
+
+} // FUNCTION : MPI_Alltoallv_NodeAware
+
+
+
+
+
+// explicit template instantiation
+template bool MPI_Alltoallv_NodeAware <char>   ( char   *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, char   *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template bool MPI_Alltoallv_NodeAware <float>  ( float  *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, float  *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template bool MPI_Alltoallv_NodeAware <double> ( double *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, double *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template bool MPI_Alltoallv_NodeAware <int>    ( int    *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, int    *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template bool MPI_Alltoallv_NodeAware <long>   ( long   *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, long   *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+
+
+
+#endif // #ifndef SERIAL
@@ -36,13 +36,16 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 {
 
 #  ifdef TIMING
-   MPI_Barrier( MPI_COMM_WORLD );
+   TRACE_MPI_BARRIER();
    Timer_Lv[lv]->Start();
 #  endif
 
+   TRACE_BEGIN( "EvolveLevel", lv );
+
 
 #  ifdef GRAVITY
    const bool   UsePot            = ( OPT__SELF_GRAVITY  ||  OPT__EXT_POT );
+   const bool   LevelMG           = ( OPT__SELF_GRAVITY  &&  OPT__LEVEL_MG  &&  lv > 0 );
 #  endif
 #  ifdef PARTICLE
    const bool   StoreAcc_Yes      = true;
@@ -62,6 +65,35 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    double dTime_SoFar, dTime_SubStep, dt_SubStep, TimeOld, TimeNew, AutoReduceDtCoeff;
 
 
+// overlap the exchange of the updated fluid field with the fluid solver for OPT__OVERLAP_MPI
+// --> only applicable when no other operation modifies the fluid field between the fluid solver and
+//     the buffer exchange in step 8, which excludes
+//     (a) GRAVITY              : step 4   (Poisson + gravity solver)
+//     (b) SrcTerms.Any         : step 6-1 (local source terms)
+//     (c) GRACKLE_ACTIVATE     : step 6-2 (Grackle cooling/heating)
+//     (d) SF_CREATE_STAR_SCHEME: step 6-3 (star formation)
+//     (e) FB_Any               : step 6-4 (feedback)
+//     (f) OPT__RESET_FLUID     : step 7   (Flu_ResetByUser_API_Ptr)
+//     (g) ELBDM_BASE_SPECTRAL  : step 2   (the base-level spectral solver bypasses the overlapped solver)
+   bool OverlapMPI_Flu = ( OPT__OVERLAP_MPI  &&  !SrcTerms.Any );
+#  ifdef GRAVITY
+   OverlapMPI_Flu = false;
+#  endif
+#  ifdef SUPPORT_GRACKLE
+   if ( GRACKLE_ACTIVATE )    OverlapMPI_Flu = false;
+#  endif
+#  ifdef STAR_FORMATION
+   if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )  OverlapMPI_Flu = false;
+#  endif
+#  ifdef FEEDBACK
+   if ( FB_Any )              OverlapMPI_Flu = false;
+#  endif
+   if ( OPT__RESET_FLUID )    OverlapMPI_Flu = false;
+#  if ( MODEL == ELBDM  &&  defined SUPPORT_FFTW )
+   if ( lv == 0  &&  ELBDM_BASE_SPECTRAL )   OverlapMPI_Flu = false;
+#  endif
+
+
 // reset the workload weighting at each level to be recorded later
    if ( lv == 0 ) {
       for (int TLv=0; TLv<NLEVEL; TLv++)  amr->NUpdateLv[TLv] = 0; }
@@ -80,7 +112,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //    1. calculate the evolution time-step
 // ===============================================================================================
 #     ifdef TIMING
-      if ( OPT__TIMING_BARRIER )    MPI_Barrier( MPI_COMM_WORLD );
+      if ( OPT__TIMING_BARRIER )    TRACE_MPI_BARRIER();
       Timer_dt[lv]->Start();
 #     endif
 
@@ -153,54 +185,10 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Flu_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
-      if ( false ) {}
-      /*
-      if ( OPT__OVERLAP_MPI )
-      {
-//       enable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( true );
-#        endif
-
-//       advance patches needed to be sent
-         TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, true ),
-                        Timer_Flu_Advance[lv],   TIMER_ON   );
-
-#        pragma omp parallel sections num_threads(2)
-         {
-#           pragma omp section
-            {
-//             transfer data simultaneously
-#              ifdef GRAVITY
-               if ( OPT__SELF_GRAVITY )
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT,   NULL_INT, DATA_GENERAL, _DENS,  _NONE, Rho_ParaBuf, USELB_YES ),
-                              Timer_GetBuf[lv][0],   TIMER_ON   );
-#              else
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
-                              Timer_GetBuf[lv][2],   TIMER_ON   );
-#              endif
-            }
-
-#           pragma omp section
-            {
-//             advance patches not needed to be sent
-               TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
-                              Timer_Flu_Advance[lv],   TIMER_ON   );
-            }
-         } // OpenMP parallel sections
-
-//       disable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( false );
-#        endif
-      } // if ( OPT__OVERLAP_MPI )
-      */
-
-      else
       {
          int FluStatus_AllRank;
 
-         TIMING_FUNC(   FluStatus_AllRank = Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, false, false ),
+         TIMING_FUNC(   FluStatus_AllRank = Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, OverlapMPI_Flu ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
 //       do nothing if AUTO_REDUCE_DT is disabled
@@ -300,8 +288,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
             } // if ( FluStatus_AllRank == GAMER_SUCCESS ) ... else ...
          } // if ( AUTO_REDUCE_DT )
-
-      } // if ( OPT__OVERLAP_MPI ) ... else ...
+      }
 
       amr->FluSg    [lv]             = SaveSg_Flu;
       amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
@@ -353,76 +340,30 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          Aux_Message( stdout, "   Lv %2d: Gra_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
       if ( lv == 0 )
-         Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot, UsePot, true, false, false, true );
+         Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot, UsePot, true, false, true );
 
       else // lv > 0
       {
-         if ( false ) {}
-         /*
-         if ( OPT__OVERLAP_MPI )
-         {
-//          enable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( true );
-#           endif
-
-//          advance patches needed to be sent
-            TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                           UsePot, true, true, true, true ),
-                           Timer_Gra_Advance[lv],   TIMER_ON   );
-
-#           pragma omp parallel sections num_threads(2)
-            {
-#              pragma omp section
-               {
-//                transfer data simultaneously
-                  if ( UsePot )
-                  TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
-                                                    _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][1],   TIMER_ON   );
-
-                  TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
-                                                    _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][2],   TIMER_ON   );
-               }
-
-#              pragma omp section
-               {
-//                advance patches not needed to be sent
-                  TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                                UsePot, true, true, false, true ),
-                                 Timer_Gra_Advance[lv],   TIMER_ON   );
-               }
-            } // OpenMP parallel sections
-
-//          disable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( false );
-#           endif
-         } // if ( OPT__OVERLAP_MPI )
-         */
-
-         else
-         {
-//          exchange the updated density field in the buffer patches for the Poisson solver
-            if ( OPT__SELF_GRAVITY )
-            TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
-                                              _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
-                           Timer_GetBuf[lv][0],   TIMER_ON   );
-
-            TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                          UsePot, true, false, false, true ),
-                           Timer_Gra_Advance[lv],   TIMER_ON   );
-
-//          exchange the updated potential in the buffer patches
-//          --> we will do this after all other operations (e.g., star formation) if OPT__MINIMIZE_MPI_BARRIER is adopted
-//              --> assuming that all remaining operations do not need to access the potential in the buffer patches
-//              --> one must enable both STORE_POT_GHOST and PAR_IMPROVE_ACC for this purpose
-            if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER )
-            TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
-                                              _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                           Timer_GetBuf[lv][1],   TIMER_ON   );
-         } // if ( OPT__OVERLAP_MPI ) ... else ...
+//       exchange the updated density field in the buffer patches for the Poisson solver
+//       --> for OPT__OVERLAP_MPI, it will be done in Gra_AdvanceDt() simultaneously with the Poisson solver
+         if ( OPT__SELF_GRAVITY  &&  !OPT__OVERLAP_MPI )
+         TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
+                                           _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
+                        Timer_GetBuf[lv][0],   TIMER_ON   );
+
+         TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
+                                       UsePot, true, OPT__OVERLAP_MPI, true ),
+                        Timer_Gra_Advance[lv],   TIMER_ON   );
+
+//       exchange the updated potential in the buffer patches
+//       --> we will do this after all other operations (e.g., star formation) if OPT__MINIMIZE_MPI_BARRIER is adopted
+//           --> assuming that all remaining operations do not need to access the potential in the buffer patches
+//           --> one must enable both STORE_POT_GHOST and PAR_IMPROVE_ACC for this purpose
+//       --> already done in Gra_AdvanceDt() for OPT__LEVEL_MG
+         if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER  &&  !LevelMG )
+         TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
+                                           _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
+                        Timer_GetBuf[lv][1],   TIMER_ON   );
 
          if ( UsePot )
          {
@@ -507,6 +448,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Src_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_SrcFlu, SaveSg_SrcMag, false, false ),
                         Timer_Src_Advance[lv],   TIMER_ON   );
 
+//       discard the dt recorded for OPT__DT_FUSED since the fluid data have been modified
+#        if ( MODEL == HYDRO )
+         dt_Fused_Invalidate( lv );
+#        endif
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 
@@ -526,6 +472,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Grackle_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Che, false, false ),
                         Timer_Che_Advance[lv],   TIMER_ON   );
 
+//       discard the dt recorded for OPT__DT_FUSED since the fluid data have been modified
+#        if ( MODEL == HYDRO )
+         dt_Fused_Invalidate( lv );
+#        endif
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       } // if ( GRACKLE_ACTIVATE )
 #     endif // #ifdef SUPPORT_GRACKLE
@@ -560,6 +511,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   SF_CreateStar( lv, TimeNew, dt_SubStep ),
                         Timer_SF[lv],   TIMER_ON   );
 
+//       discard the dt recorded for OPT__DT_FUSED since the fluid data have been modified
+#        if ( MODEL == HYDRO )
+         dt_Fused_Invalidate( lv );
+#        endif
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       } // if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
 #     endif // #ifdef STAR_FORMATION
@@ -587,6 +543,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   FB_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_FBFlu, SaveSg_FBMag ),
                         Timer_FB_Advance[lv],   TIMER_ON   );
 
+//       discard the dt recorded for OPT__DT_FUSED since the fluid data have been modified
+#        if ( MODEL == HYDRO )
+         dt_Fused_Invalidate( lv );
+#        endif
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 #     endif // #ifdef FEEDBACK
@@ -603,6 +564,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          {
             TIMING_FUNC(   Flu_ResetByUser_API_Ptr( lv, SaveSg_Flu, SaveSg_Mag, TimeNew, dt_SubStep ),
                            Timer_Flu_Advance[lv],   TIMER_ON   );
+
+//          discard the dt recorded for OPT__DT_FUSED since the fluid data have been modified
+#           if ( MODEL == HYDRO )
+            dt_Fused_Invalidate( lv );
+#           endif
          }
 
          else
@@ -614,13 +580,15 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //    8. update MPI buffers
 // ===============================================================================================
 //    exchange the updated fluid field in the buffer patches
+//    --> already done in Flu_AdvanceDt() if OverlapMPI_Flu is on
+      if ( !OverlapMPI_Flu )
       TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
                                         _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][2],   TIMER_ON   );
 
 //    exchange the updated potential in the buffer patches here if OPT__MINIMIZE_MPI_BARRIER is adopted
 #     ifdef GRAVITY
-      if ( lv > 0  &&  UsePot  &&  OPT__MINIMIZE_MPI_BARRIER )
+      if ( lv > 0  &&  UsePot  &&  OPT__MINIMIZE_MPI_BARRIER  &&  !LevelMG )
       TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                         _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][1],   TIMER_ON   );
@@ -705,14 +673,14 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //       11. enter the next refinement level
 // ===============================================================================================
 #        ifdef TIMING
-         MPI_Barrier( MPI_COMM_WORLD );
+         TRACE_MPI_BARRIER();
          Timer_Lv[lv]->Stop();
 #        endif
 
          EvolveLevel( lv+1, dTime_SubStep );
 
 #        ifdef TIMING
-         MPI_Barrier( MPI_COMM_WORLD );
+         TRACE_MPI_BARRIER();
          Timer_Lv[lv]->Start();
 #        endif
 // ===============================================================================================
@@ -816,6 +784,13 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
                                            FixUpVar_Flux | FixUpVar_Restrict, _MAG, Flu_ParaBuf, USELB_YES ),
                         Timer_GetBuf[lv][3],   TIMER_ON   );
 
+//       12-5. discard the dt recorded for OPT__DT_FUSED since the fix-up operations have modified the data
+//             --> must be done on all ranks since the coarse patches corrected by the flux fix-up
+//                 may have no sons on this rank
+#        if ( MODEL == HYDRO )
+         dt_Fused_Invalidate( lv );
+#        endif
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 // ===============================================================================================
 
@@ -955,8 +930,10 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    } // while()
 
 
+   TRACE_END();
+
 #  ifdef TIMING
-   MPI_Barrier( MPI_COMM_WORLD );
+   TRACE_MPI_BARRIER();
    Timer_Lv[lv]->Stop();
 #  endif
 
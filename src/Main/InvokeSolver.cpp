@@ -5,7 +5,7 @@ static void Preparation_Step( const Solver_t TSolver, const int lv, const double
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
                     const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const double dt, const double TimeNew );
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -242,7 +242,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
       TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt, TimeNew ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -258,7 +258,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
    TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt, TimeNew ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -269,6 +269,44 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InvokeSolver_Prepare / InvokeSolver_Solve
+// Description :  Invoke the preparation and execution steps of InvokeSolver() separately
+//
+// Note        :  1. Used by the micro-benchmark suite gamer_bench to measure the solvers in isolation
+//                   --> Do NOT use them in the regular time integration since the results are never stored
+//                       by the closing step
+//                2. Always use the array index 0
+//                3. InvokeSolver_Solve() synchronizes the GPU before returning
+//
+// Parameter   :  See InvokeSolver()
+//                NPG       : Number of patch groups to be prepared/solved (must be <= FLU/POT_GPU_NPGROUP)
+//                PID0_List : List recording the patch indices with LocalID==0 to be prepared
+//-------------------------------------------------------------------------------------------------------
+void InvokeSolver_Prepare( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                           const int NPG, const int *PID0_List )
+{
+
+   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG, PID0_List, 0, GlobalTree );
+
+} // FUNCTION : InvokeSolver_Prepare
+
+
+
+void InvokeSolver_Solve( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                         const int NPG, const double dt, const double Poi_Coeff )
+{
+
+   Solver( TSolver, lv, TimeNew, TimeOld, NPG, 0, dt, Poi_Coeff );
+
+#  ifdef GPU
+   CUAPI_Synchronize();
+#  endif
+
+} // FUNCTION : InvokeSolver_Solve
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Preparation_Step
 // Description :  Prepare the input data for the CPU/GPU solvers
@@ -792,9 +830,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
+//                TimeNew    : Target physical time to reach (for OPT__DT_FUSED in Gra_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const double dt, const double TimeNew )
 {
 
 #  ifndef DUAL_ENERGY
@@ -827,13 +866,13 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 
       case GRAVITY_SOLVER :
          Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
-                    NPG, PID0_List );
+                    h_Pot_Array_P_Out[ArrayID], h_Corner_Array_PGT[ArrayID], NPG, PID0_List, TimeNew );
       break;
 
       case POISSON_AND_GRAVITY_SOLVER :
          Poi_Close( lv, SaveSg_Pot, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List );
          Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
-                    NPG, PID0_List );
+                    h_Pot_Array_P_Out[ArrayID], h_Corner_Array_PGT[ArrayID], NPG, PID0_List, TimeNew );
       break;
 #     endif
 
@@ -63,6 +63,7 @@ int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, O
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION, OPT__FLAG_ANGULAR, OPT__FLAG_RADIAL;
 int                  OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
 bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_FUSED;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
@@ -72,10 +73,32 @@ bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID,
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
 bool                 OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+bool                 OPT__RECORD_TRACE;
+long                 TRACE_STEP_START, TRACE_STEP_END;
+int                  TRACE_MAX_EVENT;
 char                 OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
+bool                 OPT__OUTPUT_NODE_LOCAL, OPT__NODE_LOCAL_DRAIN;
+char                 NODE_LOCAL_DIR[MAX_STRING];
+int                  NODE_LOCAL_STEP;
+int                  OPT__OUTPUT_DEFLATE;
+double               OUTPUT_LOSSY_REL_ERR;
+int                  OPT__OUTPUT_IMAGE, OUTPUT_IMAGE_STEP, OUTPUT_IMAGE_NPIX, OUTPUT_IMAGE_AXIS;
+char                 OUTPUT_IMAGE_FIELD[MAX_STRING];
+double               OUTPUT_IMAGE_SLICE_X, OUTPUT_IMAGE_SLICE_Y, OUTPUT_IMAGE_SLICE_Z;
+char                 OUTPUT_BASEPS_FIELD[MAX_STRING];
+bool                 OUTPUT_BASEPS_CROSS;
+int                  OUTPUT_BASEPS_LEVEL, OUTPUT_BASEPS_STEP;
 int                  OPT__UM_IC_FLOAT8;
 double               COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
 int                  COM_MAX_ITER;
+bool                 OPT__RECORD_CLUMP;
+char                 CLUMP_FIELD[MAX_STRING];
+double               CLUMP_THRESHOLD;
+int                  CLUMP_MIN_NCELL;
+#ifdef MASSIVE_PARTICLES
+double               CLUMP_FOF_LINKLEN;
+int                  CLUMP_FOF_MIN_NPAR;
+#endif
 double               ANGMOM_ORIGIN_X, ANGMOM_ORIGIN_Y, ANGMOM_ORIGIN_Z;
 double               FLAG_ANGULAR_CEN_X, FLAG_ANGULAR_CEN_Y, FLAG_ANGULAR_CEN_Z;
 double               FLAG_RADIAL_CEN_X, FLAG_RADIAL_CEN_Y, FLAG_RADIAL_CEN_Z;
@@ -101,6 +124,8 @@ double               GAMMA, MINMOD_COEFF, AUTO_REDUCE_MINMOD_FACTOR, AUTO_REDUCE
 LR_Limiter_t         OPT__LR_LIMITER;
 Opt1stFluxCorr_t     OPT__1ST_FLUX_CORR;
 OptRSolver1st_t      OPT__1ST_FLUX_CORR_SCHEME;
+char                 NUC_TABLE[MAX_STRING];
+long                 NUC_BENCHMARK;
 bool                 OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP, OPT__FLAG_LOHNER_ENTR;
 bool                 OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES, OPT__LAST_RESORT_FLOOR;
 bool                 OPT__OUTPUT_DIVVEL, OPT__OUTPUT_MACH, OPT__OUTPUT_PRES, OPT__OUTPUT_CS;
@@ -174,6 +199,9 @@ bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, O
 double               SOR_OMEGA;
 int                  SOR_MAX_ITER, SOR_MIN_ITER;
 double               MG_TOLERATED_ERROR;
+bool                 OPT__LEVEL_MG;
+int                  LEVEL_MG_MAX_ITER;
+double               LEVEL_MG_TOLERATED_ERROR;
 int                  MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
 char                 EXT_POT_TABLE_NAME[MAX_STRING];
 double               EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
@@ -211,6 +239,8 @@ double               LB_INPUT__PAR_WEIGHT;
 #endif
 bool                 OPT__RECORD_LOAD_BALANCE;
 bool                 OPT__LB_EXCHANGE_FATHER;
+bool                 OPT__NODE_AWARE_MPI;
+bool                 OPT__PERSISTENT_MPI;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
@@ -224,7 +254,7 @@ bool                 FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #ifdef PARTICLE
 double               DT__PARVEL, DT__PARVEL_MAX, DT__PARACC;
 bool                 OPT__CK_PARTICLE, OPT__FLAG_NPAR_CELL, OPT__FLAG_PAR_MASS_CELL, OPT__FREEZE_PAR, OPT__OUTPUT_PAR_MESH;
-int                  OPT__OUTPUT_PAR_MODE, OPT__PARTICLE_COUNT, OPT__FLAG_NPAR_PATCH, PAR_IC_FLOAT8, PAR_IC_INT8, FlagTable_NParPatch[NLEVEL-1], FlagTable_NParCell[NLEVEL-1];
+int                  OPT__OUTPUT_PAR_MODE, OPT__PARTICLE_COUNT, OPT__FLAG_NPAR_PATCH, PAR_IC_FLOAT8, PAR_IC_INT8, PAR_IC_LOAD_NRANK, FlagTable_NParPatch[NLEVEL-1], FlagTable_NParCell[NLEVEL-1];
 double               FlagTable_ParMassCell[NLEVEL-1];
 ParOutputDens_t      OPT__OUTPUT_PAR_DENS;
 #endif
@@ -587,9 +617,14 @@ Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 
 Timer_t  Timer_OutputWalltime;
 
+// whether the current step is recorded by the event tracer (OPT__RECORD_TRACE)
+bool     Trace_Active = false;
+
 
 
 
+// main() of the micro-benchmark suite gamer_bench is defined in Benchmark/Bench_Main.cpp instead
+#ifndef GAMER_BENCH
 //-------------------------------------------------------------------------------------------------------
 // Function    :  main
 // Description :  GAMER main function
@@ -622,6 +657,16 @@ int main( int argc, char *argv[] )
 
    Output_DumpData( 0 );
 
+   if ( OPT__OUTPUT_IMAGE )               Output_Image( 0 );
+
+#  ifdef SUPPORT_HDF5
+   if ( OPT__OUTPUT_NODE_LOCAL )          Output_DumpData_NodeLocal( 0 );
+#  endif
+
+#  ifdef SUPPORT_FFTW
+   if ( OUTPUT_BASEPS_STEP > 0 )          Output_BasePowerSpectrum_Step( 0 );
+#  endif
+
    if ( OPT__PATCH_COUNT > 0 )            Aux_Record_PatchCount();
    if ( OPT__RECORD_MEMORY )              Aux_GetMemInfo();
    if ( OPT__RECORD_USER ) {
@@ -630,6 +675,7 @@ int main( int argc, char *argv[] )
          Aux_Error( ERROR_INFO, "Aux_Record_User_Ptr == NULL for OPT__RECORD_USER !!\n" );
    }
    if ( OPT__RECORD_CENTER )              Aux_Record_Center();
+   if ( OPT__RECORD_CLUMP )               Aux_Record_Clump();
 
 #  ifdef PARTICLE
    if ( OPT__PARTICLE_COUNT > 0 )         Par_Aux_Record_ParticleCount();
@@ -673,6 +719,8 @@ int main( int argc, char *argv[] )
 #     ifdef TIMING
       MPI_Barrier( MPI_COMM_WORLD );
       Timer_Main[0]->Start();    // timer for one iteration
+
+      Aux_Trace_SetStep( Step+1 );
 #     endif
 
 
@@ -711,6 +759,19 @@ int main( int argc, char *argv[] )
 //    ---------------------------------------------------------------------------------------------------
       TIMING_FUNC(   Output_DumpData( 1 ),            Timer_Main[3],   TIMER_ON   );
 
+      if ( OPT__OUTPUT_IMAGE )
+      TIMING_FUNC(   Output_Image( 1 ),               Timer_Main[3],   TIMER_ON   );
+
+#     ifdef SUPPORT_HDF5
+      if ( OPT__OUTPUT_NODE_LOCAL )
+      TIMING_FUNC(   Output_DumpData_NodeLocal( 1 ),  Timer_Main[3],   TIMER_ON   );
+#     endif
+
+#     ifdef SUPPORT_FFTW
+      if ( OUTPUT_BASEPS_STEP > 0 )
+      TIMING_FUNC(   Output_BasePowerSpectrum_Step( 1 ), Timer_Main[3], TIMER_ON   );
+#     endif
+
       if ( OPT__PATCH_COUNT == 1 )
       TIMING_FUNC(   Aux_Record_PatchCount(),         Timer_Main[4],   TIMER_ON   );
 
@@ -731,6 +792,9 @@ int main( int argc, char *argv[] )
       if ( OPT__RECORD_CENTER )
       TIMING_FUNC(   Aux_Record_Center(),             Timer_Main[4],   TIMER_ON   );
 
+      if ( OPT__RECORD_CLUMP )
+      TIMING_FUNC(   Aux_Record_Clump(),              Timer_Main[4],   TIMER_ON   );
+
       TIMING_FUNC(   Aux_Check(),                     Timer_Main[4],   TIMER_ON   );
 
 #     if ( MODEL == ELBDM )
@@ -825,6 +889,9 @@ int main( int argc, char *argv[] )
 
       Aux_ResetTimer();
 
+      if ( OPT__RECORD_TRACE  &&  Step >= TRACE_STEP_END )
+      Aux_Record_Trace();
+
       Timer_Other.Stop();
 #     endif
 //    ---------------------------------------------------------------------------------------------------
@@ -846,6 +913,16 @@ int main( int argc, char *argv[] )
 // output the final result
    Output_DumpData( 2 );
 
+   if ( OPT__OUTPUT_IMAGE )   Output_Image( 2 );
+
+#  ifdef SUPPORT_HDF5
+   if ( OPT__OUTPUT_NODE_LOCAL )  Output_DumpData_NodeLocal( 2 );
+#  endif
+
+#  ifdef SUPPORT_FFTW
+   if ( OUTPUT_BASEPS_STEP > 0 )  Output_BasePowerSpectrum_Step( 2 );
+#  endif
+
 
 // record the total simulation time
 #  ifdef TIMING
@@ -868,4 +945,5 @@ int main( int argc, char *argv[] )
    return 0;
 
 } // FUNCTION : Main
+#endif // #ifndef GAMER_BENCH
 
@@ -622,6 +622,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #     pragma omp for schedule( runtime )
       for (int TID=0; TID<NPG; TID++)
       {
+         TRACE_BEGIN( "Prepare_PatchData::PatchGroup", lv );
+
          PID0 = PID0_List[TID];
 
 #        ifdef GAMER_DEBUG
@@ -2184,6 +2186,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             } // for (int LocalID=0; LocalID<8; LocalID++)
          } // if ( PrepUnit == UNIT_PATCH )
 
+         TRACE_END();
+
       } // for (int TID=0; TID<NPG; TID++)
 
       if ( PrepUnit == UNIT_PATCH )
@@ -3726,6 +3730,8 @@ void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const real Tole
 // Note        :  1. Use "patch group" as the preparation unit
 //                   --> The data of all patches within the same patch group will be prepared
 //                2. Patches stored in PID0_List must be real patches (must NOT be buffer patches)
+//                3. Look up the per-patch bitmask cached by the global tree, which is independent of the tree depth
+//                   --> See LB_GlobalTree::ConstructWaveMask()
 //
 // Parameter   :  lv                   : Target refinement level
 //                h_HasWaveCounterpart : Array to store the prepared booleans indicating which cells have
@@ -3781,7 +3787,7 @@ void Prepare_PatchData_HasWaveCounterpart( const int lv, bool h_HasWaveCounterpa
             for (int j=0; j<PS1; j++)  {  J    = j + Disp_j;
                                           Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
             for (int i=0; i<PS1; i++)  {
-               h_HasWaveCounterpart[TID][Idx1] = ELBDM_HasWaveCounterpart( i, j, k, GID, GID, *GlobalTree );
+               h_HasWaveCounterpart[TID][Idx1] = GlobalTree->HasWaveCounterpart( i, j, k, GID );
                Idx1 ++;
             }}}
          } // for (int LocalID=0; LocalID<8; LocalID++ )
@@ -3819,7 +3825,7 @@ void Prepare_PatchData_HasWaveCounterpart( const int lv, bool h_HasWaveCounterpa
                   for (int j=0; j<loop[1]; j++)  { J = j + disp[1];   J2 = j + disp2[1];
                                                    Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                   for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
-                     h_HasWaveCounterpart[TID][Idx1] = ELBDM_HasWaveCounterpart( I2, J2, K2, SibGID, SibGID, *GlobalTree );
+                     h_HasWaveCounterpart[TID][Idx1] = GlobalTree->HasWaveCounterpart( I2, J2, K2, SibGID );
                      Idx1 ++;
                   }}}
 
@@ -0,0 +1,353 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+void CPU_dtSolver_HydroCFL( real g_dt_Array[], const real g_Flu_Array[][FLU_NIN_T][ CUBE(PS1) ],
+                            const real g_Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG,
+                            const real dh, const real Safety, const real MinPres,
+                            const EoS_t EoS, const MicroPhy_t MicroPhy );
+#ifdef GRAVITY
+void CPU_dtSolver_HydroGravity( real g_dt_Array[],
+                                const real g_Pot_Array[][ CUBE(GRA_NXT) ],
+                                const double g_Corner_Array[][3],
+                                const int NPatchGroup, const real dh, const real Safety, const bool P5_Gradient,
+                                const bool UsePot, const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func,
+                                const double c_ExtAcc_AuxArray[],
+                                const double ExtAcc_Time );
+#endif
+
+
+// minimum dt recorded by the closing steps of the fluid/gravity solvers on each level
+// --> index 0/1 = DT_FLU_SOLVER/DT_GRA_SOLVER
+static double Fused_dt    [2][NLEVEL];
+static double Fused_Safety[2][NLEVEL];
+static bool   Fused_Valid [NLEVEL] = { false };
+
+// per-thread arrays storing the fluid data of one patch group
+static real (*Fused_Flu_Array)[8][FLU_NIN_T][ CUBE(PS1) ]      = NULL;
+#ifdef MHD
+static real (*Fused_Mag_Array)[8][NCOMP_MAG][ PS1P1*SQR(PS1) ] = NULL;
+#endif
+
+// EoS object with the CPU function pointers
+// --> in GPU builds, the global object "EoS" stores the GPU function pointers instead
+static EoS_t Fused_EoS;
+
+static int GetSolverIdx( const Solver_t TSolver );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Start
+// Description :  Start recording the fluid and gravity dt criteria on level "lv" in the closing steps of
+//                the fluid/gravity solvers for OPT__DT_FUSED
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() before invoking the fluid solver
+//                2. The recorded dt is computed from the data stored by the LAST solver updating the fluid
+//                   --> Gra_Close() when GRAVITY is on and Flu_Close() otherwise
+//                3. Later modifications to the fluid are not taken into account
+//                   --> EvolveLevel() calls dt_Fused_Invalidate() after the source terms, Grackle, star formation,
+//                       feedback, OPT__RESET_FLUID, and the fix-up operations from level "lv+1"
+//                   --> levels with any patch on level "lv+1" thus always fall back to the dt solvers
+//                4. The recorded dt will be discarded by dt_Fused_Invalidate() when the patches on level "lv"
+//                   change
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void dt_Fused_Start( const int lv )
+{
+
+   Fused_Valid[lv] = OPT__DT_FUSED;
+
+   if ( !OPT__DT_FUSED )   return;
+
+
+// allocate the per-thread arrays and set the CPU EoS object only once
+   if ( Fused_Flu_Array == NULL )
+   {
+      Fused_Flu_Array = new real [OMP_NTHREAD][8][FLU_NIN_T][ CUBE(PS1) ];
+#     ifdef MHD
+      Fused_Mag_Array = new real [OMP_NTHREAD][8][NCOMP_MAG][ PS1P1*SQR(PS1) ];
+#     endif
+
+      Fused_EoS = EoS;
+#     ifdef GPU
+      Fused_EoS.DensEint2Pres_FuncPtr = EoS_DensEint2Pres_CPUPtr;
+      Fused_EoS.DensPres2Eint_FuncPtr = EoS_DensPres2Eint_CPUPtr;
+      Fused_EoS.DensPres2CSqr_FuncPtr = EoS_DensPres2CSqr_CPUPtr;
+      Fused_EoS.DensEint2Temp_FuncPtr = EoS_DensEint2Temp_CPUPtr;
+      Fused_EoS.DensTemp2Pres_FuncPtr = EoS_DensTemp2Pres_CPUPtr;
+      Fused_EoS.DensEint2Entr_FuncPtr = EoS_DensEint2Entr_CPUPtr;
+      Fused_EoS.GuessHTilde_FuncPtr   = EoS_GuessHTilde_CPUPtr;
+      Fused_EoS.HTilde2Temp_FuncPtr   = EoS_HTilde2Temp_CPUPtr;
+      Fused_EoS.Temp2HTilde_FuncPtr   = EoS_Temp2HTilde_CPUPtr;
+      Fused_EoS.General_FuncPtr       = EoS_General_CPUPtr;
+#     ifdef COSMIC_RAY
+      Fused_EoS.CREint2CRPres_FuncPtr = EoS_CREint2CRPres_CPUPtr;
+#     endif
+      Fused_EoS.AuxArrayDevPtr_Flt    = EoS_AuxArray_Flt;
+      Fused_EoS.AuxArrayDevPtr_Int    = EoS_AuxArray_Int;
+      Fused_EoS.Table                 = h_EoS_Table;
+#     endif // #ifdef GPU
+   } // if ( Fused_Flu_Array == NULL )
+
+
+// initialize the dt as an extremely large value, which will be reset by dt_Fused_Record()
+   for (int s=0; s<2; s++)    Fused_dt[s][lv] = HUGE_NUMBER;
+
+   Fused_Safety[0][lv] = ( Step == 0 ) ? DT__FLUID_INIT : DT__FLUID;
+#  ifdef GRAVITY
+   Fused_Safety[1][lv] = DT__GRAVITY;
+#  endif
+
+} // FUNCTION : dt_Fused_Start
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Flu
+// Description :  Estimate the minimum fluid dt of a single patch group from the data just stored by
+//                the closing step of the fluid/gravity solver
+//
+// Note        :  1. Invoked by Flu_Close() or Gra_Close() for OPT__DT_FUSED
+//                2. Thread-safe when invoked inside an OpenMP parallel region
+//                   --> Each thread uses its own copy of the per-thread arrays
+//                3. Use CPU_dtSolver_HydroCFL() to give identical results as the dt solver
+//
+// Parameter   :  lv    : Target refinement level
+//                FluSg : Sandglass of the updated fluid data
+//                MagSg : Sandglass of the updated B field (for MHD only)
+//                PID0  : Patch index with LocalID==0
+//
+// Return      :  Minimum dt among the eight patches
+//-------------------------------------------------------------------------------------------------------
+real dt_Fused_Flu( const int lv, const int FluSg, const int MagSg, const int PID0 )
+{
+
+#  ifdef OPENMP
+   const int TID = omp_get_thread_num();
+#  else
+   const int TID = 0;
+#  endif
+
+   real (*Flu_Array)[FLU_NIN_T][ CUBE(PS1) ]      = Fused_Flu_Array[TID];
+#  ifdef MHD
+   real (*Mag_Array)[NCOMP_MAG][ PS1P1*SQR(PS1) ] = Fused_Mag_Array[TID];
+#  else
+   real (*Mag_Array)[NCOMP_MAG][ PS1P1*SQR(PS1) ] = NULL;
+#  endif
+
+// the data of the target patch group have just been written and are likely still in cache
+// --> copy the entire patch group at once if its data are contiguous (see AMR_t::GroupFluid())
+   const real *FluGroup = ( FLU_NIN_T == NCOMP_TOTAL ) ? amr->GroupFluid( FluSg, lv, PID0 ) : NULL;
+
+   if ( FluGroup != NULL )
+      memcpy( Flu_Array[0][0], FluGroup, 8*FLU_NIN_T*CUBE(PS1)*sizeof(real) );
+
+   else
+   for (int LocalID=0; LocalID<8; LocalID++)
+      memcpy( Flu_Array[LocalID][0], amr->patch[FluSg][lv][PID0+LocalID]->fluid[0][0][0],
+              FLU_NIN_T*CUBE(PS1)*sizeof(real) );
+
+#  ifdef MHD
+   const real *MagGroup = amr->GroupMagnetic( MagSg, lv, PID0 );
+
+   if ( MagGroup != NULL )
+      memcpy( Mag_Array[0][0], MagGroup, 8*NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+
+   else
+   for (int LocalID=0; LocalID<8; LocalID++)
+      memcpy( Mag_Array[LocalID][0], amr->patch[MagSg][lv][PID0+LocalID]->magnetic[0],
+              NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+#  endif
+
+   real dt_Array[8], dt_min=HUGE_NUMBER;
+
+   CPU_dtSolver_HydroCFL( dt_Array, Flu_Array, Mag_Array, 1, amr->dh[lv], Fused_Safety[0][lv], MIN_PRES,
+                          Fused_EoS, MicroPhy );
+
+   for (int LocalID=0; LocalID<8; LocalID++)    dt_min = FMIN( dt_min, dt_Array[LocalID] );
+
+   return dt_min;
+
+} // FUNCTION : dt_Fused_Flu
+
+
+
+#ifdef GRAVITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Gra
+// Description :  Estimate the minimum gravity dt of a single patch group from the potential used by the
+//                gravity solver
+//
+// Note        :  1. Invoked by Gra_Close() for OPT__DT_FUSED
+//                2. Use CPU_dtSolver_HydroGravity() to give identical results as the dt solver, except
+//                   that the ghost zones of the potential may differ slightly when the Poisson and gravity
+//                   solvers are invoked together
+//
+// Parameter   :  lv           : Target refinement level
+//                Pot_Array    : Potential of the eight patches including ghost zones
+//                Corner_Array : Physical corner coordinates of the eight patches (for OPT__EXT_ACC only)
+//                TimeNew      : Physical time of the potential and external acceleration
+//
+// Return      :  Minimum dt among the eight patches
+//-------------------------------------------------------------------------------------------------------
+real dt_Fused_Gra( const int lv, const real Pot_Array[][ CUBE(GRA_NXT) ], const double Corner_Array[][3],
+                   const double TimeNew )
+{
+
+   real dt_Array[8], dt_min=HUGE_NUMBER;
+
+   CPU_dtSolver_HydroGravity( dt_Array, Pot_Array, Corner_Array, 1, amr->dh[lv], Fused_Safety[1][lv],
+                              OPT__GRA_P5_GRADIENT, (OPT__SELF_GRAVITY || OPT__EXT_POT), OPT__EXT_ACC,
+                              CPUExtAcc_Ptr, ExtAcc_AuxArray, TimeNew );
+
+   for (int LocalID=0; LocalID<8; LocalID++)    dt_min = FMIN( dt_min, dt_Array[LocalID] );
+
+   return dt_min;
+
+} // FUNCTION : dt_Fused_Gra
+#endif // #ifdef GRAVITY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Record
+// Description :  Record the minimum dt obtained by a single call to the closing step of the fluid/gravity solver
+//
+// Note        :  1. Must NOT be invoked inside an OpenMP parallel region
+//
+// Parameter   :  TSolver : Target dt solver
+//                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
+//                lv      : Target refinement level
+//                dt_min  : Minimum dt to be recorded
+//-------------------------------------------------------------------------------------------------------
+void dt_Fused_Record( const Solver_t TSolver, const int lv, const double dt_min )
+{
+
+   const int s = GetSolverIdx( TSolver );
+
+   Fused_dt[s][lv] = fmin( Fused_dt[s][lv], dt_min );
+
+} // FUNCTION : dt_Fused_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Get
+// Description :  Get the minimum dt of this rank recorded by the closing steps of the fluid/gravity solvers
+//
+// Note        :  1. Invoked by dt_InvokeSolver()
+//                2. Return false if the safety factor has changed since recording (e.g., from DT__FLUID_INIT
+//                   to DT__FLUID)
+//                3. Also return false if the record has been discarded by dt_Fused_Invalidate()
+//                   --> e.g., after the fix-up operations from level "lv+1" in EvolveLevel()
+//
+// Parameter   :  TSolver : Target dt solver
+//                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
+//                lv      : Target refinement level
+//                dt_min  : Variable to store the recorded dt
+//
+// Return      :  true  --> dt_min has been set
+//                false --> no valid record on level "lv" and dt_min is not modified
+//-------------------------------------------------------------------------------------------------------
+bool dt_Fused_Get( const Solver_t TSolver, const int lv, double *dt_min )
+{
+
+   if ( !OPT__DT_FUSED  ||  !Fused_Valid[lv] )  return false;
+
+   const int s = GetSolverIdx( TSolver );
+
+   double Safety = NULL_REAL;
+   if      ( TSolver == DT_FLU_SOLVER )  Safety = ( Step == 0 ) ? DT__FLUID_INIT : DT__FLUID;
+#  ifdef GRAVITY
+   else if ( TSolver == DT_GRA_SOLVER )  Safety = DT__GRAVITY;
+#  endif
+   else
+      Aux_Error( ERROR_INFO, "unsupported \"TSolver\" (%d) !!\n", TSolver );
+
+   if ( Safety != Fused_Safety[s][lv] )   return false;
+
+   *dt_min = Fused_dt[s][lv];
+
+   return true;
+
+} // FUNCTION : dt_Fused_Get
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_Invalidate
+// Description :  Discard the dt criteria recorded on level "lv" for OPT__DT_FUSED
+//
+// Note        :  1. Must be invoked whenever the real patches on level "lv" change or their data are modified
+//                   in a way that can invalidate the recorded dt (e.g., grid refinement and load balancing)
+//                   --> dt_InvokeSolver() will then invoke the dt solver instead until the next call to
+//                       dt_Fused_Start()
+//                2. lv < 0 --> apply to all levels
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void dt_Fused_Invalidate( const int lv )
+{
+
+   if ( lv < 0 )
+      for (int TLv=0; TLv<NLEVEL; TLv++)  Fused_Valid[TLv] = false;
+
+   else if ( lv < NLEVEL )
+      Fused_Valid[lv] = false;
+
+} // FUNCTION : dt_Fused_Invalidate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Fused_MemFree
+// Description :  Free the per-thread arrays allocated by dt_Fused_Start()
+//
+// Note        :  1. Invoked by End_MemFree()
+//-------------------------------------------------------------------------------------------------------
+void dt_Fused_MemFree()
+{
+
+   delete [] Fused_Flu_Array;    Fused_Flu_Array = NULL;
+#  ifdef MHD
+   delete [] Fused_Mag_Array;    Fused_Mag_Array = NULL;
+#  endif
+
+   dt_Fused_Invalidate( -1 );
+
+} // FUNCTION : dt_Fused_MemFree
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetSolverIdx
+// Description :  Convert the target dt solver to the first index of Fused_dt[] and Fused_Safety[]
+//
+// Parameter   :  TSolver : Target dt solver
+//
+// Return      :  0/1 for DT_FLU_SOLVER/DT_GRA_SOLVER
+//-------------------------------------------------------------------------------------------------------
+int GetSolverIdx( const Solver_t TSolver )
+{
+
+   switch ( TSolver )
+   {
+      case DT_FLU_SOLVER:  return 0;
+#     ifdef GRAVITY
+      case DT_GRA_SOLVER:  return 1;
+#     endif
+      default:
+         Aux_Error( ERROR_INFO, "unsupported \"TSolver\" (%d) !!\n", TSolver );
+         return -1;
+   }
+
+} // FUNCTION : GetSolverIdx
+
+
+
+#endif // #if ( MODEL == HYDRO )
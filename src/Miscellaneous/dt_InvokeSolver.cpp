@@ -11,6 +11,9 @@ double dt_min_for_solver;
 //
 // Note        :  1. Invoked by Mis_GetTimeStep()
 //                2. The global variable "dt_min_for_solver" will be set by dt_Close()
+//                3. For OPT__DT_FUSED, use the dt recorded by the closing steps of the fluid/gravity solvers
+//                   instead of invoking the dt solver whenever it is available
+//                   --> See dt_Fused_Start()
 //
 // Parameter   :  TSolver : Target dt solver
 //                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
@@ -26,6 +29,9 @@ double dt_InvokeSolver( const Solver_t TSolver, const int lv )
 
 
 // invoke the target dt solver
+#  if ( MODEL == HYDRO )
+   if ( ! dt_Fused_Get(TSolver, lv, &dt_min_for_solver) )
+#  endif
    InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
 
 
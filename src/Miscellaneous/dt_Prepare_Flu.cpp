@@ -13,6 +13,7 @@
 //                   --> Including/Excluding passive scalars for general/constant-gamma EoS
 //                3. Use patches instead of patch groups as the basic unit
 //                4. No ghost zones
+//                5. Copy the entire patch group at once if its data are contiguous (see AMR_t::GroupFluid())
 //
 // Parameter   :  lv            : Target refinement level
 //                h_Flu_Array_T : Host array to store the prepared fluid data
@@ -27,23 +28,32 @@ void dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
 #  pragma omp parallel for schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
-      const int PID0 = PID0_List[TID];
-
+      const int   PID0     = PID0_List[TID];
+//    FLU_NIN_T < NCOMP_TOTAL skips the passive scalars of each patch and thus cannot copy the entire patch group at once
+      const real *FluGroup = ( FLU_NIN_T == NCOMP_TOTAL ) ? amr->GroupFluid( amr->FluSg[lv], lv, PID0 ) : NULL;
+#     ifdef MHD
+      const real *MagGroup = amr->GroupMagnetic( amr->MagSg[lv], lv, PID0 );
+#     endif
+
+//    fluid variables (including/excluding passive scalars for general/constant-gamma EoS)
+      if ( FluGroup != NULL )
+         memcpy( h_Flu_Array_T[8*TID][0], FluGroup, 8*FLU_NIN_T*CUBE(PS1)*sizeof(real) );
+
+      else
       for (int LocalID=0; LocalID<8; LocalID++)
-      {
-         const int PID = PID0 + LocalID;
-         const int N   = 8*TID + LocalID;
-
-//       fluid variables (including/excluding passive scalars for general/constant-gamma EoS)
-         memcpy( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
+         memcpy( h_Flu_Array_T[ 8*TID + LocalID ][0], amr->patch[ amr->FluSg[lv] ][lv][ PID0 + LocalID ]->fluid[0][0][0],
                  FLU_NIN_T*CUBE(PS1)*sizeof(real) );
 
-//       B field
-#        ifdef MHD
-         memcpy( h_Mag_Array_T[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
+//    B field
+#     ifdef MHD
+      if ( MagGroup != NULL )
+         memcpy( h_Mag_Array_T[8*TID][0], MagGroup, 8*NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+
+      else
+      for (int LocalID=0; LocalID<8; LocalID++)
+         memcpy( h_Mag_Array_T[ 8*TID + LocalID ][0], amr->patch[ amr->MagSg[lv] ][lv][ PID0 + LocalID ]->magnetic[0],
                  NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
-#        endif
-      }
+#     endif
    } // for (int TID=0; TID<NPG; TID++)
 
 } // FUNCTION : dt_Prepare_Flu
@@ -45,24 +45,39 @@ const static flag_spectral_float  Flag_Spectral_Polynomials[FLAG_SPECTRAL_ORDER]
 // Note        :  1. This function is called once per patch group by Flag_Real()
 //                2. The size of the array Var1D must be PS2 + 2
 //                   --> Assume a ghost size of 1
+//                3. All lines of the patch group along one direction are evaluated together as a small
+//                   matrix-matrix product Coeff[order][line] = Poly[order][t] * Data[t][line]
+//                   --> Data are first gathered such that the line index is contiguous, which allows the
+//                       innermost loop over lines to be vectorized
+//                   --> The summation order of each coefficient is the same as evaluating one line at a time
+//                4. Return as soon as Cond > Threshold since the patch group will be flagged anyway
+//                   --> Coefficients are evaluated from the lowest order, which is usually the largest
+//                   --> Cond is then a lower bound of the magnitude of the largest coefficient
+//                5. Work must be allocated by the caller once per OpenMP thread with at least
+//                   (PS2 + 2 + 2)*SQR(PS2) elements
+//                   --> Size1D*NLine for the gathered lines and 2*NLine for the left/right coefficients
+//                   --> Avoid allocating the work arrays for every patch group
 //
-// Parameter   :  Var1D : Array storing the input real and imaginary parts
-//                Cond  : Reference to a floating-point variable storing the magnitude
-//                        of the largest coefficient
+// Parameter   :  Var1D     : Array storing the input real and imaginary parts
+//                Threshold : Refinement threshold (i.e., FlagTable_Spectral[lv][0])
+//                Work      : Work array of the calling thread (see note 5)
+//                Cond      : Reference to a floating-point variable storing the magnitude
+//                            of the largest coefficient
 //
-// Return      :  Cond 
+// Return      :  Cond
 //-------------------------------------------------------------------------------------------------------
-void Prepare_for_Spectral_Criterion( const real *Var1D, real& Cond )
+void Prepare_for_Spectral_Criterion( const real *Var1D, const real Threshold, flag_spectral_float *Work,
+                                     real& Cond )
 {
 
-// set the stride to a small value to sample the wave function evenly
-   const size_t Stride    = 1;
-   const size_t GhostSize = 1;
-   const size_t Size1D    = PS2 + 2*GhostSize;
-   const size_t MaxOrder  = 14;
-   const size_t NField    = 2;
+   const int GhostSize = 1;
+   const int Size1D    = PS2 + 2*GhostSize;
+   const int MaxOrder  = FLAG_SPECTRAL_ORDER;
+   const int NField    = 2;
+   const int NLine     = SQR( PS2 );                 // number of lines along each direction
+   const int RightDisp = Size1D - MaxOrder;          // displacement of the right boundary window
 // number of coefficients to consider for checking whether expansion has converged
-   const size_t NCutoff   = OPT__FLAG_SPECTRAL_N;
+   const int NCutoff   = OPT__FLAG_SPECTRAL_N;
 
 
 // check
@@ -72,55 +87,78 @@ void Prepare_for_Spectral_Criterion( const real *Var1D, real& Cond )
                  OPT__FLAG_SPECTRAL_N, MaxOrder );
 #  endif
 
-   const real* Re1D = Var1D;
-   const real* Im1D = Var1D + CUBE(Size1D);
-
-   real Row[NField][Size1D];  // array for reading input data
+   flag_spectral_float (*Data)[NLine] = ( flag_spectral_float (*)[NLine] )Work;   // [t][line] of one field
+   flag_spectral_float  *LCoeff       = Work + Size1D*NLine;
+   flag_spectral_float  *RCoeff       = LCoeff + NLine;
+   flag_spectral_float   CondMax      = 0.0;
 
 // initialise with 0
    Cond = 0;
 
-// iterate over 3 dimensions and sample the physical 2D arrays with a stride
-   for (size_t XYZ=0; XYZ<3; ++XYZ)
-   for (size_t k=GhostSize; k<Size1D-GhostSize; k+=Stride)
-   for (size_t j=GhostSize; j<Size1D-GhostSize; j+=Stride)
+// iterate over 3 dimensions and evaluate all lines along each direction at once
+   for (int XYZ=0; XYZ<3;      XYZ++)
+   for (int l=0;   l<NField;   l++  )
    {
-//    read one column of data from 3D block
-      for (size_t i=0; i<Size1D; ++i) {
-         size_t index;
+      const real *Field = Var1D + l*CUBE(Size1D);
+
+//    1. gather all lines along XYZ into Data[t][line]
+//       --> line = (k-GhostSize)*PS2 + (j-GhostSize), where j/k are the two transverse indices
+      for (int t=0; t<Size1D; t++)
+      for (int k=GhostSize, line=0; k<Size1D-GhostSize; k++)
+      for (int j=GhostSize;         j<Size1D-GhostSize; j++, line++)
+      {
+         int index;
 
          switch ( XYZ )
          {
-            case 0:
-               index = IDX321( k, j, i, Size1D, Size1D );
-               break;
-            case 1:
-               index = IDX321( k, i, j, Size1D, Size1D );
-               break;
-            case 2:
-               index = IDX321( i, k, j, Size1D, Size1D );
-               break;
+            case 0 : index = IDX321( k, j, t, Size1D, Size1D );   break;
+            case 1 : index = IDX321( k, t, j, Size1D, Size1D );   break;
+            default: index = IDX321( t, k, j, Size1D, Size1D );   break;
          }
 
-         Row[0][i] = Re1D[index];
-         Row[1][i] = Im1D[index];
-      } // i
+         Data[t][line] = Field[index];
+      }
 
-//    compute polynomial expansions of real and imaginary parts
-      for (int i=0; i<NCutoff; ++i)
+//    2. compute the polynomial expansions of both boundary windows of all lines
+      for (int i=0; i<NCutoff; i++)
       {
-         for (int l=0; l<NField; l++) {
-            flag_spectral_float LCoeff = 0;
-            flag_spectral_float RCoeff = 0;
-            for (int t=0; t<MaxOrder; t++) {
-               LCoeff += Flag_Spectral_Polynomials[ MaxOrder - NCutoff + i ][t] * Row[l][                     t ];   // left boundary
-               RCoeff += Flag_Spectral_Polynomials[ MaxOrder - NCutoff + i ][t] * Row[l][ Size1D - MaxOrder + t ];   // right boundary
-            } // t
-            Cond = MAX( Cond, abs(LCoeff) );
-            Cond = MAX( Cond, abs(RCoeff) );
-         } // l
+         const flag_spectral_float *Poly = Flag_Spectral_Polynomials[ MaxOrder - NCutoff + i ];
+
+         for (int line=0; line<NLine; line++)
+         {
+            LCoeff[line] = 0.0;
+            RCoeff[line] = 0.0;
+         }
+
+         for (int t=0; t<MaxOrder; t++)
+         {
+            const flag_spectral_float  P     = Poly[t];
+            const flag_spectral_float *LData = Data[t            ];
+            const flag_spectral_float *RData = Data[t + RightDisp];
+
+#           pragma omp simd
+            for (int line=0; line<NLine; line++)
+            {
+               LCoeff[line] += P*LData[line];   // left boundary
+               RCoeff[line] += P*RData[line];   // right boundary
+            }
+         } // t
+
+#        pragma omp simd reduction( max:CondMax )
+         for (int line=0; line<NLine; line++)
+         {
+            CondMax = MAX( CondMax, fabs(LCoeff[line]) );
+            CondMax = MAX( CondMax, fabs(RCoeff[line]) );
+         }
+
+//       3. early exit if the patch group must be flagged anyway
+         Cond = CondMax;
+
+         if ( Cond > Threshold )    break;
       } // i
-   } // XYZ, k,j
+
+      if ( Cond > Threshold )    break;
+   } // XYZ, l
 
 } // FUNCTION : Prepare_for_Spectral_Criterion
 
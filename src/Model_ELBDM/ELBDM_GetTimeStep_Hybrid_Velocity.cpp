@@ -81,6 +81,11 @@ real GetMaxVelocity( const int lv, const bool ExcludeWaveCells )
    _dh  = (real)1.0/amr->dh[lv];
    _dh2 = (real)0.5*_dh;
 
+// LocalID of the patch containing cell [I,J,K] of a patch group with I/PS1, J/PS1, K/PS1 = x, y, z
+   int LocalIDTable[2][2][2];
+   for (int LocalID=0; LocalID<8; LocalID++)
+      LocalIDTable[ TABLE_02(LocalID,'z',0,1) ][ TABLE_02(LocalID,'y',0,1) ][ TABLE_02(LocalID,'x',0,1) ] = LocalID;
+
 #  pragma omp parallel private( Flu_Array, V, GradS, im, ip, jm, jp, km, kp, I, J, K )
    {
       Flu_Array = new real [NPG][NComp1][Size_Flu][Size_Flu][Size_Flu];
@@ -94,22 +99,21 @@ real GetMaxVelocity( const int lv, const bool ExcludeWaveCells )
                             INT_CQUAD, INT_NONE, UNIT_PATCHGROUP, NSIDE_06, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
                             MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
 
+         const long GID0 = GlobalTree->PID2GID( PID0, lv );
+
 //       evaluate dS_dt
          for (int k=NGhost; k<Size_Flu-NGhost; k++)    {  km = k - 1;    kp = k + 1;   K = k - NGhost;
          for (int j=NGhost; j<Size_Flu-NGhost; j++)    {  jm = j - 1;    jp = j + 1;   J = j - NGhost;
          for (int i=NGhost; i<Size_Flu-NGhost; i++)    {  im = i - 1;    ip = i + 1;   I = i - NGhost;
 
 //          skip velocities of cells that have a wave counterpart on the refined levels
-            long GID0                   = GlobalTree->PID2GID( PID0, lv );
+//          --> only check the single patch (I, J, K) belongs to
             bool DoNotCalculateVelocity = false;
             if ( ExcludeWaveCells )
             {
-//             in principle, we only need to check the single patch (I, J, K) belongs to
-//             however, ELBDM_HasWaveCounterpart automatically returns False if (I, J, K) is outside of the patch GID0 + LocalID
-               for (int LocalID=0; LocalID<8; LocalID++ )
-               {
-                  DoNotCalculateVelocity |= ELBDM_HasWaveCounterpart( I, J, K, GID0, GID0 + LocalID, *GlobalTree );
-               }
+               const long GID = GID0 + LocalIDTable[ K/PS1 ][ J/PS1 ][ I/PS1 ];
+
+               DoNotCalculateVelocity = ELBDM_HasWaveCounterpart( I%PS1, J%PS1, K%PS1, GID, GID, *GlobalTree );
             }
 
             if ( !DoNotCalculateVelocity ) {
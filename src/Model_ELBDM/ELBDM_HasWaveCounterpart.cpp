@@ -7,9 +7,12 @@
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  ELBDM_HasWaveCounterpart
-// Description :  Check whether cell [I, J, K] in patch indexed by GID has wave counterpart on refined levels by traversing the global AMR Tree
+// Description :  Check whether cell [I, J, K] in patch indexed by GID has wave counterpart on refined levels
 //
 // Note        :  1. This function requires LB_GlobalPatch* Tree to be initialised beforehand
+//                2. Look up the per-patch bitmask cached by the global tree (LB_GlobalTree::HasWaveCounterpart())
+//                   instead of traversing the tree for each cell
+//                   --> In debug mode, the result is validated against traversing the tree
 //
 // Parameter   :  I   : x-index relative to patch GID0
 //             :  J   : y-index relative to patch GID0
@@ -21,20 +24,40 @@
 //
 // Return      :  "true"  if cell [I, J, K] in patch GID has    wave counterpart
 //                "false" if cell [I, J, K] in patch GID has NO wave counterpart
+//                         --> Also return false if cell [I, J, K] is outside patch GID
 //-------------------------------------------------------------------------------------------------------
 bool ELBDM_HasWaveCounterpart( const int I, const int J, const int K, const long GID0, const long GID, const LB_GlobalTree& GlobalTree )
 {
 
-// convert to global coordinates
-   const int X = GlobalTree.Local2Global( I, 0, GID0 );
-   const int Y = GlobalTree.Local2Global( J, 1, GID0 );
-   const int Z = GlobalTree.Local2Global( K, 2, GID0 );
+// convert to the cell indices relative to patch GID
+   int i=I, j=J, k=K;
 
-// find GID of child
+   if ( GID != GID0 )
+   {
+      const int Scale = amr->scale[ GlobalTree[GID].level ];
+
+      i += ( GlobalTree[GID0].corner[0] - GlobalTree[GID].corner[0] ) / Scale;
+      j += ( GlobalTree[GID0].corner[1] - GlobalTree[GID].corner[1] ) / Scale;
+      k += ( GlobalTree[GID0].corner[2] - GlobalTree[GID].corner[2] ) / Scale;
+   }
+
+   if ( i < 0  ||  i >= PS1  ||  j < 0  ||  j >= PS1  ||  k < 0  ||  k >= PS1 )   return false;
+
+   const bool HasWaveCounterpart = GlobalTree.HasWaveCounterpart( i, j, k, GID );
+
+
+// check the result by traversing the tree
+#  ifdef GAMER_DEBUG
+   const int  X        = GlobalTree.Local2Global( I, 0, GID0 );
+   const int  Y        = GlobalTree.Local2Global( J, 1, GID0 );
+   const int  Z        = GlobalTree.Local2Global( K, 2, GID0 );
    const long ChildGID = GlobalTree.FindRefinedCounterpart( X, Y, Z, GID );
-   if ( ChildGID == -1 ) return false;
+   const bool Expect   = ( ChildGID == -1 ) ? false : amr->use_wave_flag[ GlobalTree[ChildGID].level ];
 
-   const bool HasWaveCounterpart = amr->use_wave_flag[ GlobalTree[ChildGID].level ];
+   if ( HasWaveCounterpart != Expect )
+      Aux_Error( ERROR_INFO, "inconsistent wave counterpart mask (GID %ld, cell [%d, %d, %d], mask %d, tree %d) !!\n",
+                 GID, i, j, k, HasWaveCounterpart, Expect );
+#  endif
 
    return HasWaveCounterpart;
 
@@ -68,6 +68,12 @@ void MHD_HalfStepPrimitive( const real g_Flu_In[][ CUBE(FLU_NXT) ],
                             const real dt, const real dh, const real MinDens );
 #endif // #ifdef MHD
 
+#ifdef TIMING
+extern bool Trace_Active;
+void Aux_Trace_Begin( const char *Name, const int Level );
+void Aux_Trace_End();
+#endif
+
 #endif // #ifdef __CUDACC__ ... else ...
 
 
@@ -240,6 +246,11 @@ void CPU_FluidSolver_CTU(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+//       record the activity of each OpenMP thread for OPT__RECORD_TRACE
+#        if ( defined TIMING  &&  !defined __CUDACC__ )
+         if ( Trace_Active )  Aux_Trace_Begin( "CPU_FluidSolverCTU::PatchGroup", -1 );
+#        endif
+
 //       0. point to the arrays associated with different patch groups
 //          --> necessary because different patch groups are computed by different OpenMP threads or CUDA blocks in parallel
          real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [P];
@@ -332,6 +343,10 @@ void CPU_FluidSolver_CTU(
                                g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
                                NormPassive, NNorm, c_NormIdx, &EoS, NULL, NULL_INT, NULL_INT );
 
+#        if ( defined TIMING  &&  !defined __CUDACC__ )
+         if ( Trace_Active )  Aux_Trace_End();
+#        endif
+
       } // loop over all patch groups
    } // OpenMP parallel region
 
@@ -153,6 +153,12 @@ void CR_AddDiffuseFlux_FullStep( const real g_PriVar_Half[][ CUBE(FLU_NXT) ],
 #endif // #ifdef CR_DIFFUSION
 #endif // #ifdef COSMIC_RAY
 
+#ifdef TIMING
+extern bool Trace_Active;
+void Aux_Trace_Begin( const char *Name, const int Level );
+void Aux_Trace_End();
+#endif
+
 #endif // #ifdef __CUDACC__ ... else ...
 
 
@@ -360,6 +366,11 @@ void CPU_FluidSolver_MHM(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+//       record the activity of each OpenMP thread for OPT__RECORD_TRACE
+#        if ( defined TIMING  &&  !defined __CUDACC__ )
+         if ( Trace_Active )  Aux_Trace_Begin( "CPU_FluidSolverMHM::PatchGroup", -1 );
+#        endif
+
          Iteration = 0;
 
 //       0. point to the arrays associated with different patch groups
@@ -579,6 +590,10 @@ void CPU_FluidSolver_MHM(
 
          } while ( s_FullStepFailure  &&  Iteration <= MinMod_MaxIter );
 
+#        if ( defined TIMING  &&  !defined __CUDACC__ )
+         if ( Trace_Active )  Aux_Trace_End();
+#        endif
+
       } // loop over all patch groups
    } // OpenMP parallel region
 
@@ -5,37 +5,81 @@
 //output the dimensionless power spectrum
 //#define DIMENSIONLESS_FORM
 
-static void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *PS_total, double *NormDC );
+// maximum number of target fields in OUTPUT_BASEPS_FIELD
+#define BASEPS_NFIELD_MAX  8
 
-extern root_fftw::real_plan_nd FFTW_Plan_PS;
+static int  GetBasePSField( long TVar[] );
+static void Patch2Slab_Uniform( real *VarS, const int Level, const int *List_z_start, const int FFT_Size[], const long TVar );
+static void GetBasePowerSpectrum( real **VarK, const int NVar, const bool Cross, const root_fftw::real_plan_nd Plan_PS,
+                                  const int FFT_Size[], const int j_start, const int dj, double *PS_total, long *Count_total );
+static bool NormalizeByMean( const long TVar );
+#ifdef MASSIVE_PARTICLES
+static void PrepareParticleDensity( const int lv, const bool Init );
+#endif
+
+extern root_fftw::real_plan_nd FFTW_Plan_PS, FFTW_Plan_PS_Fine;
 
 
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Output_BasePowerSpectrum
-// Description :  Evaluate and output the base-level power spectrum of the target variable by FFT
+// Description :  Evaluate and output the power spectra of the target variables by FFT
+//
+// Note        :  1. Evaluate the power spectra of all target variables and, optionally, the cross spectra of all
+//                   pairs of target variables from a single slab decomposition and FFT per variable
+//                   --> Cross spectrum of variables a and b is Re( F_a F_b^* ), where F is the Fourier transform
+//                   --> Only SERIAL is supported for the cross spectra for now (see Aux_Check_Parameter())
+//                2. Level = 0 : use the base-level data
+//                   Level > 0 : deposit the data onto the uniform grid of level "Level"
+//                               --> Leaf patches below "Level" and all patches on "Level" are used, where the cells
+//                                   of coarser patches are copied to all the fine cells they cover
+//                               --> Only work with OUTPUT_BASEPS_LEVEL, for which the FFTW plan is created
+//                               --> Only SERIAL is supported for now (see Aux_Check_Parameter())
+//                3. Power spectra are normalized by the squared mean values (i.e., the DC modes), except for the
+//                   variables that are not positive definite (e.g., velocity)
+//                   --> See NormalizeByMean()
+//                4. k-shell binning is parallelized by OpenMP with compensated summation
+//                5. Output file layout:
+//                      k, P_1, ..., P_N, P_12, P_13, ..., P_(N-1)N
+//                   --> DC mode is not output
 //
 // Parameter   :  FileName : Name of the output file
-//                TVar     : Target variable
+//                NVar     : Number of target variables
+//                TVar     : Target variables
+//                Cross    : Output the cross spectra of all pairs of target variables
+//                Level    : Target level of the uniform grid
 //-------------------------------------------------------------------------------------------------------
-void Output_BasePowerSpectrum( const char *FileName, const long TVar )
+void Output_BasePowerSpectrum( const char *FileName, const int NVar, const long *TVar, const bool Cross, const int Level )
 {
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ...\n", __FUNCTION__, DumpID );
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (%s) ...\n", __FUNCTION__, FileName );
 
 // check
-// check only single field
-   if ( TVar == 0  ||  TVar & (TVar-1) )
-      Aux_Error( ERROR_INFO, "number of target variables is not one !!\n" );
+   if ( NVar < 1  ||  NVar > BASEPS_NFIELD_MAX )
+      Aux_Error( ERROR_INFO, "incorrect number of target variables (%d) --> must be in the range 1 ~ %d !!\n",
+                 NVar, BASEPS_NFIELD_MAX );
+// check only single field per variable
+   for (int v=0; v<NVar; v++)
+      if ( TVar[v] == 0  ||  TVar[v] & (TVar[v]-1) )
+         Aux_Error( ERROR_INFO, "number of fields in TVar[%d] = %ld is not one !!\n", v, TVar[v] );
+// check the target level
+   if ( Level < 0  ||  Level > MAX_LEVEL )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "Level", Level );
+
+   if (  Level > 0  &&  ( Level != OUTPUT_BASEPS_LEVEL || ( !OPT__OUTPUT_BASEPS && OUTPUT_BASEPS_STEP <= 0 ) )  )
+      Aux_Error( ERROR_INFO, "FFTW plan of level %d has not been created --> check OUTPUT_BASEPS_LEVEL !!\n", Level );
 // check cubic box
    if ( NX0_TOT[0] != NX0_TOT[1]  ||  NX0_TOT[0] != NX0_TOT[2] )
       Aux_Error( ERROR_INFO, "%s only works with CUBIC domain !!\n", __FUNCTION__ );
 
 
 // 1. determine the FFT size
-   const int Nx_Padded   = NX0_TOT[0]/2+1;
-   const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
+   const int FFT_Size[3] = { NX0_TOT[0]<<Level, NX0_TOT[1]<<Level, NX0_TOT[2]<<Level };
+   const int Nx_Padded   = FFT_Size[0]/2+1;
+   const int NSpec       = ( Cross ) ? NVar*(NVar+1)/2 : NVar;
+
+   const root_fftw::real_plan_nd Plan_PS = ( Level == 0 ) ? FFTW_Plan_PS : FFTW_Plan_PS_Fine;
 
 // get the array indices using by FFTW
    mpi_index_int local_nx, local_ny, local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
@@ -56,7 +100,7 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
                                                          &local_nz, &local_z_start, &local_ny_after_transpose,
                                                          &local_y_start_after_transpose );
 #  else
-   rfftwnd_mpi_local_sizes( FFTW_Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
+   rfftwnd_mpi_local_sizes( Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
                             &local_y_start_after_transpose, &total_local_size );
 #  endif
 #  endif // #ifdef SERIAL ... else ...
@@ -89,14 +133,15 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
 
 
 // 2. allocate memory
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, FFT_Size[2] ) - MIN( List_z_start[MPI_Rank], FFT_Size[2] );
 
    double *PS_total     = NULL;
-   real   *VarK         = (real*)root_fftw::fft_malloc( sizeof(real)*total_local_size );  // array storing data
-   real   *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];            // MPI send buffer for data
-   real   *RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];            // MPI recv buffer for data
-   long   *SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];                  // MPI send buffer for 1D coordinate in slab
-   long   *RecvBuf_SIdx = new long [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];   // MPI recv buffer for 1D coordinate in slab
+   long   *Count_total  = NULL;
+   real   *VarK[BASEPS_NFIELD_MAX];                                                         // arrays storing data
+   real   *SendBuf      = NULL;                                                             // MPI send buffer for data
+   real   *RecvBuf      = NULL;                                                             // MPI recv buffer for data
+   long   *SendBuf_SIdx = NULL;                                                             // MPI send buffer for 1D coordinate in slab
+   long   *RecvBuf_SIdx = NULL;                                                             // MPI recv buffer for 1D coordinate in slab
 
    int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
    int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
@@ -105,61 +150,148 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
    const bool ForPoisson  = false;  // preparing the density field for the Poisson solver
    const bool InPlacePad  = true;   // pad the array for in-place real-to-complex FFT
 
-   if ( MPI_Rank == 0 )    PS_total = new double [Nx_Padded];
+   for (int v=0; v<NVar; v++)
+      VarK[v] = (real*)root_fftw::fft_malloc( sizeof(real)*total_local_size );
 
+// the buffers of Patch2Slab() are only required for the base level
+   if ( Level == 0 )
+   {
+      SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];
+      RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];
+      SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];
+      RecvBuf_SIdx = new long [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];
+   }
 
-// 3. initialize the particle density array (rho_ext) and collect particles to the target level
-#  ifdef MASSIVE_PARTICLES
-   const bool TimingSendPar_No = false;
-   const bool JustCountNPar_No = false;
-#  ifdef LOAD_BALANCE
-   const bool PredictPos       = amr->Par->PredictPos;
-   const bool SibBufPatch      = true;
-   const bool FaSibBufPatch    = true;
-#  else
-   const bool PredictPos       = false;
-   const bool SibBufPatch      = NULL_BOOL;
-   const bool FaSibBufPatch    = NULL_BOOL;
-#  endif
+   if ( MPI_Rank == 0 )
+   {
+      PS_total    = new double [ NSpec*Nx_Padded ];
+      Count_total = new long   [ Nx_Padded ];
+   }
 
-   if ( TVar == _TOTAL_DENS ) {
-      Par_CollectParticle2OneLevel( 0, _PAR_MASS|_PAR_POSX|_PAR_POSY|_PAR_POSZ, _PAR_TYPE, PredictPos, Time[0],
-                                    SibBufPatch, FaSibBufPatch, JustCountNPar_No, TimingSendPar_No );
 
-      Prepare_PatchData_InitParticleDensityArray( 0, Time[0] );
-   } // if ( TVar == _TOTAL_DENS )
-#  endif // #ifdef MASSIVE_PARTICLES
+// 3. rearrange data from patch to slab
+   for (int v=0; v<NVar; v++)
+   {
+      if ( Level == 0 )
+      {
+//       initialize the particle density array (rho_ext) and collect particles to the target level
+#        ifdef MASSIVE_PARTICLES
+         if ( TVar[v] == _PAR_DENS  ||  TVar[v] == _TOTAL_DENS )  PrepareParticleDensity( 0, true );
+#        endif
+
+         Patch2Slab( VarK[v], SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv,
+                     List_z_start, local_nz, FFT_Size, NRecvSlice, Time[0], TVar[v], InPlacePad, ForPoisson, false );
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            free( List_PID[r] );
+            free( List_k  [r] );
+         }
 
+#        ifdef MASSIVE_PARTICLES
+         if ( TVar[v] == _PAR_DENS  ||  TVar[v] == _TOTAL_DENS )  PrepareParticleDensity( 0, false );
+#        endif
+      } // if ( Level == 0 )
 
-// 4. rearrange data from patch to slab
-   Patch2Slab( VarK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv, List_z_start,
-               local_nz, FFT_Size, NRecvSlice, Time[0], TVar, InPlacePad, ForPoisson, false );
+      else
+         Patch2Slab_Uniform( VarK[v], Level, List_z_start, FFT_Size, TVar[v] );
+   } // for (int v=0; v<NVar; v++)
 
 
-// 5. evaluate the base-level power spectrum by FFT
-   double NormDC;  // to record the FFT DC value used for normalization
-   GetBasePowerSpectrum( VarK, local_y_start_after_transpose, local_ny_after_transpose, PS_total, &NormDC );
+// 4. evaluate the power spectra by FFT
+   GetBasePowerSpectrum( VarK, NVar, Cross, Plan_PS, FFT_Size, local_y_start_after_transpose, local_ny_after_transpose,
+                         PS_total, Count_total );
 
 
-// 6. output the power spectrum
+// 5. normalize and output the power spectra
    if ( MPI_Rank == 0 )
    {
-//    check if the target file already exists
+//    5-1. normalization: SQR(AveVar) accounts for Delta=Var/AveVar
+      const double NCell = (double)FFT_Size[0]*(double)FFT_Size[1]*(double)FFT_Size[2];
+      const double Vol   = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2];
+      double AveVar[BASEPS_NFIELD_MAX], NormVar[BASEPS_NFIELD_MAX];
+
+      for (int v=0; v<NVar; v++)
+      {
+         AveVar [v] = SQRT( PS_total[ v*Nx_Padded ]/(double)Count_total[0] ) / NCell;  // from DC mode of FFT
+         NormVar[v] = ( NormalizeByMean(TVar[v]) ) ? AveVar[v] : 1.0;
+      }
+
+#     ifdef DIMENSIONLESS_FORM
+      const double k0 = 2.0*M_PI/amr->BoxSize[0];     // assuming cubic box
+#     endif
+
+      for (int a=0, s=0; a<NVar; a++)
+      for (int b=a; b<NVar; b++)
+      {
+         if ( a != b  &&  !Cross )  continue;
+
+//       auto spectra are stored before cross spectra
+         const int    sp    = ( a == b ) ? a : NVar + s++;
+         const double Coeff = Vol / ( SQR(NCell)*NormVar[a]*NormVar[b] );
+
+         for (int bin=0; bin<Nx_Padded; bin++)
+         {
+#           ifdef DIMENSIONLESS_FORM
+            const double WaveK = bin*k0;
+            const double Norm  = Coeff*CUBE(WaveK)/(2.0*M_PI*M_PI);    // dimensionless power spectrum
+#           else
+            const double Norm  = Coeff;                                // dimensional power spectrum [Mpc^3/h^3]
+#           endif
+
+            PS_total[ sp*Nx_Padded + bin ] *= Norm / (double)Count_total[bin];
+         }
+      }
+
+//    5-2. check if the target file already exists
       if ( Aux_CheckFileExist(FileName) )
          Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
 
-//    output the power spectrum
+//    5-3. output the power spectra
       const double WaveK0 = 2.0*M_PI/amr->BoxSize[0];
+      const char  *Label[BASEPS_NFIELD_MAX];
+      char         ColName[MAX_STRING];
+
+      for (int v=0; v<NVar; v++)
+      {
+         Label[v] = GetFieldBIdxLabel( TVar[v] );
+         if ( Label[v] == NULL )    Label[v] = "Unknown";
+      }
+
       FILE *File = fopen( FileName, "w" );
 
-      fprintf( File, "# average value (DC) used for normalization = %20.14e\n", NormDC );
+      fprintf( File, "# uniform grid = %d^3 (level %d)\n", FFT_Size[0], Level );
+      for (int v=0; v<NVar; v++)
+      fprintf( File, "# average value (DC) of %-12s = %20.14e%s\n",
+               Label[v], AveVar[v], ( NormalizeByMean(TVar[v]) ) ? "" : " (not used for normalization)" );
+      fprintf( File, "\n" );
+
+      fprintf( File, "#%*s", StrLen_Flt, "k" );
+      if ( NSpec == 1 )
+      fprintf( File, " %*s", StrLen_Flt, "Power" );
+      else
+      {
+         for (int a=0; a<NVar; a++)
+         {
+            sprintf( ColName, "P_%s", Label[a] );
+            fprintf( File, " %*s", StrLen_Flt, ColName );
+         }
+
+         if ( Cross )
+         for (int a=0; a<NVar; a++)
+         for (int b=a+1; b<NVar; b++)
+         {
+            sprintf( ColName, "P_%s_%s", Label[a], Label[b] );
+            fprintf( File, " %*s", StrLen_Flt, ColName );
+         }
+      }
       fprintf( File, "\n" );
-      fprintf( File, "#%*s %*s\n", StrLen_Flt, "k", StrLen_Flt, "Power" );
 
 //    DC mode is not output
-      for (int b=1; b<Nx_Padded; b++) {
-         fprintf( File, BlankPlusFormat_Flt, WaveK0*b );
-         fprintf( File, BlankPlusFormat_Flt, PS_total[b] );
+      for (int bin=1; bin<Nx_Padded; bin++) {
+         fprintf( File, BlankPlusFormat_Flt, WaveK0*bin );
+         for (int sp=0; sp<NSpec; sp++)
+         fprintf( File, BlankPlusFormat_Flt, PS_total[ sp*Nx_Padded + bin ] );
          fprintf( File, "\n");
       }
 
@@ -167,169 +299,648 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
    } // if ( MPI_Rank == 0 )
 
 
-// 7. free memory
-   root_fftw::fft_free( VarK );
+// 6. free memory
+   for (int v=0; v<NVar; v++)    root_fftw::fft_free( VarK[v] );
+
    delete [] SendBuf;
    delete [] RecvBuf;
    delete [] SendBuf_SIdx;
    delete [] RecvBuf_SIdx;
+   delete [] PS_total;
+   delete [] Count_total;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (%s) ... done\n", __FUNCTION__, FileName );
+
+} // FUNCTION : Output_BasePowerSpectrum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum
+// Description :  Evaluate and output the power spectra of the target variables set by the runtime parameters
+//
+// Note        :  1. Used for the runtime options "OPT__OUTPUT_BASEPS" and "OUTPUT_BASEPS_STEP"
+//                2. Target variables are set by OUTPUT_BASEPS_FIELD (e.g., "TotalDens,VelX")
+//                   --> See GetFieldBIdx() for the supported fields
+//                3. Cross spectra and the target level are set by OUTPUT_BASEPS_CROSS and OUTPUT_BASEPS_LEVEL
+//
+// Parameter   :  FileName : Name of the output file
+//-------------------------------------------------------------------------------------------------------
+void Output_BasePowerSpectrum( const char *FileName )
+{
+
+   long TVar[BASEPS_NFIELD_MAX];
+
+   const int NVar = GetBasePSField( TVar );
+
+   Output_BasePowerSpectrum( FileName, NVar, TVar, OUTPUT_BASEPS_CROSS, OUTPUT_BASEPS_LEVEL );
+
+} // FUNCTION : Output_BasePowerSpectrum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum_Step
+// Description :  Output the power spectra every OUTPUT_BASEPS_STEP root-level steps
+//
+// Note        :  1. Used for the runtime option "OUTPUT_BASEPS_STEP > 0", which is independent of the data dumps
+//                   controlled by OPT__OUTPUT_MODE and OPT__OUTPUT_BASEPS
+//                2. File name is "PowerSpec_StepXXXXXXXXX", where XXXXXXXXX is the current step
+//
+// Parameter   :  Stage : 0 : beginning of the run
+//                        1 : during the evolution
+//                        2 : end of the run
+//-------------------------------------------------------------------------------------------------------
+void Output_BasePowerSpectrum_Step( const int Stage )
+{
+
+// check
+   if ( Stage < 0  ||  Stage > 2 )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "Stage", Stage );
+
+   if ( OUTPUT_BASEPS_STEP <= 0 )   return;
+
+
+// check whether to output the power spectra at this step
+   static long PreviousStep = -1;
+
+   if (  Step == PreviousStep  ||  ( Stage == 1 && Step%OUTPUT_BASEPS_STEP != 0 )  )   return;
+
+   PreviousStep = Step;
+
+
+   char FileName[MAX_STRING];
+   sprintf( FileName, "PowerSpec_Step%09ld", Step );
+
+   Output_BasePowerSpectrum( FileName );
+
+} // FUNCTION : Output_BasePowerSpectrum_Step
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetBasePSField
+// Description :  Parse OUTPUT_BASEPS_FIELD to get the bitwise indices of the target fields
+//
+// Note        :  1. Fields must be separated by commas without spaces (e.g., "TotalDens,VelX")
+//                   --> ReadPara_t::Read() stops reading a value at the first space
+//                2. See GetFieldBIdx() for the supported fields
+//
+// Parameter   :  TVar : Array to store the bitwise field indices
+//
+// Return      :  Number of target fields, TVar[]
+//-------------------------------------------------------------------------------------------------------
+int GetBasePSField( long TVar[] )
+{
+
+   char FieldStr[MAX_STRING];
+   int  NField = 0;
+
+   strcpy( FieldStr, OUTPUT_BASEPS_FIELD );
+
+   for (char *Token=strtok(FieldStr, " ,\t"); Token!=NULL; Token=strtok(NULL, " ,\t"))
+   {
+      if ( NField >= BASEPS_NFIELD_MAX )
+         Aux_Error( ERROR_INFO, "number of fields in OUTPUT_BASEPS_FIELD exceeds BASEPS_NFIELD_MAX (%d) !!\n",
+                    BASEPS_NFIELD_MAX );
+
+      const long TVar1 = GetFieldBIdx( Token, CHECK_OFF );
+
+      if ( TVar1 == 0 )
+         Aux_Error( ERROR_INFO, "unsupported field \"%s\" in OUTPUT_BASEPS_FIELD !!\n", Token );
+
+      for (int f=0; f<NField; f++)
+         if ( TVar[f] == TVar1 )
+            Aux_Error( ERROR_INFO, "duplicate field \"%s\" in OUTPUT_BASEPS_FIELD !!\n", Token );
+
+      TVar[NField] = TVar1;
+      NField ++;
+   } // for (char *Token=strtok(...); Token!=NULL; ...)
+
+   if ( NField == 0 )   Aux_Error( ERROR_INFO, "no field is found in OUTPUT_BASEPS_FIELD !!\n" );
+
+   return NField;
+
+} // FUNCTION : GetBasePSField
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Patch2Slab_Uniform
+// Description :  Deposit the patch data onto the uniform grid of level "Level" in the FFTW slab decomposition
+//
+// Note        :  1. Invoked by Output_BasePowerSpectrum() for Level > 0
+//                2. Leaf patches on levels < Level and all patches on Level are used
+//                   --> Together they cover the entire domain exactly once
+//                   --> Non-leaf patches on Level store the data restricted from their descendants
+//                3. Each cell on level lv is copied to the 2^(Level-lv) x 2^(Level-lv) x 2^(Level-lv) fine cells
+//                   it covers (i.e., piecewise-constant deposit)
+//                4. Each patch slice is sent with a header of { slab index, refinement ratio, number of fine z slices }
+//                   --> Fine z slices covered by a single patch slice are split when they belong to different ranks
+//
+// Parameter   :  VarS         : Padded slab array of target variable for FFT
+//                Level        : Target level of the uniform grid
+//                List_z_start : Starting z coordinate of each rank in the FFTW slab decomposition
+//                FFT_Size     : Size of the FFT operation
+//                TVar         : Target variable to be prepared
+//-------------------------------------------------------------------------------------------------------
+void Patch2Slab_Uniform( real *VarS, const int Level, const int *List_z_start, const int FFT_Size[], const long TVar )
+{
+
+   const int  SSize[2] = { 2*(FFT_Size[0]/2+1), FFT_Size[1] };     // padded slab size in the x and y directions
+   const int  PSSize   = PS1*PS1;                                  // patch slice size
+   const int  NHead    = 3;                                        // size of the header of each patch slice
+   const long MemUnit  = (long)PS1*MAX( amr->NPatchComma[Level][1], 8 );     // set arbitrarily
+   const int  AveNz    = FFT_Size[2]/MPI_NRank + ( ( FFT_Size[2]%MPI_NRank == 0 ) ? 0 : 1 );    // average slab thickness
+   const int  ScaleL   = amr->scale[Level];
+
+   int   Cr[3];                        // corner coordinates of each patch normalized to the grid size on Level
+   long  MemSize        [MPI_NRank];
+   long  List_NSend_Head[MPI_NRank];   // number of patch slices sent to each rank
+   long *TempBuf_Head   [MPI_NRank];   // header of each patch slice sent to each rank
+   real *TempBuf_Var    [MPI_NRank];   // data of each patch slice sent to each rank
+
+
+// 1. set memory allocation unit
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      MemSize        [r] = MemUnit;
+      TempBuf_Head   [r] = (long*)malloc( MemSize[r]*sizeof(long)*NHead  );
+      TempBuf_Var    [r] = (real*)malloc( MemSize[r]*sizeof(real)*PSSize );
+      List_NSend_Head[r] = 0;
+   }
+
+
+// 2. prepare the temporary send buffer level by level
+   const OptPotBC_t  PotBC_None        = BC_POT_NONE;
+   const IntScheme_t IntScheme         = INT_NONE;
+   const NSide_t     NSide_None        = NSIDE_00;
+   const bool        IntPhase_No       = false;
+   const bool        DE_Consistency_No = false;
+   const real        MinDens_No        = -1.0;
+   const real        MinPres_No        = -1.0;
+   const real        MinTemp_No        = -1.0;
+   const real        MinEntr_No        = -1.0;
+   const int         GhostSize         = 0;
+   const int         NPG               = 1;
+
+   real (*VarPatch)[PS1][PS1][PS1] = new real [8*NPG][PS1][PS1][PS1];
+
+   for (int lv=0; lv<=Level; lv++)
+   {
+      const int Ratio = 1 << ( Level - lv );    // number of fine cells covered by a cell on lv along each direction
+
+#     ifdef MASSIVE_PARTICLES
+      if ( TVar == _PAR_DENS  ||  TVar == _TOTAL_DENS )  PrepareParticleDensity( lv, true );
+#     endif
+
+      for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+      {
+//       skip patch groups without any target patch
+         bool Target[8], AnyTarget=false;
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            Target[LocalID] = ( lv == Level  ||  amr->patch[0][lv][PID0+LocalID]->son == -1 );
+            AnyTarget      |= Target[LocalID];
+         }
+
+         if ( !AnyTarget )    continue;
+
+         Prepare_PatchData( lv, Time[lv], VarPatch[0][0][0], NULL, GhostSize, NPG, &PID0, TVar, _NONE,
+                            IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
+                            MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+//       copy data to the send buffer
+         for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+         {
+            if ( !Target[LocalID] )    continue;
+
+            for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][lv][PID]->corner[d] / ScaleL;
+
+            for (int k=0; k<PS1; k++)
+            {
+               const int zEnd = Cr[2] + (k+1)*Ratio;
+
+               for (int z=Cr[2]+k*Ratio, NSlice; z<zEnd; z+=NSlice)
+               {
+                  const int TRank = ZIndex2Rank( z, List_z_start, z/AveNz );
+
+                  NSlice = MIN( zEnd, List_z_start[TRank+1] ) - z;
+
+//                allocate enough memory
+                  if ( List_NSend_Head[TRank] >= MemSize[TRank] )
+                  {
+                     MemSize     [TRank] += MemUnit;
+                     TempBuf_Head[TRank]  = (long*)realloc( TempBuf_Head[TRank], MemSize[TRank]*sizeof(long)*NHead  );
+                     TempBuf_Var [TRank]  = (real*)realloc( TempBuf_Var [TRank], MemSize[TRank]*sizeof(real)*PSSize );
+                  }
+
+//                record header
+                  long *Head = TempBuf_Head[TRank] + List_NSend_Head[TRank]*NHead;
+
+                  Head[0] = ( (long)( z - List_z_start[TRank] )*SSize[1] + Cr[1] )*SSize[0] + Cr[0];
+                  Head[1] = Ratio;
+                  Head[2] = NSlice;
+
+//                store data
+                  real *TempBuf_Var_Ptr = TempBuf_Var[TRank] + List_NSend_Head[TRank]*PSSize;
+
+                  int idx = 0;
+                  for (int j=0; j<PS1; j++)
+                  for (int i=0; i<PS1; i++)
+                     TempBuf_Var_Ptr[ idx ++ ] = VarPatch[LocalID][k][j][i];
+
+                  List_NSend_Head[TRank] ++;
+               } // for (int z=Cr[2]+k*Ratio, NSlice; z<zEnd; z+=NSlice)
+            } // for (int k=0; k<PS1; k++)
+         } // for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+      } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+
+//    free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
+#     ifdef MASSIVE_PARTICLES
+      if ( TVar == _PAR_DENS  ||  TVar == _TOTAL_DENS )  PrepareParticleDensity( lv, false );
+#     endif
+   } // for (int lv=0; lv<=Level; lv++)
+
+   delete [] VarPatch;
+
+
+// 3. prepare the send buffer
+   long List_NRecv_Head[MPI_NRank], List_NSend_Var[MPI_NRank], List_NRecv_Var[MPI_NRank];
+   long Send_Disp_Head [MPI_NRank], Recv_Disp_Head[MPI_NRank], Send_Disp_Var [MPI_NRank], Recv_Disp_Var[MPI_NRank];
+
+// 3.1 broadcast the number of patch slices sending to different ranks
+   MPI_Alltoall( List_NSend_Head, 1, MPI_LONG, List_NRecv_Head, 1, MPI_LONG, MPI_COMM_WORLD );
 
    for (int r=0; r<MPI_NRank; r++)
    {
-      free( List_PID[r] );
-      free( List_k  [r] );
+      List_NSend_Var [r]  = List_NSend_Head[r]*PSSize;
+      List_NRecv_Var [r]  = List_NRecv_Head[r]*PSSize;
+      List_NSend_Head[r] *= NHead;
+      List_NRecv_Head[r] *= NHead;
+   }
+
+// 3.2 calculate the displacement
+   Send_Disp_Head[0] = 0L;
+   Recv_Disp_Head[0] = 0L;
+   Send_Disp_Var [0] = 0L;
+   Recv_Disp_Var [0] = 0L;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_Disp_Head[r] = Send_Disp_Head[r-1] + List_NSend_Head[r-1];
+      Recv_Disp_Head[r] = Recv_Disp_Head[r-1] + List_NRecv_Head[r-1];
+      Send_Disp_Var [r] = Send_Disp_Var [r-1] + List_NSend_Var [r-1];
+      Recv_Disp_Var [r] = Recv_Disp_Var [r-1] + List_NRecv_Var [r-1];
    }
 
-   if ( MPI_Rank == 0 )    delete [] PS_total;
+   const long NSend_Head = Send_Disp_Head[MPI_NRank-1] + List_NSend_Head[MPI_NRank-1];
+   const long NRecv_Head = Recv_Disp_Head[MPI_NRank-1] + List_NRecv_Head[MPI_NRank-1];
+   const long NSend_Var  = Send_Disp_Var [MPI_NRank-1] + List_NSend_Var [MPI_NRank-1];
+   const long NRecv_Var  = Recv_Disp_Var [MPI_NRank-1] + List_NRecv_Var [MPI_NRank-1];
+
+   long *SendBuf_Head = new long [NSend_Head];
+   long *RecvBuf_Head = new long [NRecv_Head];
+   real *SendBuf_Var  = new real [NSend_Var ];
+   real *RecvBuf_Var  = new real [NRecv_Var ];
 
-// free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
-#  ifdef MASSIVE_PARTICLES
-   if ( TVar == _TOTAL_DENS ) {
-      Par_CollectParticle2OneLevel_FreeMemory( 0, SibBufPatch, FaSibBufPatch );
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      memcpy( SendBuf_Head+Send_Disp_Head[r], TempBuf_Head[r], List_NSend_Head[r]*sizeof(long) );
+      memcpy( SendBuf_Var +Send_Disp_Var [r], TempBuf_Var [r], List_NSend_Var [r]*sizeof(real) );
 
-      Prepare_PatchData_FreeParticleDensityArray( 0 );
+      free( TempBuf_Head[r] );
+      free( TempBuf_Var [r] );
    }
-#  endif
 
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+// 4. exchange data by MPI
+   MPI_Alltoallv_GAMER( SendBuf_Head, List_NSend_Head, Send_Disp_Head, MPI_LONG,
+                        RecvBuf_Head, List_NRecv_Head, Recv_Disp_Head, MPI_LONG,       MPI_COMM_WORLD );
 
-} // FUNCTION : Output_BasePowerSpectrum
+   MPI_Alltoallv_GAMER( SendBuf_Var,  List_NSend_Var,  Send_Disp_Var,  MPI_GAMER_REAL,
+                        RecvBuf_Var,  List_NRecv_Var,  Recv_Disp_Var,  MPI_GAMER_REAL, MPI_COMM_WORLD );
+
+
+// 5. store the received data to the padded array "VarS" for FFTW
+   const long NPSlice    = NRecv_Head/NHead;    // total number of received patch slices
+   const long SliceSize  = (long)SSize[0]*SSize[1];
+   long       NFineCell  = 0L;
+
+#  pragma omp parallel for reduction( +:NFineCell ) schedule( runtime )
+   for (long t=0; t<NPSlice; t++)
+   {
+      const long *Head   = RecvBuf_Head + t*NHead;
+      const real *Var    = RecvBuf_Var  + t*PSSize;
+      const int   Ratio  = Head[1];
+      const int   NSlice = Head[2];
+
+      for (int s=0; s<NSlice; s++)
+      {
+         real *VarS_Ptr = VarS + Head[0] + s*SliceSize;
+
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+         {
+            const real Value = Var[ j*PS1 + i ];
+
+            for (int jj=0; jj<Ratio; jj++)
+            for (int ii=0; ii<Ratio; ii++)
+               VarS_Ptr[ (long)( j*Ratio + jj )*SSize[0] + i*Ratio + ii ] = Value;
+         }
+      }
+
+      NFineCell += (long)NSlice*SQR( PS1*Ratio );
+   } // for (long t=0; t<NPSlice; t++)
+
+// check
+   const long NFineCell_Expect = (long)FFT_Size[0]*FFT_Size[1]*( List_z_start[MPI_Rank+1] - List_z_start[MPI_Rank] );
+
+   if ( NFineCell != NFineCell_Expect )
+      Aux_Error( ERROR_INFO, "number of received cells (%ld) != expected value (%ld) !!\n", NFineCell, NFineCell_Expect );
+
+
+// free memory
+   delete [] SendBuf_Head;
+   delete [] RecvBuf_Head;
+   delete [] SendBuf_Var;
+   delete [] RecvBuf_Var;
+
+} // FUNCTION : Patch2Slab_Uniform
 
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  GetBasePowerSpectrum
-// Description :  Evaluate and base-level power spectrum by FFT
+// Description :  Evaluate the power spectra and cross spectra by FFT
 //
-// Note        :  Invoked by the function "Output_BasePowerSpectrum"
+// Note        :  1. Invoked by the function "Output_BasePowerSpectrum"
+//                2. Auto spectra of all variables are stored before the cross spectra, which are ordered as
+//                   (0,1), (0,2), ..., (1,2), ...
+//                3. Different OpenMP threads bin different x-rows of the FFT data with compensated (Kahan) summation
+//                   --> Partial sums of threads are combined in a fixed order, so the results are reproducible for
+//                       a given number of threads
+//                4. Results are not normalized
 //
-// Parameter   :  VarK        : Array storing the input data
+// Parameter   :  VarK        : Arrays storing the input data of all variables
+//                NVar        : Number of variables
+//                Cross       : Evaluate the cross spectra of all pairs of variables
+//                Plan_PS     : FFTW plan of the target uniform grid
+//                FFT_Size    : Size of the FFT operation
 //                j_start     : Starting j index
 //                dj          : Size of array in the j (y) direction after the forward FFT
-//                PS_total    : Power spectrum summed over all MPI ranks
-//                NormDC      : Record of the average (DC) value used for normalization of power spectrum
+//                PS_total    : Power spectra summed over all MPI ranks
+//                Count_total : Number of modes in each k bin summed over all MPI ranks
 //
-// Return      :  PS_total, NormDC
+// Return      :  PS_total, Count_total
 //-------------------------------------------------------------------------------------------------------
-void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *PS_total, double *NormDC )
+void GetBasePowerSpectrum( real **VarK, const int NVar, const bool Cross, const root_fftw::real_plan_nd Plan_PS,
+                           const int FFT_Size[], const int j_start, const int dj, double *PS_total, long *Count_total )
 {
 
 // check
-   if ( MPI_Rank == 0  &&  PS_total == NULL )   Aux_Error( ERROR_INFO, "PS_total == NULL at the root rank !!\n" );
+   if ( MPI_Rank == 0  &&  PS_total    == NULL )   Aux_Error( ERROR_INFO, "PS_total == NULL at the root rank !!\n" );
+   if ( MPI_Rank == 0  &&  Count_total == NULL )   Aux_Error( ERROR_INFO, "Count_total == NULL at the root rank !!\n" );
 
 
-   const int Nx        = NX0_TOT[0];
-   const int Ny        = NX0_TOT[1];
-   const int Nz        = NX0_TOT[2];
+   const int Nx        = FFT_Size[0];
+   const int Ny        = FFT_Size[1];
+   const int Nz        = FFT_Size[2];
    const int Nx_Padded = Nx/2 + 1;
+   const int NBin      = Nx_Padded;
+   const int NSpec     = ( Cross ) ? NVar*(NVar+1)/2 : NVar;
 
-   gamer_fftw::fft_complex *cdata=NULL;
-   double PS_local[Nx_Padded];
-   long   Count_local[Nx_Padded], Count_total[Nx_Padded];
-   int    bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
+   gamer_fftw::fft_complex *cdata[BASEPS_NFIELD_MAX];
+   int PairA[ BASEPS_NFIELD_MAX*(BASEPS_NFIELD_MAX-1)/2 ], PairB[ BASEPS_NFIELD_MAX*(BASEPS_NFIELD_MAX-1)/2 ];
 
-   root_fftw_r2c( FFTW_Plan_PS, VarK );
 
-// the data are now complex, so typecast a pointer
-   cdata = (gamer_fftw::fft_complex*) VarK;
+// forward FFT
+   for (int v=0; v<NVar; v++)
+   {
+      root_fftw_r2c( Plan_PS, VarK[v] );
+
+//    the data are now complex, so typecast a pointer
+      cdata[v] = (gamer_fftw::fft_complex*) VarK[v];
+   }
+
+   for (int a=0, p=0; a<NVar; a++)
+   for (int b=a+1; b<NVar && Cross; b++, p++)
+   {
+      PairA[p] = a;
+      PairB[p] = b;
+   }
 
 
 // set up the dimensionless wave number coefficients according to the FFTW data format
-   for (int i=0; i<Nx_Padded; i++)     bin_i[i] = i;
+   int *bin_j = new int [Ny];
+   int *bin_k = new int [Nz];
+
    for (int j=0; j<Ny;        j++)     bin_j[j] = ( j <= Ny/2 ) ? j : j-Ny;
    for (int k=0; k<Nz;        k++)     bin_k[k] = ( k <= Nz/2 ) ? k : k-Nz;
 
 
-// estimate the power spectrum
-   long Idx;
+// estimate the power spectra
+#  ifdef OPENMP
+   const int NT = OMP_NTHREAD;
+#  else
+   const int NT = 1;
+#  endif
+
+// per-thread sums and their compensations
+   double *PS_local    = new double [ (long)NT*NSpec*NBin ];
+   double *PS_Comp     = new double [ (long)NT*NSpec*NBin ];
+   long   *Count_local = new long   [ (long)NT*NBin ];
 
-   for (int b=0; b<Nx_Padded; b++)
-   {
-      PS_local   [b] = 0.0;
-      Count_local[b] = 0;
-   }
+   for (long t=0; t<(long)NT*NSpec*NBin; t++)   PS_local   [t] = PS_Comp[t] = 0.0;
+   for (long t=0; t<(long)NT*NBin;       t++)   Count_local[t] = 0;
 
 #  ifdef SERIAL // serial mode
+   const int NOuter = Nz;
+   const int NInner = Ny;
+#  else         // parallel mode
+   const int NOuter = dj;
+   const int NInner = Nz;
+#  endif
 
-   for (int k=0; k<Nz; k++)
+#  pragma omp parallel num_threads( NT )
    {
-      for (int j=0; j<Ny; j++)
-      for (int i=0; i<Nx_Padded; i++)
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+
+      double *Sum   = PS_local    + (long)TID*NSpec*NBin;
+      double *Comp  = PS_Comp     + (long)TID*NSpec*NBin;
+      long   *Count = Count_local + (long)TID*NBin;
+
+//    collapse the two outer loops since the local slab thickness (dj) can be smaller than the number of threads
+#     pragma omp for collapse( 2 ) schedule( static )
+      for (int o=0; o<NOuter; o++)
+      for (int m=0; m<NInner; m++)
       {
-         Idx = ((long)k*Ny + j)*Nx_Padded + i;
+#        ifdef SERIAL
+         const int  j    = m;
+         const int  k    = o;
+         const long Idx0 = ( (long)k*Ny + j )*Nx_Padded;
+#        else
+         const int  j    = j_start + o;
+         const int  k    = m;
+         const long Idx0 = ( (long)o*Nz + k )*Nx_Padded;
+#        endif
+
+         const long jkSqr = SQR( (long)bin_j[j] ) + SQR( (long)bin_k[k] );
+
+         for (int i=0; i<Nx_Padded; i++)
+         {
+            const long Idx = Idx0 + i;
+
+//          round to nearest bin
+            const int bin = (int)lround(  sqrt( (double)( jkSqr + SQR( (long)i ) ) )  );
+
+            if ( bin >= NBin )   continue;
+
+            Count[bin] ++;
 
-#  else // parallel mode
-   int j;
+            for (int sp=0; sp<NSpec; sp++)
+            {
+               const int a = ( sp < NVar ) ? sp : PairA[ sp - NVar ];
+               const int b = ( sp < NVar ) ? sp : PairB[ sp - NVar ];
 
-   for (int jj=0; jj<dj; jj++)
+//             Re( F_a F_b^* )
+               const double Power = (double)c_re(cdata[a][Idx])*(double)c_re(cdata[b][Idx]) +
+                                    (double)c_im(cdata[a][Idx])*(double)c_im(cdata[b][Idx]);
+
+//             compensated summation
+               const long   t = (long)sp*NBin + bin;
+               const double y = Power - Comp[t];
+               const double s = Sum[t] + y;
+
+               Comp[t] = ( s - Sum[t] ) - y;
+               Sum [t] = s;
+            }
+         } // for (int i=0; i<Nx_Padded; i++)
+      } // for o, m
+   } // OpenMP parallel region
+
+
+// combine the partial sums of all threads in order
+   double *PS_Thread    = PS_local;      // reuse the buffer of thread 0
+   long   *Count_Thread = Count_local;
+
+   for (long t=0; t<(long)NSpec*NBin; t++)
    {
-      j = j_start + jj;
+      double Sum = 0.0, Comp = 0.0;
 
-      for (int k=0; k<Nz; k++)
-      for (int i=0; i<Nx_Padded; i++)
+      for (int TID=0; TID<NT; TID++)
       {
-         Idx = ((long)jj*Nz + k)*Nx_Padded + i;
+         const long   tt = (long)TID*NSpec*NBin + t;
+         const double y  = ( PS_local[tt] - PS_Comp[tt] ) - Comp;
+         const double s  = Sum + y;
 
-#  endif // #ifdef SERIAL ... else ...
+         Comp = ( s - Sum ) - y;
+         Sum  = s;
+      }
 
-//       round to nearest bin
-//       bin =     int(   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
-#        ifdef FLOAT8
-         bin = lround (   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
-#        else
-         bin = lroundf(   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
-#        endif
+      PS_Thread[t] = Sum;
+   }
 
-         if ( bin < Nx_Padded )
-         {
-            PS_local   [bin] += double(  SQR( c_re(cdata[Idx]) ) + SQR( c_im(cdata[Idx])  ) );
-            Count_local[bin] ++;
-         }
-      } // i,j,k
-   } // i,j,k
+   for (int bin=0; bin<NBin; bin++)
+   for (int TID=1; TID<NT; TID++)
+      Count_Thread[bin] += Count_local[ (long)TID*NBin + bin ];
 
 
 // sum over all ranks
-   MPI_Reduce( PS_local,    PS_total,    Nx_Padded, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-   MPI_Reduce( Count_local, Count_total, Nx_Padded, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( PS_Thread,    PS_total,    NSpec*NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Count_Thread, Count_total, NBin,       MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+   delete [] bin_j;
+   delete [] bin_k;
+   delete [] PS_local;
+   delete [] PS_Comp;
+   delete [] Count_local;
+
+} // FUNCTION : GetBasePowerSpectrum
 
 
-// normalization
-   double Coeff;
-   double AveVar;
-   double Norm;
 
-#  ifdef DIMENSIONLESS_FORM
-   const double k0 = 2.0*M_PI/amr->BoxSize[0];     // assuming cubic box
-   double WaveK;
+//-------------------------------------------------------------------------------------------------------
+// Function    :  NormalizeByMean
+// Description :  Return whether the power spectrum of the target variable is normalized by its squared mean value
+//
+// Note        :  1. Variables that are not positive definite (e.g., momentum, velocity, and potential) can have
+//                   vanishing mean values and are thus not normalized by them
+//
+// Parameter   :  TVar : Target variable
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool NormalizeByMean( const long TVar )
+{
+
+   long TVarSigned = 0;
+
+#  if   ( MODEL == HYDRO )
+   TVarSigned |= _MOMX | _MOMY | _MOMZ | _VELX | _VELY | _VELZ | _MAGX_CC | _MAGY_CC | _MAGZ_CC;
+#  elif ( MODEL == ELBDM )
+   TVarSigned |= _REAL | _IMAG;
+#  endif
+#  ifdef GRAVITY
+   TVarSigned |= _POTE;
 #  endif
 
-   if ( MPI_Rank == 0 )
+   return !( TVar & TVarSigned );
+
+} // FUNCTION : NormalizeByMean
+
+
+
+#ifdef MASSIVE_PARTICLES
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PrepareParticleDensity
+// Description :  Prepare or free the particle data required for computing the particle mass density
+//
+// Note        :  1. Init = true : collect particles to the target level and initialize the particle density
+//                                 array (rho_ext)
+//                   Init = false: free the memory allocated by Init = true
+//
+// Parameter   :  lv   : Target level
+//                Init : Initialize (true) or free (false) the particle data
+//-------------------------------------------------------------------------------------------------------
+void PrepareParticleDensity( const int lv, const bool Init )
+{
+
+   const bool TimingSendPar_No = false;
+   const bool JustCountNPar_No = false;
+#  ifdef LOAD_BALANCE
+   const bool PredictPos       = amr->Par->PredictPos;
+   const bool SibBufPatch      = true;
+   const bool FaSibBufPatch    = true;
+#  else
+   const bool PredictPos       = false;
+   const bool SibBufPatch      = NULL_BOOL;
+   const bool FaSibBufPatch    = NULL_BOOL;
+#  endif
+
+   if ( Init )
    {
-//    normalization: SQR(AveVar) accounts for Delta=Var/AveVar
-      AveVar = SQRT(PS_total[0]/(double)Count_total[0]) / ( (double)Nx*(double)Ny*(double)Nz );  // from DC mode of FFT
-      Coeff  = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2] / SQR( (double)Nx*(double)Ny*(double)Nz*AveVar );
+      Par_CollectParticle2OneLevel( lv, _PAR_MASS|_PAR_POSX|_PAR_POSY|_PAR_POSZ, _PAR_TYPE, PredictPos, Time[lv],
+                                    SibBufPatch, FaSibBufPatch, JustCountNPar_No, TimingSendPar_No );
 
-      for (int b=0; b<Nx_Padded; b++)
-      {
-//       average
-         PS_total[b] /= (double)Count_total[b];
+      Prepare_PatchData_InitParticleDensityArray( lv, Time[lv] );
+   }
 
-//       normalization
-#        ifdef DIMENSIONLESS_FORM
-         WaveK        = b*k0;
-         Norm         = Coeff*CUBE(WaveK)/(2.0*M_PI*M_PI);     // dimensionless power spectrum
-#        else
-         Norm         = Coeff;                                 // dimensional power spectrum [Mpc^3/h^3]
-#        endif
-         PS_total[b] *= Norm;
-      }
+   else
+   {
+      Par_CollectParticle2OneLevel_FreeMemory( lv, SibBufPatch, FaSibBufPatch );
 
-      *NormDC = AveVar;
+      Prepare_PatchData_FreeParticleDensityArray( lv );
    }
 
-} // FUNCTION : GetBasePowerSpectrum
+} // FUNCTION : PrepareParticleDensity
+#endif // #ifdef MASSIVE_PARTICLES
 
 
 
@@ -0,0 +1,693 @@
+#ifdef SUPPORT_HDF5
+
+#include "GAMER.h"
+#include "HDF5_Typedef.h"
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+
+void FillIn_KeyInfo  (   KeyInfo_t &KeyInfo, const int NFieldStored );
+void FillIn_Makefile (  Makefile_t &Makefile  );
+void FillIn_SymConst (  SymConst_t &SymConst  );
+void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char FieldLabelOut[][MAX_STRING] );
+void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
+void GetCompound_Makefile ( hid_t &H5_TypeID );
+void GetCompound_SymConst ( hid_t &H5_TypeID );
+void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored );
+
+static void  WritePiece( const char *PieceName );
+static void  MakeDir( const char *DirName );
+static void *DrainPiece( void *Arg );
+
+
+// size of the I/O buffer used by the drain thread
+#define DRAIN_BUF_SIZE  ( 1L<<22 )
+
+// variables of the background drain thread
+// --> they are only accessed by the main thread except when the drain thread is running
+static pthread_t Drain_Thread;
+static bool      Drain_Active = false;
+static bool      Drain_Failed = false;
+static char      Drain_Src [2*MAX_STRING];   // piece on the node-local disk
+static char      Drain_Dst [2*MAX_STRING];   // copy in the working directory
+
+// piece of the previous checkpoint on the node-local disk
+static char      Previous_Piece[2*MAX_STRING] = "";
+static char      Previous_Dir  [2*MAX_STRING] = "";
+
+
+
+/*======================================================================================================
+Data structure of each piece "NODE_LOCAL_DIR/Checkpoint_XXXXXXXXX/Rank_YYYYYY":
+/ -> |
+     | -> Info group      -> | -> InputPara dset (compound)
+     |                       | -> KeyInfo   dset (compound)
+     |                       | -> Makefile  dset (compound)
+     |                       | -> SymConst  dset (compound)
+     |
+     | -> NodeLocal group -> | -> NRank    dset
+     |                       | -> Rank     dset
+     |                       | -> NPatch   dset   (number of real patches at each level in this rank)
+     |                       | -> CutPoint dset   (load-balance cut points of all ranks)
+     |
+     | -> Tree group      -> | -> Corner dset
+     |                       | -> LBIdx  dset
+     |                       | -> NPar   dset
+     |
+     | -> GridData group  -> | -> Dens dset
+     |                       | -> ...
+     |
+     | -> Particle group  -> | -> ParMass dset
+                             | -> ...
+
+1. Same layout as Output_DumpData_Total_HDF5() except that only the real patches and particles of this rank
+   are stored, sorted by level and then by PID
+   --> Patch index in each dataset is a local index instead of the global GID
+2. KeyInfo records the global information (e.g., the total number of patches)
+3. Only the intrinsic fields required by restart are stored (i.e., no derived fields and no father, son,
+   and sibling relations)
+======================================================================================================*/
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_DumpData_NodeLocal
+// Description :  Output a restart checkpoint with each rank writing its own patches and particles to a
+//                node-local directory
+//
+// Note        :  1. Invoked by main() when OPT__OUTPUT_NODE_LOCAL is on
+//                2. Checkpoints are output every NODE_LOCAL_STEP root-level steps and at the end of the run,
+//                   independent of OPT__OUTPUT_MODE
+//                   --> They are for restart only and do NOT replace the snapshots "Data_XXXXXX" of
+//                       OPT__OUTPUT_TOTAL, which are still written by Output_DumpData_Total_HDF5()
+//                3. Each rank writes the piece "NODE_LOCAL_DIR/Checkpoint_XXXXXXXXX/Rank_YYYYYY" without any
+//                   global file or inter-rank synchronization during writing, where XXXXXXXXX is the step
+//                   --> See the beginning of this file for the data layout
+//                4. If OPT__NODE_LOCAL_DRAIN is on, a background thread then copies the piece to
+//                   "Checkpoint_XXXXXXXXX/Rank_YYYYYY" in the working directory
+//                   --> The copy is first written as "Rank_YYYYYY.tmp" and renamed when complete
+//                   --> The thread only performs POSIX I/O (no HDF5 or MPI calls)
+//                   --> The previous drain is completed before writing a new checkpoint
+//                   --> The pieces are NOT assembled into a single HDF5 file
+//                5. Each checkpoint removes the previous one written by the same run from the node-local disk
+//                6. Init_ByRestart_HDF5() can restart from these pieces with the same number of MPI ranks
+//                   --> Set RESTART to a symbolic link to the directory "Checkpoint_XXXXXXXXX"
+//
+// Parameter   :  Stage : 0 : beginning of the run (do nothing)
+//                        1 : during the evolution
+//                        2 : end of the run
+//-------------------------------------------------------------------------------------------------------
+void Output_DumpData_NodeLocal( const int Stage )
+{
+
+// check
+   if ( Stage < 0  ||  Stage > 2 )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "Stage", Stage );
+
+
+// output checkpoints only every NODE_LOCAL_STEP steps and at the end of the run
+// --> do not output the same step twice at the end of the run
+   static long PreviousStep = -1;
+
+   if (  Stage == 0  ||  Step == PreviousStep  ||  ( Stage == 1 && Step%NODE_LOCAL_STEP != 0 )  )   return;
+
+   PreviousStep = Step;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step = %ld) ...\n", __FUNCTION__, Step );
+
+
+// check the synchronization
+   for (int lv=1; lv<NLEVEL; lv++)
+      if ( NPatchTotal[lv] != 0 )   Mis_CompareRealValue( Time[0], Time[lv], __FUNCTION__, true );
+
+
+// 1. complete the drain of the previous checkpoint
+   Output_NodeLocal_WaitDrain();
+
+
+// 2. write the piece of this rank to the node-local disk
+   char FileName[MAX_STRING], DirName[2*MAX_STRING], PieceName[2*MAX_STRING];
+
+   sprintf( FileName, "Checkpoint_%09ld", Step );
+
+   if (  snprintf( DirName, sizeof(DirName), "%s/%s", NODE_LOCAL_DIR, FileName ) >= (int)sizeof(DirName)  )
+      Aux_Error( ERROR_INFO, "node-local directory name \"%s/%s\" is too long !!\n", NODE_LOCAL_DIR, FileName );
+
+   if (  snprintf( PieceName, sizeof(PieceName), "%s/Rank_%06d", DirName, MPI_Rank ) >= (int)sizeof(PieceName)  )
+      Aux_Error( ERROR_INFO, "node-local piece name \"%s/Rank_%06d\" is too long !!\n", DirName, MPI_Rank );
+
+   MakeDir( DirName );
+
+   Timer_t Timer;
+   Timer.Start();
+
+   WritePiece( PieceName );
+
+   Timer.Stop();
+
+
+// 3. remove the piece of the previous checkpoint
+//    --> the directory is removed by the last rank on the same node
+   if ( Previous_Piece[0] != '\0' )
+   {
+      if ( remove( Previous_Piece ) != 0 )
+         Aux_Message( stderr, "WARNING : failed to remove the previous node-local checkpoint \"%s\" (rank %d) !!\n",
+                      Previous_Piece, MPI_Rank );
+
+      rmdir( Previous_Dir );
+   }
+
+   strcpy( Previous_Piece, PieceName );
+   strcpy( Previous_Dir,   DirName   );
+
+
+// 4. launch the drain thread
+   if ( OPT__NODE_LOCAL_DRAIN )
+   {
+      if ( MPI_Rank == 0 )    MakeDir( FileName );
+      MPI_Barrier( MPI_COMM_WORLD );
+
+      strcpy  ( Drain_Src, PieceName );
+      snprintf( Drain_Dst, sizeof(Drain_Dst), "%s/Rank_%06d", FileName, MPI_Rank );
+
+      Drain_Failed = false;
+
+      if ( pthread_create( &Drain_Thread, NULL, DrainPiece, NULL ) != 0 )
+      {
+         Aux_Message( stderr, "WARNING : failed to create the drain thread --> copying \"%s\" synchronously (rank %d) !!\n",
+                      Drain_Src, MPI_Rank );
+         DrainPiece( NULL );
+      }
+
+      else
+         Drain_Active = true;
+   }
+
+
+// 5. report the write time
+   double WriteTime = Timer.GetValue(), WriteTime_Max;
+
+   MPI_Reduce( &WriteTime, &WriteTime_Max, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "%s (Step = %ld) ... done (write %.3e s%s)\n",
+                   __FUNCTION__, Step, WriteTime_Max, ( OPT__NODE_LOCAL_DRAIN ) ? ", draining in background" : "" );
+
+} // FUNCTION : Output_DumpData_NodeLocal
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_NodeLocal_WaitDrain
+// Description :  Wait until the background drain of the previous node-local checkpoint completes
+//
+// Note        :  1. Must be called by all ranks since it reports the failed ranks collectively
+//                2. Invoked by Output_DumpData_NodeLocal() and End_GAMER()
+//                3. Do nothing if no drain is in progress on any rank
+//-------------------------------------------------------------------------------------------------------
+void Output_NodeLocal_WaitDrain()
+{
+
+   int NFailed = 0, NFailed_AllRank;
+
+   if ( Drain_Active )
+   {
+      pthread_join( Drain_Thread, NULL );
+      Drain_Active = false;
+
+      if ( Drain_Failed )
+      {
+         NFailed = 1;
+         Aux_Message( stderr, "WARNING : failed to drain \"%s\" to \"%s\" (rank %d) !!\n", Drain_Src, Drain_Dst, MPI_Rank );
+      }
+   }
+
+   MPI_Allreduce( &NFailed, &NFailed_AllRank, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0  &&  NFailed_AllRank > 0 )
+      Aux_Message( stderr, "WARNING : %d rank(s) failed to drain the node-local checkpoint !!\n", NFailed_AllRank );
+
+} // FUNCTION : Output_NodeLocal_WaitDrain
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WritePiece
+// Description :  Write the real patches and particles of this rank to a standalone HDF5 file
+//
+// Note        :  1. Field data are stored in the same way as Output_DumpData_Total_HDF5() so that they can be
+//                   loaded by LoadOnePatch() in Init_ByRestart_HDF5.cpp
+//                2. Each rank creates and closes its own file independently
+//
+// Parameter   :  PieceName : Name of the output file
+//-------------------------------------------------------------------------------------------------------
+void WritePiece( const char *PieceName )
+{
+
+// 1. determine the fields to be stored
+#  if (  ELBDM_SCHEME == ELBDM_HYBRID  &&  !defined( GAMER_DEBUG )  )
+   const int NCompStore = NCOMP_TOTAL - 1;   // do not store STUB field unless we are in debug mode
+#  else
+   const int NCompStore = NCOMP_TOTAL;
+#  endif
+
+   char FieldLabelOut[NFIELD_STORED_MAX][MAX_STRING];
+
+   for (int v=0; v<NCompStore; v++)    sprintf( FieldLabelOut[v], "%s", FieldLabel[v] );
+
+
+// 2. set the local patch index offset at each level
+   int NPatchLocal[NLEVEL], PatchOffset[NLEVEL], NPatchLocal_AllLv=0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NPatchLocal[lv]    = amr->NPatchComma[lv][1];
+      PatchOffset[lv]    = NPatchLocal_AllLv;
+      NPatchLocal_AllLv += NPatchLocal[lv];
+   }
+
+
+// 3. prepare HDF5 variables
+   hsize_t H5_SetDims[4], H5_MemDims[4], H5_Offset[4];
+   hid_t   H5_FileID, H5_GroupID, H5_SetID, H5_SpaceID, H5_MemID, H5_AttID_Cvt2Phy;
+   hid_t   H5_SpaceID_Scalar, H5_DataCreatePropList;
+   hid_t   H5_TypeID_Com_KeyInfo, H5_TypeID_Com_Makefile, H5_TypeID_Com_SymConst, H5_TypeID_Com_InputPara;
+   herr_t  H5_Status;
+
+   H5_DataCreatePropList = H5Pcreate( H5P_DATASET_CREATE );
+   H5_Status             = H5Pset_fill_time( H5_DataCreatePropList, H5D_FILL_TIME_NEVER );
+   H5_SpaceID_Scalar     = H5Screate( H5S_SCALAR );
+
+   GetCompound_KeyInfo  ( H5_TypeID_Com_KeyInfo   );
+   GetCompound_Makefile ( H5_TypeID_Com_Makefile  );
+   GetCompound_SymConst ( H5_TypeID_Com_SymConst  );
+   GetCompound_InputPara( H5_TypeID_Com_InputPara, NCompStore );
+
+   H5_FileID = H5Fcreate( PieceName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to create the HDF5 file \"%s\" !!\n", PieceName );
+
+
+// 4. simulation information
+   KeyInfo_t   KeyInfo;
+   Makefile_t  Makefile;
+   SymConst_t  SymConst;
+   InputPara_t InputPara;
+
+   FillIn_KeyInfo  ( KeyInfo, NCompStore );
+   FillIn_Makefile ( Makefile );
+   FillIn_SymConst ( SymConst );
+   FillIn_InputPara( InputPara, NCompStore, FieldLabelOut );
+
+   H5_GroupID = H5Gcreate( H5_FileID, "Info", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Info" );
+
+   const char  *InfoName[4] = { "KeyInfo", "Makefile", "SymConst", "InputPara" };
+   const hid_t  InfoType[4] = { H5_TypeID_Com_KeyInfo, H5_TypeID_Com_Makefile, H5_TypeID_Com_SymConst, H5_TypeID_Com_InputPara };
+   const void  *InfoData[4] = { &KeyInfo, &Makefile, &SymConst, &InputPara };
+
+   for (int t=0; t<4; t++)
+   {
+      H5_SetID  = H5Dcreate( H5_GroupID, InfoName[t], InfoType[t], H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", InfoName[t] );
+      H5_Status = H5Dwrite( H5_SetID, InfoType[t], H5S_ALL, H5S_ALL, H5P_DEFAULT, InfoData[t] );
+      H5_Status = H5Dclose( H5_SetID );
+   }
+
+   H5_Status = H5Gclose( H5_GroupID );
+
+   for (int lv=0; lv<NLEVEL-1; lv++)   free( InputPara.FlagTable_User[lv].p );
+
+
+// 5. rank layout
+   H5_GroupID = H5Gcreate( H5_FileID, "NodeLocal", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "NodeLocal" );
+
+   H5_SetID  = H5Dcreate( H5_GroupID, "NRank", H5T_NATIVE_INT, H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &MPI_NRank );
+   H5_Status = H5Dclose( H5_SetID );
+
+   H5_SetID  = H5Dcreate( H5_GroupID, "Rank", H5T_NATIVE_INT, H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &MPI_Rank );
+   H5_Status = H5Dclose( H5_SetID );
+
+   H5_SetDims[0] = NLEVEL;
+   H5_SpaceID    = H5Screate_simple( 1, H5_SetDims, NULL );
+   H5_SetID      = H5Dcreate( H5_GroupID, "NPatch", H5T_NATIVE_INT, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status     = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NPatchLocal );
+   H5_Status     = H5Dclose( H5_SetID );
+   H5_Status     = H5Sclose( H5_SpaceID );
+
+#  ifdef LOAD_BALANCE
+   long *CutPoint = new long [ NLEVEL*(MPI_NRank+1) ];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+      memcpy( CutPoint+lv*(MPI_NRank+1), amr->LB->CutPoint[lv], (MPI_NRank+1)*sizeof(long) );
+
+   H5_SetDims[0] = NLEVEL;
+   H5_SetDims[1] = MPI_NRank + 1;
+   H5_SpaceID    = H5Screate_simple( 2, H5_SetDims, NULL );
+   H5_SetID      = H5Dcreate( H5_GroupID, "CutPoint", H5T_NATIVE_LONG, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status     = H5Dwrite( H5_SetID, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, CutPoint );
+   H5_Status     = H5Dclose( H5_SetID );
+   H5_Status     = H5Sclose( H5_SpaceID );
+
+   delete [] CutPoint;
+#  endif
+
+   H5_Status = H5Gclose( H5_GroupID );
+
+
+// 6. tree information of the local patches
+   int  (*CrList)[3] = new int  [NPatchLocal_AllLv][3];
+   long  *LBIdxList  = new long [NPatchLocal_AllLv];
+#  ifdef PARTICLE
+   int   *NParList   = new int  [NPatchLocal_AllLv];
+#  endif
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int PID=0; PID<NPatchLocal[lv]; PID++)
+   {
+      const int t = PatchOffset[lv] + PID;
+
+      for (int d=0; d<3; d++)    CrList[t][d] = amr->patch[0][lv][PID]->corner[d];
+
+      LBIdxList[t] = amr->patch[0][lv][PID]->LB_Idx;
+#     ifdef PARTICLE
+      NParList [t] = amr->patch[0][lv][PID]->NPar;
+#     endif
+   }
+
+   H5_GroupID = H5Gcreate( H5_FileID, "Tree", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Tree" );
+
+// 6-1. corner
+   H5_SetDims[0] = NPatchLocal_AllLv;
+   H5_SetDims[1] = 3;
+   H5_SpaceID    = H5Screate_simple( 2, H5_SetDims, NULL );
+   H5_SetID      = H5Dcreate( H5_GroupID, "Corner", H5T_NATIVE_INT, H5_SpaceID, H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Corner" );
+
+   H5_AttID_Cvt2Phy = H5Acreate( H5_SetID, "Cvt2Phy", H5T_NATIVE_DOUBLE, H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status        = H5Awrite( H5_AttID_Cvt2Phy, H5T_NATIVE_DOUBLE, &amr->dh[TOP_LEVEL] );
+   H5_Status        = H5Aclose( H5_AttID_Cvt2Phy );
+
+   H5_Status     = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, CrList );
+   H5_Status     = H5Dclose( H5_SetID );
+   H5_Status     = H5Sclose( H5_SpaceID );
+
+// 6-2. LBIdx
+   H5_SpaceID    = H5Screate_simple( 1, H5_SetDims, NULL );
+   H5_SetID      = H5Dcreate( H5_GroupID, "LBIdx", H5T_NATIVE_LONG, H5_SpaceID, H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "LBIdx" );
+   H5_Status     = H5Dwrite( H5_SetID, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, LBIdxList );
+   H5_Status     = H5Dclose( H5_SetID );
+
+// 6-3. NPar
+#  ifdef PARTICLE
+   H5_SetID      = H5Dcreate( H5_GroupID, "NPar", H5T_NATIVE_INT, H5_SpaceID, H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "NPar" );
+   H5_Status     = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NParList );
+   H5_Status     = H5Dclose( H5_SetID );
+#  endif
+
+   H5_Status = H5Sclose( H5_SpaceID );
+   H5_Status = H5Gclose( H5_GroupID );
+
+   delete [] CrList;
+   delete [] LBIdxList;
+#  ifdef PARTICLE
+   delete [] NParList;
+#  endif
+
+
+// 7. grid data (one field at one level at a time)
+   const int FieldSizeOnePatch = sizeof(real)*CUBE(PS1);
+
+   int MaxNPatchLocal = 0;
+   for (int lv=0; lv<NLEVEL; lv++)  MaxNPatchLocal = MAX( MaxNPatchLocal, NPatchLocal[lv] );
+
+   H5_GroupID = H5Gcreate( H5_FileID, "GridData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "GridData" );
+
+// 7-1. cell-centered fields
+   real (*FieldData)[PS1][PS1][PS1] = new real [MaxNPatchLocal][PS1][PS1][PS1];
+
+   H5_SetDims[0] = NPatchLocal_AllLv;
+   H5_SetDims[1] = PS1;
+   H5_SetDims[2] = PS1;
+   H5_SetDims[3] = PS1;
+   H5_SpaceID    = H5Screate_simple( 4, H5_SetDims, NULL );
+
+   for (int v=0; v<NCompStore; v++)
+   {
+      H5_SetID = H5Dcreate( H5_GroupID, FieldLabelOut[v], H5T_GAMER_REAL, H5_SpaceID, H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldLabelOut[v] );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPatchLocal[lv] == 0 )   continue;
+
+//       convert real/imag to density/phase in the hybrid scheme as Output_DumpData_Total_HDF5()
+#        if ( ELBDM_SCHEME == ELBDM_HYBRID )
+         if (  amr->use_wave_flag[lv]  &&  ( v == REAL || v == IMAG )  )
+         {
+            for (int PID=0; PID<NPatchLocal[lv]; PID++)
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               const real Re = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[REAL][k][j][i];
+               const real Im = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[IMAG][k][j][i];
+
+               FieldData[PID][k][j][i] = ( v == REAL ) ? SATAN2( Im, Re ) : (real)0.0;
+            }
+         }
+
+         else
+#        endif
+         for (int PID=0; PID<NPatchLocal[lv]; PID++)
+            memcpy( FieldData[PID], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v], FieldSizeOnePatch );
+
+         H5_MemDims[0] = NPatchLocal[lv];
+         H5_MemDims[1] = PS1;
+         H5_MemDims[2] = PS1;
+         H5_MemDims[3] = PS1;
+         H5_MemID      = H5Screate_simple( 4, H5_MemDims, NULL );
+
+         H5_Offset[0]  = PatchOffset[lv];
+         H5_Offset[1]  = 0;
+         H5_Offset[2]  = 0;
+         H5_Offset[3]  = 0;
+
+         H5_Status = H5Sselect_hyperslab( H5_SpaceID, H5S_SELECT_SET, H5_Offset, NULL, H5_MemDims, NULL );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
+
+         H5_Status = H5Dwrite( H5_SetID, H5T_GAMER_REAL, H5_MemID, H5_SpaceID, H5P_DEFAULT, FieldData );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+
+         H5_Status = H5Sclose( H5_MemID );
+      } // for (int lv=0; lv<NLEVEL; lv++)
+
+      H5_Status = H5Dclose( H5_SetID );
+   } // for (int v=0; v<NCompStore; v++)
+
+   H5_Status = H5Sclose( H5_SpaceID );
+   delete [] FieldData;
+
+// 7-2. face-centered magnetic field
+#  ifdef MHD
+   const int FCMagSizeOnePatch = sizeof(real)*PS1P1*SQR(PS1);
+   real (*FCMagData)[PS1P1*SQR(PS1)] = new real [MaxNPatchLocal][PS1P1*SQR(PS1)];
+
+   for (int v=0; v<NCOMP_MAG; v++)
+   {
+      H5_SetDims[0] = NPatchLocal_AllLv;
+      for (int t=1; t<4; t++)
+      H5_SetDims[t] = ( 3-t == v ) ? PS1P1 : PS1;
+
+      H5_SpaceID = H5Screate_simple( 4, H5_SetDims, NULL );
+      H5_SetID   = H5Dcreate( H5_GroupID, MagLabel[v], H5T_GAMER_REAL, H5_SpaceID, H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", MagLabel[v] );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPatchLocal[lv] == 0 )   continue;
+
+         for (int PID=0; PID<NPatchLocal[lv]; PID++)
+            memcpy( FCMagData[PID], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v], FCMagSizeOnePatch );
+
+         H5_MemDims[0] = NPatchLocal[lv];
+         for (int t=1; t<4; t++)
+         H5_MemDims[t] = H5_SetDims[t];
+         H5_MemID      = H5Screate_simple( 4, H5_MemDims, NULL );
+
+         H5_Offset[0]  = PatchOffset[lv];
+         H5_Offset[1]  = 0;
+         H5_Offset[2]  = 0;
+         H5_Offset[3]  = 0;
+
+         H5_Status = H5Sselect_hyperslab( H5_SpaceID, H5S_SELECT_SET, H5_Offset, NULL, H5_MemDims, NULL );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field !!\n" );
+
+         H5_Status = H5Dwrite( H5_SetID, H5T_GAMER_REAL, H5_MemID, H5_SpaceID, H5P_DEFAULT, FCMagData );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+
+         H5_Status = H5Sclose( H5_MemID );
+      } // for (int lv=0; lv<NLEVEL; lv++)
+
+      H5_Status = H5Dclose( H5_SetID );
+      H5_Status = H5Sclose( H5_SpaceID );
+   } // for (int v=0; v<NCOMP_MAG; v++)
+
+   delete [] FCMagData;
+#  endif // #ifdef MHD
+
+   H5_Status = H5Gclose( H5_GroupID );
+
+
+// 8. particles (one attribute at a time)
+//    --> particles must be stored in the same order as their associated patches
+#  ifdef PARTICLE
+   long NParLocal = 0;
+   for (int lv=0; lv<NLEVEL; lv++)  NParLocal += amr->Par->NPar_Lv[lv];
+
+   real_par *ParFltBuf = new real_par [NParLocal];
+   long_par *ParIntBuf = new long_par [NParLocal];
+
+   H5_GroupID = H5Gcreate( H5_FileID, "Particle", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Particle" );
+
+   H5_SetDims[0] = NParLocal;
+   H5_SpaceID    = H5Screate_simple( 1, H5_SetDims, NULL );
+
+// skip the last PAR_NATT_FLT/INT_UNSTORED attributes since they are not stored on disk
+   for (int v=0; v<PAR_NATT_FLT_STORED+PAR_NATT_INT_STORED; v++)
+   {
+      const bool  IsFlt    = ( v < PAR_NATT_FLT_STORED );
+      const int   vv       = ( IsFlt ) ? v : v - PAR_NATT_FLT_STORED;
+      const char *ParLabel = ( IsFlt ) ? ParAttFltLabel[vv] : ParAttIntLabel[vv];
+      long        NParInBuf = 0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int PID=0; PID<NPatchLocal[lv]; PID++)
+      for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+      {
+         const long ParID = amr->patch[0][lv][PID]->ParList[p];
+
+         if ( IsFlt )   ParFltBuf[ NParInBuf ++ ] = amr->Par->AttributeFlt[vv][ParID];
+         else           ParIntBuf[ NParInBuf ++ ] = amr->Par->AttributeInt[vv][ParID];
+      }
+
+      if ( NParInBuf != NParLocal )
+         Aux_Error( ERROR_INFO, "number of particles in patches (%ld) != expect (%ld) !!\n", NParInBuf, NParLocal );
+
+      H5_SetID = H5Dcreate( H5_GroupID, ParLabel, ( IsFlt ) ? H5T_GAMER_REAL_PAR : H5T_GAMER_LONG_PAR, H5_SpaceID,
+                            H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", ParLabel );
+
+      if ( IsFlt )   H5_Status = H5Dwrite( H5_SetID, H5T_GAMER_REAL_PAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, ParFltBuf );
+      else           H5_Status = H5Dwrite( H5_SetID, H5T_GAMER_LONG_PAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, ParIntBuf );
+      if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write the particle attribute \"%s\" !!\n", ParLabel );
+
+      H5_Status = H5Dclose( H5_SetID );
+   } // for (int v=0; v<PAR_NATT_FLT_STORED+PAR_NATT_INT_STORED; v++)
+
+   H5_Status = H5Sclose( H5_SpaceID );
+   H5_Status = H5Gclose( H5_GroupID );
+
+   delete [] ParFltBuf;
+   delete [] ParIntBuf;
+#  endif // #ifdef PARTICLE
+
+
+// 9. close all objects
+   H5_Status = H5Tclose( H5_TypeID_Com_KeyInfo );
+   H5_Status = H5Tclose( H5_TypeID_Com_Makefile );
+   H5_Status = H5Tclose( H5_TypeID_Com_SymConst );
+   H5_Status = H5Tclose( H5_TypeID_Com_InputPara );
+   H5_Status = H5Sclose( H5_SpaceID_Scalar );
+   H5_Status = H5Pclose( H5_DataCreatePropList );
+   H5_Status = H5Fclose( H5_FileID );
+
+} // FUNCTION : WritePiece
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MakeDir
+// Description :  Create a directory if it does not exist
+//
+// Note        :  1. Ranks on the same node may create the same directory simultaneously
+//                   --> Do not treat EEXIST as an error
+//
+// Parameter   :  DirName : Name of the target directory
+//-------------------------------------------------------------------------------------------------------
+void MakeDir( const char *DirName )
+{
+
+   if (  mkdir( DirName, 0755 ) != 0  &&  errno != EEXIST  )
+      Aux_Error( ERROR_INFO, "failed to create the directory \"%s\" (%s) !!\n", DirName, strerror(errno) );
+
+} // FUNCTION : MakeDir
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  DrainPiece
+// Description :  Copy the node-local piece Drain_Src to Drain_Dst
+//
+// Note        :  1. Executed by the background drain thread created in Output_DumpData_NodeLocal()
+//                   --> Must not call any MPI, HDF5, or Aux_Error() function
+//                2. Write to "Drain_Dst.tmp" first and rename it when complete so that an existing Drain_Dst is
+//                   always a complete copy
+//                3. Set Drain_Failed on failure, which is reported by Output_NodeLocal_WaitDrain()
+//
+// Parameter   :  Arg : Useless (required by pthread_create())
+//-------------------------------------------------------------------------------------------------------
+void *DrainPiece( void *Arg )
+{
+
+   char TmpName[2*MAX_STRING+4];
+   snprintf( TmpName, sizeof(TmpName), "%s.tmp", Drain_Dst );
+
+   FILE *Src = fopen( Drain_Src, "rb" );
+   FILE *Dst = fopen( TmpName,   "wb" );
+
+   if ( Src == NULL  ||  Dst == NULL )
+   {
+      if ( Src != NULL )   fclose( Src );
+      if ( Dst != NULL )   fclose( Dst );
+
+      Drain_Failed = true;
+      return NULL;
+   }
+
+   char  *Buf = new char [DRAIN_BUF_SIZE];
+   size_t NRead;
+
+   while (  ( NRead = fread( Buf, 1, DRAIN_BUF_SIZE, Src ) ) > 0  )
+   {
+      if ( fwrite( Buf, 1, NRead, Dst ) != NRead )
+      {
+         Drain_Failed = true;
+         break;
+      }
+   }
+
+   if ( ferror(Src) )      Drain_Failed = true;
+   if ( fclose(Dst) != 0 ) Drain_Failed = true;
+   fclose( Src );
+
+   delete [] Buf;
+
+   if ( !Drain_Failed  &&  rename( TmpName, Drain_Dst ) != 0 )   Drain_Failed = true;
+
+   return NULL;
+
+} // FUNCTION : DrainPiece
+
+
+
+#endif // #ifdef SUPPORT_HDF5
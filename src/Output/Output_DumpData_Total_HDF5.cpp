@@ -9,10 +9,14 @@ void FillIn_Makefile (  Makefile_t &Makefile  );
 void FillIn_SymConst (  SymConst_t &SymConst  );
 void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char FieldLabelOut[][MAX_STRING] );
 
-static void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
-static void GetCompound_Makefile ( hid_t &H5_TypeID );
-static void GetCompound_SymConst ( hid_t &H5_TypeID );
-static void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored );
+void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
+void GetCompound_Makefile ( hid_t &H5_TypeID );
+void GetCompound_SymConst ( hid_t &H5_TypeID );
+void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored );
+
+void   Output_HDF5_SetChunkDeflate( const hid_t H5_PropList, const hsize_t H5_SetDims[4] );
+herr_t Output_HDF5_WriteGridData( const hid_t H5_SetID, const hid_t H5_MemID, const hid_t H5_SpaceID, real *Data,
+                                  const int NPatch, const long GID0, const int NElemPerPatch, const double RelErr );
 
 
 
@@ -69,7 +73,7 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2500)
+// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2514)
 // Description :  Output all simulation data in the HDF5 format, which can be used as a restart file
 //                or loaded by YT
 //
@@ -106,6 +110,18 @@ Procedure for outputting new variables:
 //                        --> Currently we store different attributes in separate datasets
 //                        --> Particles are stored in the order of their associated GIDs as well, but the order of
 //                            particles in the same patch is not specified
+//                11. For OPT__OUTPUT_DEFLATE > 0, datasets in the "GridData" group are chunked with one patch group
+//                    per chunk and compressed by the shuffle and deflate filters
+//                    --> Chunks are compressed in parallel by OpenMP threads (see Output_HDF5_WriteGridData())
+//                    --> Derived fields are further rounded to the relative error OUTPUT_LOSSY_REL_ERR if it is positive,
+//                        while the intrinsic fields required by restart are always lossless
+//                12. All derived fields (e.g., OPT__OUTPUT_PRES/TEMP/ENTR/CS/DIVVEL/MACH/DIVMAG/USER_FIELD) at one level
+//                    are computed in a single OpenMP-threaded pass and written chunk by chunk
+//                    --> Ghost zones of each patch group are prepared only once for all derived fields requiring them
+//                    --> Require an additional buffer of NDerStored*MIN(NPatch,Der_ChunkNPatch)*PS1^3 reals, where
+//                        NDerStored is the number of derived fields and NPatch is the number of real patches at
+//                        one level in this rank
+//                    --> Flu_DerivedField_User_Ptr() must be thread-safe
 //
 // Parameter   :  FileName : Name of the output file
 //
@@ -263,6 +279,23 @@ Procedure for outputting new variables:
 //                2481 : 2024/12/11 --> output OPT__FLAG_ANGULAR, FlagTable_Angular, FLAG_ANGULAR_CEN_X, FLAG_ANGULAR_CEN_Y, FLAG_ANGULAR_CEN_Z
 //                                             OPT__FLAG_RADIAL,  FlagTable_Radial,  FLAG_RADIAL_CEN_X,  FLAG_RADIAL_CEN_Y,  FLAG_RADIAL_CEN_Z
 //                2500 : 2024/07/01 --> output particle integer attributes
+//                2501 : 2026/10/16 --> output PAR_IC_LOAD_NRANK
+//                2502 : 2026/10/16 --> output OPT__NODE_AWARE_MPI
+//                2503 : 2026/10/16 --> output OPT__PERSISTENT_MPI
+//                2504 : 2026/10/16 --> output OPT__DT_FUSED
+//                2505 : 2026/10/16 --> output OPT__LEVEL_MG, LEVEL_MG_MAX_ITER, and LEVEL_MG_TOLERATED_ERROR
+//                2506 : 2026/10/16 --> output NUC_TABLE and NUC_BENCHMARK
+//                2507 : 2026/10/16 --> output PERF_COUNTER
+//                2508 : 2026/10/16 --> output OPT__RECORD_TRACE, TRACE_STEP_START, TRACE_STEP_END, and TRACE_MAX_EVENT
+//                2509 : 2026/10/17 --> output OPT__OUTPUT_NODE_LOCAL, NODE_LOCAL_DIR, and OPT__NODE_LOCAL_DRAIN
+//                2510 : 2026/10/17 --> output OPT__OUTPUT_DEFLATE and OUTPUT_LOSSY_REL_ERR
+//                2511 : 2026/10/17 --> output OPT__OUTPUT_IMAGE, OUTPUT_IMAGE_STEP, OUTPUT_IMAGE_NPIX, OUTPUT_IMAGE_AXIS,
+//                                      OUTPUT_IMAGE_FIELD, and OUTPUT_IMAGE_SLICE_X/Y/Z
+//                2512 : 2026/10/17 --> output OUTPUT_BASEPS_FIELD, OUTPUT_BASEPS_CROSS, OUTPUT_BASEPS_LEVEL, and
+//                                      OUTPUT_BASEPS_STEP
+//                2513 : 2026/10/17 --> output OPT__RECORD_CLUMP, CLUMP_FIELD, CLUMP_THRESHOLD, CLUMP_MIN_NCELL,
+//                                      CLUMP_FOF_LINKLEN, and CLUMP_FOF_MIN_NPAR
+//                2514 : 2026/10/17 --> output NODE_LOCAL_STEP
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total_HDF5( const char *FileName )
 {
@@ -328,6 +361,9 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    }
 #  endif
 
+// all fields stored after DerDumpIdx0 are derived fields
+   const int DerDumpIdx0 = NFieldStored;
+
 #  if ( MODEL == HYDRO )
    const int PresDumpIdx   = ( OPT__OUTPUT_PRES ) ? NFieldStored++ : NoDump;
    if ( PresDumpIdx >= NFIELD_STORED_MAX )
@@ -666,23 +702,38 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_GroupID_GridData = H5Gcreate( H5_FileID, "GridData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
       if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "GridData" );
 
+//    set the chunked layout and compression filters
+      hid_t H5_DataCreatePropList_Grid = H5Pcopy( H5_DataCreatePropList );
+      Output_HDF5_SetChunkDeflate( H5_DataCreatePropList_Grid, H5_SetDims_Field );
+
 //    create the datasets of all fields
       for (int v=0; v<NFieldStored; v++)
       {
          H5_SetID_Field = H5Dcreate( H5_GroupID_GridData, FieldLabelOut[v], H5T_GAMER_REAL, H5_SpaceID_Field,
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_Grid, H5P_DEFAULT );
          if ( H5_SetID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldLabelOut[v] );
          H5_Status = H5Dclose( H5_SetID_Field );
       }
 
+      H5_Status = H5Pclose( H5_DataCreatePropList_Grid );
+
 //    create the datasets of all magnetic field components
 #     ifdef MHD
       for (int v=0; v<NCOMP_MAG; v++)
       {
+         H5_SetDims_FCMag[0] = pc.NPatchAllLv;
+         for (int t=1; t<4; t++)
+         H5_SetDims_FCMag[t] = ( 3-t == v ) ? PS1P1 : PS1;
+
+         H5_DataCreatePropList_Grid = H5Pcopy( H5_DataCreatePropList );
+         Output_HDF5_SetChunkDeflate( H5_DataCreatePropList_Grid, H5_SetDims_FCMag );
+
          H5_SetID_FCMag = H5Dcreate( H5_GroupID_GridData, MagLabel[v], H5T_GAMER_REAL, H5_SpaceID_FCMag[v],
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_Grid, H5P_DEFAULT );
          if ( H5_SetID_FCMag < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", MagLabel[v] );
          H5_Status = H5Dclose( H5_SetID_FCMag );
+
+         H5_Status = H5Pclose( H5_DataCreatePropList_Grid );
       }
 #     endif
 
@@ -716,19 +767,33 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 #  endif // #ifdef PARTICLE
 
 // for the derived fields
-   const int Der_NP = 8;
-
-   real (*Der_FluIn)[NCOMP_TOTAL][ CUBE(DER_NXT)            ] = new real [Der_NP][NCOMP_TOTAL ][ CUBE(DER_NXT)            ];
-   real (*Der_Out  )             [ CUBE(PS1)                ] = new real         [DER_NOUT_MAX][ CUBE(PS1)                ];
+   const int  Der_NP          = 8;
+   const int  Der_ChunkNPatch = 2048;   // number of patches computed and written at a time (must be a multiple of Der_NP)
+   const int  NDerStored      = NFieldStored - DerDumpIdx0;
+#  if ( MODEL == HYDRO )
+   const bool Der_PrepFlu     = ( OPT__OUTPUT_DIVVEL || OPT__OUTPUT_MACH || OPT__OUTPUT_USER_FIELD );
+#  else
+   const bool Der_PrepFlu     = ( OPT__OUTPUT_USER_FIELD );
+#  endif
 #  ifdef MHD
-   real (*Der_MagFC)[NCOMP_MAG  ][ (DER_NXT+1)*SQR(DER_NXT) ] = new real [Der_NP][NCOMP_MAG   ][ (DER_NXT+1)*SQR(DER_NXT) ];
-   real (*Der_MagCC)             [ CUBE(DER_NXT)            ] = new real         [NCOMP_MAG   ][ CUBE(DER_NXT)            ];
+   const bool Der_PrepMag     = ( Der_PrepFlu  &&  ( OPT__OUTPUT_MACH || OPT__OUTPUT_USER_FIELD ) );
 #  else
-   real (*Der_MagFC)[NCOMP_MAG  ][ (DER_NXT+1)*SQR(DER_NXT) ] = NULL;
-   real (*Der_MagCC)             [ CUBE(DER_NXT)            ] = NULL;
+   const bool Der_PrepMag     = false;
+#  endif
+#  if ( MODEL == HYDRO )
+// whether any derived field is computed cell by cell without ghost zones
+   const bool Der_CellLocal   = ( OPT__OUTPUT_PRES || OPT__OUTPUT_TEMP || OPT__OUTPUT_ENTR || OPT__OUTPUT_CS
+#                               ifdef MHD
+                                  || OPT__OUTPUT_DIVMAG
+#                               endif
+#                               ifdef SRHD
+                                  || OPT__OUTPUT_LORENTZ || OPT__OUTPUT_3VELOCITY || OPT__OUTPUT_ENTHALPY
+#                               endif
+                                );
 #  endif
-// allocate the maximum required memory (i.e., with NCOMP_TOTAL fields) for the temporary array Der_FluInTmp[]
-   real (*Der_FluInTmp) = new real [ Der_NP*NCOMP_TOTAL*CUBE(DER_NXT) ];
+
+   real (*DerData)[PS1][PS1][PS1] = NULL;          // data of all derived fields in one chunk
+   real (*DerPtr[NFIELD_STORED_MAX])[PS1][PS1][PS1];  // DerPtr[v] points to the data of the derived field v
 
 
 // output one level at a time so that data at the same level are consecutive on disk (even for multiple ranks)
@@ -749,6 +814,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       }
 #     endif
 
+
       for (int TRank=0; TRank<MPI_NRank; TRank++)
       {
          if ( MPI_Rank == TRank )
@@ -793,8 +859,12 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 //          output one field at one level in one rank at a time
             FieldData = new real [ amr->NPatchComma[lv][1] ][PS1][PS1][PS1];
 
-            for (int v=0; v<NFieldStored; v++)
+//          --> derived fields are computed and written in step 5-2-1-5
+            for (int v=0; v<DerDumpIdx0; v++)
             {
+//             buffer to be written to disk
+               real *WriteData = FieldData[0][0][0];
+
 //             5-2-1-3. collect the target field from all patches at the current target level
 //             a. gravitational potential
 #              ifdef GRAVITY
@@ -839,296 +909,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                }
 #              endif
 
-//             d. derived fields
-#              if ( MODEL == HYDRO )
-//             d-1. gas pressure
-               else if ( v == PresDumpIdx )
-               {
-//                we do not check minimum pressure here
-                  Prepare_PatchData( lv, Time[lv], FieldData[0][0][0], NULL, 0, amr->NPatchComma[lv][1]/8, PID0List,
-                                     _PRES, _NONE, OPT__FLU_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_00,
-                                     IntPhase_No, OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
-                                     DE_Consistency_No );
-               }
-
-//             d-2. gas temperature
-               else if ( v == TempDumpIdx )
-               {
-                  const bool CheckMinTemp_No = false;
-
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     real u[NCOMP_TOTAL], Temp, Emag=NULL_REAL;
-
-                     for (int v=0; v<NCOMP_TOTAL; v++)   u[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
-
-#                    ifdef MHD
-                     Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
-#                    endif
-                     Temp = Hydro_Con2Temp( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
-                                            CheckMinTemp_No, NULL_REAL, Emag, EoS_DensEint2Temp_CPUPtr,
-                                            EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                            EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-                     FieldData[PID][k][j][i] = Temp;
-                  }
-               } // if ( v == TempDumpIdx )
-
-#              ifndef SRHD
-//             d-3. gas entropy
-               else if ( v == EntrDumpIdx )
-               {
-                  const bool CheckMinEntr_No = false;
-
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     real u[NCOMP_TOTAL], Entr, Emag=NULL_REAL;
-
-                     for (int v=0; v<NCOMP_TOTAL; v++)   u[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
-
-#                    ifdef MHD
-                     Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
-#                    endif
-                     Entr = Hydro_Con2Entr( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
-                                            CheckMinEntr_No, NULL_REAL, Emag, EoS_DensEint2Entr_CPUPtr,
-                                            EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-                     FieldData[PID][k][j][i] = Entr;
-                  }
-               } // if ( v == EntrDumpIdx )
-#              endif
-
-//             d-4. sound speed
-               else if ( v == CsDumpIdx )
-               {
-                  const bool CheckMinPres_No = false;
-
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     real u[NCOMP_TOTAL], Pres, Cs2, Emag=NULL_REAL;
-
-                     for (int v=0; v<NCOMP_TOTAL; v++)   u[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
-
-#                    ifdef MHD
-                     Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
-#                    endif
-
-#                    ifdef SRHD
-                     real Prim[NCOMP_TOTAL];
-                     Hydro_Con2Pri( u, Prim, (real)-HUGE_NUMBER, NULL_BOOL, NULL_INT, NULL,
-                                    NULL_BOOL, NULL_REAL, EoS_DensEint2Pres_CPUPtr,
-                                    EoS_DensPres2Eint_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, NULL );
-
-                     Cs2 = EoS_DensPres2CSqr_CPUPtr( Prim[0], Prim[4], NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-#                    else
-                     Pres = Hydro_Con2Pres( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
-                                            CheckMinPres_No, NULL_REAL, Emag, EoS_DensEint2Pres_CPUPtr,
-                                            EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                            EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
-                     Cs2  = EoS_DensPres2CSqr_CPUPtr( u[DENS], Pres, u+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int,
-                                                      h_EoS_Table );
-#                    endif
-                     FieldData[PID][k][j][i] = SQRT( Cs2 );
-                  }
-               } // if ( v == CsDumpIdx )
-
-//             d-5. divergence(velocity)
-               else if ( v == DivVelDumpIdx )
-               {
-                  for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-                  {
-//                   prepare the input density and momentum
-//                   --> no need to prepare other fields
-//                   --> store in Der_FluInTmp[] first and then copy to Der_FluIn[] since the shape of the latter
-//                       is fixed to "[Der_NP][NCOMP_TOTAL][CUBE(DER_NXT)]" even though some fields may be useless
-                     Prepare_PatchData( lv, Time[lv], Der_FluInTmp, NULL, DER_GHOST_SIZE, 1, &PID0,
-                                        _DENS|_MOMX|_MOMY|_MOMZ, _NONE, OPT__FLU_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_26,
-                                        IntPhase_No, OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
-                                        DE_Consistency_No );
-
-//                   type casting for convenience
-                     real (*Der_FluInTmp3D)[4][ CUBE(DER_NXT) ] = ( real (*)[4][ CUBE(DER_NXT) ] )Der_FluInTmp;
-
-                     for (int LocalID=0; LocalID<8; LocalID++)
-                     {
-//                      copy data from Der_FluInTmp[] to Der_FluIn[]
-                        const int Size1v = sizeof(real)*CUBE(DER_NXT);
-                        memcpy( Der_FluIn[LocalID][DENS], Der_FluInTmp3D[LocalID][0], Size1v );
-                        memcpy( Der_FluIn[LocalID][MOMX], Der_FluInTmp3D[LocalID][1], Size1v );
-                        memcpy( Der_FluIn[LocalID][MOMY], Der_FluInTmp3D[LocalID][2], Size1v );
-                        memcpy( Der_FluIn[LocalID][MOMZ], Der_FluInTmp3D[LocalID][3], Size1v );
-
-//                      compute and store the target derived field
-                        const int PID  = PID0 + LocalID;
-                        const int NDer = 1;
-                        Flu_DerivedField_DivVel( FieldData[PID][0][0], Der_FluIn[LocalID][0], NULL,
-                                                 NDer, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
-                     }
-                  } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-               } // if ( v == DivVelDumpIdx )
-
-//             d-6. Mach number
-               else if ( v == MachDumpIdx )
-               {
-                  for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-                  {
-//                   prepare the input fields
-//                   --> must prepare all NCOMP_TOTAL and NCOMP_MAG fields
-                     Prepare_PatchData( lv, Time[lv], Der_FluIn[0][0], Der_MagFC[0][0], DER_GHOST_SIZE, 1, &PID0,
-                                        _TOTAL, _MAG, OPT__FLU_INT_SCHEME, OPT__MAG_INT_SCHEME, UNIT_PATCH, NSIDE_26,
-                                        IntPhase_No, OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
-                                        DE_Consistency_No );
-
-                     for (int LocalID=0; LocalID<8; LocalID++)
-                     {
-//                      convert B field from face-centered to cell-centered
-#                       ifdef MHD
-                        for (int k=0; k<DER_NXT; k++)
-                        for (int j=0; j<DER_NXT; j++)
-                        for (int i=0; i<DER_NXT; i++)
-                        {
-                           const int IdxCC = IDX321( i, j, k, DER_NXT, DER_NXT );
-                           real B_CC[NCOMP_MAG];
-
-                           MHD_GetCellCenteredBField( B_CC, Der_MagFC[LocalID][MAGX], Der_MagFC[LocalID][MAGY],
-                                                      Der_MagFC[LocalID][MAGZ], DER_NXT, DER_NXT, DER_NXT, i, j, k );
-
-                           Der_MagCC[MAGX][IdxCC] = B_CC[MAGX];
-                           Der_MagCC[MAGY][IdxCC] = B_CC[MAGY];
-                           Der_MagCC[MAGZ][IdxCC] = B_CC[MAGZ];
-                        }
-#                       endif // #ifdef MHD
-
-//                      compute and store the target derived field
-                        const int PID  = PID0 + LocalID;
-                        const int NDer = 1;
-                        Flu_DerivedField_Mach( FieldData[PID][0][0], Der_FluIn[LocalID][0], Der_MagCC[0],
-                                               NDer, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
-                     } // for (int LocalID=0; LocalID<8; LocalID++)
-                  } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-               } // if ( v == MachDumpIdx )
-
-//             d-7. divergence(B field)
-#              ifdef MHD
-               else if ( v == DivMagDumpIdx )
-               {
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     const real DivB = MHD_GetCellCenteredDivBInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
-                     FieldData[PID][k][j][i] = DivB;
-                  }
-               }
-#              endif
-
-#              ifdef SRHD
-               else if (  ( v >= VelDumpIdx0 && v < VelDumpIdx0+3 )  ||  v == LorentzDumpIdx )
-               {
-                  const int vv = v - VelDumpIdx0 + 1;
-                  real Prim[NCOMP_TOTAL], Cons[NCOMP_TOTAL], LorentzFactor;
-
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     for (int fv=0; fv<NCOMP_TOTAL; fv++)  Cons[fv] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[fv][k][j][i];
-
-                     Hydro_Con2Pri( Cons, Prim, (real)-HUGE_NUMBER, false, NULL_INT, NULL,
-                                    NULL_BOOL, (real)NULL_REAL, NULL, NULL, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, &LorentzFactor );
-
-//                   d-8. Lorentz factor
-                     if      ( v == LorentzDumpIdx )
-                        FieldData[PID][k][j][i] = LorentzFactor;
-
-//                   d-9. 3-velocity
-                     else if ( v >= VelDumpIdx0  &&  v < VelDumpIdx0+3 )
-                        FieldData[PID][k][j][i] = Prim[vv] / LorentzFactor;
-                  }
-               }
-
-//             d-10. reduced enthalpy
-               else if ( v == EnthalpyDumpIdx )
-               {
-                  real Cons[NCOMP_TOTAL], HTilde;
-
-                  for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  for (int k=0; k<PS1; k++)
-                  for (int j=0; j<PS1; j++)
-                  for (int i=0; i<PS1; i++)
-                  {
-                     for (int fv=0; fv<NCOMP_TOTAL; fv++)  Cons[fv] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[fv][k][j][i];
-
-                     HTilde = Hydro_Con2HTilde( Cons, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                                EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-                     FieldData[PID][k][j][i] = HTilde;
-                  }
-               }
-#              endif // #ifdef SRHD
-#              endif // #if ( MODEL == HYDRO )
-
-//             d-11. user-defined derived fields
-//             the following check also works for OPT__OUTPUT_USER_FIELD==false since UserDerField_Num is initialized as 0
-               else if ( v >= UserDumpIdx0  &&  v < UserDumpIdx0 + UserDerField_Num )
-               {
-                  for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-                  {
-//                   prepare the input fields
-//                   --> must prepare all NCOMP_TOTAL and NCOMP_MAG fields
-                     Prepare_PatchData( lv, Time[lv], Der_FluIn[0][0], Der_MagFC[0][0], DER_GHOST_SIZE, 1, &PID0,
-                                        _TOTAL, _MAG, OPT__FLU_INT_SCHEME, OPT__MAG_INT_SCHEME, UNIT_PATCH, NSIDE_26,
-                                        IntPhase_No, OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
-                                        DE_Consistency_No );
-
-                     for (int LocalID=0; LocalID<8; LocalID++)
-                     {
-//                      convert B field from face-centered to cell-centered
-#                       ifdef MHD
-                        for (int k=0; k<DER_NXT; k++)
-                        for (int j=0; j<DER_NXT; j++)
-                        for (int i=0; i<DER_NXT; i++)
-                        {
-                           const int IdxCC = IDX321( i, j, k, DER_NXT, DER_NXT );
-                           real B_CC[NCOMP_MAG];
-
-                           MHD_GetCellCenteredBField( B_CC, Der_MagFC[LocalID][MAGX], Der_MagFC[LocalID][MAGY],
-                                                      Der_MagFC[LocalID][MAGZ], DER_NXT, DER_NXT, DER_NXT, i, j, k );
-
-                           Der_MagCC[MAGX][IdxCC] = B_CC[MAGX];
-                           Der_MagCC[MAGY][IdxCC] = B_CC[MAGY];
-                           Der_MagCC[MAGZ][IdxCC] = B_CC[MAGZ];
-                        }
-#                       endif // #ifdef MHD
-
-//                      compute and store the target derived field
-//                      --> store in Der_Out[] first and then copy to FieldData[] since we only output one field at a time
-//                      --> there are redundant calculations in Flu_DerivedField_User_Ptr since it always computes
-//                          UserDerField_Num fields while we only need one field at a time
-//###OPTIMIZATION: only compute the derived field being dumped
-                        const int PID  = PID0 + LocalID;
-                        const int NDer = UserDerField_Num;
-                        Flu_DerivedField_User_Ptr( Der_Out[0], Der_FluIn[LocalID][0], Der_MagCC[0],
-                                                   NDer, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
-
-//                      copy data from Der_Der[] to FieldData[]
-                        const int DerIdx = v - UserDumpIdx0;
-                        memcpy( FieldData[PID], Der_Out[DerIdx], FieldSizeOnePatch );
-                     } // for (int LocalID=0; LocalID<8; LocalID++)
-                  } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
-               } // if ( v >= UserDumpIdx0  &&  v < UserDumpIdx0 + UserDerField_Num )
-
-//             e. fluid variables
+//             d. fluid variables
                else if ( v >= FluDumpIdx0  &&  v < FluDumpIdx0+NCompStore )
                {
 //                convert real/imag to density/phase in hybrid scheme
@@ -1165,20 +946,262 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-2-1-4. write data to disk
+//                      --> apply lossy compression to the derived fields only since the intrinsic fields are required by restart
+               const bool   Intrinsic = ( v >= FluDumpIdx0  &&  v < FluDumpIdx0+NCompStore );
+               const double RelErr    = ( Intrinsic ) ? -1.0 : OUTPUT_LOSSY_REL_ERR;
+
                H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
 
-               H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT, FieldData );
+               H5_Status = Output_HDF5_WriteGridData( H5_SetID_Field, H5_MemID_Field, H5_SpaceID_Field, WriteData,
+                                                      amr->NPatchComma[lv][1], pc.GID_Offset[lv], CUBE(PS1), RelErr );
                if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
 
                H5_Status = H5Dclose( H5_SetID_Field );
-            } // for (int v=0; v<NFieldStored; v++)
+            } // for (int v=0; v<DerDumpIdx0; v++)
 
-
-//          5-2-1-5.free resource before dumping magnetic field to save memory
             delete [] FieldData;
 
             H5_Status = H5Sclose( H5_MemID_Field );
 
+
+//          5-2-1-5. compute and write all derived fields chunk by chunk to reduce memory consumption
+//                   --> prepare the ghost zones of each patch group only once for all derived fields requiring them
+//                   --> each chunk contains at most Der_ChunkNPatch patches, which are distributed to OpenMP threads
+//                       by patch groups
+            if ( NDerStored > 0 )
+            {
+               const int NPatch    = amr->NPatchComma[lv][1];
+               const int NPatchBuf = MIN( NPatch, Der_ChunkNPatch );
+
+               DerData = new real [ (long)NDerStored*NPatchBuf ][PS1][PS1][PS1];
+
+               for (int v=DerDumpIdx0; v<NFieldStored; v++)    DerPtr[v] = DerData + (long)( v - DerDumpIdx0 )*NPatchBuf;
+
+               for (int PID_Start=0; PID_Start<NPatch; PID_Start+=Der_ChunkNPatch)
+               {
+                  const int NPatchChunk = MIN( Der_ChunkNPatch, NPatch-PID_Start );
+
+//                5-2-1-5-1. compute all derived fields in this chunk
+#                 pragma omp parallel
+                  {
+                     real (*Der_FluIn)[NCOMP_TOTAL][ CUBE(DER_NXT)            ] = NULL;
+                     real (*Der_MagFC)[NCOMP_MAG  ][ (DER_NXT+1)*SQR(DER_NXT) ] = NULL;
+                     real (*Der_MagCC)             [ CUBE(DER_NXT)            ] = NULL;
+                     real (*Der_Out  )             [ CUBE(PS1)                ] = NULL;
+
+                     if ( Der_PrepFlu )               Der_FluIn = new real [Der_NP][NCOMP_TOTAL ][ CUBE(DER_NXT)            ];
+                     if ( Der_PrepMag )               Der_MagFC = new real [Der_NP][NCOMP_MAG   ][ (DER_NXT+1)*SQR(DER_NXT) ];
+                     if ( Der_PrepMag )               Der_MagCC = new real         [NCOMP_MAG   ][ CUBE(DER_NXT)            ];
+                     if ( OPT__OUTPUT_USER_FIELD )    Der_Out   = new real         [DER_NOUT_MAX][ CUBE(PS1)                ];
+
+#                    pragma omp for schedule( runtime )
+                     for (int PID0=PID_Start; PID0<PID_Start+NPatchChunk; PID0+=Der_NP)
+                     {
+//                      a. prepare all fluid variables and magnetic field with ghost zones
+                        if ( Der_PrepFlu )
+                        Prepare_PatchData( lv, Time[lv], Der_FluIn[0][0], ( Der_PrepMag ) ? Der_MagFC[0][0] : NULL,
+                                           DER_GHOST_SIZE, 1, &PID0, _TOTAL, ( Der_PrepMag ) ? _MAG : _NONE,
+                                           OPT__FLU_INT_SCHEME, ( Der_PrepMag ) ? OPT__MAG_INT_SCHEME : INT_NONE, UNIT_PATCH, NSIDE_26,
+                                           IntPhase_No, OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No,
+                                           DE_Consistency_No );
+
+                        for (int LocalID=0; LocalID<Der_NP; LocalID++)
+                        {
+                           const int PID      = PID0 + LocalID;
+                           const int ChunkPID = PID - PID_Start;
+
+//                         b. derived fields computed cell by cell from the patch data
+#                          if ( MODEL == HYDRO )
+                           if ( Der_CellLocal )
+                           for (int k=0; k<PS1; k++)
+                           for (int j=0; j<PS1; j++)
+                           for (int i=0; i<PS1; i++)
+                           {
+                              const bool CheckMin_No = false;
+                              real u[NCOMP_TOTAL], Emag=NULL_REAL;
+
+                              for (int fv=0; fv<NCOMP_TOTAL; fv++)   u[fv] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[fv][k][j][i];
+
+#                             ifdef MHD
+                              if ( OPT__OUTPUT_PRES || OPT__OUTPUT_TEMP || OPT__OUTPUT_ENTR || OPT__OUTPUT_CS )
+                              Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
+#                             endif
+
+//                            b-1. gas pressure (also used by the sound speed)
+#                             ifdef SRHD
+                              const bool NeedPres = OPT__OUTPUT_PRES;
+#                             else
+                              const bool NeedPres = ( OPT__OUTPUT_PRES || OPT__OUTPUT_CS );
+#                             endif
+                              real Pres = NULL_REAL;
+
+                              if ( NeedPres )
+                                 Pres = Hydro_Con2Pres( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
+                                                        CheckMin_No, NULL_REAL, Emag, EoS_DensEint2Pres_CPUPtr,
+                                                        EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                        EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+
+                              if ( OPT__OUTPUT_PRES )
+                                 DerPtr[PresDumpIdx][ChunkPID][k][j][i] = Pres;
+
+//                            b-2. gas temperature
+                              if ( OPT__OUTPUT_TEMP )
+                                 DerPtr[TempDumpIdx][ChunkPID][k][j][i]
+                                    = Hydro_Con2Temp( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
+                                                      CheckMin_No, NULL_REAL, Emag, EoS_DensEint2Temp_CPUPtr,
+                                                      EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                      EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+
+//                            b-3. gas entropy
+#                             ifndef SRHD
+                              if ( OPT__OUTPUT_ENTR )
+                                 DerPtr[EntrDumpIdx][ChunkPID][k][j][i]
+                                    = Hydro_Con2Entr( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
+                                                      CheckMin_No, NULL_REAL, Emag, EoS_DensEint2Entr_CPUPtr,
+                                                      EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+#                             endif
+
+//                            b-4. sound speed
+                              if ( OPT__OUTPUT_CS )
+                              {
+                                 real Cs2;
+#                                ifdef SRHD
+                                 real Prim[NCOMP_TOTAL];
+                                 Hydro_Con2Pri( u, Prim, (real)-HUGE_NUMBER, NULL_BOOL, NULL_INT, NULL,
+                                                NULL_BOOL, NULL_REAL, EoS_DensEint2Pres_CPUPtr,
+                                                EoS_DensPres2Eint_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, NULL );
+
+                                 Cs2 = EoS_DensPres2CSqr_CPUPtr( Prim[0], Prim[4], NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+#                                else
+                                 Cs2 = EoS_DensPres2CSqr_CPUPtr( u[DENS], Pres, u+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int,
+                                                                 h_EoS_Table );
+#                                endif
+                                 DerPtr[CsDumpIdx][ChunkPID][k][j][i] = SQRT( Cs2 );
+                              }
+
+//                            b-5. divergence(B field)
+#                             ifdef MHD
+                              if ( OPT__OUTPUT_DIVMAG )
+                                 DerPtr[DivMagDumpIdx][ChunkPID][k][j][i] = MHD_GetCellCenteredDivBInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
+#                             endif
+
+#                             ifdef SRHD
+//                            b-6. Lorentz factor and 3-velocity
+                              if ( OPT__OUTPUT_LORENTZ || OPT__OUTPUT_3VELOCITY )
+                              {
+                                 real Prim[NCOMP_TOTAL], LorentzFactor;
+
+                                 Hydro_Con2Pri( u, Prim, (real)-HUGE_NUMBER, false, NULL_INT, NULL,
+                                                NULL_BOOL, (real)NULL_REAL, NULL, NULL, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, &LorentzFactor );
+
+                                 if ( OPT__OUTPUT_LORENTZ )
+                                    DerPtr[LorentzDumpIdx][ChunkPID][k][j][i] = LorentzFactor;
+
+                                 if ( OPT__OUTPUT_3VELOCITY )
+                                 for (int d=0; d<3; d++)
+                                    DerPtr[ VelDumpIdx0 + d ][ChunkPID][k][j][i] = Prim[ d + 1 ] / LorentzFactor;
+                              }
+
+//                            b-7. reduced enthalpy
+                              if ( OPT__OUTPUT_ENTHALPY )
+                                 DerPtr[EnthalpyDumpIdx][ChunkPID][k][j][i]
+                                    = Hydro_Con2HTilde( u, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                                        EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+#                             endif // #ifdef SRHD
+                           } // i,j,k
+#                          endif // #if ( MODEL == HYDRO )
+
+//                         c. derived fields requiring ghost zones
+                           if ( ! Der_PrepFlu )    continue;
+
+//                         convert B field from face-centered to cell-centered
+#                          ifdef MHD
+                           if ( Der_PrepMag )
+                           for (int k=0; k<DER_NXT; k++)
+                           for (int j=0; j<DER_NXT; j++)
+                           for (int i=0; i<DER_NXT; i++)
+                           {
+                              const int IdxCC = IDX321( i, j, k, DER_NXT, DER_NXT );
+                              real B_CC[NCOMP_MAG];
+
+                              MHD_GetCellCenteredBField( B_CC, Der_MagFC[LocalID][MAGX], Der_MagFC[LocalID][MAGY],
+                                                         Der_MagFC[LocalID][MAGZ], DER_NXT, DER_NXT, DER_NXT, i, j, k );
+
+                              Der_MagCC[MAGX][IdxCC] = B_CC[MAGX];
+                              Der_MagCC[MAGY][IdxCC] = B_CC[MAGY];
+                              Der_MagCC[MAGZ][IdxCC] = B_CC[MAGZ];
+                           }
+#                          endif // #ifdef MHD
+
+#                          if ( MODEL == HYDRO )
+//                         c-1. divergence(velocity)
+                           if ( OPT__OUTPUT_DIVVEL )
+                              Flu_DerivedField_DivVel( DerPtr[DivVelDumpIdx][ChunkPID][0][0], Der_FluIn[LocalID][0], NULL,
+                                                       1, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
+
+//                         c-2. Mach number
+                           if ( OPT__OUTPUT_MACH )
+                              Flu_DerivedField_Mach( DerPtr[MachDumpIdx][ChunkPID][0][0], Der_FluIn[LocalID][0],
+                                                     ( Der_PrepMag ) ? Der_MagCC[0] : NULL,
+                                                     1, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
+#                          endif
+
+//                         c-3. user-defined derived fields
+//                              --> Flu_DerivedField_User_Ptr() computes all UserDerField_Num fields at once
+                           if ( OPT__OUTPUT_USER_FIELD )
+                           {
+                              Flu_DerivedField_User_Ptr( Der_Out[0], Der_FluIn[LocalID][0], ( Der_PrepMag ) ? Der_MagCC[0] : NULL,
+                                                         UserDerField_Num, DER_NXT, DER_NXT, DER_NXT, DER_GHOST_SIZE, amr->dh[lv] );
+
+                              for (int d=0; d<UserDerField_Num; d++)
+                                 memcpy( DerPtr[ UserDumpIdx0 + d ][ChunkPID], Der_Out[d], FieldSizeOnePatch );
+                           }
+                        } // for (int LocalID=0; LocalID<Der_NP; LocalID++)
+                     } // for (int PID0=PID_Start; PID0<PID_Start+NPatchChunk; PID0+=Der_NP)
+
+                     delete [] Der_FluIn;
+                     delete [] Der_MagFC;
+                     delete [] Der_MagCC;
+                     delete [] Der_Out;
+                  } // OpenMP parallel region
+
+
+//                5-2-1-5-2. write all derived fields in this chunk
+                  H5_MemDims_Field[0] = NPatchChunk;
+
+                  H5_MemID_Field = H5Screate_simple( 4, H5_MemDims_Field, NULL );
+                  if ( H5_MemID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemDims_Field" );
+
+                  H5_Offset_Field[0] = pc.GID_Offset[lv] + PID_Start;
+                  H5_Count_Field [0] = NPatchChunk;
+
+                  H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_SET, H5_Offset_Field, NULL, H5_Count_Field, NULL );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
+
+                  for (int v=DerDumpIdx0; v<NFieldStored; v++)
+                  {
+                     H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
+
+                     H5_Status = Output_HDF5_WriteGridData( H5_SetID_Field, H5_MemID_Field, H5_SpaceID_Field, DerPtr[v][0][0][0],
+                                                            NPatchChunk, pc.GID_Offset[lv]+PID_Start, CUBE(PS1),
+                                                            OUTPUT_LOSSY_REL_ERR );
+                     if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+
+                     H5_Status = H5Dclose( H5_SetID_Field );
+                  }
+
+                  H5_Status = H5Sclose( H5_MemID_Field );
+               } // for (int PID_Start=0; PID_Start<NPatch; PID_Start+=Der_ChunkNPatch)
+
+               delete [] DerData;
+               DerData = NULL;
+            } // if ( NDerStored > 0 )
+
+
+//          5-2-1-6. free resource before dumping magnetic field to save memory
+
 //          free memory used for outputting particle density
 #           ifdef MASSIVE_PARTICLES
             if ( OPT__OUTPUT_PAR_DENS != PAR_OUTPUT_DENS_NONE )
@@ -1229,7 +1252,8 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 //             5-2-2-4. write data to disk
                H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
 
-               H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5P_DEFAULT, FCMagData );
+               H5_Status = Output_HDF5_WriteGridData( H5_SetID_FCMag, H5_MemID_FCMag, H5_SpaceID_FCMag[v], FCMagData[0],
+                                                      amr->NPatchComma[lv][1], pc.GID_Offset[lv], PS1P1*SQR(PS1), -1.0 );
                if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
 
                H5_Status = H5Dclose( H5_SetID_FCMag );
@@ -1258,13 +1282,6 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    H5_Status = H5Sclose( H5_SpaceID_FCMag[v] );
 #  endif
 
-   delete [] Der_FluIn;
-   delete [] Der_Out;
-#  ifdef MHD
-   delete [] Der_MagFC;
-   delete [] Der_MagCC;
-#  endif
-   delete [] Der_FluInTmp;
 
 
 
@@ -1598,7 +1615,7 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo, const int NFieldStored )
 
    const time_t CalTime = time( NULL );   // calendar time
 
-   KeyInfo.FormatVersion        = 2500;
+   KeyInfo.FormatVersion        = 2514;
    KeyInfo.Model                = MODEL;
    KeyInfo.NLevel               = NLEVEL;
    KeyInfo.NCompFluid           = NCOMP_FLUID;
@@ -1759,6 +1776,12 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.TimingSolver           = 0;
 #  endif
 
+#  ifdef PERF_COUNTER
+   Makefile.PerfCounter            = 1;
+#  else
+   Makefile.PerfCounter            = 0;
+#  endif
+
 #  ifdef FLOAT8
    Makefile.Float8                 = 1;
 #  else
@@ -2331,6 +2354,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Par_ICType              = amr->Par->ParICType;
    InputPara.Par_ICFloat8            = PAR_IC_FLOAT8;
    InputPara.Par_ICInt8              = PAR_IC_INT8;
+   InputPara.Par_ICLoadNRank         = PAR_IC_LOAD_NRANK;
    InputPara.Par_Interp              = amr->Par->Interp;
    InputPara.Par_InterpTracer        = amr->Par->InterpTracer;
    InputPara.Par_Integ               = amr->Par->Integ;
@@ -2387,6 +2411,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__DtUser             = OPT__DT_USER;
    InputPara.Opt__DtLevel            = OPT__DT_LEVEL;
    InputPara.Opt__RecordDt           = OPT__RECORD_DT;
+   InputPara.Opt__DtFused            = OPT__DT_FUSED;
    InputPara.AutoReduceDt            = AUTO_REDUCE_DT;
    InputPara.AutoReduceDtFactor      = AUTO_REDUCE_DT_FACTOR;
    InputPara.AutoReduceDtFactorMin   = AUTO_REDUCE_DT_FACTOR_MIN;
@@ -2472,6 +2497,8 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
    InputPara.Opt__RecordLoadBalance  = OPT__RECORD_LOAD_BALANCE;
    InputPara.Opt__LB_ExchangeFather  = OPT__LB_EXCHANGE_FATHER;
+   InputPara.Opt__NodeAwareMPI       = OPT__NODE_AWARE_MPI;
+   InputPara.Opt__PersistentMPI      = OPT__PERSISTENT_MPI;
 #  endif
    InputPara.Opt__MinimizeMPIBarrier = OPT__MINIMIZE_MPI_BARRIER;
 
@@ -2481,6 +2508,8 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.MolecularWeight         = MOLECULAR_WEIGHT;
    InputPara.MuNorm                  = MU_NORM;
    InputPara.IsoTemp                 = ISO_TEMP;
+   InputPara.NucTable                = NUC_TABLE;
+   InputPara.NucBenchmark            = NUC_BENCHMARK;
    InputPara.MinMod_Coeff            = MINMOD_COEFF;
    InputPara.MinMod_MaxIter          = MINMOD_MAX_ITER;
    InputPara.Opt__LR_Limiter         = OPT__LR_LIMITER;
@@ -2575,6 +2604,9 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.MG_NPostSmooth          = MG_NPOST_SMOOTH;
    InputPara.MG_ToleratedError       = MG_TOLERATED_ERROR;
 #  endif
+   InputPara.Opt__LevelMG            = OPT__LEVEL_MG;
+   InputPara.LevelMG_MaxIter         = LEVEL_MG_MAX_ITER;
+   InputPara.LevelMG_ToleratedError  = LEVEL_MG_TOLERATED_ERROR;
    InputPara.Pot_GPU_NPGroup         = POT_GPU_NPGROUP;
    InputPara.Opt__GraP5Gradient      = OPT__GRA_P5_GRADIENT;
    InputPara.Opt__SelfGravity        = OPT__SELF_GRAVITY;
@@ -2735,6 +2767,10 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__Output_Par_Mesh        = OPT__OUTPUT_PAR_MESH;
 #  endif
    InputPara.Opt__Output_BasePS          = OPT__OUTPUT_BASEPS;
+   InputPara.Output_BasePS_Field         = OUTPUT_BASEPS_FIELD;
+   InputPara.Output_BasePS_Cross         = OUTPUT_BASEPS_CROSS;
+   InputPara.Output_BasePS_Level         = OUTPUT_BASEPS_LEVEL;
+   InputPara.Output_BasePS_Step          = OUTPUT_BASEPS_STEP;
    InputPara.Opt__Output_Base            = OPT__OUTPUT_BASE;
 #  ifdef GRAVITY
    InputPara.Opt__Output_Pot             = OPT__OUTPUT_POT;
@@ -2764,6 +2800,20 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__Output_UserField       = OPT__OUTPUT_USER_FIELD;
    InputPara.Opt__Output_Mode            = OPT__OUTPUT_MODE;
    InputPara.Opt__Output_Restart         = OPT__OUTPUT_RESTART;
+   InputPara.Opt__Output_NodeLocal       = OPT__OUTPUT_NODE_LOCAL;
+   InputPara.NodeLocal_Dir               = NODE_LOCAL_DIR;
+   InputPara.Opt__NodeLocal_Drain        = OPT__NODE_LOCAL_DRAIN;
+   InputPara.NodeLocal_Step              = NODE_LOCAL_STEP;
+   InputPara.Opt__Output_Deflate         = OPT__OUTPUT_DEFLATE;
+   InputPara.Output_Lossy_RelErr         = OUTPUT_LOSSY_REL_ERR;
+   InputPara.Opt__Output_Image           = OPT__OUTPUT_IMAGE;
+   InputPara.Output_Image_Step           = OUTPUT_IMAGE_STEP;
+   InputPara.Output_Image_NPix           = OUTPUT_IMAGE_NPIX;
+   InputPara.Output_Image_Axis           = OUTPUT_IMAGE_AXIS;
+   InputPara.Output_Image_Field          = OUTPUT_IMAGE_FIELD;
+   InputPara.Output_Image_SliceX         = OUTPUT_IMAGE_SLICE_X;
+   InputPara.Output_Image_SliceY         = OUTPUT_IMAGE_SLICE_Y;
+   InputPara.Output_Image_SliceZ         = OUTPUT_IMAGE_SLICE_Z;
    InputPara.Opt__Output_Step            = OUTPUT_STEP;
    InputPara.Opt__Output_Dt              = OUTPUT_DT;
    InputPara.Opt__Output_Text_Format_Flt = OPT__OUTPUT_TEXT_FORMAT_FLT;
@@ -2786,6 +2836,10 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__RecordUnphy        = OPT__RECORD_UNPHY;
    InputPara.Opt__RecordMemory       = OPT__RECORD_MEMORY;
    InputPara.Opt__RecordPerformance  = OPT__RECORD_PERFORMANCE;
+   InputPara.Opt__RecordTrace        = OPT__RECORD_TRACE;
+   InputPara.Trace_StepStart         = TRACE_STEP_START;
+   InputPara.Trace_StepEnd           = TRACE_STEP_END;
+   InputPara.Trace_MaxEvent          = TRACE_MAX_EVENT;
    InputPara.Opt__ManualControl      = OPT__MANUAL_CONTROL;
    InputPara.Opt__RecordCenter       = OPT__RECORD_CENTER;
    InputPara.COM_CenX                = COM_CEN_X;
@@ -2795,6 +2849,14 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.COM_MinRho              = COM_MIN_RHO;
    InputPara.COM_TolErrR             = COM_TOLERR_R;
    InputPara.COM_MaxIter             = COM_MAX_ITER;
+   InputPara.Opt__RecordClump        = OPT__RECORD_CLUMP;
+   InputPara.Clump_Field             = CLUMP_FIELD;
+   InputPara.Clump_Threshold         = CLUMP_THRESHOLD;
+   InputPara.Clump_MinNCell          = CLUMP_MIN_NCELL;
+#  ifdef MASSIVE_PARTICLES
+   InputPara.Clump_FoF_LinkLen       = CLUMP_FOF_LINKLEN;
+   InputPara.Clump_FoF_MinNPar       = CLUMP_FOF_MIN_NPAR;
+#  endif
    InputPara.Opt__RecordUser         = OPT__RECORD_USER;
    InputPara.Opt__OptimizeAggressive = OPT__OPTIMIZE_AGGRESSIVE;
    InputPara.Opt__SortPatchByLBIdx   = OPT__SORT_PATCH_BY_LBIDX;
@@ -3015,6 +3077,7 @@ void GetCompound_Makefile( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "BitwiseReproducibility", HOFFSET(Makefile_t,BitwiseReproducibility ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Timing",                 HOFFSET(Makefile_t,Timing                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "TimingSolver",           HOFFSET(Makefile_t,TimingSolver           ), H5T_NATIVE_INT );
+   H5Tinsert( H5_TypeID, "PerfCounter",            HOFFSET(Makefile_t,PerfCounter            ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Float8",                 HOFFSET(Makefile_t,Float8                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Serial",                 HOFFSET(Makefile_t,Serial                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "LoadBalance",            HOFFSET(Makefile_t,LoadBalance            ), H5T_NATIVE_INT );
@@ -3363,6 +3426,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Par_ICType",              HOFFSET(InputPara_t,Par_ICType             ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_ICFloat8",            HOFFSET(InputPara_t,Par_ICFloat8           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_ICInt8",              HOFFSET(InputPara_t,Par_ICInt8             ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_ICLoadNRank",         HOFFSET(InputPara_t,Par_ICLoadNRank        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_Interp",              HOFFSET(InputPara_t,Par_Interp             ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_InterpTracer",        HOFFSET(InputPara_t,Par_InterpTracer       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_Integ",               HOFFSET(InputPara_t,Par_Integ              ), H5T_NATIVE_INT     );
@@ -3437,6 +3501,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__DtUser",             HOFFSET(InputPara_t,Opt__DtUser            ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__DtLevel",            HOFFSET(InputPara_t,Opt__DtLevel           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordDt",           HOFFSET(InputPara_t,Opt__RecordDt          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__DtFused",            HOFFSET(InputPara_t,Opt__DtFused           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "AutoReduceDt",            HOFFSET(InputPara_t,AutoReduceDt           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactor",      HOFFSET(InputPara_t,AutoReduceDtFactor     ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactorMin",   HOFFSET(InputPara_t,AutoReduceDtFactorMin  ), H5T_NATIVE_DOUBLE  );
@@ -3522,6 +3587,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
    H5Tinsert( H5_TypeID, "Opt__RecordLoadBalance",  HOFFSET(InputPara_t,Opt__RecordLoadBalance ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__LB_ExchangeFather",  HOFFSET(InputPara_t,Opt__LB_ExchangeFather ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__NodeAwareMPI",       HOFFSET(InputPara_t,Opt__NodeAwareMPI      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PersistentMPI",      HOFFSET(InputPara_t,Opt__PersistentMPI     ), H5T_NATIVE_INT     );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__MinimizeMPIBarrier", HOFFSET(InputPara_t,Opt__MinimizeMPIBarrier), H5T_NATIVE_INT     );
 
@@ -3531,6 +3598,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "MolecularWeight",         HOFFSET(InputPara_t,MolecularWeight        ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MuNorm",                  HOFFSET(InputPara_t,MuNorm                 ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "IsoTemp",                 HOFFSET(InputPara_t,IsoTemp                ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "NucTable",                HOFFSET(InputPara_t,NucTable               ), H5_TypeID_VarStr   );
+   H5Tinsert( H5_TypeID, "NucBenchmark",            HOFFSET(InputPara_t,NucBenchmark           ), H5T_NATIVE_LONG    );
    H5Tinsert( H5_TypeID, "MinMod_Coeff",            HOFFSET(InputPara_t,MinMod_Coeff           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MinMod_MaxIter",          HOFFSET(InputPara_t,MinMod_MaxIter         ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__LR_Limiter",         HOFFSET(InputPara_t,Opt__LR_Limiter        ), H5T_NATIVE_INT     );
@@ -3636,6 +3705,9 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "MG_NPostSmooth",          HOFFSET(InputPara_t,MG_NPostSmooth         ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "MG_ToleratedError",       HOFFSET(InputPara_t,MG_ToleratedError      ), H5T_NATIVE_DOUBLE           );
 #  endif
+   H5Tinsert( H5_TypeID, "Opt__LevelMG",            HOFFSET(InputPara_t,Opt__LevelMG           ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "LevelMG_MaxIter",         HOFFSET(InputPara_t,LevelMG_MaxIter        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "LevelMG_ToleratedError",  HOFFSET(InputPara_t,LevelMG_ToleratedError ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Pot_GPU_NPGroup",         HOFFSET(InputPara_t,Pot_GPU_NPGroup        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__GraP5Gradient",      HOFFSET(InputPara_t,Opt__GraP5Gradient     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__SelfGravity",        HOFFSET(InputPara_t,Opt__SelfGravity       ), H5T_NATIVE_INT              );
@@ -3776,6 +3848,10 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__Output_Par_Mesh",        HOFFSET(InputPara_t,Opt__Output_Par_Mesh       ), H5T_NATIVE_INT              );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__Output_BasePS",          HOFFSET(InputPara_t,Opt__Output_BasePS         ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_BasePS_Field",         HOFFSET(InputPara_t,Output_BasePS_Field        ), H5_TypeID_VarStr            );
+   H5Tinsert( H5_TypeID, "Output_BasePS_Cross",         HOFFSET(InputPara_t,Output_BasePS_Cross        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_BasePS_Level",         HOFFSET(InputPara_t,Output_BasePS_Level        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_BasePS_Step",          HOFFSET(InputPara_t,Output_BasePS_Step         ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Base",            HOFFSET(InputPara_t,Opt__Output_Base           ), H5T_NATIVE_INT              );
 #  ifdef GRAVITY
    H5Tinsert( H5_TypeID, "Opt__Output_Pot",             HOFFSET(InputPara_t,Opt__Output_Pot            ), H5T_NATIVE_INT              );
@@ -3805,6 +3881,20 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__Output_UserField",       HOFFSET(InputPara_t,Opt__Output_UserField      ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Mode",            HOFFSET(InputPara_t,Opt__Output_Mode           ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Restart",         HOFFSET(InputPara_t,Opt__Output_Restart        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_NodeLocal",       HOFFSET(InputPara_t,Opt__Output_NodeLocal      ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "NodeLocal_Dir",               HOFFSET(InputPara_t,NodeLocal_Dir              ), H5_TypeID_VarStr            );
+   H5Tinsert( H5_TypeID, "Opt__NodeLocal_Drain",        HOFFSET(InputPara_t,Opt__NodeLocal_Drain       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "NodeLocal_Step",              HOFFSET(InputPara_t,NodeLocal_Step             ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_Deflate",         HOFFSET(InputPara_t,Opt__Output_Deflate        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_Lossy_RelErr",         HOFFSET(InputPara_t,Output_Lossy_RelErr        ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Opt__Output_Image",           HOFFSET(InputPara_t,Opt__Output_Image          ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_Image_Step",           HOFFSET(InputPara_t,Output_Image_Step          ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_Image_NPix",           HOFFSET(InputPara_t,Output_Image_NPix          ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_Image_Axis",           HOFFSET(InputPara_t,Output_Image_Axis          ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_Image_Field",          HOFFSET(InputPara_t,Output_Image_Field         ), H5_TypeID_VarStr            );
+   H5Tinsert( H5_TypeID, "Output_Image_SliceX",         HOFFSET(InputPara_t,Output_Image_SliceX        ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Output_Image_SliceY",         HOFFSET(InputPara_t,Output_Image_SliceY        ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Output_Image_SliceZ",         HOFFSET(InputPara_t,Output_Image_SliceZ        ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Opt__Output_Step",            HOFFSET(InputPara_t,Opt__Output_Step           ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Dt",              HOFFSET(InputPara_t,Opt__Output_Dt             ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Opt__Output_Text_Format_Flt", HOFFSET(InputPara_t,Opt__Output_Text_Format_Flt), H5_TypeID_VarStr            );
@@ -3827,6 +3917,10 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__RecordUnphy",        HOFFSET(InputPara_t,Opt__RecordUnphy       ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RecordMemory",       HOFFSET(InputPara_t,Opt__RecordMemory      ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RecordPerformance",  HOFFSET(InputPara_t,Opt__RecordPerformance ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__RecordTrace",        HOFFSET(InputPara_t,Opt__RecordTrace       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Trace_StepStart",         HOFFSET(InputPara_t,Trace_StepStart        ), H5T_NATIVE_LONG             );
+   H5Tinsert( H5_TypeID, "Trace_StepEnd",           HOFFSET(InputPara_t,Trace_StepEnd          ), H5T_NATIVE_LONG             );
+   H5Tinsert( H5_TypeID, "Trace_MaxEvent",          HOFFSET(InputPara_t,Trace_MaxEvent         ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__ManualControl",      HOFFSET(InputPara_t,Opt__ManualControl     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RecordCenter",       HOFFSET(InputPara_t,Opt__RecordCenter      ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "COM_CenX",                HOFFSET(InputPara_t,COM_CenX               ), H5T_NATIVE_DOUBLE           );
@@ -3836,6 +3930,14 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "COM_MinRho",              HOFFSET(InputPara_t,COM_MinRho             ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "COM_TolErrR",             HOFFSET(InputPara_t,COM_TolErrR            ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "COM_MaxIter",             HOFFSET(InputPara_t,COM_MaxIter            ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__RecordClump",        HOFFSET(InputPara_t,Opt__RecordClump       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Clump_Field",             HOFFSET(InputPara_t,Clump_Field            ), H5_TypeID_VarStr            );
+   H5Tinsert( H5_TypeID, "Clump_Threshold",         HOFFSET(InputPara_t,Clump_Threshold        ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Clump_MinNCell",          HOFFSET(InputPara_t,Clump_MinNCell         ), H5T_NATIVE_INT              );
+#  ifdef MASSIVE_PARTICLES
+   H5Tinsert( H5_TypeID, "Clump_FoF_LinkLen",       HOFFSET(InputPara_t,Clump_FoF_LinkLen      ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Clump_FoF_MinNPar",       HOFFSET(InputPara_t,Clump_FoF_MinNPar      ), H5T_NATIVE_INT              );
+#  endif
    H5Tinsert( H5_TypeID, "Opt__RecordUser",         HOFFSET(InputPara_t,Opt__RecordUser        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__OptimizeAggressive", HOFFSET(InputPara_t,Opt__OptimizeAggressive), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__SortPatchByLBIdx",   HOFFSET(InputPara_t,Opt__SortPatchByLBIdx  ), H5T_NATIVE_INT              );
@@ -0,0 +1,229 @@
+#ifdef SUPPORT_HDF5
+
+#include "GAMER.h"
+#include "HDF5_Typedef.h"
+#include <zlib.h>
+
+
+// number of patches stored in one HDF5 chunk (i.e., one patch group)
+#define H5_CHUNK_NPATCH    8
+
+// integer type and number of mantissa bits of "real"
+#ifdef FLOAT8
+typedef uint64_t RealBits_t;
+#  define NBIT_MANTISSA    52
+#  define NBIT_EXPONENT    11
+#else
+typedef uint32_t RealBits_t;
+#  define NBIT_MANTISSA    23
+#  define NBIT_EXPONENT     8
+#endif
+
+// H5Dwrite_chunk() is supported since HDF5 1.10.3
+#if (  H5_VERSION_GE( 1, 10, 3 )  )
+#  define SUPPORT_H5_WRITE_CHUNK
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_HDF5_SetChunkDeflate
+// Description :  Set the chunked layout and the shuffle and deflate filters of a grid dataset
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5() when creating the datasets in the "GridData" group
+//                2. Do nothing if OPT__OUTPUT_DEFLATE == 0 (i.e., keep the contiguous layout)
+//                3. Each chunk stores one patch group (i.e., H5_CHUNK_NPATCH patches)
+//                   --> Dataset names and dimensions are unchanged so that the data can be loaded by
+//                       Init_ByRestart_HDF5() and yt transparently
+//
+// Parameter   :  H5_PropList : Dataset creation property list to be modified
+//                H5_SetDims  : Dataset dimensions [NPatch][...][...][...]
+//-------------------------------------------------------------------------------------------------------
+void Output_HDF5_SetChunkDeflate( const hid_t H5_PropList, const hsize_t H5_SetDims[4] )
+{
+
+   if ( OPT__OUTPUT_DEFLATE == 0 )  return;
+
+   if ( H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0 )
+      Aux_Error( ERROR_INFO, "the HDF5 library does not support the deflate filter for OPT__OUTPUT_DEFLATE !!\n" );
+
+   hsize_t H5_ChunkDims[4];
+   herr_t  H5_Status;
+
+   H5_ChunkDims[0] = MIN( H5_SetDims[0], H5_CHUNK_NPATCH );
+   for (int d=1; d<4; d++)    H5_ChunkDims[d] = H5_SetDims[d];
+
+// chunk dimensions must be positive
+   if ( H5_ChunkDims[0] == 0 )   return;
+
+// the shuffle filter must be set before the deflate filter
+   H5_Status = H5Pset_chunk( H5_PropList, 4, H5_ChunkDims );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the chunk dimensions !!\n" );
+
+   H5_Status = H5Pset_shuffle( H5_PropList );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the shuffle filter !!\n" );
+
+   H5_Status = H5Pset_deflate( H5_PropList, OPT__OUTPUT_DEFLATE );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the deflate filter !!\n" );
+
+} // FUNCTION : Output_HDF5_SetChunkDeflate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_HDF5_RoundMantissa
+// Description :  Round the floating-point numbers to the minimum number of mantissa bits satisfying a given
+//                relative error bound
+//
+// Note        :  1. Lossy compression for the derived fields controlled by OUTPUT_LOSSY_REL_ERR
+//                   --> The discarded mantissa bits are set to zero, which are then compressed efficiently by
+//                       the shuffle and deflate filters
+//                   --> The rounded data are still IEEE floating-point numbers, so no special decoder is required
+//                2. Number of mantissa bits kept (NKeep) satisfies 2^(-NKeep-1) <= RelErr, so the relative error
+//                   of each normal number is bounded by RelErr
+//                3. Inf and NaN are unchanged
+//                4. Data are modified in place
+//
+// Parameter   :  Data   : Array to be rounded
+//                NData  : Number of elements in Data
+//                RelErr : Relative error bound
+//                         --> Do nothing if RelErr <= 0.0
+//-------------------------------------------------------------------------------------------------------
+void Output_HDF5_RoundMantissa( real *Data, const long NData, const double RelErr )
+{
+
+   if ( RelErr <= 0.0 )    return;
+
+   const int NKeep = MAX(  (int)ceil( -log2(RelErr) - 1.0 ), 0  );
+
+   if ( NKeep >= NBIT_MANTISSA )    return;
+
+   const int        NDrop   = NBIT_MANTISSA - NKeep;
+   const RealBits_t Half    = (RealBits_t)1 << ( NDrop - 1 );
+   const RealBits_t Mask    = ~(  ( (RealBits_t)1 << NDrop ) - 1  );
+   const RealBits_t ExpMask = (  ( (RealBits_t)1 << NBIT_EXPONENT ) - 1  ) << NBIT_MANTISSA;
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NData; t++)
+   {
+      RealBits_t Bits;
+
+      memcpy( &Bits, Data+t, sizeof(real) );
+
+//    skip Inf and NaN
+      if ( ( Bits & ExpMask ) == ExpMask )   continue;
+
+//    round half away from zero (a carry into the exponent correctly rounds up to the next power of two)
+      Bits = ( Bits + Half ) & Mask;
+
+      memcpy( Data+t, &Bits, sizeof(real) );
+   }
+
+} // FUNCTION : Output_HDF5_RoundMantissa
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_HDF5_WriteGridData
+// Description :  Write the grid data of the consecutive patches at one level in this rank to a dataset in the
+//                "GridData" group
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5()
+//                2. For OPT__OUTPUT_DEFLATE == 0, call H5Dwrite() with the hyperslab already selected in
+//                   H5_SpaceID, which is the same as the uncompressed output
+//                3. For OPT__OUTPUT_DEFLATE > 0, compress all chunks by OpenMP threads and write them by
+//                   H5Dwrite_chunk(), which bypasses the single-threaded HDF5 filter pipeline
+//                   --> Chunks are compressed by the same shuffle and deflate algorithms as the HDF5 filters
+//                       set by Output_HDF5_SetChunkDeflate(), so they can be decompressed by any HDF5 reader
+//                   --> Fall back to H5Dwrite() (i.e., compression by the HDF5 filters) if the patches are not
+//                       aligned with chunks or H5Dwrite_chunk() is not supported
+//                       --> Should not happen since patches are always allocated in patch groups
+//                4. Data are first rounded by Output_HDF5_RoundMantissa() if RelErr > 0.0
+//                   --> Data are modified in place
+//
+// Parameter   :  H5_SetID      : Target dataset
+//                H5_MemID      : Memory dataspace of Data
+//                H5_SpaceID    : Dataset dataspace with the target hyperslab selected
+//                Data          : Data of NPatch patches
+//                NPatch        : Number of patches
+//                GID0          : GID of the first patch
+//                NElemPerPatch : Number of elements per patch
+//                RelErr        : Relative error bound of lossy compression (<= 0.0 --> lossless)
+//
+// Return      :  Status of the HDF5 write (negative on failure)
+//-------------------------------------------------------------------------------------------------------
+herr_t Output_HDF5_WriteGridData( const hid_t H5_SetID, const hid_t H5_MemID, const hid_t H5_SpaceID, real *Data,
+                                  const int NPatch, const long GID0, const int NElemPerPatch, const double RelErr )
+{
+
+// 1. lossy compression
+   Output_HDF5_RoundMantissa( Data, (long)NPatch*NElemPerPatch, RelErr );
+
+
+// 2. write data through the HDF5 filter pipeline
+#  ifdef SUPPORT_H5_WRITE_CHUNK
+   if (  OPT__OUTPUT_DEFLATE == 0  ||  NPatch % H5_CHUNK_NPATCH != 0  ||  GID0 % H5_CHUNK_NPATCH != 0  )
+#  endif
+      return H5Dwrite( H5_SetID, H5T_GAMER_REAL, H5_MemID, H5_SpaceID, H5P_DEFAULT, Data );
+
+
+// 3. compress all chunks in parallel and write them directly
+#  ifdef SUPPORT_H5_WRITE_CHUNK
+   const int    NChunk     = NPatch / H5_CHUNK_NPATCH;
+   const int    NElemChunk = H5_CHUNK_NPATCH*NElemPerPatch;
+   const uLong  ChunkSize  = (uLong)NElemChunk*sizeof(real);
+   const uLong  BufSize    = compressBound( ChunkSize );
+
+   Bytef  *CompBuf  = new Bytef  [ (long)NChunk*BufSize ];
+   uLongf *CompSize = new uLongf [NChunk];
+   int     NFailed  = 0;
+
+#  pragma omp parallel
+   {
+      Bytef *ShuffleBuf = new Bytef [ChunkSize];
+
+#     pragma omp for reduction( +:NFailed ) schedule( static )
+      for (int c=0; c<NChunk; c++)
+      {
+         const Bytef *Src = (const Bytef*)( Data + (long)c*NElemChunk );
+
+//       byte shuffle: the b-th byte of all elements are stored together (same as the HDF5 shuffle filter)
+         for (int b=0; b<(int)sizeof(real); b++)
+         for (int e=0; e<NElemChunk; e++)
+            ShuffleBuf[ (long)b*NElemChunk + e ] = Src[ (long)e*sizeof(real) + b ];
+
+//       deflate (same as the HDF5 deflate filter)
+         CompSize[c] = BufSize;
+
+         if ( compress2( CompBuf+(long)c*BufSize, CompSize+c, ShuffleBuf, ChunkSize, OPT__OUTPUT_DEFLATE ) != Z_OK )
+            NFailed ++;
+      }
+
+      delete [] ShuffleBuf;
+   } // OpenMP parallel region
+
+   if ( NFailed > 0 )   Aux_Error( ERROR_INFO, "failed to compress %d chunk(s) !!\n", NFailed );
+
+// filter mask = 0 --> all filters have been applied
+   const uint32_t FilterMask = 0;
+   hsize_t        H5_Offset[4] = { 0, 0, 0, 0 };
+   herr_t         H5_Status    = 0;
+
+   for (int c=0; c<NChunk  &&  H5_Status>=0; c++)
+   {
+      H5_Offset[0] = GID0 + (long)c*H5_CHUNK_NPATCH;
+      H5_Status    = H5Dwrite_chunk( H5_SetID, H5P_DEFAULT, FilterMask, H5_Offset, CompSize[c], CompBuf+(long)c*BufSize );
+   }
+
+   delete [] CompBuf;
+   delete [] CompSize;
+
+   return H5_Status;
+#  endif // #ifdef SUPPORT_H5_WRITE_CHUNK
+
+} // FUNCTION : Output_HDF5_WriteGridData
+
+
+
+#endif // #ifdef SUPPORT_HDF5
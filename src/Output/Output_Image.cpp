@@ -0,0 +1,526 @@
+#include "GAMER.h"
+
+#ifdef SUPPORT_HDF5
+#include "HDF5_Typedef.h"
+#endif
+
+
+// maximum number of target fields in OUTPUT_IMAGE_FIELD
+#define IMAGE_NFIELD_MAX   16
+
+static int  GetImageField( char Label[][MAX_STRING], long TVar[] );
+static void WriteImage( const char *FileName, const int NImage, char ImageName[][MAX_STRING], const int *ImageNu,
+                        const int *ImageNv, double **ImageData );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_Image
+// Description :  Compute the projections and slices of the target fields across the AMR hierarchy and store
+//                the images in a single file
+//
+// Note        :  1. Used for the runtime option "OPT__OUTPUT_IMAGE"
+//                   --> OUTPUT_IMAGE_PROJ : density-weighted projection along the target axis
+//                       OUTPUT_IMAGE_SLICE: slice at OUTPUT_IMAGE_SLICE_X/Y/Z normal to the target axis
+//                2. Images are output every OUTPUT_IMAGE_STEP root-level steps, independent of OPT__OUTPUT_MODE
+//                   --> File name is "Image_XXXXXXXXX", where XXXXXXXXX is the current step
+//                3. Target fields are set by OUTPUT_IMAGE_FIELD (e.g., "Dens,Temp,VelX")
+//                   --> See GetImageField() for the supported fields
+//                4. Images are constructed from the leaf patches on all levels
+//                   --> Each cell is deposited onto pixels according to the overlap area, so images can have
+//                       either a higher or lower resolution than the simulation
+//                   --> Image axes follow the cyclic order: (y,z), (z,x), and (x,y) for the x, y, and z axes
+//                   --> The longer image side has OUTPUT_IMAGE_NPIX pixels, and the pixels are square only when
+//                       the box dimensions along the two image axes are both multiples of their pixel numbers
+//                5. Projection of field f is sum(f*rho*dl)/sum(rho*dl) along each line of sight, and the column
+//                   density sum(rho*dl) is also stored as "ColumnDens"
+//                   --> Slices are the area-weighted cell values
+//                6. Support hybrid OpenMP/MPI parallelization
+//                   --> Different OpenMP threads deposit cells into the same image by atomic operations
+//                   --> Images of all ranks are combined on the root rank by MPI_Reduce()
+//                   --> Only the root rank writes the file
+//                7. With SUPPORT_HDF5, images are stored as 2D double-precision datasets named "Proj[XYZ]_Field"
+//                   and "Slice[XYZ]_Field" with dimensions [Nv][Nu], together with the datasets "Time", "Step",
+//                   "BoxSize", and "SliceCoord"
+//                   --> Otherwise images are stored in a binary file with the following layout:
+//                          double Time, long Step, int NImage
+//                          NImage x { char Name[MAX_STRING], int Nu, int Nv, double Data[Nv][Nu] }
+//
+// Parameter   :  Stage : 0 : beginning of the run
+//                        1 : during the evolution
+//                        2 : end of the run
+//-------------------------------------------------------------------------------------------------------
+void Output_Image( const int Stage )
+{
+
+// check
+   if ( Stage < 0  ||  Stage > 2 )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "Stage", Stage );
+
+   if ( OPT__OUTPUT_IMAGE == 0 )    return;
+
+
+// check whether to output images at this step
+   static long PreviousStep = -1;
+
+   if (  Step == PreviousStep  ||  ( Stage == 1 && Step%OUTPUT_IMAGE_STEP != 0 )  )   return;
+
+   PreviousStep = Step;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step = %ld) ...\n", __FUNCTION__, Step );
+
+
+// 1. set the target fields
+// --> _DENS is always prepared for the density weighting of projections
+   char Label[IMAGE_NFIELD_MAX][MAX_STRING];
+   long TVar[IMAGE_NFIELD_MAX], TVarAll=_DENS;
+
+   const int NField = GetImageField( Label, TVar );
+
+   for (int f=0; f<NField; f++)  TVarAll |= TVar[f];
+
+// fields returned by Prepare_PatchData() are sorted by their bitwise indices
+   int NVarAll=0, DensPos=-1, FieldPos[IMAGE_NFIELD_MAX];
+
+   for (int b=0; b<(int)sizeof(long)*8; b++)
+   {
+      const long TVar1 = 1L << b;
+
+      if ( !( TVarAll & TVar1 ) )   continue;
+
+      if ( TVar1 == _DENS )   DensPos = NVarAll;
+
+      for (int f=0; f<NField; f++)
+         if ( TVar[f] == TVar1 )    FieldPos[f] = NVarAll;
+
+      NVarAll ++;
+   }
+
+
+// 2. set the image geometry and allocate the image buffers
+// --> each image buffer stores NField weighted sums followed by the total weight
+   const double SliceCoord[3] = { OUTPUT_IMAGE_SLICE_X, OUTPUT_IMAGE_SLICE_Y, OUTPUT_IMAGE_SLICE_Z };
+   const char   AxisName[3]   = { 'X', 'Y', 'Z' };
+   const int    NType         = 2;
+   const int    TypeProj      = 0;
+   const int    TypeSlice     = 1;
+   const bool   TypeOn[NType] = { (bool)( OPT__OUTPUT_IMAGE & OUTPUT_IMAGE_PROJ  ),
+                                  (bool)( OPT__OUTPUT_IMAGE & OUTPUT_IMAGE_SLICE ) };
+
+   bool    AxisOn[3];
+   int     Nu[3], Nv[3], Ax_u[3], Ax_v[3];
+   double  du[3], dv[3];
+   double *Buf[3][NType];
+
+   for (int a=0; a<3; a++)
+   {
+      AxisOn[a] = ( OUTPUT_IMAGE_AXIS == 3  ||  OUTPUT_IMAGE_AXIS == a );
+      Ax_u  [a] = (a+1)%3;
+      Ax_v  [a] = (a+2)%3;
+
+      const double Lu   = amr->BoxSize[ Ax_u[a] ];
+      const double Lv   = amr->BoxSize[ Ax_v[a] ];
+      const double LMax = MAX( Lu, Lv );
+
+      Nu[a] = MAX(  1, (int)round( OUTPUT_IMAGE_NPIX*Lu/LMax )  );
+      Nv[a] = MAX(  1, (int)round( OUTPUT_IMAGE_NPIX*Lv/LMax )  );
+      du[a] = Lu / Nu[a];
+      dv[a] = Lv / Nv[a];
+
+      for (int t=0; t<NType; t++)
+      {
+         if ( AxisOn[a]  &&  TypeOn[t] )
+         {
+            const long NBuf = (long)( NField + 1 )*Nu[a]*Nv[a];
+
+            Buf[a][t] = new double [NBuf];
+            for (long p=0; p<NBuf; p++)   Buf[a][t][p] = 0.0;
+         }
+
+         else
+            Buf[a][t] = NULL;
+      }
+   } // for (int a=0; a<3; a++)
+
+
+// 3. deposit the leaf cells on all levels onto the images
+#  ifdef OPENMP
+   const int NT = OMP_NTHREAD;   // number of OpenMP threads
+#  else
+   const int NT = 1;
+#  endif
+
+   const int  NGhost             = 0;
+   const int  NPG                = 1;
+   const bool IntPhase_No        = false;
+   const real MinDens_No         = -1.0;
+   const real MinPres_No         = -1.0;
+   const real MinTemp_No         = -1.0;
+   const real MinEntr_No         = -1.0;
+   const bool DE_Consistency_Yes = true;
+
+   real *PrepData = new real [ (long)NT*8*NVarAll*CUBE(PS1) ];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const double dh       = amr->dh[lv];
+      const double PrepTime = amr->FluSgTime[lv][ amr->FluSg[lv] ];
+
+#     pragma omp parallel
+      {
+#        ifdef OPENMP
+         const int TID = omp_get_thread_num();
+#        else
+         const int TID = 0;
+#        endif
+
+         real *PrepData_TID = PrepData + (long)TID*8*NVarAll*CUBE(PS1);
+         real  Val[IMAGE_NFIELD_MAX];
+
+#        pragma omp for schedule( runtime )
+         for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+         {
+//          skip patch groups without any leaf patch
+            bool HasLeaf = false;
+
+            for (int LocalID=0; LocalID<8; LocalID++)
+            {
+               if ( amr->patch[0][lv][PID0+LocalID]->son == -1 )
+               {
+                  HasLeaf = true;
+                  break;
+               }
+            }
+
+            if ( !HasLeaf )   continue;
+
+
+//          prepare all target fields at once
+            Prepare_PatchData( lv, PrepTime, PrepData_TID, NULL, NGhost, NPG, &PID0, TVarAll, _NONE,
+                               INT_NONE, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
+                               MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_Yes );
+
+
+            for (int LocalID=0; LocalID<8; LocalID++)
+            {
+               const int PID = PID0 + LocalID;
+
+               if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+               const real   *Data1P = PrepData_TID + (long)LocalID*NVarAll*CUBE(PS1);
+               const double *EdgeL  = amr->patch[0][lv][PID]->EdgeL;
+
+               for (int k=0; k<PS1; k++)
+               for (int j=0; j<PS1; j++)
+               for (int i=0; i<PS1; i++)
+               {
+                  const int    idx     = IDX321( i, j, k, PS1, PS1 );
+                  const double Left[3] = { EdgeL[0] + i*dh, EdgeL[1] + j*dh, EdgeL[2] + k*dh };
+                  const double Dens    = Data1P[ DensPos*CUBE(PS1) + idx ];
+
+                  for (int f=0; f<NField; f++)  Val[f] = Data1P[ FieldPos[f]*CUBE(PS1) + idx ];
+
+                  for (int a=0; a<3; a++)
+                  {
+                     if ( !AxisOn[a] )    continue;
+
+                     const bool InSlice = ( TypeOn[TypeSlice]  &&  SliceCoord[a] >= Left[a]  &&  SliceCoord[a] < Left[a]+dh );
+
+                     if ( !TypeOn[TypeProj]  &&  !InSlice )  continue;
+
+                     const double u0  = Left[ Ax_u[a] ];
+                     const double v0  = Left[ Ax_v[a] ];
+                     const int    iu0 = MAX( (int)floor( u0/du[a] ), 0 );
+                     const int    iv0 = MAX( (int)floor( v0/dv[a] ), 0 );
+                     const int    iu1 = MIN( (int)floor( (u0+dh)/du[a] ), Nu[a]-1 );
+                     const int    iv1 = MIN( (int)floor( (v0+dh)/dv[a] ), Nv[a]-1 );
+                     const long   NPix = (long)Nu[a]*Nv[a];
+
+                     for (int iv=iv0; iv<=iv1; iv++)
+                     {
+                        const double ov = MIN( v0+dh, (iv+1)*dv[a] ) - MAX( v0, iv*dv[a] );
+
+                        if ( ov <= 0.0 )  continue;
+
+                        for (int iu=iu0; iu<=iu1; iu++)
+                        {
+                           const double ou = MIN( u0+dh, (iu+1)*du[a] ) - MAX( u0, iu*du[a] );
+
+                           if ( ou <= 0.0 )  continue;
+
+//                         fraction of the pixel area covered by this cell
+                           const double Frac = ou*ov/( du[a]*dv[a] );
+                           const long   Pix  = (long)iv*Nu[a] + iu;
+
+                           if ( TypeOn[TypeProj] )
+                           {
+                              double *Img = Buf[a][TypeProj];
+                              const double Col = Dens*dh*Frac;
+
+                              for (int f=0; f<NField; f++)
+                              {
+#                                pragma omp atomic
+                                 Img[ f*NPix + Pix ] += Val[f]*Col;
+                              }
+
+#                             pragma omp atomic
+                              Img[ NField*NPix + Pix ] += Col;
+                           }
+
+                           if ( InSlice )
+                           {
+                              double *Img = Buf[a][TypeSlice];
+
+                              for (int f=0; f<NField; f++)
+                              {
+#                                pragma omp atomic
+                                 Img[ f*NPix + Pix ] += Val[f]*Frac;
+                              }
+
+#                             pragma omp atomic
+                              Img[ NField*NPix + Pix ] += Frac;
+                           }
+                        } // for (int iu=iu0; iu<=iu1; iu++)
+                     } // for (int iv=iv0; iv<=iv1; iv++)
+                  } // for (int a=0; a<3; a++)
+               } // i,j,k
+            } // for (int LocalID=0; LocalID<8; LocalID++)
+         } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+      } // OpenMP parallel region
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   delete [] PrepData;
+
+
+// 4. collect data from all ranks (in-place reduction)
+#  ifndef SERIAL
+   for (int a=0; a<3; a++)
+   for (int t=0; t<NType; t++)
+   {
+      if ( Buf[a][t] == NULL )   continue;
+
+      const int NBuf = ( NField + 1 )*Nu[a]*Nv[a];
+
+      if ( MPI_Rank == 0 )    MPI_Reduce( MPI_IN_PLACE, Buf[a][t], NBuf, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      else                    MPI_Reduce( Buf[a][t],    NULL,      NBuf, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   }
+#  endif
+
+
+// 5. normalize the images and write them to disk by the root rank
+   if ( MPI_Rank == 0 )
+   {
+      const int NImageMax = 3*NType*( NField + 1 );
+
+      char   (*ImageName)[MAX_STRING] = new char [NImageMax][MAX_STRING];
+      int     *ImageNu   = new int     [NImageMax];
+      int     *ImageNv   = new int     [NImageMax];
+      double **ImageData = new double* [NImageMax];
+      int      NImage    = 0;
+
+      for (int a=0; a<3; a++)
+      for (int t=0; t<NType; t++)
+      {
+         if ( Buf[a][t] == NULL )   continue;
+
+         const long NPix = (long)Nu[a]*Nv[a];
+         double    *Wgt  = Buf[a][t] + NField*NPix;
+
+         for (int f=0; f<NField; f++)
+         {
+            double *Img = Buf[a][t] + f*NPix;
+
+            for (long p=0; p<NPix; p++)   Img[p] = ( Wgt[p] > 0.0 ) ? Img[p]/Wgt[p] : 0.0;
+
+            sprintf( ImageName[NImage], "%s%c_%s", (t==TypeProj)?"Proj":"Slice", AxisName[a], Label[f] );
+            ImageNu  [NImage] = Nu[a];
+            ImageNv  [NImage] = Nv[a];
+            ImageData[NImage] = Img;
+            NImage ++;
+         }
+
+//       store the column density of projections
+         if ( t == TypeProj )
+         {
+            sprintf( ImageName[NImage], "Proj%c_ColumnDens", AxisName[a] );
+            ImageNu  [NImage] = Nu[a];
+            ImageNv  [NImage] = Nv[a];
+            ImageData[NImage] = Wgt;
+            NImage ++;
+         }
+      } // a, t
+
+      char FileName[MAX_STRING];
+      sprintf( FileName, "Image_%09ld", Step );
+
+      WriteImage( FileName, NImage, ImageName, ImageNu, ImageNv, ImageData );
+
+      delete [] ImageName;
+      delete [] ImageNu;
+      delete [] ImageNv;
+      delete [] ImageData;
+   } // if ( MPI_Rank == 0 )
+
+
+// 6. free memory
+   for (int a=0; a<3; a++)
+   for (int t=0; t<NType; t++)
+      delete [] Buf[a][t];
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step = %ld) ... done\n", __FUNCTION__, Step );
+
+} // FUNCTION : Output_Image
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetImageField
+// Description :  Parse OUTPUT_IMAGE_FIELD to get the labels and bitwise indices of the target fields
+//
+// Note        :  1. Fields must be separated by commas without spaces (e.g., "Dens,Temp,VelX")
+//                   --> ReadPara_t::Read() stops reading a value at the first space
+//                2. See GetFieldBIdx() for the supported fields
+//                   --> Particle mass density ("ParDens" and "TotalDens" with MASSIVE_PARTICLES) is not supported
+//
+// Parameter   :  Label : Array to store the field labels
+//                TVar  : Array to store the bitwise field indices
+//
+// Return      :  Number of target fields, Label[], TVar[]
+//-------------------------------------------------------------------------------------------------------
+int GetImageField( char Label[][MAX_STRING], long TVar[] )
+{
+
+   char FieldStr[MAX_STRING];
+   int  NField = 0;
+
+   strcpy( FieldStr, OUTPUT_IMAGE_FIELD );
+
+   for (char *Token=strtok(FieldStr, " ,\t"); Token!=NULL; Token=strtok(NULL, " ,\t"))
+   {
+      if ( NField >= IMAGE_NFIELD_MAX )
+         Aux_Error( ERROR_INFO, "number of fields in OUTPUT_IMAGE_FIELD exceeds IMAGE_NFIELD_MAX (%d) !!\n",
+                    IMAGE_NFIELD_MAX );
+
+      const long TVar1 = GetFieldBIdx( Token, CHECK_OFF );
+
+      if ( TVar1 == 0 )
+         Aux_Error( ERROR_INFO, "unsupported field \"%s\" in OUTPUT_IMAGE_FIELD !!\n", Token );
+
+#     ifdef MASSIVE_PARTICLES
+      if ( TVar1 == _PAR_DENS  ||  TVar1 == _TOTAL_DENS )
+         Aux_Error( ERROR_INFO, "particle mass density \"%s\" is not supported by OUTPUT_IMAGE_FIELD !!\n", Token );
+#     endif
+
+      for (int f=0; f<NField; f++)
+         if ( TVar[f] == TVar1 )
+            Aux_Error( ERROR_INFO, "duplicate field \"%s\" in OUTPUT_IMAGE_FIELD !!\n", Token );
+
+      strcpy( Label[NField], Token );
+      TVar[NField] = TVar1;
+      NField ++;
+   } // for (char *Token=strtok(...); Token!=NULL; ...)
+
+   if ( NField == 0 )   Aux_Error( ERROR_INFO, "no field is found in OUTPUT_IMAGE_FIELD !!\n" );
+
+   return NField;
+
+} // FUNCTION : GetImageField
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteImage
+// Description :  Write the images to disk
+//
+// Note        :  1. Invoked by Output_Image() on the root rank
+//                2. See the notes of Output_Image() for the file format
+//
+// Parameter   :  FileName  : Name of the output file
+//                NImage    : Number of images
+//                ImageName : Name of each image
+//                ImageNu   : Number of pixels along the first image axis of each image
+//                ImageNv   : Number of pixels along the second image axis of each image
+//                ImageData : Pixel data of each image with the layout [Nv][Nu]
+//-------------------------------------------------------------------------------------------------------
+void WriteImage( const char *FileName, const int NImage, char ImageName[][MAX_STRING], const int *ImageNu,
+                 const int *ImageNv, double **ImageData )
+{
+
+   if ( Aux_CheckFileExist(FileName) )
+      Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+
+#  ifdef SUPPORT_HDF5
+   const double SliceCoord[3] = { OUTPUT_IMAGE_SLICE_X, OUTPUT_IMAGE_SLICE_Y, OUTPUT_IMAGE_SLICE_Z };
+
+   hid_t   H5_FileID, H5_SpaceID, H5_SetID;
+   hsize_t H5_Dims[2];
+   herr_t  H5_Status;
+
+   H5_FileID = H5Fcreate( FileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to create the HDF5 file \"%s\" !!\n", FileName );
+
+// basic information
+   H5_SpaceID = H5Screate( H5S_SCALAR );
+   H5_SetID   = H5Dcreate( H5_FileID, "Time", H5T_NATIVE_DOUBLE, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status  = H5Dwrite( H5_SetID, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, Time );
+   H5_Status  = H5Dclose( H5_SetID );
+   H5_SetID   = H5Dcreate( H5_FileID, "Step", H5T_NATIVE_LONG, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status  = H5Dwrite( H5_SetID, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &Step );
+   H5_Status  = H5Dclose( H5_SetID );
+   H5_Status  = H5Sclose( H5_SpaceID );
+
+   H5_Dims[0] = 3;
+   H5_SpaceID = H5Screate_simple( 1, H5_Dims, NULL );
+   H5_SetID   = H5Dcreate( H5_FileID, "BoxSize", H5T_NATIVE_DOUBLE, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status  = H5Dwrite( H5_SetID, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, amr->BoxSize );
+   H5_Status  = H5Dclose( H5_SetID );
+   H5_SetID   = H5Dcreate( H5_FileID, "SliceCoord", H5T_NATIVE_DOUBLE, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   H5_Status  = H5Dwrite( H5_SetID, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, SliceCoord );
+   H5_Status  = H5Dclose( H5_SetID );
+   H5_Status  = H5Sclose( H5_SpaceID );
+
+// images
+   for (int m=0; m<NImage; m++)
+   {
+      H5_Dims[0] = ImageNv[m];
+      H5_Dims[1] = ImageNu[m];
+
+      H5_SpaceID = H5Screate_simple( 2, H5_Dims, NULL );
+      H5_SetID   = H5Dcreate( H5_FileID, ImageName[m], H5T_NATIVE_DOUBLE, H5_SpaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", ImageName[m] );
+
+      H5_Status  = H5Dwrite( H5_SetID, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, ImageData[m] );
+      if ( H5_Status < 0 ) Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" !!\n", ImageName[m] );
+
+      H5_Status  = H5Dclose( H5_SetID );
+      H5_Status  = H5Sclose( H5_SpaceID );
+   }
+
+   H5_Status = H5Fclose( H5_FileID );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to close the HDF5 file \"%s\" !!\n", FileName );
+
+
+#  else // #ifdef SUPPORT_HDF5
+   FILE *File = fopen( FileName, "wb" );
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+
+   fwrite( Time,    sizeof(double), 1, File );
+   fwrite( &Step,   sizeof(long),   1, File );
+   fwrite( &NImage, sizeof(int),    1, File );
+
+   for (int m=0; m<NImage; m++)
+   {
+      fwrite( ImageName[m],  sizeof(char),   MAX_STRING,                    File );
+      fwrite( ImageNu+m,     sizeof(int),    1,                             File );
+      fwrite( ImageNv+m,     sizeof(int),    1,                             File );
+      fwrite( ImageData[m],  sizeof(double), (long)ImageNu[m]*ImageNv[m],   File );
+   }
+
+   fclose( File );
+#  endif // #ifdef SUPPORT_HDF5 ... else ...
+
+} // FUNCTION : WriteImage
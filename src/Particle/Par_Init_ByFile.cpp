@@ -4,6 +4,12 @@
 // declare as static so that other functions cannot invoke it directly and must use the function pointer
 static void Par_Init_ByFile_Default();
 
+template <typename T_in, typename T_out>
+static void ConvertParICData( T_out *Out, const char *In, const long NPar, const long Stride );
+
+// maximum number of bytes loaded by a single fread() call in Par_Init_ByFile_Default()
+#define PAR_IC_CHUNK_SIZE  ( 1L << 27 )
+
 // this function pointer may be overwritten by various test problem initializers
 // --> link to Par_Init_ByFile_Default() by default
 void (*Par_Init_ByFile_User_Ptr)() = Par_Init_ByFile_Default;
@@ -41,6 +47,8 @@ void (*Par_Init_ByFile_User_Ptr)() = Par_Init_ByFile_Default;
 //                   --> No need to provide particle acceleration and time
 //                8. For LOAD_BALANCE, the number of particles in each rank must be set in advance
 //                   --> Currently it's set by Init_Parallelization()
+//                9. The number of MPI ranks loading PAR_IC simultaneously is controlled by the runtime
+//                   parameter "PAR_IC_LOAD_NRANK"
 //
 // Parameter   :  None
 //
@@ -71,6 +79,11 @@ void Par_Init_ByFile()
 // Description :  Initialize particle attributes from a file
 //
 // Note        :  1. Refer to the "Note" section in "Particle/Par_Init_ByFile.cpp -> Par_Init_ByFile()"
+//                2. Data are loaded in chunks of at most PAR_IC_CHUNK_SIZE bytes per fread() and converted
+//                   one attribute at a time to allow vectorization
+//                   --> For PAR_IC_FORMAT_ATT_ID, data are loaded directly into the particle repository
+//                       when the precision of PAR_IC matches that of the repository
+//                3. Only PAR_IC_LOAD_NRANK ranks load data simultaneously
 //
 // Parameter   :  None
 //
@@ -99,6 +112,9 @@ void Par_Init_ByFile_Default()
    if ( !Aux_CheckFileExist(FileName) )
       Aux_Error( ERROR_INFO, "file \"%s\" does not exist for PAR_INIT == PAR_INIT_BY_FILE !!\n", FileName );
 
+   if ( PAR_IC_LOAD_NRANK <= 0 )
+      Aux_Error( ERROR_INFO, "PAR_IC_LOAD_NRANK (%d) <= 0 !!\n", PAR_IC_LOAD_NRANK );
+
 // determine the load_data_size for loading PAR_IC
    size_t load_data_size_flt = ( PAR_IC_FLOAT8 ) ? sizeof(double) : sizeof(float);
    size_t load_data_size_int = ( PAR_IC_INT8   ) ? sizeof(long)   : sizeof(int)  ;
@@ -118,8 +134,8 @@ void Par_Init_ByFile_Default()
    MPI_Barrier( MPI_COMM_WORLD );
 
 
-// set the file offset for this rank
-   long NPar_EachRank[MPI_NRank], NPar_Check=0, FileOffset=0;
+// set the particle offset for this rank
+   long NPar_EachRank[MPI_NRank], NPar_Check=0, ParOffset=0;
 
    MPI_Allgather( &NParThisRank, 1, MPI_LONG, NPar_EachRank, 1, MPI_LONG, MPI_COMM_WORLD );
 
@@ -128,123 +144,190 @@ void Par_Init_ByFile_Default()
    if ( NPar_Check != NParAllRank )
       Aux_Error( ERROR_INFO, "total number of particles found (%ld) != expect (%ld) !!\n", NPar_Check, NParAllRank );
 
+   for (int r=0; r<MPI_Rank; r++)   ParOffset += NPar_EachRank[r];
 
-// load data
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... " );
 
-// allocate buffer for loading PAR_IC
-   char* ParFltData_ThisRank = new char [ NParThisRank*NParAttFlt*load_data_size_flt ];
-   char* ParIntData_ThisRank = new char [ NParThisRank*NParAttInt*load_data_size_int ];
+// set the target attribute index of each loaded attribute
+// --> assuming that the orders of the particle attributes stored on the disk and in Par->AttributeFlt/Int[] are the same
+// --> no need to skip acceleration and time since they are always put at the end of the attribute list
+   real_par *AttFlt[NParAttFlt];
+   long_par *AttInt[NParAttInt];
 
-// note that fread() may fail for large files if sizeof(size_t) == 4 instead of 8
-   FILE *File = fopen( FileName, "rb" );
-
-   if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
+   for (int v_in=0, v_out=0; v_in<NParAttFlt; v_in++, v_out++)
    {
-      for (int r=0; r<MPI_Rank; r++)   FileOffset += NPar_EachRank[r]*( long(NParAttFlt)*load_data_size_flt + long(NParAttInt)*load_data_size_int );
-
-      fseek( File, FileOffset, SEEK_SET );
+      if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
 
-      for (long p=0; p<NParThisRank; p++)
-      {
-         fread( ParFltData_ThisRank+p*NParAttFlt*load_data_size_flt, load_data_size_flt, long(NParAttFlt), File );
-         fread( ParIntData_ThisRank+p*NParAttInt*load_data_size_int, load_data_size_int, long(NParAttInt), File );
-      }
+      AttFlt[v_in] = amr->Par->AttributeFlt[v_out];
    }
 
-   else
+   for (int v_in=0, v_out=0; v_in<NParAttInt; v_in++, v_out++)
    {
-      for (int r=0; r<MPI_Rank; r++)   FileOffset += NPar_EachRank[r]*load_data_size_flt;
+      if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
 
-      for (int v=0; v<NParAttFlt; v++)
-      {
-         fseek( File, FileOffset, SEEK_SET );
-         fread( ParFltData_ThisRank+v*NParThisRank*load_data_size_flt, load_data_size_flt, NParThisRank, File );
-         FileOffset += NParAllRank*load_data_size_flt;
-      }
+      AttInt[v_in] = amr->Par->AttributeInt[v_out];
+   }
+
+
+// load data with PAR_IC_LOAD_NRANK ranks at a time
+// --> note that fread() may fail for large files if sizeof(size_t) == 4 instead of 8
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ...\n" );
 
-      for (int v=0; v<NParAttInt; v++)
+   for (int TRank0=0; TRank0<MPI_NRank; TRank0+=PAR_IC_LOAD_NRANK)
+   {
+      if ( MPI_Rank >= TRank0  &&  MPI_Rank < TRank0+PAR_IC_LOAD_NRANK )
       {
-         fseek( File, FileOffset, SEEK_SET );
-         fread( ParIntData_ThisRank+v*NParThisRank*load_data_size_int, load_data_size_int, NParThisRank, File );
-         FileOffset += NParAllRank*load_data_size_int;
-      }
-   } // if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT ) ... else ...
+         if ( MPI_Rank == TRank0 )  Aux_Message( stdout, "      Loading ranks %4d -- %4d ... ",
+                                                 TRank0, MIN(TRank0+PAR_IC_LOAD_NRANK-1, MPI_NRank-1) );
+
+         FILE *File = fopen( FileName, "rb" );
+
+//       [id][att]: load all attributes of NParChunk particles at a time
+         if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
+         {
+            const long  RecSize   = long(NParAttFlt)*load_data_size_flt + long(NParAttInt)*load_data_size_int;
+            const long  NParChunk = MIN( MAX( PAR_IC_CHUNK_SIZE/RecSize, 1L ), MAX( NParThisRank, 1L ) );
+            const long  IntOffset = long(NParAttFlt)*load_data_size_flt;
+                  char *Buffer    = new char [ NParChunk*RecSize ];
+
+            fseek( File, ParOffset*RecSize, SEEK_SET );
+
+            for (long p0=0; p0<NParThisRank; p0+=NParChunk)
+            {
+               const long NPar = MIN( NParChunk, NParThisRank-p0 );
+
+               if ( fread( Buffer, RecSize, NPar, File ) != (size_t)NPar )
+                  Aux_Error( ERROR_INFO, "fail to load %ld particles from the file \"%s\" !!\n", NPar, FileName );
+
+               for (int v=0; v<NParAttFlt; v++)
+               {
+                  if ( PAR_IC_FLOAT8 )
+                     ConvertParICData<double>( AttFlt[v]+p0, Buffer+v*load_data_size_flt, NPar, RecSize );
+                  else
+                     ConvertParICData<float >( AttFlt[v]+p0, Buffer+v*load_data_size_flt, NPar, RecSize );
+               }
+
+               for (int v=0; v<NParAttInt; v++)
+               {
+                  if ( PAR_IC_INT8 )
+                     ConvertParICData<long>( AttInt[v]+p0, Buffer+IntOffset+v*load_data_size_int, NPar, RecSize );
+                  else
+                     ConvertParICData<int >( AttInt[v]+p0, Buffer+IntOffset+v*load_data_size_int, NPar, RecSize );
+               }
+            } // for (long p0=0; p0<NParThisRank; p0+=NParChunk)
+
+            delete [] Buffer;
+         } // if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
+
+//       [att][id]: load one attribute of NParChunk particles at a time
+         else
+         {
+            const long  NParChunk = MIN( MAX( PAR_IC_CHUNK_SIZE/long(sizeof(double)), 1L ), MAX( NParThisRank, 1L ) );
+            const long  IntOffset = NParAllRank*NParAttFlt*load_data_size_flt;
+                  char *Buffer    = new char [ NParChunk*sizeof(double) ];
 
-   fclose( File );
+//          load data into the particle repository directly if the data types match
+            const bool  DirectFlt = ( load_data_size_flt == sizeof(real_par) );
+            const bool  DirectInt = ( load_data_size_int == sizeof(long_par) );
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+            for (int v=0; v<NParAttFlt; v++)
+            {
+               fseek( File, ( v*NParAllRank + ParOffset )*load_data_size_flt, SEEK_SET );
 
+               for (long p0=0; p0<NParThisRank; p0+=NParChunk)
+               {
+                  const long  NPar = MIN( NParChunk, NParThisRank-p0 );
+                        char *Ptr  = ( DirectFlt ) ? (char*)( AttFlt[v]+p0 ) : Buffer;
 
-// store data into the particle repository
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Storing data into particle repository ... " );
+                  if ( fread( Ptr, load_data_size_flt, NPar, File ) != (size_t)NPar )
+                     Aux_Error( ERROR_INFO, "fail to load %ld particles from the file \"%s\" !!\n", NPar, FileName );
 
-   real_par *ParFltData1 = new real_par [NParAttFlt];
-   long_par *ParIntData1 = new long_par [NParAttInt];
+                  if ( DirectFlt )  continue;
 
-   for (long p=0; p<NParThisRank; p++)
-   {
-//    collect data for the target particle
-//    [id][att]
-      if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((double*)(ParFltData_ThisRank+(p*NParAttFlt+v)*load_data_size_flt)) );
-         else
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((float* )(ParFltData_ThisRank+(p*NParAttFlt+v)*load_data_size_flt)) );
+                  if ( PAR_IC_FLOAT8 )
+                     ConvertParICData<double>( AttFlt[v]+p0, Buffer, NPar, sizeof(double) );
+                  else
+                     ConvertParICData<float >( AttFlt[v]+p0, Buffer, NPar, sizeof(float ) );
+               }
+            }
 
-         if ( PAR_IC_INT8 )
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((long*  )(ParIntData_ThisRank+(p*NParAttInt+v)*load_data_size_int)) );
-         else
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((int*   )(ParIntData_ThisRank+(p*NParAttInt+v)*load_data_size_int)) );
-      }
+            for (int v=0; v<NParAttInt; v++)
+            {
+               fseek( File, IntOffset + ( v*NParAllRank + ParOffset )*load_data_size_int, SEEK_SET );
 
-//    [att][id]
-      else
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((double*)(ParFltData_ThisRank+(v*NParThisRank+p)*load_data_size_flt)) );
-         else
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((float* )(ParFltData_ThisRank+(v*NParThisRank+p)*load_data_size_flt)) );
+               for (long p0=0; p0<NParThisRank; p0+=NParChunk)
+               {
+                  const long  NPar = MIN( NParChunk, NParThisRank-p0 );
+                        char *Ptr  = ( DirectInt ) ? (char*)( AttInt[v]+p0 ) : Buffer;
 
-         if ( PAR_IC_INT8 )
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((long*  )(ParIntData_ThisRank+(v*NParThisRank+p)*load_data_size_int)) );
-         else
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((int*   )(ParIntData_ThisRank+(v*NParThisRank+p)*load_data_size_int)) );
-      }
+                  if ( fread( Ptr, load_data_size_int, NPar, File ) != (size_t)NPar )
+                     Aux_Error( ERROR_INFO, "fail to load %ld particles from the file \"%s\" !!\n", NPar, FileName );
 
-//    assuming that the orders of the particle attributes stored on the disk and in Par->AttributeFlt/Int[] are the same
-//    --> no need to skip acceleration and time since they are always put at the end of the attribute list
-      for (int v_in=0, v_out=0; v_in<NParAttFlt; v_in++, v_out++)
-      {
-         if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
+                  if ( DirectInt )  continue;
 
-         amr->Par->AttributeFlt[v_out][p] = ParFltData1[v_in];
-      }
+                  if ( PAR_IC_INT8 )
+                     ConvertParICData<long>( AttInt[v]+p0, Buffer, NPar, sizeof(long) );
+                  else
+                     ConvertParICData<int >( AttInt[v]+p0, Buffer, NPar, sizeof(int ) );
+               }
+            }
 
-      for (int v_in=0, v_out=0; v_in<NParAttInt; v_in++, v_out++)
-      {
-         if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
+            delete [] Buffer;
+         } // if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT ) ... else ...
+
+         fclose( File );
+
+         if ( MPI_Rank == TRank0 )  Aux_Message( stdout, "done\n" );
+      } // if ( MPI_Rank >= TRank0  &&  MPI_Rank < TRank0+PAR_IC_LOAD_NRANK )
+
+      MPI_Barrier( MPI_COMM_WORLD );
+   } // for (int TRank0=0; TRank0<MPI_NRank; TRank0+=PAR_IC_LOAD_NRANK)
 
-         amr->Par->AttributeInt[v_out][p] = ParIntData1[v_in];
-      }
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... done\n" );
 
-      if ( SingleParMass )    amr->Par->Mass[p] = amr->Par->ParICMass;
-      if ( SingleParType )    amr->Par->Type[p] = amr->Par->ParICType;
 
-//    synchronize all particles to the physical time at the base level
-      amr->Par->Time[p] = Time[0];
-   } // for (long p=0; p<NParThisRank; p++)
+// set the attributes not stored in PAR_IC
+   if ( SingleParMass )
+      for (long p=0; p<NParThisRank; p++)    amr->Par->Mass[p] = amr->Par->ParICMass;
 
-   delete [] ParFltData_ThisRank;
-   delete [] ParIntData_ThisRank;
-   delete [] ParFltData1;
-   delete [] ParIntData1;
+   if ( SingleParType )
+      for (long p=0; p<NParThisRank; p++)    amr->Par->Type[p] = amr->Par->ParICType;
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+// synchronize all particles to the physical time at the base level
+   for (long p=0; p<NParThisRank; p++)       amr->Par->Time[p] = Time[0];
 
 } // FUNCTION : Par_Init_ByFile_Default
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ConvertParICData
+// Description :  Convert particle data loaded from PAR_IC to the data type of the particle repository
+//
+// Note        :  1. Invoked by Par_Init_ByFile_Default()
+//                2. Use memcpy() to load the input data since they may not be aligned for the
+//                   PAR_IC_FORMAT_ID_ATT format
+//                   --> Compilers can still vectorize the loop for contiguous input (i.e., Stride == sizeof(T_in))
+//
+// Parameter   :  Out    : Output array
+//                In     : Input buffer
+//                NPar   : Number of particles to be converted
+//                Stride : Distance in bytes between two adjacent particles in "In"
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+template <typename T_in, typename T_out>
+void ConvertParICData( T_out *Out, const char *In, const long NPar, const long Stride )
+{
+
+   for (long p=0; p<NPar; p++)
+   {
+      T_in tmp;
+      memcpy( &tmp, In+p*Stride, sizeof(T_in) );
+      Out[p] = (T_out)tmp;
+   }
+
+} // FUNCTION : ConvertParICData
+
+
+
 #endif // #ifdef PARTICLE
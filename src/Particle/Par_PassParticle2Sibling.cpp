@@ -24,6 +24,8 @@ extern Timer_t *Timer_Par_MPI[NLEVEL][6];
 //                   into the simulation domain if periodic B.C. is assumed
 //                3. Particles transferred to buffer patches (at either lv or lv-1) will be resent to their
 //                   corresponding real patches by calling Par_LB_ExchangeParticleBetweenPatch()
+//                4. Particles lying outside the active region are buffered by each OpenMP thread and then removed
+//                   by Particle_t::RemoveParticleBatch() without the critical construct
 //
 // Parameter   :  lv            : Target refinement level
 //                TimingSendPar : Measure the elapsed time of Par_LB_SendParticleData(), which is called by
@@ -48,7 +50,7 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
    real_par *ParPos[3]           = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
    const long_par *PType = amr->Par->Type;
 
-   int     NPar_Remove_Tot=0;
+   int     NPar_Remove_Tot=0, NPar_Outside_Tot=0;
    int     NPar, NGuess, NPar_Remove, ArraySize[26], ijk[3], Side, TSib, SibPID, FaPID, FaSib, FaSibPID;
    long    ParID;
    int    *RemoveParList;
@@ -68,7 +70,12 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
 #  pragma omp parallel private( NPar, NGuess, NPar_Remove, ArraySize, ijk, TSib, ParID, RemoveParList, EdgeL, EdgeR )
    {
 
-#  pragma omp for reduction( +:NPar_Remove_Tot ) schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+// particles lying outside the active region in all patches handled by this thread
+   int   NPar_Outside_Thread  = 0;
+   int   OutsideParListSize   = 0;
+   long *OutsideParList       = NULL;
+
+#  pragma omp for reduction( +:NPar_Remove_Tot, NPar_Outside_Tot ) schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
 // loop over all **real** patches
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
@@ -153,14 +160,17 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
          {
             RemoveParList[ NPar_Remove ++ ] = p;
             NPar_Remove_Tot ++;
+            NPar_Outside_Tot ++;
+
+//          record the particles to be removed by RemoveParticleBatch() after looping over all patches
+//          --> RemoveOneParticle() would modify NPar_Active/Inactive, which are global variables
+            if ( NPar_Outside_Thread >= OutsideParListSize )
+            {
+               OutsideParListSize = (int)ceil( PARLIST_GROWTH_FACTOR*(OutsideParListSize+1) );
+               OutsideParList     = (long*)realloc( OutsideParList, OutsideParListSize*sizeof(long) );
+            }
 
-//          use OpenMP critical construct since RemoveOneParticle will modify NPar_Active/Inactive, which are global variables
-//          --> note that the order of which thread calls RemoveOneParticle() is non-deterministic and may change from run to run
-//              --> order of particles stored in the particle repository (i.e., their particle ID) may change from run to run
-//              --> particle text file may change from run to run since it's dumped according to the order of particle ID
-//          --> but it's not an issue since the actual data of each particle will not be affected
-#           pragma omp critical
-            amr->Par->RemoveOneParticle( ParID, PAR_INACTIVE_OUTSIDE );
+            OutsideParList[ NPar_Outside_Thread ++ ] = ParID;
 
             if ( OPT__VERBOSE )
                Aux_Message( stderr, "\nWARNING : removing particle %10d (Pos = [%14.7e, %14.7e, %14.7e], Time = %13.7e)\n",
@@ -226,6 +236,29 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
 
    } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
 
+
+// remove particles lying outside the active region
+// --> the implicit barrier of the worksharing loop above ensures that NPar_Outside_Tot is complete
+// --> each thread claims a block of InactiveParList[] by an atomic operation instead of the critical construct
+// --> note that the order of removed particles stored in InactiveParList[] is non-deterministic and may change
+//     from run to run
+//     --> order of particles stored in the particle repository (i.e., their particle ID) may change from run to run
+//     --> particle text file may change from run to run since it's dumped according to the order of particle ID
+// --> but it's not an issue since the actual data of each particle will not be affected
+   if ( NPar_Outside_Tot > 0 )
+   {
+#     pragma omp single
+      amr->Par->BeginRemoveBatch( NPar_Outside_Tot );
+
+      amr->Par->RemoveParticleBatch( NPar_Outside_Thread, OutsideParList, PAR_INACTIVE_OUTSIDE );
+
+#     pragma omp barrier
+#     pragma omp single nowait
+      amr->Par->EndRemoveBatch();
+   }
+
+   free( OutsideParList );
+
    } // end of OpenMP parallel region
 
 
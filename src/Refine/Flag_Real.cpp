@@ -4,7 +4,7 @@ void Flag_Grandson( const int lv, const int PID, const int LocalID );
 void Prepare_for_Lohner( const OptLohnerForm_t Form, const real *Var1D, real *Ave1D, real *Slope1D, const int NVar );
 
 #if ( MODEL == ELBDM )
-void Prepare_for_Spectral_Criterion( const real *Var1D, real& Cond1D );
+void Prepare_for_Spectral_Criterion( const real *Var1D, const real Threshold, double *Work, real& Cond1D );
 #endif
 
 
@@ -195,6 +195,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       real *Lohner_Slope                 = NULL;   // array storing the slopes of Lohner_Var for Lohner
       real *Interf_Var                   = NULL;   // array storing the density and phase for the interference criterion
       real *Spectral_Var                 = NULL;   // array storing a patch group of real and imaginary parts for the spectral criterion
+      double *Spectral_Work              = NULL;   // work array of Prepare_for_Spectral_Criterion() (always in double precision)
       real  Spectral_Cond                = 0.0;    // variable storing the magnitude of the largest coefficient for the spectral criterion
 
       int  i_start, i_end, j_start, j_end, k_start, k_end, SibID, SibPID, PID;
@@ -227,7 +228,10 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 
 #     if ( MODEL == ELBDM )
       if ( Spectral_NVar > 0 )
-         Spectral_Var = new real [ Spectral_NVar*CUBE(Spectral_NCell) ];   // prepare one patch group
+      {
+         Spectral_Var  = new real   [ Spectral_NVar*CUBE(Spectral_NCell) ];  // prepare one patch group
+         Spectral_Work = new double [ (Spectral_NCell+2)*SQR(PS2) ];         // 2: left/right coefficients
+      }
 #     endif
 
 #     if ( ELBDM_SCHEME == ELBDM_HYBRID )
@@ -263,7 +267,8 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                                MinDens, MinPres, MinTemp, MinEntr, DE_Consistency_No );
 
 //          evaluate the spectral refinement criterion
-            Prepare_for_Spectral_Criterion( Spectral_Var, Spectral_Cond );
+//          --> return early once the patch group must be flagged
+            Prepare_for_Spectral_Criterion( Spectral_Var, FlagTable_Spectral[lv][0], Spectral_Work, Spectral_Cond );
          }
 #        endif
 
@@ -714,6 +719,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       delete [] Lohner_Slope;
       delete [] Interf_Var;
       delete [] Spectral_Var;
+      delete [] Spectral_Work;
 
    } // OpenMP parallel region
 
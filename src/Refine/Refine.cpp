@@ -24,6 +24,11 @@ void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 {
 
+// discard the dt recorded for OPT__DT_FUSED on the son level since its patches are going to change
+#  if ( MODEL == HYDRO )
+   dt_Fused_Invalidate( lv+1 );
+#  endif
+
 // invoke the load-balance refine function
 #  ifdef LOAD_BALANCE
    if ( UseLBFunc == USELB_YES )
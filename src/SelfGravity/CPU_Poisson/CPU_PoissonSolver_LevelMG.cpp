@@ -0,0 +1,990 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+// number of smoothing steps in each V-cycle
+#define NPRE_SMOOTH       2
+#define NPOST_SMOOTH      2
+
+// relative L2 residual of the conjugate-gradient solver on the bottom multigrid level
+#define BOTTOM_TOLERANCE  1.0e-8
+
+// maximum number of multigrid levels (PS1 --> 1 cell per patch)
+#define MAX_NLV          10
+
+// index of the cell (i,j,k) in the patch P of a multigrid level with the grid width w (including ghost zones)
+#define IDX( P, k, j, i, w )     ( ( (long)(P)*(w) + (k) )*(w)*(w) + (j)*(w) + (i) )
+
+static void FillGhost( real *Sol, const int lv, const int SaveSg, const int NReal, const int N, const bool Exchange );
+static void Smoothing( real *Sol, const real *RHS, const int lv, const int SaveSg, const int NReal, const int N,
+                       const int MGLv, const real dh );
+static double GetError( real *Sol, const real *RHS, real *Def, const int lv, const int SaveSg, const int NReal,
+                        const int N, const real dh );
+static void ComputeDefect( const real *Sol, const real *RHS, real *Def, const int NReal, const int N, const real dh,
+                           double &SumDef, double &SumSol );
+static void Restrict( const real *Def_F, real *RHS_C, const int NReal, const int N_F );
+static void Prolongate_and_Correct( const real *Sol_C, real *Sol_F, const int lv, const int NReal, const int N_F );
+static void ExchangeBuffer( const real *Sol, const int lv, const int SaveSg, const int NReal, const int N );
+static void BottomSolver_Init( const int lv, const int NReal, long &NAll, long &Disp, int *Count, int *Displ,
+                               long (**Nbr)[6], bool &Singular );
+static void BottomSolver( real *Sol, const real *RHS, const int NReal, const real dh, const long NAll, const long Disp,
+                          const int *Count, const int *Displ, const long (*Nbr)[6], const bool Singular );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_PoissonSolver_LevelMG
+// Description :  Solve the Poisson equation on all patches of a refinement level "lv > 0" together by a
+//                level-wide geometric multigrid scheme (OPT__LEVEL_MG)
+//
+// Note        :  1. Invoked by Gra_AdvanceDt() and Bench_LevelMG()
+//                2. Unlike CPU_PoissonSolver_SOR/MG(), which solve each patch independently on a POT_NXT^3 block
+//                   padded with POT_GHOST_SIZE ghost zones, here each patch only stores a single layer of
+//                   ghost zones filled by its sibling patches
+//                   --> Only the ghost zones without a sibling patch adopt the coarse-grid potential as the
+//                       Dirichlet boundary condition
+//                   --> On the coarser multigrid levels, the correction vanishes on the patch faces without
+//                       a sibling patch (i.e., ghost = -interior), so that the boundary is located at the same
+//                       position on all multigrid levels
+//                3. Multigrid hierarchy
+//                   --> The multigrid level MGLv stores (PS1>>MGLv)^3 cells per patch down to a single cell per
+//                       patch, so that the sibling relation of all multigrid levels is the same as that of "lv"
+//                   --> Cell-centered restriction (8-cell average) and trilinear prolongation
+//                   --> Red-black Gauss-Seidel smoothing with a level-wide coloring
+//                   --> The bottom level (one cell per patch) is solved to BOTTOM_TOLERANCE by a conjugate-gradient
+//                       solver on all ranks (see BottomSolver()), so that the convergence rate of the V-cycles
+//                       does not deteriorate with the number of patches
+//                4. Sibling buffer patches
+//                   --> Their solution is exchanged by Buf_GetBufferData() once per smoothing step and before
+//                       computing the defect and prolongation (see FillGhost())
+//                   --> The second color of each red-black sweep thus uses the solution of the first color on
+//                       other ranks from the previous exchange
+//                5. Error is estimated by the L1 norm of the defect in the same way as CPU_PoissonSolver_MG()
+//                   --> Iterate until either the error < LEVEL_MG_TOLERATED_ERROR or the number of V-cycles
+//                       reaches MaxIter
+//                6. The output potential excludes the ghost zones and includes the external potential
+//                   (if OPT__EXT_POT is on)
+//                   --> The caller must collect the potential of buffer patches and set pot_ext[] afterwards
+//                7. Use the host arrays h_Rho_Array_P[0] and h_Pot_Array_P_In[0] of the per-patch solvers
+//                   as the temporary arrays for preparing density and coarse-grid potential
+//                8. Always run on CPUs, even in the GPU mode
+//
+// Parameter   :  lv           : Target refinement level (>0)
+//                Poi_Coeff    : Coefficient in front of the RHS in the Poisson eq.
+//                SaveSg       : Sandglass to store the updated potential
+//                PrepTime     : Physical time to prepare density and coarse-grid potential
+//                MaxIter      : Maximum number of V-cycles
+//                GuessFromPot : Use the potential already stored in amr->patch->pot[SaveSg] as the initial guess
+//                               --> Otherwise use the interpolated coarse-grid potential
+//                               --> Used by Bench_LevelMG() to evaluate the error of the per-patch solvers
+//                ErrHist      : Array to store the error of the initial guess and after each V-cycle
+//                               --> Must have at least MaxIter+1 elements
+//                               --> Do not warn about the unconverged solution if ErrHist != NULL
+//                               --> Set to NULL to skip evaluating the error of the initial guess
+//
+// Return      :  amr->patch->pot[], ErrHist[], number of V-cycles
+//-------------------------------------------------------------------------------------------------------
+int CPU_PoissonSolver_LevelMG( const int lv, const real Poi_Coeff, const int SaveSg, const double PrepTime,
+                               const int MaxIter, const bool GuessFromPot, double *ErrHist )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( lv == 0 )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+
+   if ( SaveSg != 0  &&  SaveSg != 1 )
+      Aux_Error( ERROR_INFO, "incorrect SaveSg (%d) !!\n", SaveSg );
+#  endif
+
+
+// nothing to do if there is no patch on this level
+// --> NPatchTotal[] is the same for all ranks, so it is safe to return here before any MPI communication
+   if ( NPatchTotal[lv] == 0 )   return 0;
+
+
+   const int NReal    = amr->NPatchComma[lv][1];
+   const int NPG_Real = NReal/8;
+
+
+// set the depth of the multigrid hierarchy
+// --> PS1 is a power of two (checked by Aux_Check_Parameter()), so the bottom level has one cell per patch
+   int  NLv=0, N[MAX_NLV];
+   real dh[MAX_NLV];
+
+   for (int n=PS1; n>=1  &&  NLv<MAX_NLV; n/=2)
+   {
+      N [NLv] = n;
+      dh[NLv] = amr->dh[lv]*(PS1/n);
+      NLv ++;
+   }
+
+   const int BottomLv = NLv - 1;
+
+#  ifdef GAMER_DEBUG
+   if ( N[BottomLv] != 1 )
+      Aux_Error( ERROR_INFO, "bottom multigrid level has %d cells per patch (PS1 = %d) !!\n", N[BottomLv], PS1 );
+#  endif
+
+
+// allocate the multigrid arrays (including one ghost zone on each side)
+   real *Sol[MAX_NLV], *RHS[MAX_NLV], *Def[MAX_NLV];
+
+   for (int MGLv=0; MGLv<NLv; MGLv++)
+   {
+      const long NCell = (long)CUBE( N[MGLv]+2 );
+
+      Sol[MGLv] = new real [ NReal*NCell ];
+      RHS[MGLv] = new real [ NReal*NCell ];
+      Def[MGLv] = new real [ NReal*NCell ];
+   }
+
+
+// 1. prepare density and coarse-grid potential (as the initial guess and B.C.) by the per-patch routines
+   const int  NPG_Max  = POT_GPU_NPGROUP;
+   const int  CGhost   = ( POT_GHOST_SIZE + 3 )/2;
+   const int  FSize    = PS1 + 4;
+   const int  W0       = PS1 + 2;
+   const bool Mono_No  = false;
+   const int  CSize3[3]  = { POT_NXT, POT_NXT, POT_NXT };
+   const int  CStart3[3] = { CGhost-1, CGhost-1, CGhost-1 };
+   const int  CRange3[3] = { PS1/2+2, PS1/2+2, PS1/2+2 };
+   const int  FSize3[3]  = { FSize, FSize, FSize };
+   const int  FStart3[3] = { 0, 0, 0 };
+
+   int *PID0_List = new int [NPG_Max];
+
+   for (int Disp=0; Disp<NPG_Real; Disp+=NPG_Max)
+   {
+      const int NPG = MIN( NPG_Max, NPG_Real-Disp );
+
+      for (int t=0; t<NPG; t++)  PID0_List[t] = 8*( Disp + t );
+
+      Poi_Prepare_Rho( lv, PrepTime, h_Rho_Array_P   [0], NPG, PID0_List );
+      Poi_Prepare_Pot( lv, PrepTime, h_Pot_Array_P_In[0], NPG, PID0_List );
+
+#     pragma omp parallel
+      {
+         real (*FData)[FSize][FSize] = new real [FSize][FSize][FSize];
+
+#        pragma omp for schedule( static )
+         for (int t=0; t<8*NPG; t++)
+         {
+            const int PID = 8*Disp + t;
+
+//          RHS
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+               RHS[0][ IDX(PID,k+1,j+1,i+1,W0) ]
+                  = Poi_Coeff*h_Rho_Array_P[0][t][k+RHO_GHOST_SIZE][j+RHO_GHOST_SIZE][i+RHO_GHOST_SIZE];
+
+//          interpolated coarse-grid potential including one ghost zone on each side
+            Interpolate( h_Pot_Array_P_In[0][t][0][0], CSize3, CStart3, CRange3, FData[0][0], FSize3, FStart3,
+                         1, OPT__POT_INT_SCHEME, false, &Mono_No, false, ALL_CONS_NO, INT_PRIM_NO,
+                         INT_FIX_MONO_COEFF, NULL, NULL );
+
+            for (int k=0; k<W0; k++)
+            for (int j=0; j<W0; j++)
+            for (int i=0; i<W0; i++)
+               Sol[0][ IDX(PID,k,j,i,W0) ] = FData[k+1][j+1][i+1];
+         }
+
+         delete [] FData;
+      } // OpenMP parallel region
+   } // for (int Disp=0; Disp<NPG_Real; Disp+=NPG_Max)
+
+   delete [] PID0_List;
+
+
+// replace the initial guess by the existing potential excluding the external potential
+// --> must be done before ExchangeBuffer(), which overwrites amr->patch->pot[SaveSg]
+   const double dh_2 = 0.5*amr->dh[lv];
+
+   if ( GuessFromPot )
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<NReal; PID++)
+      {
+         const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + dh_2;
+         const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + dh_2;
+         const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + dh_2;
+
+         for (int k=0; k<PS1; k++)  {  const double z = z0 + k*amr->dh[lv];
+         for (int j=0; j<PS1; j++)  {  const double y = y0 + j*amr->dh[lv];
+         for (int i=0; i<PS1; i++)  {  const double x = x0 + i*amr->dh[lv];
+
+            Sol[0][ IDX(PID,k+1,j+1,i+1,W0) ] = amr->patch[SaveSg][lv][PID]->pot[k][j][i];
+
+            if ( OPT__EXT_POT )
+               Sol[0][ IDX(PID,k+1,j+1,i+1,W0) ] -= CPUExtPot_Ptr( x, y, z, PrepTime, ExtPot_AuxArray_Flt,
+                                                                   ExtPot_AuxArray_Int, EXT_POT_USAGE_ADD,
+                                                                   h_ExtPotTable, h_ExtPotGenePtr );
+         }}}
+      } // for (int PID=0; PID<NReal; PID++)
+   } // if ( GuessFromPot )
+
+
+// 2. V-cycles
+   const bool Exchange_Yes = true;
+
+// set the neighbour table of the bottom level
+   long   NAll, Disp;
+   int   *Count = new int [MPI_NRank];
+   int   *Displ = new int [MPI_NRank];
+   long (*Nbr)[6] = NULL;
+   bool   Singular;
+
+   BottomSolver_Init( lv, NReal, NAll, Disp, Count, Displ, &Nbr, Singular );
+
+   int    Iter  = 0;
+   double Error = ( ErrHist == NULL ) ? __FLT_MAX__ : GetError( Sol[0], RHS[0], Def[0], lv, SaveSg, NReal, N[0], dh[0] );
+
+   if ( ErrHist != NULL )  ErrHist[0] = Error;
+
+   while ( Iter < MaxIter  &&  Error > LEVEL_MG_TOLERATED_ERROR )
+   {
+//    finer --> coarser levels
+      for (int MGLv=0; MGLv<BottomLv; MGLv++)
+      {
+         double SumDef, SumSol;
+
+         for (int s=0; s<NPRE_SMOOTH; s++)
+            Smoothing( Sol[MGLv], RHS[MGLv], lv, SaveSg, NReal, N[MGLv], MGLv, dh[MGLv] );
+
+         FillGhost( Sol[MGLv], lv, SaveSg, NReal, N[MGLv], Exchange_Yes );
+         ComputeDefect( Sol[MGLv], RHS[MGLv], Def[MGLv], NReal, N[MGLv], dh[MGLv], SumDef, SumSol );
+         Restrict( Def[MGLv], RHS[MGLv+1], NReal, N[MGLv] );
+
+//       initialize the correction on the coarser level as zero
+         const long NCell = (long)NReal*CUBE( N[MGLv+1]+2 );
+#        pragma omp parallel for schedule( static )
+         for (long t=0; t<NCell; t++)  Sol[MGLv+1][t] = (real)0.0;
+      }
+
+//    bottom level (including its ghost zones)
+      BottomSolver( Sol[BottomLv], RHS[BottomLv], NReal, dh[BottomLv], NAll, Disp, Count, Displ, Nbr, Singular );
+
+//    coarser --> finer levels
+      for (int MGLv=BottomLv-1; MGLv>=0; MGLv--)
+      {
+         if ( MGLv+1 < BottomLv )
+            FillGhost( Sol[MGLv+1], lv, SaveSg, NReal, N[MGLv+1], Exchange_Yes );
+         Prolongate_and_Correct( Sol[MGLv+1], Sol[MGLv], lv, NReal, N[MGLv] );
+
+         for (int s=0; s<NPOST_SMOOTH; s++)
+            Smoothing( Sol[MGLv], RHS[MGLv], lv, SaveSg, NReal, N[MGLv], MGLv, dh[MGLv] );
+      }
+
+//    estimate the level-wide error
+      Error = GetError( Sol[0], RHS[0], Def[0], lv, SaveSg, NReal, N[0], dh[0] );
+      Iter ++;
+
+      if ( ErrHist != NULL )  ErrHist[Iter] = Error;
+   } // while ( Iter < MaxIter  &&  Error > LEVEL_MG_TOLERATED_ERROR )
+
+   if ( MPI_Rank == 0  &&  ErrHist == NULL )
+   {
+      if ( Error > LEVEL_MG_TOLERATED_ERROR )
+         Aux_Message( stderr, "WARNING : lv %d exceeds the maximum tolerated error after %d V-cycles (error = %13.7e) !!\n",
+                      lv, Iter, Error );
+
+      else if ( OPT__VERBOSE )
+         Aux_Message( stdout, "   Lv %2d: level-wide multigrid converges in %d V-cycles (error = %13.7e)\n",
+                      lv, Iter, Error );
+   }
+
+
+// 3. store the solution and add external potential
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + dh_2;
+      const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + dh_2;
+      const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + dh_2;
+
+      for (int k=0; k<PS1; k++)  {  const double z = z0 + k*amr->dh[lv];
+      for (int j=0; j<PS1; j++)  {  const double y = y0 + j*amr->dh[lv];
+      for (int i=0; i<PS1; i++)  {  const double x = x0 + i*amr->dh[lv];
+
+         amr->patch[SaveSg][lv][PID]->pot[k][j][i] = Sol[0][ IDX(PID,k+1,j+1,i+1,W0) ];
+
+         if ( OPT__EXT_POT )
+            amr->patch[SaveSg][lv][PID]->pot[k][j][i] += CPUExtPot_Ptr( x, y, z, PrepTime, ExtPot_AuxArray_Flt,
+                                                                        ExtPot_AuxArray_Int, EXT_POT_USAGE_ADD,
+                                                                        h_ExtPotTable, h_ExtPotGenePtr );
+      }}}
+   } // for (int PID=0; PID<NReal; PID++)
+
+
+// free memory
+   for (int MGLv=0; MGLv<NLv; MGLv++)
+   {
+      delete [] Sol[MGLv];
+      delete [] RHS[MGLv];
+      delete [] Def[MGLv];
+   }
+
+   delete [] Count;
+   delete [] Displ;
+   delete [] Nbr;
+
+   return Iter;
+
+} // FUNCTION : CPU_PoissonSolver_LevelMG
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FillGhost
+// Description :  Fill up the ghost zones of all real patches from their sibling patches
+//
+// Note        :  1. Only the six face siblings are required by the 7-point Laplacian
+//                2. Ghost zones without a sibling patch
+//                   --> Finest multigrid level (N == PS1): not modified, which store the coarse-grid potential
+//                   --> Coarser multigrid levels: set to the opposite of the adjacent interior cells so that the
+//                       correction vanishes on the patch faces
+//                3. Sibling buffer patches are read from amr->patch->pot[SaveSg] directly
+//                   --> Exchange == true: invoke ExchangeBuffer() first to collect their current solution
+//                       Exchange == false: reuse the data of the previous exchange on the same multigrid level
+//
+// Parameter   :  Sol      : Array storing the solution of the target multigrid level
+//                lv       : Target AMR level
+//                SaveSg   : Sandglass of the potential used as the temporary storage of ExchangeBuffer()
+//                NReal    : Number of real patches
+//                N        : Number of cells per patch in each direction on the target multigrid level
+//                Exchange : Collect the solution of the sibling buffer patches from other ranks
+//-------------------------------------------------------------------------------------------------------
+void FillGhost( real *Sol, const int lv, const int SaveSg, const int NReal, const int N, const bool Exchange )
+{
+
+   const int W = N + 2;
+
+   if ( Exchange )   ExchangeBuffer( Sol, lv, SaveSg, NReal, N );
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int s=0; s<6; s++)
+      {
+         const int SibPID = amr->patch[0][lv][PID]->sibling[s];
+         const int d      = s/2;
+         const int Ghost  = ( s%2 == 0 ) ? 0 : N+1;   // ghost layer of the target patch
+         const int Source = ( s%2 == 0 ) ? N : 1;     // interior layer of the sibling patch
+
+//       no sibling patch
+         if ( SibPID < 0 )
+         {
+            if ( N == PS1 )   continue;
+
+            const int Inner = ( s%2 == 0 ) ? 1 : N;   // interior layer of the target patch
+
+            for (int b=1; b<=N; b++)
+            for (int a=1; a<=N; a++)
+            {
+               switch ( d )
+               {
+                  case 0:  Sol[ IDX(PID,b,a,Ghost,W) ] = -Sol[ IDX(PID,b,a,Inner,W) ];  break;
+                  case 1:  Sol[ IDX(PID,b,Ghost,a,W) ] = -Sol[ IDX(PID,b,Inner,a,W) ];  break;
+                  case 2:  Sol[ IDX(PID,Ghost,b,a,W) ] = -Sol[ IDX(PID,Inner,b,a,W) ];  break;
+               }
+            }
+         }
+
+//       real sibling patches
+         else if ( SibPID < NReal )
+         {
+            for (int b=1; b<=N; b++)
+            for (int a=1; a<=N; a++)
+            {
+               switch ( d )
+               {
+                  case 0:  Sol[ IDX(PID,b,a,Ghost,W) ] = Sol[ IDX(SibPID,b,a,Source,W) ];  break;
+                  case 1:  Sol[ IDX(PID,b,Ghost,a,W) ] = Sol[ IDX(SibPID,b,Source,a,W) ];  break;
+                  case 2:  Sol[ IDX(PID,Ghost,b,a,W) ] = Sol[ IDX(SibPID,Source,b,a,W) ];  break;
+               }
+            }
+         }
+
+//       sibling buffer patches (see ExchangeBuffer() for the data layout)
+         else
+         {
+            const real (*Pot)[PS1][PS1] = amr->patch[SaveSg][lv][SibPID]->pot;
+            const int   Src             = ( s%2 == 0 ) ? PS1-1 : 0;
+
+            for (int b=1; b<=N; b++)
+            for (int a=1; a<=N; a++)
+            {
+               switch ( d )
+               {
+                  case 0:  Sol[ IDX(PID,b,a,Ghost,W) ] = Pot[b-1][a-1][Src];  break;
+                  case 1:  Sol[ IDX(PID,b,Ghost,a,W) ] = Pot[b-1][Src][a-1];  break;
+                  case 2:  Sol[ IDX(PID,Ghost,b,a,W) ] = Pot[Src][b-1][a-1];  break;
+               }
+            }
+         }
+      } // for (int s=0; s<6; s++)
+   } // for (int PID=0; PID<NReal; PID++)
+
+} // FUNCTION : FillGhost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Smoothing
+// Description :  Apply one level-wide red-black Gauss-Seidel sweep
+//
+// Note        :  1. The color is determined by the global cell indices so that the sweep is identical to
+//                   that on a single uniform grid
+//                2. Refill the ghost zones before updating each color
+//                   --> Only exchange the sibling buffer patches before the first color to reduce the
+//                       number of MPI exchanges
+//
+// Parameter   :  Sol    : Array storing the solution of the target multigrid level
+//                RHS    : Array storing the RHS of the target multigrid level
+//                lv     : Target AMR level
+//                SaveSg : Sandglass of the potential used as the temporary storage of ExchangeBuffer()
+//                NReal  : Number of real patches
+//                N      : Number of cells per patch in each direction on the target multigrid level
+//                MGLv   : Target multigrid level
+//                dh     : Cell size on the target multigrid level
+//-------------------------------------------------------------------------------------------------------
+void Smoothing( real *Sol, const real *RHS, const int lv, const int SaveSg, const int NReal, const int N,
+                const int MGLv, const real dh )
+{
+
+   const int  W       = N + 2;
+   const real dh2     = dh*dh;
+   const real One_Six = (real)1.0/(real)6.0;
+
+   for (int Color=0; Color<2; Color++)
+   {
+      FillGhost( Sol, lv, SaveSg, NReal, N, Color == 0 );
+
+#     pragma omp parallel for schedule( static )
+      for (int PID=0; PID<NReal; PID++)
+      {
+         int Parity = Color;
+         for (int d=0; d<3; d++)    Parity += ( amr->patch[0][lv][PID]->corner[d]/amr->scale[lv] ) >> MGLv;
+
+         for (int k=1; k<=N; k++)
+         for (int j=1; j<=N; j++)
+         for (int i=1+(k+j+Parity)%2; i<=N; i+=2)
+         {
+            const long Idx = IDX( PID, k, j, i, W );
+
+            Sol[Idx] = One_Six*(   Sol[Idx+W*W] + Sol[Idx-W*W] + Sol[Idx+W] + Sol[Idx-W] + Sol[Idx+1] + Sol[Idx-1]
+                                 - dh2*RHS[Idx] );
+         }
+      } // for (int PID=0; PID<NReal; PID++)
+   } // for (int Color=0; Color<2; Color++)
+
+} // FUNCTION : Smoothing
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetError
+// Description :  Estimate the level-wide error of the solution on the finest multigrid level
+//
+// Note        :  1. Error = dh^2*L1(defect)/L1(solution) summed over all ranks, which is the same estimate as
+//                   CPU_PoissonSolver_MG()
+//                2. Fill up the ghost zones (including the sibling buffer patches) in advance
+//                3. Also store the defect in Def[]
+//
+// Parameter   :  Sol    : Array storing the solution of the finest multigrid level
+//                RHS    : Array storing the RHS of the finest multigrid level
+//                Def    : Array to store the defect
+//                lv     : Target AMR level
+//                SaveSg : Sandglass of the potential used as the temporary storage of ExchangeBuffer()
+//                NReal  : Number of real patches
+//                N      : Number of cells per patch in each direction on the finest multigrid level
+//                dh     : Cell size on the finest multigrid level
+//
+// Return      :  Level-wide error
+//-------------------------------------------------------------------------------------------------------
+double GetError( real *Sol, const real *RHS, real *Def, const int lv, const int SaveSg, const int NReal,
+                 const int N, const real dh )
+{
+
+   const bool Exchange_Yes = true;
+
+   double SumDef, SumSol;
+
+   FillGhost( Sol, lv, SaveSg, NReal, N, Exchange_Yes );
+   ComputeDefect( Sol, RHS, Def, NReal, N, dh, SumDef, SumSol );
+
+#  ifndef SERIAL
+   double Sum_ThisRank[2] = { SumDef, SumSol }, Sum_AllRank[2];
+   MPI_Allreduce( Sum_ThisRank, Sum_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+   SumDef = Sum_AllRank[0];
+   SumSol = Sum_AllRank[1];
+#  endif
+
+   return ( SumSol > 0.0 ) ? SQR(dh)*SumDef/SumSol : 0.0;
+
+} // FUNCTION : GetError
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ComputeDefect
+// Description :  Compute the defect "RHS - Laplacian(Sol)" of all real patches
+//
+// Note        :  1. Ghost zones of Sol[] must be filled in advance
+//                2. Also return the L1 norms of the defect and solution of this rank for estimating error
+//
+// Parameter   :  Sol    : Array storing the solution of the target multigrid level
+//                RHS    : Array storing the RHS of the target multigrid level
+//                Def    : Array to store the defect
+//                NReal  : Number of real patches
+//                N      : Number of cells per patch in each direction on the target multigrid level
+//                dh     : Cell size on the target multigrid level
+//                SumDef : L1 norm of the defect to be returned
+//                SumSol : L1 norm of the solution to be returned
+//-------------------------------------------------------------------------------------------------------
+void ComputeDefect( const real *Sol, const real *RHS, real *Def, const int NReal, const int N, const real dh,
+                    double &SumDef, double &SumSol )
+{
+
+   const int  W    = N + 2;
+   const real _dh2 = (real)1.0/(dh*dh);
+
+   double SumDef_t = 0.0, SumSol_t = 0.0;
+
+#  pragma omp parallel for reduction( +:SumDef_t, SumSol_t ) schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int k=1; k<=N; k++)
+      for (int j=1; j<=N; j++)
+      for (int i=1; i<=N; i++)
+      {
+         const long Idx = IDX( PID, k, j, i, W );
+
+         Def[Idx] = RHS[Idx] - _dh2*(   Sol[Idx+W*W] + Sol[Idx-W*W] + Sol[Idx+W] + Sol[Idx-W] + Sol[Idx+1] + Sol[Idx-1]
+                                      - (real)6.0*Sol[Idx] );
+
+         SumDef_t += FABS( Def[Idx] );
+         SumSol_t += FABS( Sol[Idx] );
+      }
+   }
+
+   SumDef = SumDef_t;
+   SumSol = SumSol_t;
+
+} // FUNCTION : ComputeDefect
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Restrict
+// Description :  Restrict the defect to the RHS on the next coarser multigrid level by averaging 8 cells
+//
+// Parameter   :  Def_F : Array storing the fine-grid defect
+//                RHS_C : Array to store the coarse-grid RHS
+//                NReal : Number of real patches
+//                N_F   : Number of fine-grid cells per patch in each direction
+//-------------------------------------------------------------------------------------------------------
+void Restrict( const real *Def_F, real *RHS_C, const int NReal, const int N_F )
+{
+
+   const int  N_C  = N_F/2;
+   const int  W_F  = N_F + 2;
+   const int  W_C  = N_C + 2;
+   const real _8   = (real)0.125;
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int K=1; K<=N_C; K++)    {  const int k = 2*K - 1;
+      for (int J=1; J<=N_C; J++)    {  const int j = 2*J - 1;
+      for (int I=1; I<=N_C; I++)    {  const int i = 2*I - 1;
+
+         const long Idx = IDX( PID, k, j, i, W_F );
+
+         RHS_C[ IDX(PID,K,J,I,W_C) ] = _8*(   Def_F[Idx            ] + Def_F[Idx            +1]
+                                            + Def_F[Idx        +W_F] + Def_F[Idx        +W_F+1]
+                                            + Def_F[Idx+W_F*W_F    ] + Def_F[Idx+W_F*W_F    +1]
+                                            + Def_F[Idx+W_F*W_F+W_F] + Def_F[Idx+W_F*W_F+W_F+1] );
+      }}}
+   }
+
+} // FUNCTION : Restrict
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prolongate_and_Correct
+// Description :  Prolongate the coarse-grid correction by trilinear interpolation and add it to the fine-grid
+//                solution
+//
+// Note        :  Ghost zones of Sol_C[] must be filled in advance
+//
+// Parameter   :  Sol_C : Array storing the coarse-grid correction
+//                Sol_F : Array storing the fine-grid solution to be corrected
+//                lv    : Target AMR level
+//                NReal : Number of real patches
+//                N_F   : Number of fine-grid cells per patch in each direction
+//-------------------------------------------------------------------------------------------------------
+void Prolongate_and_Correct( const real *Sol_C, real *Sol_F, const int lv, const int NReal, const int N_F )
+{
+
+   const int  W_F      = N_F + 2;
+   const int  W_C      = N_F/2 + 2;
+   const real Wei[2]   = { (real)0.75, (real)0.25 };
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int k=1; k<=N_F; k++)    {  const int K = (k+1)/2;   const int dK = ( k%2 ) ? -1 : +1;
+      for (int j=1; j<=N_F; j++)    {  const int J = (j+1)/2;   const int dJ = ( j%2 ) ? -1 : +1;
+      for (int i=1; i<=N_F; i++)    {  const int I = (i+1)/2;   const int dI = ( i%2 ) ? -1 : +1;
+
+         real Corr = (real)0.0;
+
+         for (int c=0; c<2; c++)
+         for (int b=0; b<2; b++)
+         for (int a=0; a<2; a++)
+            Corr += Wei[c]*Wei[b]*Wei[a]*Sol_C[ IDX(PID,K+c*dK,J+b*dJ,I+a*dI,W_C) ];
+
+         Sol_F[ IDX(PID,k,j,i,W_F) ] += Corr;
+      }}}
+   }
+
+} // FUNCTION : Prolongate_and_Correct
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ExchangeBuffer
+// Description :  Collect the solution of the sibling buffer patches on the target multigrid level from other ranks
+//
+// Note        :  1. Store the solution of real patches in amr->patch->pot[SaveSg] and invoke Buf_GetBufferData()
+//                   --> FillGhost() then reads the data of buffer patches from amr->patch->pot[SaveSg]
+//                2. Only one cell layer adjacent to the real patches is transferred
+//                   --> For N < PS1, the cell (i,j,k) is stored in pot[k'][j'][i'] for all i'/j'/k' with
+//                       MIN(i',N-1) == i and so on, so that the first and last layers along each direction
+//                       still lie at pot index 0 and PS1-1
+//                3. Do nothing in the serial mode
+//
+// Parameter   :  Sol    : Array storing the solution of the target multigrid level
+//                lv     : Target AMR level
+//                SaveSg : Sandglass of the potential used as the temporary storage
+//                NReal  : Number of real patches
+//                N      : Number of cells per patch in each direction on the target multigrid level
+//-------------------------------------------------------------------------------------------------------
+void ExchangeBuffer( const real *Sol, const int lv, const int SaveSg, const int NReal, const int N )
+{
+
+#  ifndef SERIAL
+   const int W         = N + 2;
+   const int ParaBuf_1 = 1;
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int k=0; k<PS1; k++)  {  const int kk = MIN( k, N-1 ) + 1;
+      for (int j=0; j<PS1; j++)  {  const int jj = MIN( j, N-1 ) + 1;
+      for (int i=0; i<PS1; i++)  {  const int ii = MIN( i, N-1 ) + 1;
+         amr->patch[SaveSg][lv][PID]->pot[k][j][i] = Sol[ IDX(PID,kk,jj,ii,W) ];
+      }}}
+   }
+
+   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg, POT_FOR_POISSON, _POTE, _NONE, ParaBuf_1, USELB_YES );
+#  endif // #ifndef SERIAL
+
+} // FUNCTION : ExchangeBuffer
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BottomSolver_Init
+// Description :  Set the neighbour table of the bottom multigrid level for BottomSolver()
+//
+// Note        :  1. The bottom level has one cell per patch, and the cells of all ranks are stored in the
+//                   rank order
+//                   --> The cell of the real patch PID of this rank is stored at Disp+PID
+//                2. Neighbours are identified by the patch indices in the simulation box gathered from all ranks
+//                   --> Invoked once per solve since the patch distribution does not change during the V-cycles
+//                   --> Nbr[c][s] = -1 if the patch has no sibling in direction s, for which the correction
+//                       vanishes on the patch face (see FillGhost())
+//                3. Singular == true if no patch has a missing sibling (e.g., a fully refined periodic level),
+//                   for which the solution is only defined up to a constant
+//
+// Parameter   :  lv       : Target AMR level
+//                NReal    : Number of real patches on this rank
+//                NAll     : Total number of real patches on all ranks
+//                Disp     : Index of the first real patch of this rank
+//                Count    : Number of real patches on each rank
+//                Displ    : Index of the first real patch of each rank
+//                Nbr      : Neighbour table to be allocated
+//                Singular : Whether the linear system is singular
+//
+// Return      :  NAll, Disp, Count[], Displ[], Nbr, Singular
+//-------------------------------------------------------------------------------------------------------
+void BottomSolver_Init( const int lv, const int NReal, long &NAll, long &Disp, int *Count, int *Displ,
+                        long (**Nbr)[6], bool &Singular )
+{
+
+   const int  PScale = PS1*amr->scale[lv];
+   const long NP[3]  = { amr->BoxScale[0]/PScale, amr->BoxScale[1]/PScale, amr->BoxScale[2]/PScale };
+
+
+// 1. patch indices of the real patches on this rank and their siblings
+   long (*Key)[7] = new long [ MAX(NReal,1) ][7];
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      long Idx[3];
+      for (int d=0; d<3; d++)    Idx[d] = amr->patch[0][lv][PID]->corner[d] / PScale;
+
+      Key[PID][0] = ( Idx[2]*NP[1] + Idx[1] )*NP[0] + Idx[0];
+
+      for (int s=0; s<6; s++)
+      {
+         if ( amr->patch[0][lv][PID]->sibling[s] < 0 )
+         {
+            Key[PID][s+1] = -1;
+            continue;
+         }
+
+//       sibling patches across the periodic boundaries are wrapped into the simulation box
+         const int d = s/2;
+         long SibIdx[3] = { Idx[0], Idx[1], Idx[2] };
+
+         SibIdx[d] = ( SibIdx[d] + ( (s%2) ? 1 : -1 ) + NP[d] ) % NP[d];
+
+         Key[PID][s+1] = ( SibIdx[2]*NP[1] + SibIdx[1] )*NP[0] + SibIdx[0];
+      }
+   }
+
+
+// 2. gather the patch indices of all ranks
+#  ifndef SERIAL
+   MPI_Allgather( &NReal, 1, MPI_INT, Count, 1, MPI_INT, MPI_COMM_WORLD );
+#  else
+   Count[0] = NReal;
+#  endif
+
+   Displ[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  Displ[r] = Displ[r-1] + Count[r-1];
+
+   NAll = (long)Displ[MPI_NRank-1] + Count[MPI_NRank-1];
+   Disp = Displ[MPI_Rank];
+
+   long (*Key_All)[7] = new long [NAll][7];
+
+#  ifndef SERIAL
+   int *Count_Key = new int [MPI_NRank];
+   int *Displ_Key = new int [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Count_Key[r] = 7*Count[r];
+      Displ_Key[r] = 7*Displ[r];
+   }
+
+   MPI_Allgatherv( Key[0], 7*NReal, MPI_LONG, Key_All[0], Count_Key, Displ_Key, MPI_LONG, MPI_COMM_WORLD );
+
+   delete [] Count_Key;
+   delete [] Displ_Key;
+#  else
+   memcpy( Key_All[0], Key[0], 7*NReal*sizeof(long) );
+#  endif
+
+   delete [] Key;
+
+
+// 3. look up the neighbours
+   long *SortKey  = new long [NAll];
+   long *SortIdx  = new long [NAll];
+   long  NMissing = 0;
+
+   for (long c=0; c<NAll; c++)   SortKey[c] = Key_All[c][0];
+
+   Mis_Heapsort( NAll, SortKey, SortIdx );
+
+   *Nbr = new long [NAll][6];
+
+#  pragma omp parallel for reduction( +:NMissing ) schedule( static )
+   for (long c=0; c<NAll; c++)
+   {
+      for (int s=0; s<6; s++)
+      {
+         const long t = ( Key_All[c][s+1] < 0 ) ? -1 : Mis_BinarySearch( SortKey, 0L, NAll-1, Key_All[c][s+1] );
+
+#        ifdef GAMER_DEBUG
+         if ( Key_All[c][s+1] >= 0  &&  t < 0 )
+            Aux_Error( ERROR_INFO, "sibling %d of the bottom-level cell %ld (key %ld) is not found !!\n",
+                       s, c, Key_All[c][s+1] );
+#        endif
+
+         (*Nbr)[c][s] = ( t < 0 ) ? -1 : SortIdx[t];
+
+         if ( t < 0 )   NMissing ++;
+      }
+   }
+
+   Singular = ( NMissing == 0 );
+
+   delete [] Key_All;
+   delete [] SortKey;
+   delete [] SortIdx;
+
+} // FUNCTION : BottomSolver_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BottomSolver
+// Description :  Solve the bottom multigrid level of all ranks by the conjugate-gradient method
+//
+// Note        :  1. Gather the RHS of all ranks and solve the 7-point Laplacian on all ranks redundantly
+//                   --> Ghost zones without siblings are the opposite of the adjacent cells (see FillGhost())
+//                   --> One MPI_Allgatherv() per V-cycle and no communication during the iterations
+//                2. Iterate until the L2 norm of the residual is reduced by BOTTOM_TOLERANCE or the number of
+//                   iterations reaches NAll
+//                3. Project out the mean of the RHS and solution if Singular == true
+//                4. Store the solution and ghost zones of the real patches of this rank in Sol[]
+//                   --> No need to invoke FillGhost() afterwards
+//                5. Use double precision
+//
+// Parameter   :  Sol      : Array to store the solution of the bottom multigrid level
+//                RHS      : Array storing the RHS of the bottom multigrid level
+//                NReal    : Number of real patches on this rank
+//                dh       : Cell size on the bottom multigrid level
+//                NAll     : Total number of real patches on all ranks
+//                Disp     : Index of the first real patch of this rank
+//                Count    : Number of real patches on each rank
+//                Displ    : Index of the first real patch of each rank
+//                Nbr      : Neighbour table set by BottomSolver_Init()
+//                Singular : Whether the linear system is singular
+//-------------------------------------------------------------------------------------------------------
+void BottomSolver( real *Sol, const real *RHS, const int NReal, const real dh, const long NAll, const long Disp,
+                   const int *Count, const int *Displ, const long (*Nbr)[6], const bool Singular )
+{
+
+   const int W = 3;   // one cell plus one ghost zone on each side
+
+   double *B  = new double [NAll];
+   double *X  = new double [NAll];
+   double *R  = new double [NAll];
+   double *P  = new double [NAll];
+   double *AP = new double [NAll];
+
+
+// 1. gather the RHS of "6*x - sum(neighbours) = -dh^2*RHS"
+   for (int PID=0; PID<NReal; PID++)   B[Disp+PID] = -SQR( (double)dh )*RHS[ IDX(PID,1,1,1,W) ];
+
+#  ifndef SERIAL
+   MPI_Allgatherv( MPI_IN_PLACE, 0, MPI_DOUBLE, B, Count, Displ, MPI_DOUBLE, MPI_COMM_WORLD );
+#  endif
+
+   if ( Singular )
+   {
+      double Mean = 0.0;
+      for (long c=0; c<NAll; c++)   Mean += B[c];
+      Mean /= NAll;
+      for (long c=0; c<NAll; c++)   B[c] -= Mean;
+   }
+
+
+// 2. conjugate-gradient iterations with a zero initial guess
+   double RR = 0.0;
+
+#  pragma omp parallel for reduction( +:RR ) schedule( static )
+   for (long c=0; c<NAll; c++)
+   {
+      X[c] = 0.0;
+      R[c] = B[c];
+      P[c] = B[c];
+      RR  += B[c]*B[c];
+   }
+
+   const double RR_Tol = SQR( BOTTOM_TOLERANCE )*RR;
+
+   for (long Iter=0; Iter<NAll  &&  RR > RR_Tol; Iter++)
+   {
+      double PAP = 0.0;
+
+#     pragma omp parallel for reduction( +:PAP ) schedule( static )
+      for (long c=0; c<NAll; c++)
+      {
+         double Sum = 6.0*P[c];
+
+         for (int s=0; s<6; s++)
+         {
+            if ( Nbr[c][s] >= 0 )   Sum -= P[ Nbr[c][s] ];
+            else                    Sum += P[c];
+         }
+
+         AP[c] = Sum;
+         PAP  += P[c]*Sum;
+      }
+
+      if ( PAP <= 0.0 )    break;
+
+      const double Alpha  = RR/PAP;
+      double       RR_New = 0.0;
+
+#     pragma omp parallel for reduction( +:RR_New ) schedule( static )
+      for (long c=0; c<NAll; c++)
+      {
+         X[c]   += Alpha*P [c];
+         R[c]   -= Alpha*AP[c];
+         RR_New += R[c]*R[c];
+      }
+
+      const double Beta = RR_New/RR;
+
+#     pragma omp parallel for schedule( static )
+      for (long c=0; c<NAll; c++)   P[c] = R[c] + Beta*P[c];
+
+      RR = RR_New;
+   } // for (long Iter=0; Iter<NAll  &&  RR > RR_Tol; Iter++)
+
+   if ( Singular )
+   {
+      double Mean = 0.0;
+      for (long c=0; c<NAll; c++)   Mean += X[c];
+      Mean /= NAll;
+      for (long c=0; c<NAll; c++)   X[c] -= Mean;
+   }
+
+
+// 3. store the solution and ghost zones of this rank
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      Sol[ IDX(PID,1,1,1,W) ] = (real)X[Disp+PID];
+
+      for (int s=0; s<6; s++)
+      {
+         const long Nb    = Nbr[Disp+PID][s];
+         const int  Ghost = ( s%2 == 0 ) ? 0 : 2;
+         const real Value = ( Nb >= 0 ) ? (real)X[Nb] : -(real)X[Disp+PID];
+
+         switch ( s/2 )
+         {
+            case 0:  Sol[ IDX(PID,1,1,Ghost,W) ] = Value;  break;
+            case 1:  Sol[ IDX(PID,1,Ghost,1,W) ] = Value;  break;
+            case 2:  Sol[ IDX(PID,Ghost,1,1,W) ] = Value;  break;
+         }
+      }
+   }
+
+
+   delete [] B;
+   delete [] X;
+   delete [] R;
+   delete [] P;
+   delete [] AP;
+
+} // FUNCTION : BottomSolver
+
+
+
+#endif // #ifdef GRAVITY
@@ -8,6 +8,16 @@
 #define POT_NXT_INT  ( (POT_NXT-2)*2    )    // size of the array "Pot_Array_Int"
 #define POT_USELESS  ( POT_GHOST_SIZE%2 )    // # of useless cells in each side of the array "Pot_Array_Int"
 
+static void SOR_Interpolate( const real Pot_In[][POT_NXT][POT_NXT], real Pot_Array_Int[][POT_NXT_INT][POT_NXT_INT],
+                             const IntScheme_t IntScheme );
+#if ( SOR_CPU_NLANE > 1 )
+static void CPU_PoissonSolver_SOR_Interleaved( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
+                                               const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
+                                                     real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                                               const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
+                                               const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme );
+#endif
+
 
 
 
@@ -17,6 +27,8 @@
 //
 // Note        :  1. Reference : Numerical Recipes, Chapter 20.5
 //                2. Typically, the number of iterations required to reach round-off errors is 20 ~ 25 (single precision)
+//                3. Invoke CPU_PoissonSolver_SOR_Interleaved() instead if SOR_CPU_NLANE > 1
+//                   --> SOR_CPU_NLANE is set automatically in CUPOT.h for AVX2/AVX-512 CPUs
 //
 // Parameter   :  Rho_Array      : Array to store the input density
 //                Pot_Array_In   : Array to store the input "coarse-grid" potential for interpolation
@@ -39,20 +51,21 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
                             const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme )
 {
 
+#  if ( SOR_CPU_NLANE > 1 )
+   CPU_PoissonSolver_SOR_Interleaved( Rho_Array, Pot_Array_In, Pot_Array_Out, NPatchGroup, dh, Min_Iter, Max_Iter,
+                                      Omega, Poi_Coeff, IntScheme );
+
+#  else
+
    const int  NPatch    = NPatchGroup*8;
    const real Const     = Poi_Coeff*dh*dh;
    const real Omega_6   = Omega/(real)6.0;
-   const real Const_8   = (real)1.0/(real)  8.0;
-   const real Const_64  = (real)1.0/(real) 64.0;
-   const real Const_512 = (real)1.0/(real)512.0;
-   const real Mp[3]     = { (real)-3.0/32.0, (real)+30.0/32.0, (real)+5.0/32.0 };
-   const real Mm[3]     = { (real)+5.0/32.0, (real)+30.0/32.0, (real)-3.0/32.0 };
 
 #  pragma omp parallel
    {
       int i_start, i_start_pass, i_start_k;     // i_start_(pass,k) : record the i_start in the (pass,k) loop
-      int ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, Iter, x, y, z;
-      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual;
+      int ip, jp, kp, im, jm, km, I, J, K, ii, jj, kk, Iter;
+      real Residual_Total_Old, Residual_Total, Residual;
 
 //    array to store the interpolated "fine-grid" potential (as the initial guess and the B.C.)
       real (*Pot_Array_Int)[POT_NXT_INT][POT_NXT_INT] = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT];
@@ -65,134 +78,7 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
 //       a. interpolation : Pot_Array_In --> Pot_Array_Int
 // ------------------------------------------------------------------------------------------------------------
-         switch ( IntScheme )
-         {
-            /*
-            case INT_CENTRAL :
-            {
-               for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;    kp = k + 1;    km = k - 1;
-               for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;    jp = j + 1;    jm = j - 1;
-               for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;    ip = i + 1;    im = i - 1;
-
-                  Slope_x = (real)0.125 * ( Pot_Array_In[P][k ][j ][ip] - Pot_Array_In[P][k ][j ][im] );
-                  Slope_y = (real)0.125 * ( Pot_Array_In[P][k ][jp][i ] - Pot_Array_In[P][k ][jm][i ] );
-                  Slope_z = (real)0.125 * ( Pot_Array_In[P][kp][j ][i ] - Pot_Array_In[P][km][j ][i ] );
-
-                  Pot_Array_Int[K ][J ][I ] = Pot_Array_In[P][k][j][i] - Slope_z - Slope_y - Slope_x;
-                  Pot_Array_Int[K ][J ][Ip] = Pot_Array_In[P][k][j][i] - Slope_z - Slope_y + Slope_x;
-                  Pot_Array_Int[K ][Jp][I ] = Pot_Array_In[P][k][j][i] - Slope_z + Slope_y - Slope_x;
-                  Pot_Array_Int[K ][Jp][Ip] = Pot_Array_In[P][k][j][i] - Slope_z + Slope_y + Slope_x;
-                  Pot_Array_Int[Kp][J ][I ] = Pot_Array_In[P][k][j][i] + Slope_z - Slope_y - Slope_x;
-                  Pot_Array_Int[Kp][J ][Ip] = Pot_Array_In[P][k][j][i] + Slope_z - Slope_y + Slope_x;
-                  Pot_Array_Int[Kp][Jp][I ] = Pot_Array_In[P][k][j][i] + Slope_z + Slope_y - Slope_x;
-                  Pot_Array_Int[Kp][Jp][Ip] = Pot_Array_In[P][k][j][i] + Slope_z + Slope_y + Slope_x;
-
-               }}}
-            }
-            break; // INT_CENTRAL
-            */
-
-
-            case INT_CQUAD :
-            {
-               for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;    kp = k + 1;    km = k - 1;
-               for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;    jp = j + 1;    jm = j - 1;
-               for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;    ip = i + 1;    im = i - 1;
-
-                  C2_Slope[ 0] = Const_8   * ( Pot_Array_In[P][k ][j ][ip] - Pot_Array_In[P][k ][j ][im] );
-                  C2_Slope[ 1] = Const_8   * ( Pot_Array_In[P][k ][jp][i ] - Pot_Array_In[P][k ][jm][i ] );
-                  C2_Slope[ 2] = Const_8   * ( Pot_Array_In[P][kp][j ][i ] - Pot_Array_In[P][km][j ][i ] );
-
-                  C2_Slope[ 3] = Const_64  * ( Pot_Array_In[P][km][j ][ip] - Pot_Array_In[P][km][j ][im] );
-                  C2_Slope[ 4] = Const_64  * ( Pot_Array_In[P][km][jp][i ] - Pot_Array_In[P][km][jm][i ] );
-                  C2_Slope[ 5] = Const_64  * ( Pot_Array_In[P][k ][jm][ip] - Pot_Array_In[P][k ][jm][im] );
-                  C2_Slope[ 6] = Const_64  * ( Pot_Array_In[P][k ][jp][ip] - Pot_Array_In[P][k ][jp][im] );
-                  C2_Slope[ 7] = Const_64  * ( Pot_Array_In[P][kp][j ][ip] - Pot_Array_In[P][kp][j ][im] );
-                  C2_Slope[ 8] = Const_64  * ( Pot_Array_In[P][kp][jp][i ] - Pot_Array_In[P][kp][jm][i ] );
-
-                  C2_Slope[ 9] = Const_512 * ( Pot_Array_In[P][km][jm][ip] - Pot_Array_In[P][km][jm][im] );
-                  C2_Slope[10] = Const_512 * ( Pot_Array_In[P][km][jp][ip] - Pot_Array_In[P][km][jp][im] );
-                  C2_Slope[11] = Const_512 * ( Pot_Array_In[P][kp][jm][ip] - Pot_Array_In[P][kp][jm][im] );
-                  C2_Slope[12] = Const_512 * ( Pot_Array_In[P][kp][jp][ip] - Pot_Array_In[P][kp][jp][im] );
-
-
-                  Pot_Array_Int[K ][J ][I ] = - C2_Slope[ 0] - C2_Slope[ 1] - C2_Slope[ 2] - C2_Slope[ 3]
-                                              - C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] + C2_Slope[ 7]
-                                              + C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
-                                              - C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[K ][J ][Ip] = + C2_Slope[ 0] - C2_Slope[ 1] - C2_Slope[ 2] + C2_Slope[ 3]
-                                              - C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] - C2_Slope[ 7]
-                                              + C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
-                                              + C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[K ][Jp][I ] = - C2_Slope[ 0] + C2_Slope[ 1] - C2_Slope[ 2] - C2_Slope[ 3]
-                                              + C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] + C2_Slope[ 7]
-                                              - C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
-                                              + C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[K ][Jp][Ip] = + C2_Slope[ 0] + C2_Slope[ 1] - C2_Slope[ 2] + C2_Slope[ 3]
-                                              + C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] - C2_Slope[ 7]
-                                              - C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
-                                              - C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[Kp][J ][I ] = - C2_Slope[ 0] - C2_Slope[ 1] + C2_Slope[ 2] + C2_Slope[ 3]
-                                              + C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] - C2_Slope[ 7]
-                                              - C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
-                                              + C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[Kp][J ][Ip] = + C2_Slope[ 0] - C2_Slope[ 1] + C2_Slope[ 2] - C2_Slope[ 3]
-                                              + C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] + C2_Slope[ 7]
-                                              - C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
-                                              - C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[Kp][Jp][I ] = - C2_Slope[ 0] + C2_Slope[ 1] + C2_Slope[ 2] + C2_Slope[ 3]
-                                              - C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] - C2_Slope[ 7]
-                                              + C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
-                                              - C2_Slope[12] + Pot_Array_In[P][k][j][i];
-
-                  Pot_Array_Int[Kp][Jp][Ip] = + C2_Slope[ 0] + C2_Slope[ 1] + C2_Slope[ 2] - C2_Slope[ 3]
-                                              - C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] + C2_Slope[ 7]
-                                              + C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
-                                              + C2_Slope[12] + Pot_Array_In[P][k][j][i];
-               }}} // i, j, k
-            }
-            break; // INT_CQUAD
-
-
-            case INT_QUAD :
-            {
-               for (int k=0; k<POT_NXT_INT; k++)
-               for (int j=0; j<POT_NXT_INT; j++)
-               for (int i=0; i<POT_NXT_INT; i++)   Pot_Array_Int[k][j][i] = (real)0.0;
-
-               for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;
-               for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;
-               for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;
-
-                  for (int dk=-1; dk<=1; dk++)  {  z = dk+1;  kk = k + dk;
-                  for (int dj=-1; dj<=1; dj++)  {  y = dj+1;  jj = j + dj;
-                  for (int di=-1; di<=1; di++)  {  x = di+1;  ii = i + di;
-
-                     Pot_Array_Int[K ][J ][I ] += Pot_Array_In[P][kk][jj][ii] * Mm[z] * Mm[y] * Mm[x];
-                     Pot_Array_Int[K ][J ][Ip] += Pot_Array_In[P][kk][jj][ii] * Mm[z] * Mm[y] * Mp[x];
-                     Pot_Array_Int[K ][Jp][I ] += Pot_Array_In[P][kk][jj][ii] * Mm[z] * Mp[y] * Mm[x];
-                     Pot_Array_Int[K ][Jp][Ip] += Pot_Array_In[P][kk][jj][ii] * Mm[z] * Mp[y] * Mp[x];
-                     Pot_Array_Int[Kp][J ][I ] += Pot_Array_In[P][kk][jj][ii] * Mp[z] * Mm[y] * Mm[x];
-                     Pot_Array_Int[Kp][J ][Ip] += Pot_Array_In[P][kk][jj][ii] * Mp[z] * Mm[y] * Mp[x];
-                     Pot_Array_Int[Kp][Jp][I ] += Pot_Array_In[P][kk][jj][ii] * Mp[z] * Mp[y] * Mm[x];
-                     Pot_Array_Int[Kp][Jp][Ip] += Pot_Array_In[P][kk][jj][ii] * Mp[z] * Mp[y] * Mp[x];
-
-                  }}}
-               }}} // i, j, k
-            }
-            break; // INT_QUAD
-
-
-            default:
-               Aux_Error( ERROR_INFO, "ERROR : incorrect parameter %s = %d !!\n", "IntScheme", IntScheme );
-
-         } // switch ( IntScheme )
+         SOR_Interpolate( Pot_Array_In[P], Pot_Array_Int, IntScheme );
 
 
 
@@ -291,8 +177,369 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
    } // OpenMP parallel region
 
+#  endif // #if ( SOR_CPU_NLANE > 1 ) ... else ...
+
 } // FUNCTION : CPU_PoissonSolver_SOR
 
 
 
+#if ( SOR_CPU_NLANE > 1 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_PoissonSolver_SOR_Interleaved
+// Description :  Patch-interleaved version of CPU_PoissonSolver_SOR() for SIMD CPUs
+//
+// Note        :  1. Invoked by CPU_PoissonSolver_SOR() when SOR_CPU_NLANE > 1
+//                2. SOR_CPU_NLANE patches are stored in the array-of-structures-of-arrays layout [k][j][i][lane]
+//                   so that the same red-black update is applied to all lanes with a single SIMD instruction
+//                   --> one 18^3 patch alone is too small to be vectorized efficiently
+//                3. Each lane checks convergence independently and stops updating its potential afterwards
+//                   --> results are identical to those of the scalar solver
+//                4. The last lane group is padded with zero density and potential if NPatchGroup*8 is not
+//                   a multiple of SOR_CPU_NLANE
+//
+// Parameter   :  See CPU_PoissonSolver_SOR()
+//-------------------------------------------------------------------------------------------------------
+void CPU_PoissonSolver_SOR_Interleaved( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
+                                        const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
+                                              real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                                        const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
+                                        const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme )
+{
+
+   const int  NL        = SOR_CPU_NLANE;
+   const int  NPatch    = NPatchGroup*8;
+   const int  NGroup    = ( NPatch + NL - 1 ) / NL;
+   const real Const     = Poi_Coeff*dh*dh;
+   const real Omega_6   = Omega/(real)6.0;
+
+#  pragma omp parallel
+   {
+      int  i_start, i_start_pass, i_start_k;    // i_start_(pass,k) : record the i_start in the (pass,k) loop
+      int  kp, km, jp, jm, ip, im, kk, jj, ii, I, J, K, Iter, NValid, NActive, NIter[NL];
+      real Residual_Total_Old[NL], Residual_Total[NL], Active[NL];
+
+//    Pot_Array_Int : interpolated potential of a single patch
+//    Pot_Lane      : interpolated potential of SOR_CPU_NLANE patches interleaved along the last dimension
+//    Rho_Lane      : density of SOR_CPU_NLANE patches interleaved along the last dimension
+      real (*Pot_Array_Int)[POT_NXT_INT][POT_NXT_INT]     = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT];
+      real (*Pot_Lane)[POT_NXT_INT][POT_NXT_INT][NL]      = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT][NL];
+      real (*Rho_Lane)[RHO_NXT    ][RHO_NXT    ][NL]      = new real [RHO_NXT    ][RHO_NXT    ][RHO_NXT    ][NL];
+
+
+//    loop over all lane groups
+#     pragma omp for schedule( runtime )
+      for (int G=0; G<NGroup; G++)
+      {
+         const int P0 = G*NL;
+         NValid = MIN( NL, NPatch-P0 );
+
+//       a. interpolation and interleaving : Pot_Array_In --> Pot_Array_Int --> Pot_Lane, Rho_Array --> Rho_Lane
+// ------------------------------------------------------------------------------------------------------------
+         for (int w=0; w<NL; w++)
+         {
+            if ( w < NValid )
+            {
+               SOR_Interpolate( Pot_Array_In[P0+w], Pot_Array_Int, IntScheme );
+
+               for (int k=0; k<POT_NXT_INT; k++)
+               for (int j=0; j<POT_NXT_INT; j++)
+               for (int i=0; i<POT_NXT_INT; i++)   Pot_Lane[k][j][i][w] = Pot_Array_Int[k][j][i];
+
+               for (int k=0; k<RHO_NXT; k++)
+               for (int j=0; j<RHO_NXT; j++)
+               for (int i=0; i<RHO_NXT; i++)       Rho_Lane[k][j][i][w] = Rho_Array[P0+w][k][j][i];
+
+               Active[w] = (real)1.0;
+            }
+
+            else
+            {
+               for (int k=0; k<POT_NXT_INT; k++)
+               for (int j=0; j<POT_NXT_INT; j++)
+               for (int i=0; i<POT_NXT_INT; i++)   Pot_Lane[k][j][i][w] = (real)0.0;
+
+               for (int k=0; k<RHO_NXT; k++)
+               for (int j=0; j<RHO_NXT; j++)
+               for (int i=0; i<RHO_NXT; i++)       Rho_Lane[k][j][i][w] = (real)0.0;
+
+               Active[w] = (real)0.0;
+            }
+
+            Residual_Total_Old[w] = __FLT_MAX__;
+            NIter             [w] = Max_Iter;
+         } // for (int w=0; w<NL; w++)
+
+
+
+//       b. use the SOR scheme to evaluate potential of all lanes simultaneously
+// ------------------------------------------------------------------------------------------------------------
+         NActive = NValid;
+
+         for (Iter=0; Iter<Max_Iter && NActive>0; Iter++)
+         {
+            for (int w=0; w<NL; w++)   Residual_Total[w] = (real)0.0;
+
+            i_start_pass = 1 + POT_USELESS;
+
+//          odd-even ordering
+            for (int pass=0; pass<2; pass++)
+            {
+               i_start_k = i_start_pass;
+
+               for (int k=1+POT_USELESS; k<POT_NXT_INT-1-POT_USELESS; k++)
+               {
+                  i_start = i_start_k;
+                  kp      = k+1;
+                  km      = k-1;
+                  kk      = k-1-POT_USELESS;
+
+                  for (int j=1+POT_USELESS; j<POT_NXT_INT-1-POT_USELESS; j++)
+                  {
+                     jp = j+1;
+                     jm = j-1;
+                     jj = j-1-POT_USELESS;
+
+                     for (int i=i_start; i<POT_NXT_INT-1-POT_USELESS; i+=2)
+                     {
+                        ip = i+1;
+                        im = i-1;
+                        ii = i-1-POT_USELESS;
+
+//                      the lanes of converged patches are masked out by Active[]
+#                       pragma omp simd
+                        for (int w=0; w<NL; w++)
+                        {
+                           const real Residual = (             Pot_Lane[kp][j ][i ][w] + Pot_Lane[km][j ][i ][w]
+                                                   +           Pot_Lane[k ][jp][i ][w] + Pot_Lane[k ][jm][i ][w]
+                                                   +           Pot_Lane[k ][j ][ip][w] + Pot_Lane[k ][j ][im][w]
+                                                   - (real)6.0*Pot_Lane[k ][j ][i ][w] - Const*Rho_Lane[kk][jj][ii][w]  );
+
+                           Pot_Lane[k][j][i][w] += Active[w]*Omega_6*Residual;
+                           Residual_Total[w]    += FABS( Residual );
+                        }
+                     } // i
+
+                     i_start = 3 - i_start + 2*POT_USELESS;
+
+                  } // j
+
+                  i_start_k = 3 - i_start_k + 2*POT_USELESS;
+
+               } // k
+
+               i_start_pass = 3 - i_start_pass + 2*POT_USELESS;
+
+            } // for (int pass=0; pass<2; pass++)
+
+
+//          convergence check of each lane (same criterion as CPU_PoissonSolver_SOR())
+            for (int w=0; w<NValid; w++)
+            {
+               if ( Active[w] == (real)0.0 )    continue;
+
+               if (  Iter+1 >= Min_Iter  &&  Residual_Total[w] > Residual_Total_Old[w]  )
+               {
+                  Active[w] = (real)0.0;
+                  NIter [w] = Iter + 1;
+                  NActive --;
+               }
+
+               else
+                  Residual_Total_Old[w] = Residual_Total[w];
+            }
+         } // for (Iter=0; Iter<Max_Iter && NActive>0; Iter++)
+
+
+         for (int w=0; w<NValid; w++)
+         {
+            if ( NIter[w] == Max_Iter  &&  Active[w] != (real)0.0 )
+               Aux_Message( stderr, "WARNING : Rank = %2d, Patch %6d exceeds Max_Iter in the SOR iteration !!\n",
+                            MPI_Rank, P0+w );
+         }
+
+
+//       c. copy data : Pot_Lane --> Pot_Array_Out
+// ------------------------------------------------------------------------------------------------------------
+         for (int w=0; w<NValid; w++)
+         {
+            for (int k=0; k<GRA_NXT; k++)    {  K = k + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int j=0; j<GRA_NXT; j++)    {  J = j + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int i=0; i<GRA_NXT; i++)    {  I = i + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+
+               Pot_Array_Out[P0+w][k][j][i] = Pot_Lane[K][J][I][w];
+
+            }}}
+         }
+
+      } // for (int G=0; G<NGroup; G++)
+
+
+      delete [] Pot_Array_Int;
+      delete [] Pot_Lane;
+      delete [] Rho_Lane;
+
+   } // OpenMP parallel region
+
+} // FUNCTION : CPU_PoissonSolver_SOR_Interleaved
+#endif // #if ( SOR_CPU_NLANE > 1 )
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SOR_Interpolate
+// Description :  Interpolate the coarse-grid potential of a single patch as the initial guess and the B.C.
+//
+// Note        :  1. Invoked by CPU_PoissonSolver_SOR() and CPU_PoissonSolver_SOR_Interleaved()
+//
+// Parameter   :  Pot_In        : Input "coarse-grid" potential of the target patch
+//                Pot_Array_Int : Output interpolated "fine-grid" potential
+//                IntScheme     : Interpolation scheme for potential (INT_CQUAD/INT_QUAD)
+//-------------------------------------------------------------------------------------------------------
+void SOR_Interpolate( const real Pot_In[][POT_NXT][POT_NXT], real Pot_Array_Int[][POT_NXT_INT][POT_NXT_INT],
+                      const IntScheme_t IntScheme )
+{
+
+   const real Const_8   = (real)1.0/(real)  8.0;
+   const real Const_64  = (real)1.0/(real) 64.0;
+   const real Const_512 = (real)1.0/(real)512.0;
+   const real Mp[3]     = { (real)-3.0/32.0, (real)+30.0/32.0, (real)+5.0/32.0 };
+   const real Mm[3]     = { (real)+5.0/32.0, (real)+30.0/32.0, (real)-3.0/32.0 };
+
+   int  ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, x, y, z;
+   real Slope_x, Slope_y, Slope_z, C2_Slope[13];
+
+
+   switch ( IntScheme )
+   {
+      /*
+      case INT_CENTRAL :
+      {
+         for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;    kp = k + 1;    km = k - 1;
+         for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;    jp = j + 1;    jm = j - 1;
+         for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;    ip = i + 1;    im = i - 1;
+
+            Slope_x = (real)0.125 * ( Pot_In[k ][j ][ip] - Pot_In[k ][j ][im] );
+            Slope_y = (real)0.125 * ( Pot_In[k ][jp][i ] - Pot_In[k ][jm][i ] );
+            Slope_z = (real)0.125 * ( Pot_In[kp][j ][i ] - Pot_In[km][j ][i ] );
+
+            Pot_Array_Int[K ][J ][I ] = Pot_In[k][j][i] - Slope_z - Slope_y - Slope_x;
+            Pot_Array_Int[K ][J ][Ip] = Pot_In[k][j][i] - Slope_z - Slope_y + Slope_x;
+            Pot_Array_Int[K ][Jp][I ] = Pot_In[k][j][i] - Slope_z + Slope_y - Slope_x;
+            Pot_Array_Int[K ][Jp][Ip] = Pot_In[k][j][i] - Slope_z + Slope_y + Slope_x;
+            Pot_Array_Int[Kp][J ][I ] = Pot_In[k][j][i] + Slope_z - Slope_y - Slope_x;
+            Pot_Array_Int[Kp][J ][Ip] = Pot_In[k][j][i] + Slope_z - Slope_y + Slope_x;
+            Pot_Array_Int[Kp][Jp][I ] = Pot_In[k][j][i] + Slope_z + Slope_y - Slope_x;
+            Pot_Array_Int[Kp][Jp][Ip] = Pot_In[k][j][i] + Slope_z + Slope_y + Slope_x;
+
+         }}}
+      }
+      break; // INT_CENTRAL
+      */
+
+
+      case INT_CQUAD :
+      {
+         for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;    kp = k + 1;    km = k - 1;
+         for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;    jp = j + 1;    jm = j - 1;
+         for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;    ip = i + 1;    im = i - 1;
+
+            C2_Slope[ 0] = Const_8   * ( Pot_In[k ][j ][ip] - Pot_In[k ][j ][im] );
+            C2_Slope[ 1] = Const_8   * ( Pot_In[k ][jp][i ] - Pot_In[k ][jm][i ] );
+            C2_Slope[ 2] = Const_8   * ( Pot_In[kp][j ][i ] - Pot_In[km][j ][i ] );
+
+            C2_Slope[ 3] = Const_64  * ( Pot_In[km][j ][ip] - Pot_In[km][j ][im] );
+            C2_Slope[ 4] = Const_64  * ( Pot_In[km][jp][i ] - Pot_In[km][jm][i ] );
+            C2_Slope[ 5] = Const_64  * ( Pot_In[k ][jm][ip] - Pot_In[k ][jm][im] );
+            C2_Slope[ 6] = Const_64  * ( Pot_In[k ][jp][ip] - Pot_In[k ][jp][im] );
+            C2_Slope[ 7] = Const_64  * ( Pot_In[kp][j ][ip] - Pot_In[kp][j ][im] );
+            C2_Slope[ 8] = Const_64  * ( Pot_In[kp][jp][i ] - Pot_In[kp][jm][i ] );
+
+            C2_Slope[ 9] = Const_512 * ( Pot_In[km][jm][ip] - Pot_In[km][jm][im] );
+            C2_Slope[10] = Const_512 * ( Pot_In[km][jp][ip] - Pot_In[km][jp][im] );
+            C2_Slope[11] = Const_512 * ( Pot_In[kp][jm][ip] - Pot_In[kp][jm][im] );
+            C2_Slope[12] = Const_512 * ( Pot_In[kp][jp][ip] - Pot_In[kp][jp][im] );
+
+
+            Pot_Array_Int[K ][J ][I ] = - C2_Slope[ 0] - C2_Slope[ 1] - C2_Slope[ 2] - C2_Slope[ 3]
+                                        - C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] + C2_Slope[ 7]
+                                        + C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
+                                        - C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[K ][J ][Ip] = + C2_Slope[ 0] - C2_Slope[ 1] - C2_Slope[ 2] + C2_Slope[ 3]
+                                        - C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] - C2_Slope[ 7]
+                                        + C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
+                                        + C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[K ][Jp][I ] = - C2_Slope[ 0] + C2_Slope[ 1] - C2_Slope[ 2] - C2_Slope[ 3]
+                                        + C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] + C2_Slope[ 7]
+                                        - C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
+                                        + C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[K ][Jp][Ip] = + C2_Slope[ 0] + C2_Slope[ 1] - C2_Slope[ 2] + C2_Slope[ 3]
+                                        + C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] - C2_Slope[ 7]
+                                        - C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
+                                        - C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[Kp][J ][I ] = - C2_Slope[ 0] - C2_Slope[ 1] + C2_Slope[ 2] + C2_Slope[ 3]
+                                        + C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] - C2_Slope[ 7]
+                                        - C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
+                                        + C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[Kp][J ][Ip] = + C2_Slope[ 0] - C2_Slope[ 1] + C2_Slope[ 2] - C2_Slope[ 3]
+                                        + C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] + C2_Slope[ 7]
+                                        - C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
+                                        - C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[Kp][Jp][I ] = - C2_Slope[ 0] + C2_Slope[ 1] + C2_Slope[ 2] + C2_Slope[ 3]
+                                        - C2_Slope[ 4] + C2_Slope[ 5] - C2_Slope[ 6] - C2_Slope[ 7]
+                                        + C2_Slope[ 8] - C2_Slope[ 9] + C2_Slope[10] + C2_Slope[11]
+                                        - C2_Slope[12] + Pot_In[k][j][i];
+
+            Pot_Array_Int[Kp][Jp][Ip] = + C2_Slope[ 0] + C2_Slope[ 1] + C2_Slope[ 2] - C2_Slope[ 3]
+                                        - C2_Slope[ 4] - C2_Slope[ 5] + C2_Slope[ 6] + C2_Slope[ 7]
+                                        + C2_Slope[ 8] + C2_Slope[ 9] - C2_Slope[10] - C2_Slope[11]
+                                        + C2_Slope[12] + Pot_In[k][j][i];
+         }}} // i, j, k
+      }
+      break; // INT_CQUAD
+
+
+      case INT_QUAD :
+      {
+         for (int k=0; k<POT_NXT_INT; k++)
+         for (int j=0; j<POT_NXT_INT; j++)
+         for (int i=0; i<POT_NXT_INT; i++)   Pot_Array_Int[k][j][i] = (real)0.0;
+
+         for (int k=1; k<POT_NXT-1; k++)  {  K = (k-1)*2;   Kp = K + 1;
+         for (int j=1; j<POT_NXT-1; j++)  {  J = (j-1)*2;   Jp = J + 1;
+         for (int i=1; i<POT_NXT-1; i++)  {  I = (i-1)*2;   Ip = I + 1;
+
+            for (int dk=-1; dk<=1; dk++)  {  z = dk+1;  kk = k + dk;
+            for (int dj=-1; dj<=1; dj++)  {  y = dj+1;  jj = j + dj;
+            for (int di=-1; di<=1; di++)  {  x = di+1;  ii = i + di;
+
+               Pot_Array_Int[K ][J ][I ] += Pot_In[kk][jj][ii] * Mm[z] * Mm[y] * Mm[x];
+               Pot_Array_Int[K ][J ][Ip] += Pot_In[kk][jj][ii] * Mm[z] * Mm[y] * Mp[x];
+               Pot_Array_Int[K ][Jp][I ] += Pot_In[kk][jj][ii] * Mm[z] * Mp[y] * Mm[x];
+               Pot_Array_Int[K ][Jp][Ip] += Pot_In[kk][jj][ii] * Mm[z] * Mp[y] * Mp[x];
+               Pot_Array_Int[Kp][J ][I ] += Pot_In[kk][jj][ii] * Mp[z] * Mm[y] * Mm[x];
+               Pot_Array_Int[Kp][J ][Ip] += Pot_In[kk][jj][ii] * Mp[z] * Mm[y] * Mp[x];
+               Pot_Array_Int[Kp][Jp][I ] += Pot_In[kk][jj][ii] * Mp[z] * Mp[y] * Mm[x];
+               Pot_Array_Int[Kp][Jp][Ip] += Pot_In[kk][jj][ii] * Mp[z] * Mp[y] * Mp[x];
+
+            }}}
+         }}} // i, j, k
+      }
+      break; // INT_QUAD
+
+
+      default:
+         Aux_Error( ERROR_INFO, "ERROR : incorrect parameter %s = %d !!\n", "IntScheme", IntScheme );
+
+   } // switch ( IntScheme )
+
+} // FUNCTION : SOR_Interpolate
+
+
+
 #endif // #if ( defined GRAVITY  &&  !defined GPU  &&  POT_SCHEME == SOR )
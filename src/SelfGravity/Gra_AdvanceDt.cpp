@@ -8,6 +8,19 @@ extern Timer_t *Timer_GetBuf     [NLEVEL][8];
 extern Timer_t *Timer_Par_Collect[NLEVEL];
 #endif
 
+#ifdef LOAD_BALANCE
+// arguments of the Poisson/gravity solvers overlapped with the MPI communication
+struct GraOverlapArg_t
+{
+   Solver_t TSolver;
+   int      lv;
+   double   TimeNew, TimeOld, dt, Poi_Coeff;
+   int      SaveSg_Flu, SaveSg_Pot;
+};
+
+static void Gra_AdvanceDt_Async( void *Arg );
+#endif
+
 
 
 
@@ -23,6 +36,16 @@ extern Timer_t *Timer_Par_Collect[NLEVEL];
 //                   (they will be updated in EvolveLevel instead)
 //                   --> It is because the lv-0 Poisson and Gravity solvers are invoked separately, and Gravity solver
 //                       needs to call Prepare_PatchData to get the updated potential
+//                5. OverlapMPI (LOAD_BALANCE and lv>0 only):
+//                   --> Exchange the density field of buffer patches at SaveSg_Flu for OPT__SELF_GRAVITY by non-blocking
+//                       MPI while advancing the patch groups requiring no sibling buffer patch (i.e., OverlapMPI_PotAsyncPID0),
+//                       and then advance the remaining patch groups (i.e., OverlapMPI_PotSyncPID0)
+//                   --> The caller must NOT exchange the density field in advance
+//                6. OPT__LEVEL_MG (lv>0 and OPT__SELF_GRAVITY only):
+//                   --> Invoke CPU_PoissonSolver_LevelMG() instead of the per-patch Poisson solver, and then
+//                       invoke the gravity solver separately in the same way as lv=0
+//                   --> PotSg at lv>0 will also be updated here, and the potential of buffer patches will be
+//                       collected here
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -36,15 +59,13 @@ extern Timer_t *Timer_Par_Collect[NLEVEL];
 //                                        (including both self-gravity potential and external potential)
 //                Gravity      : true --> invoke the Gravity solver to evolve fluid by the gravitational acceleration
 //                                        (including self-gravity, external potentional, and external acceleration)
-//                OverlapMPI   : true --> Overlap MPI time with CPU/GPU computation
-//                Overlap_Sync : true  --> Advance the patches which cannot be overlapped with MPI communication
-//                               false --> Advance the patches which can    be overlapped with MPI communication
-//                               (useful only if "OverlapMPI == true")
+//                OverlapMPI   : true --> Overlap the exchange of the density field with CPU/GPU computation
+//                                          --> See Note 5 above
 //                Timing       : enable timing --> disable it in Flu_CorrAfterAllSync()
 //-------------------------------------------------------------------------------------------------------
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                     const int SaveSg_Flu, const int SaveSg_Pot, const bool Poisson, const bool Gravity,
-                    const bool OverlapMPI, const bool Overlap_Sync, const bool Timing )
+                    const bool OverlapMPI, const bool Timing )
 {
 
 // check
@@ -63,6 +84,11 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    if (  !Poisson  &&  Gravity  &&  ( OPT__SELF_GRAVITY || OPT__EXT_POT )  )
       Aux_Message( stderr, "WARNING : Poisson=off but Gravity=on --> ARE YOU SURE ?!\n" );
 
+#  ifndef LOAD_BALANCE
+   if ( OverlapMPI )
+      Aux_Error( ERROR_INFO, "MPI overlapping is NOT supported if LOAD_BALANCE is off !!\n" );
+#  endif
+
 
 // whether we actually need potential
    const bool UsePot = (  Poisson  &&  ( OPT__SELF_GRAVITY || OPT__EXT_POT )  );
@@ -144,10 +170,6 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 
       if ( Gravity )
       {
-//       TIMING_FUNC(   InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
-//                                    OverlapMPI, Overlap_Sync ),
-//                      Timer_Gra_Advance[lv],   Timing  );
-
          TIMING_FUNC(   InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
                                       false, false ),
                         Timer_Gra_Advance[lv],   Timing   );
@@ -157,19 +179,61 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    } // if ( lv == 0 )
 
 
+   else if ( Poisson  &&  OPT__SELF_GRAVITY  &&  OPT__LEVEL_MG ) // lv > 0 with the level-wide multigrid
+   {
+//    the density field of buffer patches has not been exchanged by the caller for OverlapMPI
+      if ( OverlapMPI )
+      Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL, _DENS, _NONE, Rho_ParaBuf, USELB_YES );
+
+      const bool GuessFromPot_No = false;
+
+      CPU_PoissonSolver_LevelMG( lv, Poi_Coeff, SaveSg_Pot, TimeNew, LEVEL_MG_MAX_ITER, GuessFromPot_No, NULL );
+
+//    the gravity solver requires the updated potential of both real and buffer patches
+      amr->PotSg    [lv]             = SaveSg_Pot;
+      amr->PotSgTime[lv][SaveSg_Pot] = TimeNew;
+
+      Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
+
+#     ifdef STORE_POT_GHOST
+      Poi_StorePotWithGhostZone( lv, SaveSg_Pot, true );
+#     endif
+
+      if ( Gravity )
+         InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT, false, false );
+   } // lv > 0 with the level-wide multigrid
+
+
    else // lv > 0
    {
-      if      (  Poisson  &&  !Gravity )
-         InvokeSolver( POISSON_SOLVER,             lv, TimeNew, TimeOld, NULL_REAL, Poi_Coeff, NULL_INT,   NULL_INT, SaveSg_Pot,
-                       OverlapMPI, Overlap_Sync );
+      Solver_t TSolver;
+      if      (  Poisson  &&  !Gravity )   TSolver = POISSON_SOLVER;
+      else if ( !Poisson  &&   Gravity )   TSolver = GRAVITY_SOLVER;
+      else                                 TSolver = POISSON_AND_GRAVITY_SOLVER;
+
+      const double Poi_Coeff_In = ( Poisson ) ? Poi_Coeff  : NULL_REAL;
+      const double dt_In        = ( Gravity ) ? dt         : NULL_REAL;
+      const int    SaveSg_FluIn = ( Gravity ) ? SaveSg_Flu : NULL_INT;
+      const int    SaveSg_PotIn = ( Poisson ) ? SaveSg_Pot : NULL_INT;
+
+//    only the density field exchanged for OPT__SELF_GRAVITY can be overlapped with the Poisson solver
+      if ( OverlapMPI  &&  Poisson  &&  OPT__SELF_GRAVITY )
+      {
+#        ifdef LOAD_BALANCE
+         GraOverlapArg_t Arg = { TSolver, lv, TimeNew, TimeOld, dt_In, Poi_Coeff_In, SaveSg_FluIn, SaveSg_PotIn };
 
-      else if ( !Poisson  &&   Gravity )
-         InvokeSolver( GRAVITY_SOLVER,             lv, TimeNew, TimeOld, dt,        NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
-                       OverlapMPI, Overlap_Sync );
+//       (1) exchange the density field while advancing the patch groups requiring no sibling buffer patch
+//       --> the gravity solver does not modify density, so it's safe to update the real patches simultaneously
+         LB_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL, _DENS, _NONE, Rho_ParaBuf,
+                           Gra_AdvanceDt_Async, &Arg );
+
+//       (2) patch groups adjacent to sibling buffer patches
+         InvokeSolver( TSolver, lv, TimeNew, TimeOld, dt_In, Poi_Coeff_In, SaveSg_FluIn, NULL_INT, SaveSg_PotIn, true, true );
+#        endif
+      }
 
-      else if (  Poisson  &&   Gravity )
-         InvokeSolver( POISSON_AND_GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt,        Poi_Coeff, SaveSg_Flu, NULL_INT, SaveSg_Pot,
-                       OverlapMPI, Overlap_Sync );
+      else
+         InvokeSolver( TSolver, lv, TimeNew, TimeOld, dt_In, Poi_Coeff_In, SaveSg_FluIn, NULL_INT, SaveSg_PotIn, false, false );
    }
 
 
@@ -196,4 +260,26 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 
 
 
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Gra_AdvanceDt_Async
+// Description :  Advance the patch groups whose ghost zones require no sibling buffer patch
+//
+// Note        :  1. Invoked by LB_GetBufferData() after posting the non-blocking MPI requests
+//
+// Parameter   :  Arg : Pointer to GraOverlapArg_t storing the arguments of InvokeSolver()
+//-------------------------------------------------------------------------------------------------------
+void Gra_AdvanceDt_Async( void *Arg )
+{
+
+   const GraOverlapArg_t *GraArg = (GraOverlapArg_t*)Arg;
+
+   InvokeSolver( GraArg->TSolver, GraArg->lv, GraArg->TimeNew, GraArg->TimeOld, GraArg->dt, GraArg->Poi_Coeff,
+                 GraArg->SaveSg_Flu, NULL_INT, GraArg->SaveSg_Pot, true, false );
+
+} // FUNCTION : Gra_AdvanceDt_Async
+#endif // #ifdef LOAD_BALANCE
+
+
+
 #endif // #ifdef GRAVITY
@@ -13,24 +13,33 @@
 // Note        :  1. Use SaveSg to determine where to store the data
 //                   --> Currently it's set to the same Sg as the fluid data when calling
 //                       Gra_AdvanceDt() in EvolveLevel()
+//                2. For OPT__DT_FUSED, also record the minimum fluid and gravity dt of the updated patches
+//                   --> The fluid dt is recorded here instead of in Flu_Close() since the gravity solver is
+//                       the last solver updating the fluid
+//                   --> See dt_Fused_Start()
 //
-// Parameter   :  lv             : Target refinement level
-//                SaveSg         : Sandglass to store the updated data
-//                h_Flu_Array_G  : Host array storing the updated fluid variables
-//                h_DE_Array_G   : Host array storing the dual-energy status
-//                h_Emag_Array_G : Host array storing the cell-centered magnetic energy (MHD with DUAL_ENERGY only)
-//                NPG            : Number of patch groups to store the updated data
-//                PID0_List      : List recording the patch indices with LocalID==0 to be udpated
+// Parameter   :  lv                 : Target refinement level
+//                SaveSg             : Sandglass to store the updated data
+//                h_Flu_Array_G      : Host array storing the updated fluid variables
+//                h_DE_Array_G       : Host array storing the dual-energy status
+//                h_Emag_Array_G     : Host array storing the cell-centered magnetic energy (MHD with DUAL_ENERGY only)
+//                h_Pot_Array_P_Out  : Host array storing the potential used by the gravity solver (for OPT__DT_FUSED only)
+//                h_Corner_Array_PGT : Host array storing the patch corner coordinates (for OPT__DT_FUSED only)
+//                NPG                : Number of patch groups to store the updated data
+//                PID0_List          : List recording the patch indices with LocalID==0 to be udpated
+//                TimeNew            : Physical time of the updated data (for OPT__DT_FUSED only)
 //-------------------------------------------------------------------------------------------------------
 void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_NIN][PS1][PS1][PS1],
                 const char h_DE_Array_G[][PS1][PS1][PS1], const real h_Emag_Array_G[][PS1][PS1][PS1],
-                const int NPG, const int *PID0_List )
+                const real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT], const double h_Corner_Array_PGT[][3],
+                const int NPG, const int *PID0_List, const double TimeNew )
 {
 
-   int N, PID, PID0;
+   int  N, PID, PID0;
+   real dt_min_flu=HUGE_NUMBER, dt_min_gra=HUGE_NUMBER;
 
 
-#  pragma omp parallel for private( N, PID, PID0 ) schedule( static )
+#  pragma omp parallel for private( N, PID, PID0 ) reduction( min:dt_min_flu, dt_min_gra ) schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       PID0 = PID0_List[TID];
@@ -107,8 +116,27 @@ void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_N
 #        error : unsupported MODEL !!
 #        endif // MODEL
       } // for (int LocalID=0; LocalID<8; LocalID++)
+
+//    estimate the fluid and gravity dt while the updated data are still in cache
+#     if ( MODEL == HYDRO )
+      if ( OPT__DT_FUSED )
+      {
+         dt_min_flu = FMIN( dt_min_flu, dt_Fused_Flu(lv, SaveSg, amr->MagSg[lv], PID0) );
+         dt_min_gra = FMIN( dt_min_gra, dt_Fused_Gra(lv, (const real (*)[ CUBE(GRA_NXT) ])h_Pot_Array_P_Out[8*TID],
+                                                     h_Corner_Array_PGT+8*TID, TimeNew) );
+      }
+#     endif
    } // for (int TID=0; TID<NPG; TID++)
 
+
+#  if ( MODEL == HYDRO )
+   if ( OPT__DT_FUSED )
+   {
+      dt_Fused_Record( DT_FLU_SOLVER, lv, dt_min_flu );
+      dt_Fused_Record( DT_GRA_SOLVER, lv, dt_min_gra );
+   }
+#  endif
+
 } // FUNCTION : Gra_Close
 
 
@@ -17,6 +17,8 @@
 //                3. One must invoke Buf_GetBufferData( ..., _TOTAL, ... ) after calling this function
 //                4. Currently this function does not check whether the cell mass exceeds the Jeans mass
 //                   --> Ref: "jeanmass" in star_maker_ssn.F of Enzo
+//                5. New star particles are buffered by each OpenMP thread and then added to the particle
+//                   repository by Particle_t::AddParticleBatch() without the critical construct
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Current physical time (after advancing solution by dt)
@@ -76,6 +78,11 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    const real   GraConst       = ( false                ) ? -1.0/(12.0*dh) : -1.0/(2.0*dh); // P5 is NOT supported yet
 
 
+   const int NPatch = amr->NPatchComma[lv][1];
+   int *NNewParEachPatch = new int [NPatch];
+   long NNewParAllPatch  = 0;
+
+
 // start of OpenMP parallel region
 #  pragma omp parallel
    {
@@ -94,25 +101,45 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    real   (*pot_ext)[GRA_NXT][GRA_NXT] = NULL;
 #  endif
 
+// new star particles of all patches handled by this thread
+// --> the arrays grow such that there is always enough space for the new particles of one patch
    const int    MaxNewParPerPatch = CUBE(PS1);
-   real_par   (*NewParAttFlt)[PAR_NATT_FLT_TOTAL] = new real_par [MaxNewParPerPatch][PAR_NATT_FLT_TOTAL];
-   long_par   (*NewParAttInt)[PAR_NATT_INT_TOTAL] = new long_par [MaxNewParPerPatch][PAR_NATT_INT_TOTAL];
-   long        *NewParID                          = new long     [MaxNewParPerPatch];
+   long         ThreadArraySize   = MaxNewParPerPatch;
+   real_par   (*ThreadAttFlt)[PAR_NATT_FLT_TOTAL] = (real_par(*)[PAR_NATT_FLT_TOTAL])malloc( ThreadArraySize*sizeof(*ThreadAttFlt) );
+   long_par   (*ThreadAttInt)[PAR_NATT_INT_TOTAL] = (long_par(*)[PAR_NATT_INT_TOTAL])malloc( ThreadArraySize*sizeof(*ThreadAttInt) );
+   real_par   (*NewParAttFlt)[PAR_NATT_FLT_TOTAL] = NULL;
+   long_par   (*NewParAttInt)[PAR_NATT_INT_TOTAL] = NULL;
+   long        *NewParID                          = NULL;
 
-   int NNewPar;
+   int  NNewPar;
+   long NNewParThread = 0;
 
 
 // loop over all real patches
 // use static schedule to ensure bitwise reproducibility when running with the same numbers of OpenMP threads and MPI ranks
 // --> bitwise reproducibility will still break when running with different numbers of OpenMP threads and/or MPI ranks
 //     unless both BITWISE_REPRODUCIBILITY and SF_CREATE_STAR_DET_RANDOM are enabled
-#  pragma omp for schedule( static )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+#  pragma omp for reduction( +:NNewParAllPatch ) schedule( static )
+   for (int PID=0; PID<NPatch; PID++)
    {
+      NNewParEachPatch[PID] = 0;
+
 //    skip non-leaf patches
       if ( amr->patch[0][lv][PID]->son != -1 )  continue;
 
 
+//    make sure that there is enough memory for the new particles of this patch
+      if ( NNewParThread + MaxNewParPerPatch > ThreadArraySize )
+      {
+         ThreadArraySize = (long)ceil( PARLIST_GROWTH_FACTOR*(NNewParThread+MaxNewParPerPatch) );
+         ThreadAttFlt    = (real_par(*)[PAR_NATT_FLT_TOTAL])realloc( ThreadAttFlt, ThreadArraySize*sizeof(*ThreadAttFlt) );
+         ThreadAttInt    = (long_par(*)[PAR_NATT_INT_TOTAL])realloc( ThreadAttInt, ThreadArraySize*sizeof(*ThreadAttInt) );
+      }
+
+      NewParAttFlt = ThreadAttFlt + NNewParThread;
+      NewParAttInt = ThreadAttInt + NNewParThread;
+
+
 //    to get deterministic and different random numbers for all patches, reset the random seed of each patch according to
 //    its location and time
 //    --> patches at different time and/or AMR levels may still have the same random seeds...
@@ -181,7 +208,7 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 
 
 //       2. store the information of new star particles
-//       --> we will not create these new particles until looping over all cells in a patch in order to reduce
+//       --> we will not create these new particles until looping over all patches in order to reduce
 //           the OpenMP synchronization overhead
 //       ===========================================================================================================
 //       check
@@ -259,47 +286,78 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
       } // i,j,k
 
 
+//    record the number of new particles in this patch
+      NNewParEachPatch[PID]  = NNewPar;
+      NNewParThread         += NNewPar;
+      NNewParAllPatch       += NNewPar;
+   } // for (int PID=0; PID<NPatch; PID++)
+
+
+
+// 4. create new star particles
+// ===========================================================================================================
+// 4-1. allocate memory for all new particles in this rank
+//      --> the implicit barrier of the worksharing loop above ensures that NNewParAllPatch is complete
+#  pragma omp single
+   amr->Par->BeginAddBatch( NNewParAllPatch );
 
-//    4. create new star particles
-//    ===========================================================================================================
-//    use OpenMP critical construct since both amr->Par->AddOneParticle() and amr->patch[0][lv][PID]->AddParticle()
-//    will modify some global variables
-//    --> note that the order of which thread calls amr->Par->AddOneParticle() is non-deterministic and may change from run to run
-//        --> order of particles stored in the particle repository (i.e., their particle ID) may change from run to run
-//        --> particle text file may change from run to run since it's dumped according to the order of particle ID
-//    --> but it's not an issue since the actual data of each particle will not be affected
-#     pragma omp critical
-      {
-//       4-1. add particles to the particle repository
-         for (int p=0; p<NNewPar; p++)
-            NewParID[p] = amr->Par->AddOneParticle( NewParAttFlt[p], NewParAttInt[p] );
-
-
-//       4-2. add particles to the patch
-         const long_par *PType = amr->Par->Type;
-#        ifdef DEBUG_PARTICLE
-//       do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//       may change after calling amr->Par->AddOneParticle()
-         const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
-         char Comment[100];
-         sprintf( Comment, "%s", __FUNCTION__ );
-
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv],
-                                              PType, ParPos, amr->Par->NPar_AcPlusInac, Comment );
-#        else
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv], PType );
-#        endif
-      } // pragma omp critical
 
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+// 4-2. add particles to the particle repository
+//      --> each thread claims a block of particle IDs by an atomic operation instead of the critical construct
+//      --> note that the order of particle IDs assigned to different threads is non-deterministic and may change
+//          from run to run
+//          --> particle text file may change from run to run since it's dumped according to the order of particle ID
+//      --> but it's not an issue since the actual data of each particle will not be affected
+   long *ThreadParID = new long [ MAX(NNewParThread,1L) ];
+
+   amr->Par->AddParticleBatch( NNewParThread, ThreadAttFlt, ThreadAttInt, ThreadParID );
+
+#  pragma omp barrier
+#  pragma omp single
+   amr->Par->EndAddBatch();
+
+
+// 4-3. add particles to the patches
+//      --> use the same static schedule as above so that each thread handles the same patches and
+//          the new particles of each patch are stored in the same order in ThreadParID[]
+//      --> patches are owned by a single thread, and NPar_Lv is updated by an atomic operation
+   const long_par *PType = amr->Par->Type;
+#  ifdef DEBUG_PARTICLE
+   const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+   char Comment[100];
+   sprintf( Comment, "%s", __FUNCTION__ );
+#  endif
+   long NPar_Lv_Thread = 0;
+
+   NewParID = ThreadParID;
+
+#  pragma omp for schedule( static )
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      if ( NNewParEachPatch[PID] == 0 )   continue;
+
+#     ifdef DEBUG_PARTICLE
+      amr->patch[0][lv][PID]->AddParticle( NNewParEachPatch[PID], NewParID, &NPar_Lv_Thread,
+                                           PType, ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#     else
+      amr->patch[0][lv][PID]->AddParticle( NNewParEachPatch[PID], NewParID, &NPar_Lv_Thread, PType );
+#     endif
+
+      NewParID += NNewParEachPatch[PID];
+   }
+
+#  pragma omp atomic
+   amr->Par->NPar_Lv[lv] += NPar_Lv_Thread;
 
 // free memory
-   delete [] NewParAttFlt;
-   delete [] NewParAttInt;
-   delete [] NewParID;
+   free( ThreadAttFlt );
+   free( ThreadAttInt );
+   delete [] ThreadParID;
 
    } // end of OpenMP parallel region
 
+   delete [] NNewParEachPatch;
+
 
 // get the total number of active particles in all MPI ranks
    MPI_Allreduce( &amr->Par->NPar_Active, &amr->Par->NPar_Active_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
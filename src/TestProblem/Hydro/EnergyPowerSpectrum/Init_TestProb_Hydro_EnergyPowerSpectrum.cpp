@@ -196,7 +196,9 @@ void OutputEnergyPowerSpectrum()
    char FileName_EnergyPS[MAX_STRING];
    sprintf( FileName_EnergyPS, "EnergyPowerSpectrum_%06d", DumpID );
 
-   Output_BasePowerSpectrum( FileName_EnergyPS, _ENGY );
+   const long TVar[1] = { _ENGY };
+
+   Output_BasePowerSpectrum( FileName_EnergyPS, 1, TVar, false, 0 );
 
 } // FUNCTION : OutputEnergyPowerSpectrum
 #endif // #if ( MODEL == HYDRO  &&  defined SUPPORT_FFTW )
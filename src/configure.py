@@ -443,7 +443,7 @@ def load_arguments():
     parser.add_argument( "--eos", type=str, metavar="TYPE", gamer_name="EOS",
                          default=None, choices=["GAMMA", "ISOTHERMAL", "NUCLEAR", "TABULAR", "COSMIC_RAY", "TAUBMATHEWS", "USER"],
                          depend={"model":"HYDRO"},
-                         constraint={ "ISOTHERMAL":{"barotropic":True}, "COSMIC_RAY":{"cosmic_ray":True}, "TAUBMATHEWS":{"srhd":True} },
+                         constraint={ "ISOTHERMAL":{"barotropic":True}, "COSMIC_RAY":{"cosmic_ray":True}, "TAUBMATHEWS":{"srhd":True}, "NUCLEAR":{"hdf5":True} },
                          help="Equation of state. Must be set when <--model=HYDRO>. Must enable <--barotropic> for ISOTHERMAL.\n"
                        )
 
@@ -609,7 +609,7 @@ def load_arguments():
 
     parser.add_argument( "--max_patch", type=int, metavar="INTEGER", gamer_name="MAX_PATCH",
                          default=1000000,
-                         help="Set the maximum number of patches on each AMR level.\n"
+                         help="Deprecated: the patch tables grow on demand so the number of patches is no longer limited. Only recorded in the output files.\n"
                        )
 
     parser.add_argument( "--patch_size", type=int, metavar="INTEGER", gamer_name="PATCH_SIZE",
@@ -638,6 +638,12 @@ def load_arguments():
                          help="Enable more detailed timing analysis of GPU solvers. This option will disable CPU/GPU overlapping and thus deteriorate performance. Must enable <--timing>.\n"
                        )
 
+    parser.add_argument( "--perf_counter", type=str2bool, metavar="BOOLEAN", gamer_name="PERF_COUNTER",
+                         default=False,
+                         constraint={ True:{"timing_solver":True} },
+                         help="Record the hardware performance counters (cycles, instructions, and LLC misses) of GPU/CPU solvers using the Linux perf_event_open() system call. Must enable <--timing_solver>.\n"
+                       )
+
     parser.add_argument( "--double", type=str2bool, metavar="BOOLEAN", gamer_name="FLOAT8",
                          default=False,
                          help="Enable double precision.\n"
@@ -718,7 +724,7 @@ def load_arguments():
     parser.add_argument( "--overlap_mpi", type=str2bool, metavar="BOOLEAN", gamer_name="OVERLAP_MPI",
                          default=False,
                          constraint={ True:{"mpi":True} },
-                         help="Overlap MPI communication with computation. Not supported yet. Must enable <--mpi>.\n"
+                         help="Overlap MPI communication with computation. Must enable <--mpi>.\n"
                        )
 
     parser.add_argument( "--gpu", type=str2bool, metavar="BOOLEAN", gamer_name="GPU",
@@ -965,8 +971,8 @@ def validation( paths, depends, constraints, **kwargs ):
         LOGGER.error("<--patch_size> should be an even number greater than or equal to 8. Current: %d"%kwargs["patch_size"])
         success = False
 
-    if kwargs["overlap_mpi"]:
-        LOGGER.error("<--overlap_mpi> is not supported yet.")
+    if kwargs["overlap_mpi"] and kwargs["mhd"]:
+        LOGGER.error("<--overlap_mpi> does not support <--mhd>.")
         success = False
 
     if not success: raise BaseException( "The above vaildation failed." )